@@ -1,31 +1,46 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 #include <stddef.h>
 
 #include "carray.h"
+#include "cthreadpool.h"
 
 /* ======================================= */
 /* ============= Definitions ============= */
 /* ======================================= */
 
 struct _array {
-    union {
-        void*  prim_data;
-        void** comp_data;
-    };
+    unsigned char* data;     // contiguous storage of 'capacity * element_size' bytes
+    unsigned char* occupied; // bitmap of occupied slots, one bit per slot
+    size_t offset;           // index of the first slot in 'occupied' (non-zero for views only)
+    array* parent;           // owner of the storage if the array is a view, otherwise NULL
 
     size_t capacity;
     size_t size;
-    void  (*destructor)(void*);
-    bool  (*comparator)(void*, void*);
-    void* (*copy)(void*);
+    size_t element_size;
+    void (*destructor)(void*);
+    bool (*equality)(const void*, const void*);
+    void (*copy)(void*, const void*);
 };
 
+// The header is padded so that the storage following it is suitably aligned for any type.
+#define CARRAY_HEADER_SIZE ((sizeof(array) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t))
+
+// Number of bytes occupied by the bitmap of an array of the given capacity.
+#define CARRAY_BITMAP_SIZE(capacity) (((capacity) + 7) / 8)
+
 /* ================================ */
 /* === Error handling functions === */
 /* ================================ */
 
 // General error handling function.
 static void array_error_handling(const char* error_msg, const int error_code) {
-    fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CARRAY_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
     exit(error_code);
 }
 
@@ -40,70 +55,159 @@ static void array_check_index(const array* arr, const size_t index) {
     if (arr->capacity <= index) {
         delete_array((array*)arr);
         array_error_handling(CARRAY_ERRMSSG_INDEX_OUT_OF_BOUNDS,
-                             CARRAY_ERRMSSG_INDEX_OUT_OF_BOUNDS);
+                             CARRAY_ERRCODE_INDEX_OUT_OF_BOUNDS);
+    }
+}
+
+// Checks the 'count' (at least 1) slots starting at 'index'. A last index past SIZE_MAX is out of bounds as well.
+static void array_check_range(const array* arr, const size_t index, const size_t count) {
+    array_check_index(arr, count - 1 > SIZE_MAX - index ? SIZE_MAX : index + count - 1);
+}
+
+static void array_check_destination(const void* destination) {
+    if (!destination) {
+        array_error_handling(CARRAY_ERRMSSG_NULL_DESTINATION,
+                             CARRAY_ERRCODE_NULL_DESTINATION);
     }
 }
 
 // General warning handling function.
 static void array_warning_handling(const char* warn_msg) {
-    fprintf(stderr, "%s\n", warn_msg);
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CARRAY_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ======= Slot bookkeeping ======= */
+/* ================================ */
+
+// Returns the address of the slot at 'index'.
+static inline unsigned char* array_slot(const array* arr, const size_t index) {
+    return arr->data + index * arr->element_size;
+}
+
+static inline bool array_bit_get(const unsigned char* bits, const size_t index) {
+    return (bits[index / 8] >> (index % 8)) & 1u;
+}
+
+static inline void array_bit_set(unsigned char* bits, const size_t index, const bool value) {
+    if (value) bits[index / 8] |= (unsigned char)(1u << (index % 8));
+    else       bits[index / 8] &= (unsigned char)~(1u << (index % 8));
+}
+
+static inline bool array_slot_isoccupied(const array* arr, const size_t index) {
+    return array_bit_get(arr->occupied, arr->offset + index);
+}
+
+// Marks the slot as occupied or empty and keeps the element count of the array (and of its owner) up to date.
+static void array_slot_mark(array* arr, const size_t index, const bool value) {
+    if (array_slot_isoccupied(arr, index) == value) return;
+
+    array_bit_set(arr->occupied, arr->offset + index, value);
+
+    if (value) {
+        arr->size++;
+        if (arr->parent) arr->parent->size++;
+    } else {
+        arr->size--;
+        if (arr->parent) arr->parent->size--;
+    }
+}
+
+static inline void array_slot_set(array* arr, const size_t index) {
+    array_slot_mark(arr, index, true);
+}
+
+static inline void array_slot_reset(array* arr, const size_t index) {
+    array_slot_mark(arr, index, false);
+}
+
+// Number of stored elements. Views recount, since their owner may have been modified in the meantime.
+static size_t array_count(const array* arr) {
+    if (!arr->parent) return arr->size;
+
+    size_t count = 0;
+    for (size_t i = 0; i < arr->capacity; i++) count += array_slot_isoccupied(arr, i);
+    return count;
+}
+
+// Compares 'count' bits of two bitmaps starting at the given bit offsets.
+static bool array_bits_areequal(const unsigned char* bits1, size_t offset1, const unsigned char* bits2, size_t offset2, size_t count) {
+    if (offset1 % 8 == 0 && offset2 % 8 == 0) {
+        size_t bytes = count / 8;
+        if (memcmp(bits1 + offset1 / 8, bits2 + offset2 / 8, bytes) != 0) return false;
+        offset1 += bytes * 8;
+        offset2 += bytes * 8;
+        count   -= bytes * 8;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (array_bit_get(bits1, offset1 + i) != array_bit_get(bits2, offset2 + i)) return false;
+    }
+
+    return true;
+}
+
+// Calls the destructor on the slot (if there is one) and zeroes it.
+static void array_slot_destroy(array* arr, const size_t index) {
+    unsigned char* slot = array_slot(arr, index);
+    if (arr->destructor) arr->destructor(slot);
+    memset(slot, 0, arr->element_size);
 }
 
 /* ========================================= */
 /* ======== Constructor, destructor ======== */
 /* ========================================= */
 
-// Constructor of 'generic' array. 'destrutcor' and 'copy' are 
-array* new_array(const size_t capacity, void (*destructor)(void*), bool (*equality)(void*, void*), void* (*copy)(void*)) {
+// Constructor of 'generic' array. 'element_size' is the size of one element in bytes, e.g. 'sizeof(int)'.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+array* new_array(const size_t capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*)) {
     if (capacity == 0) {
         array_warning_handling(CARRAY_WARNMSG_EMPTY_CAPACITY);
         return NULL;
     }
 
-    array* arr = calloc(1, sizeof(array));
+    if (element_size == 0) {
+        array_warning_handling(CARRAY_WARNMSG_EMPTY_ELEMENT_SIZE);
+        return NULL;
+    }
+
+    if (capacity > (SIZE_MAX - CARRAY_HEADER_SIZE - CARRAY_BITMAP_SIZE(capacity)) / element_size) {
+        array_error_handling(CARRAY_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                             CARRAY_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    // Header, elements and bitmap share a single allocation.
+    size_t data_size = capacity * element_size;
+    unsigned char* block = calloc(1, CARRAY_HEADER_SIZE + data_size + CARRAY_BITMAP_SIZE(capacity));
+
+    if (!block) array_error_handling(CARRAY_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                     CARRAY_ERRCODE_MEMORY_ALLOCATION_FAILURE);
 
-    if (!arr) array_error_handling(CARRAY_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
-                                   CARRAY_ERRCODE_MEMORY_ALLOCATION_FAILURE);
-    
+    array* arr = (array*)block;
+    arr->data = block + CARRAY_HEADER_SIZE;
+    arr->occupied = arr->data + data_size;
     arr->capacity = capacity;
     arr->size = 0;
+    arr->element_size = element_size;
     arr->destructor = destructor;
     arr->equality = equality;
     arr->copy = copy;
 
-    if (arr->destructor) {
-        arr->comp_data = calloc(capacity, sizeof(void*));
-
-        if (!arr->comp_data) {
-            free(arr);
-            array_error_handling(CARRAY_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
-                                 CARRAY_ERRCODE_MEMORY_ALLOCATION_FAILURE);
-        }
-    } else {
-        arr->prim_data = calloc(capacity, sizeof(void));
-
-        if (!arr->prim_data) {
-            free(arr);
-            array_error_handling(CARRAY_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
-                                 CARRAY_ERRCODE_MEMORY_ALLOCATION_FAILURE);
-        }
-    }
-
     return arr;
 }
 
 // Destructor of array. Standardised template: void func_name(void* obj).
-void delete_array (void* obj) {
+void delete_array(void* obj) {
     if (obj) {
         array* arr = (array*)obj;
-        if (arr->destructor) {
+
+        // Views do not own their elements, only the header is released.
+        if (arr->destructor && !arr->parent) {
             for (size_t i = 0; i < arr->capacity; i++) {
-                arr->destructor(arr->comp_data[i]);
+                if (array_slot_isoccupied(arr, i)) arr->destructor(array_slot(arr, i));
             }
-
-            free(arr->comp_data);
-        } else {
-            free(arr->prim_data);
         }
 
         free(arr);
@@ -125,17 +229,28 @@ size_t array_get_capacity(const array* arr) {
 // Getter of the number of stored elements.
 size_t array_get_size(const array* arr) {
     array_check_null(arr);
-    return arr->size;
+    return array_count(arr);
 }
 
-// Returns the element at the specified index. Note the 'void*' return value, hence it can return NULL.
+// Getter of the size of one element in bytes.
+size_t array_get_element_size(const array* arr) {
+    array_check_null(arr);
+    return arr->element_size;
+}
+
+// Returns a pointer to the element at the specified index. Returns NULL if the slot is empty.
 void* array_get_item_at(const array* arr, const size_t index) {
     array_check_null(arr);
     array_check_index(arr, index);
 
-    if (arr->destructor) {
-        return arr->comp_data[index];
-    } else return arr->prim_data[index];
+    if (!array_slot_isoccupied(arr, index)) return NULL;
+    return array_slot(arr, index);
+}
+
+// Returns a pointer to the first slot of the contiguous storage. Slots are 'array_get_element_size()' bytes apart.
+void* array_get_data(const array* arr) {
+    array_check_null(arr);
+    return arr->data;
 }
 
 /* ======================================= */
@@ -145,13 +260,20 @@ void* array_get_item_at(const array* arr, const size_t index) {
 // Checks whether the array is empty.
 bool array_isempty(const array* arr) {
     array_check_null(arr);
-    return arr->size == 0;
+    return array_count(arr) == 0;
 }
 
 // Checks whether the array is full.
 bool array_isfull(const array* arr) {
     array_check_null(arr);
-    return arr->size == arr->capacity;
+    return array_count(arr) == arr->capacity;
+}
+
+// Checks whether there is an element stored at the specified index.
+bool array_isoccupied(const array* arr, const size_t index) {
+    array_check_null(arr);
+    array_check_index(arr, index);
+    return array_slot_isoccupied(arr, index);
 }
 
 // Checks whether the contents of the two arrays are identical. The order of elements matters.
@@ -159,54 +281,978 @@ bool array_areequal(const array* arr1, const array* arr2) {
     array_check_null(arr1);
     array_check_null(arr2);
 
-    if (arr1->destructor != arr2->destructor) return false;
+    if (arr1->destructor != arr2->destructor ||
+        arr1->equality != arr2->equality ||
+        arr1->element_size != arr2->element_size) return false;
 
-    if (arr1->capacity != arr2->capacity || 
-        arr1->size != arr2->size) return false;
-    
-    for (size_t i = 0; i < arr1->capacity) {
-        if (arr1->destructor) {
-            if (arr1->equality(arr1->comp_data[i], arr2->comp_data[i])) {
-                return false;
-            }
-        }
+    if (arr1->capacity != arr2->capacity ||
+        array_count(arr1) != array_count(arr2)) return false;
+
+    if (!arr1->equality) {
+        // Empty slots are always zeroed, so the whole storage can be compared at once.
+        return memcmp(arr1->data, arr2->data, arr1->capacity * arr1->element_size) == 0 &&
+               array_bits_areequal(arr1->occupied, arr1->offset, arr2->occupied, arr2->offset, arr1->capacity);
+    }
+
+    for (size_t i = 0; i < arr1->capacity; i++) {
+        bool occupied = array_slot_isoccupied(arr1, i);
+        if (occupied != array_slot_isoccupied(arr2, i)) return false;
+        if (!occupied) continue;
+
+        if (!arr1->equality(array_slot(arr1, i), array_slot(arr2, i))) return false;
     }
 
     return true;
 }
 
 /* ======================================= */
-/* =========== General methods =========== */ 
+/* =========== General methods =========== */
 /* ======================================= */
 
-// Inserts 'obj' where the 'index' is NULL and overwrites the existing object.
-void  array_insert_item_to (const array* arr, const size_t index, void* obj);
+// Moves the element pointed to by 'obj' into the slot at 'index' (bitwise, the array takes ownership). Overwrites the existing object.
+void array_insert_item_to(array* arr, const size_t index, const void* obj) {
+    array_check_null(arr);
+    array_check_index(arr, index);
 
-// Removes the item found at the 'index', resets the index to NULL and returns the object.
-void* array_remove_item_at (const array* arr, const size_t index);
+    if (array_slot_isoccupied(arr, index)) {
+        if (arr->destructor) arr->destructor(array_slot(arr, index));
+    } else {
+        array_slot_set(arr, index);
+    }
+
+    memcpy(array_slot(arr, index), obj, arr->element_size);
+}
+
+// Moves the item found at the 'index' into 'destination' and empties the slot. Returns 'destination' or NULL if the slot was empty.
+void* array_remove_item_at(array* arr, const size_t index, void* destination) {
+    array_check_null(arr);
+    array_check_destination(destination);
+    array_check_index(arr, index);
 
-// Deletes the item found at the 'index', resets the index to NULL. Returns nothing.
-void  array_delete_item_at (const array* arr, const size_t index);
+    if (!array_slot_isoccupied(arr, index)) return NULL;
+
+    memcpy(destination, array_slot(arr, index), arr->element_size);
+    memset(array_slot(arr, index), 0, arr->element_size);
+    array_slot_reset(arr, index);
+
+    return destination;
+}
+
+// Deletes the item found at the 'index' and empties the slot. Returns nothing.
+void array_delete_item_at(array* arr, const size_t index) {
+    array_check_null(arr);
+    array_check_index(arr, index);
 
-// Creates a copy of the object at the specified 'index'.
-void* array_copy_item_from (const array* arr, const size_t index);
+    if (!array_slot_isoccupied(arr, index)) return;
+
+    array_slot_destroy(arr, index);
+    array_slot_reset(arr, index);
+}
+
+// Creates a copy of the object at the specified 'index' in 'destination'. Returns 'destination' or NULL if the slot was empty.
+void* array_copy_item_from(const array* arr, const size_t index, void* destination) {
+    array_check_null(arr);
+    array_check_destination(destination);
+    array_check_index(arr, index);
+
+    if (!array_slot_isoccupied(arr, index)) return NULL;
+
+    if (arr->copy) {
+        arr->copy(destination, array_slot(arr, index));
+    } else {
+        memcpy(destination, array_slot(arr, index), arr->element_size);
+    }
+
+    return destination;
+}
 
 /* ====================================================== */
-/* =========== Immutative array manipulations =========== */ 
+/* =========== Immutative array manipulations =========== */
 /* ====================================================== */
 
-// Copies the entire contents of 'arr'.
-array* array_copy     (const array* arr);
+// Copies the entire contents of 'arr'. Copying a view results in an array owning its elements.
+array* array_copy(const array* arr) {
+    array_check_null(arr);
+    array* copy = new_array(arr->capacity, arr->element_size, arr->destructor, arr->equality, arr->copy);
+    array_copy_range(copy, 0, arr, 0, arr->capacity);
+    return copy;
+}
+
+// Creates a view of the slots between the indices (both inclusive). Nothing is copied: the view shares the storage of 'arr'.
+array* array_subarray(const array* arr, const size_t start_index, const size_t end_index) {
+    array_check_null(arr);
+    array_check_index(arr, start_index);
+    array_check_index(arr, end_index);
+
+    if (end_index < start_index) {
+        array_warning_handling(CARRAY_WARNMSG_INVALID_RANGE);
+        return NULL;
+    }
+
+    array* view = calloc(1, sizeof(array));
 
-// Creates a subarray based on the indices.
-array* array_subarray (const array* arr, const size_t start_index, const size_t end_index);
+    if (!view) array_error_handling(CARRAY_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                    CARRAY_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    *view = *arr;
+    view->data = array_slot(arr, start_index);
+    view->offset = arr->offset + start_index;
+    view->parent = arr->parent ? arr->parent : (array*)arr;
+    view->capacity = end_index - start_index + 1;
+    view->size = array_count(view);
+
+    return view;
+}
+
+// Checks whether the array is a view created by 'array_subarray()'.
+bool array_isview(const array* arr) {
+    array_check_null(arr);
+    return arr->parent != NULL;
+}
 
 /* ====================================================== */
-/* ============ Mutative array manipulations ============ */ 
+/* ============ Mutative array manipulations ============ */
 /* ====================================================== */
 
 // Erases all the elements of the array, resulting in an empty one.
-void array_mut_clean (array* arr);
+void array_mut_clean(array* arr) {
+    array_check_null(arr);
+
+    if (arr->destructor) {
+        for (size_t i = 0; i < arr->capacity; i++) {
+            if (array_slot_isoccupied(arr, i)) arr->destructor(array_slot(arr, i));
+        }
+    }
+
+    memset(arr->data, 0, arr->capacity * arr->element_size);
+
+    if (arr->parent) {
+        for (size_t i = 0; i < arr->capacity; i++) array_slot_reset(arr, i);
+    } else {
+        memset(arr->occupied, 0, CARRAY_BITMAP_SIZE(arr->capacity));
+        arr->size = 0;
+    }
+}
+
+// Fills every slot of the array with a copy of the element pointed to by 'obj'.
+void array_fill(array* arr, const void* obj) {
+    array_check_null(arr);
+
+    if (arr->copy || arr->destructor) {
+        for (size_t i = 0; i < arr->capacity; i++) {
+            if (array_slot_isoccupied(arr, i)) array_slot_destroy(arr, i);
+
+            if (arr->copy) arr->copy(array_slot(arr, i), obj);
+            else memcpy(array_slot(arr, i), obj, arr->element_size);
+
+            array_slot_set(arr, i);
+        }
+
+        return;
+    }
+
+    // Trivially copyable elements: copy once, then keep doubling the filled prefix.
+    size_t total = arr->capacity * arr->element_size;
+    size_t filled = arr->element_size;
+    memcpy(arr->data, obj, arr->element_size);
+
+    while (filled < total) {
+        size_t chunk = filled < total - filled ? filled : total - filled;
+        memcpy(arr->data + filled, arr->data, chunk);
+        filled += chunk;
+    }
+
+    if (arr->parent) {
+        for (size_t i = 0; i < arr->capacity; i++) array_slot_set(arr, i);
+    } else {
+        memset(arr->occupied, 0xFF, arr->capacity / 8);
+        for (size_t i = arr->capacity / 8 * 8; i < arr->capacity; i++) array_bit_set(arr->occupied, i, true);
+        arr->size = arr->capacity;
+    }
+}
+
+// Copies 'count' slots of 'source' starting at 'source_index' into 'destination' starting at 'destination_index'.
+// Empty source slots leave empty destination slots. The ranges may overlap.
+void array_copy_range(array* destination, const size_t destination_index, const array* source, const size_t source_index, const size_t count) {
+    array_check_null(destination);
+    array_check_null(source);
+
+    if (count == 0) return;
+
+    if (destination->element_size != source->element_size) {
+        array_warning_handling(CARRAY_WARNMSG_COPY_INCOMPATIBLE);
+        return;
+    }
+
+    array_check_range(destination, destination_index, count);
+    array_check_range(source, source_index, count);
+
+    unsigned char* destination_data = array_slot(destination, destination_index);
+    const unsigned char* source_data = array_slot(source, source_index);
+
+    if (!destination->copy && !destination->destructor) {
+        // Trivially copyable elements: one bulk move, then the occupancy bits.
+        memmove(destination_data, source_data, count * destination->element_size);
+
+        bool backwards = destination->occupied == source->occupied &&
+                         destination->offset + destination_index > source->offset + source_index;
+
+        for (size_t k = 0; k < count; k++) {
+            size_t i = backwards ? count - 1 - k : k;
+            array_slot_mark(destination, destination_index + i, array_slot_isoccupied(source, source_index + i));
+        }
+
+        return;
+    }
+
+    // Overlapping ranges are processed from the end that has not been read yet.
+    bool backwards = destination_data > source_data;
+
+    for (size_t k = 0; k < count; k++) {
+        size_t i = backwards ? count - 1 - k : k;
+
+        if (destination_data + i * destination->element_size == source_data + i * source->element_size) continue;
+        if (array_slot_isoccupied(destination, destination_index + i)) array_slot_destroy(destination, destination_index + i);
+
+        if (array_slot_isoccupied(source, source_index + i)) {
+            if (destination->copy) destination->copy(array_slot(destination, destination_index + i), array_slot(source, source_index + i));
+            else memcpy(array_slot(destination, destination_index + i), array_slot(source, source_index + i), destination->element_size);
+            array_slot_set(destination, destination_index + i);
+        } else {
+            array_slot_reset(destination, destination_index + i);
+        }
+    }
+}
+
+// Swaps 'size' bytes between the two memory regions through a small stack buffer.
+static void array_swap_bytes(unsigned char* first, unsigned char* second, size_t size) {
+    unsigned char buffer[256];
+
+    while (size > 0) {
+        size_t chunk = size < sizeof(buffer) ? size : sizeof(buffer);
+        memcpy(buffer, first, chunk);
+        memcpy(first, second, chunk);
+        memcpy(second, buffer, chunk);
+        first  += chunk;
+        second += chunk;
+        size   -= chunk;
+    }
+}
 
 // Swaps the contents of two arrays storing the same amount of elements and having the same destructor, equality and copy functions.
-void array_mut_swap  (array* old_arr, array* new_arr);
\ No newline at end of file
+void array_mut_swap(array* old_arr, array* new_arr) {
+    array_check_null(old_arr);
+    array_check_null(new_arr);
+
+    if (old_arr->capacity != new_arr->capacity || old_arr->element_size != new_arr->element_size ||
+        old_arr->destructor != new_arr->destructor || old_arr->equality != new_arr->equality ||
+        old_arr->copy != new_arr->copy) {
+        array_warning_handling(CARRAY_WARNMSG_SWAP_INCOMPATIBLE);
+        return;
+    }
+
+    array_swap_bytes(old_arr->data, new_arr->data, old_arr->capacity * old_arr->element_size);
+
+    if (!old_arr->parent && !new_arr->parent) {
+        array_swap_bytes(old_arr->occupied, new_arr->occupied, CARRAY_BITMAP_SIZE(old_arr->capacity));
+
+        size_t size = old_arr->size;
+        old_arr->size = new_arr->size;
+        new_arr->size = size;
+        return;
+    }
+
+    // At least one of them is a view: swap bit by bit so that the owners' element counts stay correct.
+    for (size_t i = 0; i < old_arr->capacity; i++) {
+        bool old_occupied = array_slot_isoccupied(old_arr, i);
+        array_slot_mark(old_arr, i, array_slot_isoccupied(new_arr, i));
+        array_slot_mark(new_arr, i, old_occupied);
+    }
+}
+
+/* ======================================= */
+/* ======== Sorting and searching ======== */
+/* ======================================= */
+
+// Below this many elements the sorting functions fall back to insertion sort.
+#define CARRAY_INSERTION_SORT_THRESHOLD 16
+
+// Swaps two elements of 'size' bytes. Sizes of 4 and 8 bytes are moved as whole words.
+static inline void array_swap_elements(unsigned char* first, unsigned char* second, const size_t size) {
+    if (size == sizeof(uint64_t)) {
+        uint64_t buffer;
+        memcpy(&buffer, first, sizeof(buffer));
+        memcpy(first, second, sizeof(buffer));
+        memcpy(second, &buffer, sizeof(buffer));
+    } else if (size == sizeof(uint32_t)) {
+        uint32_t buffer;
+        memcpy(&buffer, first, sizeof(buffer));
+        memcpy(first, second, sizeof(buffer));
+        memcpy(second, &buffer, sizeof(buffer));
+    } else {
+        array_swap_bytes(first, second, size);
+    }
+}
+
+// Moves the occupied slots to the front of the array (keeping their order) and returns their number.
+static size_t array_compact(array* arr) {
+    size_t count = 0;
+
+    for (size_t i = 0; i < arr->capacity; i++) {
+        if (!array_slot_isoccupied(arr, i)) continue;
+
+        if (i != count) {
+            memcpy(array_slot(arr, count), array_slot(arr, i), arr->element_size);
+            memset(array_slot(arr, i), 0, arr->element_size);
+            array_slot_reset(arr, i);
+            array_slot_set(arr, count);
+        }
+
+        count++;
+    }
+
+    return count;
+}
+
+static unsigned char* array_allocate_buffer(const size_t size) {
+    unsigned char* buffer = malloc(size);
+
+    if (!buffer) array_error_handling(CARRAY_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                      CARRAY_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    return buffer;
+}
+
+// Stable insertion sort. 'buffer' must hold one element.
+static void array_insertion_sort(unsigned char* base, const size_t count, const size_t size, int (*compare)(const void*, const void*), unsigned char* buffer) {
+    for (size_t i = 1; i < count; i++) {
+        unsigned char* current = base + i * size;
+        if (compare(current - size, current) <= 0) continue;
+
+        memcpy(buffer, current, size);
+        size_t j = i;
+
+        while (j > 0 && compare(base + (j - 1) * size, buffer) > 0) j--;
+
+        memmove(base + (j + 1) * size, base + j * size, (i - j) * size);
+        memcpy(base + j * size, buffer, size);
+    }
+}
+
+static void array_sift_down(unsigned char* base, size_t root, const size_t count, const size_t size, int (*compare)(const void*, const void*)) {
+    while (2 * root + 1 < count) {
+        size_t child = 2 * root + 1;
+        if (child + 1 < count && compare(base + child * size, base + (child + 1) * size) < 0) child++;
+        if (compare(base + root * size, base + child * size) >= 0) return;
+
+        array_swap_elements(base + root * size, base + child * size, size);
+        root = child;
+    }
+}
+
+// Fallback of the introsort once the recursion gets too deep, guaranteeing O(n log n).
+static void array_heap_sort(unsigned char* base, const size_t count, const size_t size, int (*compare)(const void*, const void*)) {
+    for (size_t i = count / 2; i > 0; i--) array_sift_down(base, i - 1, count, size, compare);
+
+    for (size_t end = count - 1; end > 0; end--) {
+        array_swap_elements(base, base + end * size, size);
+        array_sift_down(base, 0, end, size, compare);
+    }
+}
+
+// Introsort: median-of-three quicksort, heapsort when 'depth' runs out and insertion sort for small ranges.
+static void array_introsort(unsigned char* base, size_t count, const size_t size, int (*compare)(const void*, const void*), unsigned char* buffer, size_t depth) {
+    while (count > CARRAY_INSERTION_SORT_THRESHOLD) {
+        if (depth == 0) {
+            array_heap_sort(base, count, size, compare);
+            return;
+        }
+
+        depth--;
+
+        // Order the first, middle and last elements, then use the median as the pivot at position 0.
+        unsigned char* first  = base;
+        unsigned char* middle = base + (count / 2) * size;
+        unsigned char* last   = base + (count - 1) * size;
+
+        if (compare(middle, first) < 0) array_swap_elements(middle, first, size);
+        if (compare(last, middle) < 0) {
+            array_swap_elements(last, middle, size);
+            if (compare(middle, first) < 0) array_swap_elements(middle, first, size);
+        }
+
+        array_swap_elements(first, middle, size);
+
+        // Hoare partition around the pivot kept at 'base'.
+        size_t i = 0;
+        size_t j = count;
+
+        while (true) {
+            do { i++; } while (i < count && compare(base + i * size, base) < 0);
+            do { j--; } while (compare(base + j * size, base) > 0);
+            if (i >= j) break;
+            array_swap_elements(base + i * size, base + j * size, size);
+        }
+
+        array_swap_elements(base, base + j * size, size);
+
+        // Recurse into the smaller part, iterate over the larger one.
+        size_t left_count  = j;
+        size_t right_count = count - j - 1;
+
+        if (left_count < right_count) {
+            array_introsort(base, left_count, size, compare, buffer, depth);
+            base  += (j + 1) * size;
+            count  = right_count;
+        } else {
+            array_introsort(base + (j + 1) * size, right_count, size, compare, buffer, depth);
+            count = left_count;
+        }
+    }
+
+    array_insertion_sort(base, count, size, compare, buffer);
+}
+
+// Top-down merge sort. 'buffer' must hold at least 'count / 2 + 1' elements.
+static void array_merge_sort(unsigned char* base, const size_t count, const size_t size, int (*compare)(const void*, const void*), unsigned char* buffer) {
+    if (count <= CARRAY_INSERTION_SORT_THRESHOLD) {
+        array_insertion_sort(base, count, size, compare, buffer);
+        return;
+    }
+
+    size_t middle = count / 2;
+    array_merge_sort(base, middle, size, compare, buffer);
+    array_merge_sort(base + middle * size, count - middle, size, compare, buffer);
+
+    // Already in order: nothing to merge.
+    if (compare(base + (middle - 1) * size, base + middle * size) <= 0) return;
+
+    memcpy(buffer, base, middle * size);
+
+    size_t left = 0, right = middle, output = 0;
+
+    while (left < middle && right < count) {
+        if (compare(base + right * size, buffer + left * size) < 0) {
+            memcpy(base + output * size, base + right * size, size);
+            right++;
+        } else {
+            memcpy(base + output * size, buffer + left * size, size);
+            left++;
+        }
+
+        output++;
+    }
+
+    memcpy(base + output * size, buffer + left * size, (middle - left) * size);
+}
+
+// Sorts the elements in ascending order with an introsort. Empty slots are moved to the end of the array.
+// 'compare' follows the convention of 'string_compare()' and receives pointers to the slots.
+void array_sort(array* arr, int (*compare)(const void*, const void*)) {
+    array_check_null(arr);
+    size_t count = array_compact(arr);
+    if (count < 2) return;
+
+    size_t depth = 0;
+    for (size_t n = count; n > 1; n >>= 1) depth += 2;
+
+    unsigned char* buffer = array_allocate_buffer(arr->element_size);
+    array_introsort(arr->data, count, arr->element_size, compare, buffer, depth);
+    free(buffer);
+}
+
+// Sorts the elements in ascending order with a merge sort, keeping the order of equal elements. Empty slots are moved to the end of the array.
+void array_sort_stable(array* arr, int (*compare)(const void*, const void*)) {
+    array_check_null(arr);
+    size_t count = array_compact(arr);
+    if (count < 2) return;
+
+    unsigned char* buffer = array_allocate_buffer((count / 2 + 1) * arr->element_size);
+    array_merge_sort(arr->data, count, arr->element_size, compare, buffer);
+    free(buffer);
+}
+
+// Size of the numeric type in bytes.
+static size_t array_key_size(const array_key_type type) {
+    switch (type) {
+        case ARRAY_KEY_INT8:  case ARRAY_KEY_UINT8:  return 1;
+        case ARRAY_KEY_INT16: case ARRAY_KEY_UINT16: return 2;
+        case ARRAY_KEY_INT32: case ARRAY_KEY_UINT32: case ARRAY_KEY_FLOAT:  return 4;
+        case ARRAY_KEY_INT64: case ARRAY_KEY_UINT64: case ARRAY_KEY_DOUBLE: return 8;
+    }
+
+    return 0;
+}
+
+// Maps the element to an unsigned integer whose natural order equals the numeric order of the element.
+static inline uint64_t array_radix_key(const unsigned char* element, const array_key_type type, const size_t size) {
+    uint64_t bits = 0;
+
+    switch (size) {
+        case 1: { uint8_t  value; memcpy(&value, element, 1); bits = value; break; }
+        case 2: { uint16_t value; memcpy(&value, element, 2); bits = value; break; }
+        case 4: { uint32_t value; memcpy(&value, element, 4); bits = value; break; }
+        case 8: { uint64_t value; memcpy(&value, element, 8); bits = value; break; }
+    }
+
+    uint64_t sign = (uint64_t)1 << (size * 8 - 1);
+
+    switch (type) {
+        case ARRAY_KEY_INT8: case ARRAY_KEY_INT16: case ARRAY_KEY_INT32: case ARRAY_KEY_INT64:
+            return bits ^ sign;
+        case ARRAY_KEY_FLOAT: case ARRAY_KEY_DOUBLE:
+            // Negative numbers have all bits flipped, positive ones only the sign bit.
+            return (bits & sign) ? ~bits & (sign | (sign - 1)) : bits | sign;
+        default:
+            return bits;
+    }
+}
+
+// Sorts numeric elements in ascending order with an LSD radix sort (stable, no comparisons). Empty slots are moved to the end of the array.
+void array_sort_typed(array* arr, const array_key_type type) {
+    array_check_null(arr);
+
+    size_t size = array_key_size(type);
+
+    if (size != arr->element_size) {
+        array_warning_handling(CARRAY_WARNMSG_KEY_TYPE_MISMATCH);
+        return;
+    }
+
+    size_t count = array_compact(arr);
+    if (count < 2) return;
+
+    size_t* histogram = calloc(size * 256, sizeof(size_t));
+    unsigned char* buffer = array_allocate_buffer(count * size);
+
+    if (!histogram) array_error_handling(CARRAY_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                         CARRAY_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    // One pass builds the histograms of every digit.
+    for (size_t i = 0; i < count; i++) {
+        uint64_t key = array_radix_key(arr->data + i * size, type, size);
+        for (size_t digit = 0; digit < size; digit++) histogram[digit * 256 + ((key >> (digit * 8)) & 0xFF)]++;
+    }
+
+    unsigned char* source = arr->data;
+    unsigned char* destination = buffer;
+
+    for (size_t digit = 0; digit < size; digit++) {
+        size_t* counts = histogram + digit * 256;
+
+        // Every element shares this digit: the pass would not move anything.
+        bool trivial = false;
+        for (size_t b = 0; b < 256; b++) {
+            if (counts[b] == count) trivial = true;
+            if (counts[b] != 0) break;
+        }
+
+        if (trivial) continue;
+
+        size_t offset = 0;
+        for (size_t b = 0; b < 256; b++) {
+            size_t bucket = counts[b];
+            counts[b] = offset;
+            offset += bucket;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            uint64_t key = array_radix_key(source + i * size, type, size);
+            memcpy(destination + counts[(key >> (digit * 8)) & 0xFF]++ * size, source + i * size, size);
+        }
+
+        unsigned char* swap = source;
+        source = destination;
+        destination = swap;
+    }
+
+    if (source != arr->data) memcpy(arr->data, source, count * size);
+
+    free(buffer);
+    free(histogram);
+}
+
+// Returns the index of the first element that does not compare less than 'key', or 'array_get_size()' if there is none.
+// The array must be sorted with its empty slots at the end. 'compare' receives the element first and 'key' second.
+size_t array_lower_bound(const array* arr, const void* key, int (*compare)(const void*, const void*)) {
+    array_check_null(arr);
+    size_t low = 0, high = array_count(arr);
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (compare(array_slot(arr, middle), key) < 0) low = middle + 1;
+        else high = middle;
+    }
+
+    return low;
+}
+
+// Returns the index of the first element that compares greater than 'key', or 'array_get_size()' if there is none.
+size_t array_upper_bound(const array* arr, const void* key, int (*compare)(const void*, const void*)) {
+    array_check_null(arr);
+    size_t low = 0, high = array_count(arr);
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (compare(array_slot(arr, middle), key) <= 0) low = middle + 1;
+        else high = middle;
+    }
+
+    return low;
+}
+
+// Returns a pointer to an element equal to 'key' or NULL if there is none. The array must be sorted.
+void* array_binary_search(const array* arr, const void* key, int (*compare)(const void*, const void*)) {
+    size_t index = array_lower_bound(arr, key, compare);
+
+    if (index < array_count(arr) && compare(array_slot(arr, index), key) == 0) return array_slot(arr, index);
+    return NULL;
+}
+
+// Branch-free lower bound over a plain C array of the given type: the comparison is inlined and never called through a pointer.
+#define CARRAY_DEFINE_LOWER_BOUND(type)                                              \
+static size_t array_lower_bound_##type(const type* data, size_t count, const type key) { \
+    const type* base = data;                                                         \
+    while (count > 1) {                                                              \
+        size_t half = count / 2;                                                     \
+        base = (base[half - 1] < key) ? base + half : base;                          \
+        count -= half;                                                               \
+    }                                                                                \
+    return (size_t)(base - data) + (count == 1 && *base < key);                      \
+}
+
+CARRAY_DEFINE_LOWER_BOUND(int8_t)
+CARRAY_DEFINE_LOWER_BOUND(int16_t)
+CARRAY_DEFINE_LOWER_BOUND(int32_t)
+CARRAY_DEFINE_LOWER_BOUND(int64_t)
+CARRAY_DEFINE_LOWER_BOUND(uint8_t)
+CARRAY_DEFINE_LOWER_BOUND(uint16_t)
+CARRAY_DEFINE_LOWER_BOUND(uint32_t)
+CARRAY_DEFINE_LOWER_BOUND(uint64_t)
+CARRAY_DEFINE_LOWER_BOUND(float)
+CARRAY_DEFINE_LOWER_BOUND(double)
+
+// Typed counterpart of 'array_lower_bound()' for numeric elements. 'key' points to a value of the given type.
+size_t array_lower_bound_typed(const array* arr, const void* key, const array_key_type type) {
+    array_check_null(arr);
+
+    if (array_key_size(type) != arr->element_size) {
+        array_warning_handling(CARRAY_WARNMSG_KEY_TYPE_MISMATCH);
+        return array_count(arr);
+    }
+
+    size_t count = array_count(arr);
+
+    switch (type) {
+        case ARRAY_KEY_INT8:   return array_lower_bound_int8_t  ((const int8_t*)  arr->data, count, *(const int8_t*)  key);
+        case ARRAY_KEY_INT16:  return array_lower_bound_int16_t ((const int16_t*) arr->data, count, *(const int16_t*) key);
+        case ARRAY_KEY_INT32:  return array_lower_bound_int32_t ((const int32_t*) arr->data, count, *(const int32_t*) key);
+        case ARRAY_KEY_INT64:  return array_lower_bound_int64_t ((const int64_t*) arr->data, count, *(const int64_t*) key);
+        case ARRAY_KEY_UINT8:  return array_lower_bound_uint8_t ((const uint8_t*) arr->data, count, *(const uint8_t*) key);
+        case ARRAY_KEY_UINT16: return array_lower_bound_uint16_t((const uint16_t*)arr->data, count, *(const uint16_t*)key);
+        case ARRAY_KEY_UINT32: return array_lower_bound_uint32_t((const uint32_t*)arr->data, count, *(const uint32_t*)key);
+        case ARRAY_KEY_UINT64: return array_lower_bound_uint64_t((const uint64_t*)arr->data, count, *(const uint64_t*)key);
+        case ARRAY_KEY_FLOAT:  return array_lower_bound_float   ((const float*)   arr->data, count, *(const float*)   key);
+        case ARRAY_KEY_DOUBLE: return array_lower_bound_double  ((const double*)  arr->data, count, *(const double*)  key);
+    }
+
+    return count;
+}
+
+// Typed counterpart of 'array_binary_search()' for numeric elements.
+void* array_binary_search_typed(const array* arr, const void* key, const array_key_type type) {
+    size_t index = array_lower_bound_typed(arr, key, type);
+
+    if (index >= array_count(arr)) return NULL;
+
+    const unsigned char* element = array_slot(arr, index);
+    bool found;
+
+    switch (type) {
+        case ARRAY_KEY_FLOAT:  found = *(const float*)element  == *(const float*)key;  break;
+        case ARRAY_KEY_DOUBLE: found = *(const double*)element == *(const double*)key; break;
+        default:               found = memcmp(element, key, arr->element_size) == 0;   break;
+    }
+
+    return found ? (void*)element : NULL;
+}
+
+/* ======================================= */
+/* ========= Parallel algorithms ========= */
+/* ======================================= */
+
+// Target size of the chunks handed to the workers: small enough to stay in the L2 cache of one core.
+#define CARRAY_PARALLEL_CHUNK_BYTES (64 * 1024)
+
+// Below this many elements per worker, 'array_parallel_sort()' does not split the array any further.
+#define CARRAY_PARALLEL_SORT_MIN_RUN 4096
+
+// Shared state of one parallel call. Chunks are processed independently and report back through 'partials' and 'deltas'.
+typedef struct {
+    array* arr;
+    const array* source;
+    size_t chunk;
+    size_t lead;
+
+    void (*for_each)(void*, void*);
+    void (*map)(void*, const void*, void*);
+    void (*accumulate)(void*, const void*, void*);
+    void* context;
+
+    unsigned char* partials;     // one accumulator per chunk ('array_parallel_reduce()')
+    size_t partial_size;
+    const void* identity;
+    long long* deltas;           // change of the element count per chunk ('array_parallel_map()')
+
+    int (*compare)(const void*, const void*);
+    unsigned char* source_data;  // merge rounds of 'array_parallel_sort()'
+    unsigned char* destination_data;
+    size_t* bounds;
+    size_t runs;
+} array_parallel_job;
+
+static threadpool* array_parallel_pool(threadpool* pool) {
+    return pool ? pool : threadpool_get_default();
+}
+
+// Splits the array into chunks of whole bitmap bytes, so that no two chunks ever write the same byte of the bitmap.
+static size_t array_parallel_plan(const array* arr, array_parallel_job* job) {
+    size_t chunk = CARRAY_PARALLEL_CHUNK_BYTES / arr->element_size;
+    if (chunk < 64) chunk = 64;
+    chunk = (chunk + 7) / 8 * 8;
+
+    job->chunk = chunk;
+    job->lead  = (8 - arr->offset % 8) % 8;
+
+    if (arr->capacity <= job->lead) return 1;
+    return (arr->capacity - job->lead + chunk - 1) / chunk;
+}
+
+static void array_parallel_bounds(const array* arr, const array_parallel_job* job, const size_t index, size_t* begin, size_t* end) {
+    size_t first = index == 0 ? 0 : job->lead + index * job->chunk;
+    size_t last  = job->lead + (index + 1) * job->chunk;
+    *begin = first < arr->capacity ? first : arr->capacity;
+    *end   = last  < arr->capacity ? last  : arr->capacity;
+}
+
+// Adds 'delta' to the element count of the array and of its owner.
+static void array_adjust_size(array* arr, const long long delta) {
+    arr->size = (size_t)((long long)arr->size + delta);
+    if (arr->parent) arr->parent->size = (size_t)((long long)arr->parent->size + delta);
+}
+
+static void array_parallel_for_each_chunk(void* argument, size_t index) {
+    array_parallel_job* job = (array_parallel_job*)argument;
+    size_t begin, end;
+    array_parallel_bounds(job->arr, job, index, &begin, &end);
+
+    for (size_t i = begin; i < end; i++) {
+        if (array_slot_isoccupied(job->arr, i)) job->for_each(array_slot(job->arr, i), job->context);
+    }
+}
+
+// Calls 'function(element, context)' on every element, spreading cache-sized chunks over the workers of 'pool' (NULL: default pool).
+void array_parallel_for_each(array* arr, void (*function)(void*, void*), void* context, threadpool* pool) {
+    array_check_null(arr);
+
+    array_parallel_job job = { 0 };
+    job.arr = arr;
+    job.for_each = function;
+    job.context = context;
+
+    threadpool_run(array_parallel_pool(pool), array_parallel_for_each_chunk, &job, array_parallel_plan(arr, &job));
+}
+
+static void array_parallel_map_chunk(void* argument, size_t index) {
+    array_parallel_job* job = (array_parallel_job*)argument;
+    array* destination = job->arr;
+    size_t begin, end;
+    array_parallel_bounds(destination, job, index, &begin, &end);
+
+    // The bitmap is written directly: the element count is adjusted once every chunk has finished.
+    long long delta = 0;
+
+    for (size_t i = begin; i < end; i++) {
+        unsigned char* slot = array_slot(destination, i);
+        const unsigned char* source_slot = array_slot(job->source, i);
+        bool occupied = array_slot_isoccupied(destination, i);
+
+        if (array_slot_isoccupied(job->source, i)) {
+            if (occupied && destination->destructor && slot != source_slot) destination->destructor(slot);
+            job->map(slot, source_slot, job->context);
+
+            if (!occupied) {
+                array_bit_set(destination->occupied, destination->offset + i, true);
+                delta++;
+            }
+        } else if (occupied) {
+            array_slot_destroy(destination, i);
+            array_bit_set(destination->occupied, destination->offset + i, false);
+            delta--;
+        }
+    }
+
+    job->deltas[index] = delta;
+}
+
+// Constructs 'destination[i]' from 'source[i]' by 'function(destination_slot, source_slot, context)' for every element of 'source', in parallel.
+// Both arrays must have the same capacity; their element sizes may differ. Empty source slots empty the destination slot.
+void array_parallel_map(const array* source, array* destination, void (*function)(void*, const void*, void*), void* context, threadpool* pool) {
+    array_check_null(source);
+    array_check_null(destination);
+
+    if (source->capacity != destination->capacity) {
+        array_warning_handling(CARRAY_WARNMSG_MAP_INCOMPATIBLE);
+        return;
+    }
+
+    array_parallel_job job = { 0 };
+    job.arr = destination;
+    job.source = source;
+    job.map = function;
+    job.context = context;
+
+    size_t chunks = array_parallel_plan(destination, &job);
+    job.deltas = calloc(chunks, sizeof(long long));
+
+    if (!job.deltas) array_error_handling(CARRAY_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                          CARRAY_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    threadpool_run(array_parallel_pool(pool), array_parallel_map_chunk, &job, chunks);
+
+    for (size_t i = 0; i < chunks; i++) array_adjust_size(destination, job.deltas[i]);
+    free(job.deltas);
+}
+
+static void array_parallel_reduce_chunk(void* argument, size_t index) {
+    array_parallel_job* job = (array_parallel_job*)argument;
+    unsigned char* accumulator = job->partials + index * job->partial_size;
+    size_t begin, end;
+    array_parallel_bounds(job->source, job, index, &begin, &end);
+
+    memcpy(accumulator, job->identity, job->partial_size);
+
+    for (size_t i = begin; i < end; i++) {
+        if (array_slot_isoccupied(job->source, i)) job->accumulate(accumulator, array_slot(job->source, i), job->context);
+    }
+}
+
+// Reduces the elements in parallel. 'result' points to 'result_size' bytes holding the identity value on entry and the result on return.
+// Every chunk folds its elements into a copy of the identity by 'accumulate(accumulator, element, context)',
+// then the partial results are folded into 'result' in order by 'combine(result, partial, context)'.
+void array_parallel_reduce(const array* arr, void* result, const size_t result_size, void (*accumulate)(void*, const void*, void*), void (*combine)(void*, const void*, void*), void* context, threadpool* pool) {
+    array_check_null(arr);
+
+    array_parallel_job job = { 0 };
+    job.source = arr;
+    job.accumulate = accumulate;
+    job.context = context;
+    job.partial_size = result_size;
+
+    size_t chunks = array_parallel_plan(arr, &job);
+    job.partials = array_allocate_buffer(chunks * result_size);
+    job.identity = array_allocate_buffer(result_size);
+    memcpy((void*)job.identity, result, result_size);
+
+    threadpool_run(array_parallel_pool(pool), array_parallel_reduce_chunk, &job, chunks);
+
+    for (size_t i = 0; i < chunks; i++) combine(result, job.partials + i * result_size, context);
+
+    free((void*)job.identity);
+    free(job.partials);
+}
+
+static void array_parallel_sort_run(void* argument, size_t index) {
+    array_parallel_job* job = (array_parallel_job*)argument;
+    size_t size  = job->arr->element_size;
+    size_t count = job->bounds[index + 1] - job->bounds[index];
+
+    size_t depth = 0;
+    for (size_t n = count; n > 1; n >>= 1) depth += 2;
+
+    unsigned char* buffer = array_allocate_buffer(size);
+    array_introsort(job->arr->data + job->bounds[index] * size, count, size, job->compare, buffer, depth);
+    free(buffer);
+}
+
+// Merges the runs '2 * index' and '2 * index + 1' of the current round (or copies a trailing run without a pair).
+static void array_parallel_merge_pair(void* argument, size_t index) {
+    array_parallel_job* job = (array_parallel_job*)argument;
+    size_t size   = job->arr->element_size;
+    size_t first  = job->bounds[2 * index];
+    size_t middle = job->bounds[2 * index + 1];
+    size_t last   = 2 * index + 2 <= job->runs ? job->bounds[2 * index + 2] : middle;
+
+    const unsigned char* left  = job->source_data + first * size;
+    const unsigned char* right = job->source_data + middle * size;
+    unsigned char* output      = job->destination_data + first * size;
+    size_t left_count = middle - first, right_count = last - middle;
+
+    while (left_count > 0 && right_count > 0) {
+        if (job->compare(right, left) < 0) {
+            memcpy(output, right, size);
+            right += size;
+            right_count--;
+        } else {
+            memcpy(output, left, size);
+            left += size;
+            left_count--;
+        }
+
+        output += size;
+    }
+
+    memcpy(output, left, left_count * size);
+    memcpy(output + left_count * size, right, right_count * size);
+}
+
+// Sorts the elements in ascending order: every worker sorts one run with the introsort, then the runs are merged pairwise in parallel.
+// Equal elements may be reordered. Empty slots are moved to the end of the array.
+void array_parallel_sort(array* arr, int (*compare)(const void*, const void*), threadpool* pool) {
+    array_check_null(arr);
+    pool = array_parallel_pool(pool);
+
+    size_t count = array_compact(arr);
+    size_t runs  = threadpool_get_workers(pool);
+    if (runs > count / CARRAY_PARALLEL_SORT_MIN_RUN) runs = count / CARRAY_PARALLEL_SORT_MIN_RUN;
+
+    if (runs < 2) {
+        array_sort(arr, compare);
+        return;
+    }
+
+    array_parallel_job job = { 0 };
+    job.arr = arr;
+    job.compare = compare;
+    job.runs = runs;
+    job.bounds = malloc((runs + 1) * sizeof(size_t));
+
+    if (!job.bounds) array_error_handling(CARRAY_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                          CARRAY_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    for (size_t i = 0; i <= runs; i++) job.bounds[i] = count * i / runs;
+
+    threadpool_run(pool, array_parallel_sort_run, &job, runs);
+
+    unsigned char* buffer = array_allocate_buffer(count * arr->element_size);
+    job.source_data = arr->data;
+    job.destination_data = buffer;
+
+    while (job.runs > 1) {
+        size_t pairs = (job.runs + 1) / 2;
+        threadpool_run(pool, array_parallel_merge_pair, &job, pairs);
+
+        // Every merged pair becomes one run of the next round.
+        for (size_t i = 1; i <= pairs; i++) job.bounds[i] = job.bounds[2 * i < job.runs ? 2 * i : job.runs];
+        job.runs = pairs;
+
+        unsigned char* swap = job.source_data;
+        job.source_data = job.destination_data;
+        job.destination_data = swap;
+    }
+
+    if (job.source_data != arr->data) memcpy(arr->data, job.source_data, count * arr->element_size);
+
+    free(buffer);
+    free(job.bounds);
+}
@@ -4,6 +4,8 @@
 #include <stddef.h>
 #include <stdbool.h>
 
+#include "cthreadpool.h"
+
 /* ======================================= */
 /* ============= Definitions ============= */
 /* ======================================= */
@@ -13,25 +15,33 @@ The 'array' type is the closest data structure to a traditional C-style array, w
 Therefore, it has the following characteristics:
     - not resizeable
     - mergeing and splitting operations are not available
-    - stores elements of one type, which are ensured by the destructor, equality and copy functions
+    - stores elements of one type, which are ensured by the element size and the destructor, equality and copy functions
 Similar in nature to std::array in C++.
+
+Elements are stored by value in one contiguous block of 'capacity * element_size' bytes, allocated together with the array itself.
+Consequently, the callback functions always receive pointers to the element slots, never the elements themselves:
+    - destructor: releases the resources owned by the element in the slot, but does not free the slot
+    - equality:   compares the elements found in the two slots
+    - copy:       copy-constructs the element of the source slot into the (uninitialised) destination slot
+If 'destructor' and 'copy' are NULL, the elements are considered trivially copyable and are moved around by 'memcpy()'.
 */
 
-// Type definition of 'string' type.
+// Type definition of 'array' type.
 typedef struct _array array;
 
-// Alternative 'keyword' for type 'string'.
+// Alternative 'keyword' for type 'array'.
 typedef array Array;
 
-// Alternative 'keyword' for type 'string'.
+// Alternative 'keyword' for type 'array'.
 typedef array array_t;
 
 /* ========================================= */
 /* ======== Constructor, destructor ======== */
 /* ========================================= */
 
-// Constructor of 'generic' array. 'destrutcor' and 'copy' are 
-array* new_array    (const size_t capacity, void (*destructor)(void*), bool (*equality)(void*, void*), void* (*copy)(void*));
+// Constructor of 'generic' array. 'element_size' is the size of one element in bytes, e.g. 'sizeof(int)'.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+array* new_array    (const size_t capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*));
 
 // Destructor of array. Standardised template: void func_name(void* obj).
 void   delete_array (void* obj);
@@ -41,13 +51,19 @@ void   delete_array (void* obj);
 /* ======================================= */
 
 // Getter of capacity.
-size_t array_get_capacity (const array* arr);
+size_t array_get_capacity     (const array* arr);
 
 // Getter of the number of stored elements.
-size_t array_get_size     (const array* arr);
+size_t array_get_size         (const array* arr);
+
+// Getter of the size of one element in bytes.
+size_t array_get_element_size (const array* arr);
+
+// Returns a pointer to the element at the specified index. Returns NULL if the slot is empty.
+void*  array_get_item_at      (const array* arr, const size_t index);
 
-// Returns the element at the specified index. Note the 'void*' return value, hence it can return NULL.
-void   array_get_item_at  (const array* arr, const size_t index);
+// Returns a pointer to the first slot of the contiguous storage. Slots are 'array_get_element_size()' bytes apart.
+void*  array_get_data         (const array* arr);
 
 // Special macro to facilitate the casting of primitive types when retrieving them from the array.
 #define CAST(type, pointer) (*(type*)(pointer))
@@ -57,55 +73,135 @@ void   array_get_item_at  (const array* arr, const size_t index);
 /* ======================================= */
 
 // Checks whether the array is empty.
-bool array_isempty  (const array* arr);
+bool array_isempty    (const array* arr);
 
 // Checks whether the array is full.
-bool array_isfull   (const array* arr);
+bool array_isfull     (const array* arr);
+
+// Checks whether there is an element stored at the specified index.
+bool array_isoccupied (const array* arr, const size_t index);
 
 // Checks whether the contents of the two arrays are identical. The order of elements matters.
-bool array_areequal (const array* arr1, const array* arr2);
+bool array_areequal   (const array* arr1, const array* arr2);
 
 /* ======================================= */
-/* =========== General methods =========== */ 
+/* =========== General methods =========== */
 /* ======================================= */
 
-// Inserts 'obj' where the 'index' is NULL and overwrites the existing object.
-void  array_insert_item_to (const array* arr, const size_t index, void* obj);
+// Moves the element pointed to by 'obj' into the slot at 'index' (bitwise, the array takes ownership). Overwrites the existing object.
+void  array_insert_item_to (array* arr, const size_t index, const void* obj);
 
-// Removes the item found at the 'index', resets the index to NULL and returns the object.
-void* array_remove_item_at (const array* arr, const size_t index);
+// Moves the item found at the 'index' into 'destination' and empties the slot. Returns 'destination' or NULL if the slot was empty.
+void* array_remove_item_at (array* arr, const size_t index, void* destination);
 
-// Deletes the item found at the 'index', resets the index to NULL. Returns nothing.
-void  array_delete_item_at (const array* arr, const size_t index);
+// Deletes the item found at the 'index' and empties the slot. Returns nothing.
+void  array_delete_item_at (array* arr, const size_t index);
 
-// Creates a copy of the object at the specified 'index'.
-void* array_copy_item_from (const array* arr, const size_t index);
+// Creates a copy of the object at the specified 'index' in 'destination'. Returns 'destination' or NULL if the slot was empty.
+void* array_copy_item_from (const array* arr, const size_t index, void* destination);
 
 /* ====================================================== */
-/* =========== Immutative array manipulations =========== */ 
+/* =========== Immutative array manipulations =========== */
 /* ====================================================== */
 
 // Copies the entire contents of 'arr'.
 array* array_copy     (const array* arr);
 
-// Creates a subarray based on the indices.
+// Creates a subarray based on the indices (both inclusive). The result is a non-owning view sharing the storage of 'arr':
+// changes made through either are visible in both, and the view must be deleted before 'arr'.
 array* array_subarray (const array* arr, const size_t start_index, const size_t end_index);
 
+// Checks whether the array is a view created by 'array_subarray()'.
+bool   array_isview   (const array* arr);
+
 /* ====================================================== */
-/* ============ Mutative array manipulations ============ */ 
+/* ============ Mutative array manipulations ============ */
 /* ====================================================== */
 
 // Erases all the elements of the array, resulting in an empty one.
-void array_mut_clean (array* arr);
+void array_mut_clean  (array* arr);
+
+// Fills every slot of the array with a copy of the element pointed to by 'obj'.
+void array_fill       (array* arr, const void* obj);
+
+// Copies 'count' slots of 'source' starting at 'source_index' into 'destination' starting at 'destination_index'.
+// Empty source slots leave empty destination slots. The ranges may overlap.
+void array_copy_range (array* destination, const size_t destination_index, const array* source, const size_t source_index, const size_t count);
 
 // Swaps the contents of two arrays storing the same amount of elements and having the same destructor, equality and copy functions.
-void array_mut_swap  (array* old_arr, array* new_arr);
+void array_mut_swap   (array* old_arr, array* new_arr);
+
+/* ======================================= */
+/* ======== Sorting and searching ======== */
+/* ======================================= */
+
+// Numeric element types understood by the typed (callback-free) sorting and searching functions.
+typedef enum {
+    ARRAY_KEY_INT8,  ARRAY_KEY_INT16,  ARRAY_KEY_INT32,  ARRAY_KEY_INT64,
+    ARRAY_KEY_UINT8, ARRAY_KEY_UINT16, ARRAY_KEY_UINT32, ARRAY_KEY_UINT64,
+    ARRAY_KEY_FLOAT, ARRAY_KEY_DOUBLE
+} array_key_type;
+
+// Sorts the elements in ascending order with an introsort. Empty slots are moved to the end of the array.
+// 'compare' follows the convention of 'string_compare()' and receives pointers to the slots.
+void   array_sort                (array* arr, int (*compare)(const void*, const void*));
+
+// Sorts the elements in ascending order with a merge sort, keeping the order of equal elements. Empty slots are moved to the end of the array.
+void   array_sort_stable         (array* arr, int (*compare)(const void*, const void*));
+
+// Sorts numeric elements in ascending order with an LSD radix sort (stable, no comparisons). Empty slots are moved to the end of the array.
+void   array_sort_typed          (array* arr, const array_key_type type);
+
+// Returns the index of the first element that does not compare less than 'key', or 'array_get_size()' if there is none.
+// The array must be sorted with its empty slots at the end. 'compare' receives the element first and 'key' second.
+size_t array_lower_bound         (const array* arr, const void* key, int (*compare)(const void*, const void*));
+
+// Returns the index of the first element that compares greater than 'key', or 'array_get_size()' if there is none.
+size_t array_upper_bound         (const array* arr, const void* key, int (*compare)(const void*, const void*));
+
+// Returns a pointer to an element equal to 'key' or NULL if there is none. The array must be sorted.
+void*  array_binary_search       (const array* arr, const void* key, int (*compare)(const void*, const void*));
+
+// Typed counterpart of 'array_lower_bound()' for numeric elements. 'key' points to a value of the given type.
+size_t array_lower_bound_typed   (const array* arr, const void* key, const array_key_type type);
+
+// Typed counterpart of 'array_binary_search()' for numeric elements.
+void*  array_binary_search_typed (const array* arr, const void* key, const array_key_type type);
+
+/* ======================================= */
+/* ========= Parallel algorithms ========= */
+/* ======================================= */
+
+// The parallel algorithms split the array into cache-sized chunks and run them on the workers of 'pool'.
+// If 'pool' is NULL, the shared pool returned by 'threadpool_get_default()' is used. Callbacks must be thread-safe.
+
+// Calls 'function(element, context)' on every element.
+void array_parallel_for_each (array* arr, void (*function)(void*, void*), void* context, threadpool* pool);
+
+// Constructs 'destination[i]' from 'source[i]' by 'function(destination_slot, source_slot, context)' for every element of 'source'.
+// Both arrays must have the same capacity; their element sizes may differ. Empty source slots empty the destination slot.
+void array_parallel_map      (const array* source, array* destination, void (*function)(void*, const void*, void*), void* context, threadpool* pool);
+
+// Reduces the elements. 'result' points to 'result_size' bytes holding the identity value on entry and the result on return.
+// Every chunk folds its elements into a copy of the identity by 'accumulate(accumulator, element, context)',
+// then the partial results are folded into 'result' in order by 'combine(result, partial, context)'.
+void array_parallel_reduce   (const array* arr, void* result, const size_t result_size, void (*accumulate)(void*, const void*, void*), void (*combine)(void*, const void*, void*), void* context, threadpool* pool);
+
+// Sorts the elements in ascending order: every worker sorts one run, then the runs are merged pairwise in parallel.
+// Equal elements may be reordered. Empty slots are moved to the end of the array.
+void array_parallel_sort     (array* arr, int (*compare)(const void*, const void*), threadpool* pool);
 
 /* ====================================== */
 /* ========== Warning messages ========== */
 /* ====================================== */
 
-#define CARRAY_WARNMSG_EMPTY_CAPACITY "Warning: capacity cannot be 0."
+#define CARRAY_WARNMSG_EMPTY_CAPACITY     "Warning: capacity cannot be 0."
+#define CARRAY_WARNMSG_EMPTY_ELEMENT_SIZE "Warning: element size cannot be 0."
+#define CARRAY_WARNMSG_SWAP_INCOMPATIBLE  "Warning: arrays of different capacity, element size or callbacks cannot be swapped. No changes have been made."
+#define CARRAY_WARNMSG_COPY_INCOMPATIBLE  "Warning: arrays of different element size cannot be copied into each other. No changes have been made."
+#define CARRAY_WARNMSG_INVALID_RANGE      "Warning: end index precedes start index. Returns NULL."
+#define CARRAY_WARNMSG_MAP_INCOMPATIBLE   "Warning: arrays of different capacity cannot be mapped onto each other. No changes have been made."
+#define CARRAY_WARNMSG_KEY_TYPE_MISMATCH  "Warning: the size of the key type differs from the element size. No changes have been made."
 // #define CARRAY_WARNMSG_BLABLABLA "Warning: blablabla"
 
 /* ====================================== */
@@ -115,6 +211,9 @@ void array_mut_swap  (array* old_arr, array* new_arr);
 #define CARRAY_ERRMSSG_NULL_ARRAY "Error: array is a null pointer."
 #define CARRAY_ERRCODE_NULL_ARRAY -1
 
+#define CARRAY_ERRMSSG_NULL_DESTINATION "Error: destination is a null pointer."
+#define CARRAY_ERRCODE_NULL_DESTINATION -1
+
 #define CARRAY_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
 #define CARRAY_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
 
@@ -124,4 +223,4 @@ void array_mut_swap  (array* old_arr, array* new_arr);
 #define CARRAY_ERRMSSG_BLABLABLA "Error: blablabla"
 #define CARRAY_ERRCODE_BLABLABLA -4
 
-#endif // ARRAY_H
\ No newline at end of file
+#endif // ARRAY_H
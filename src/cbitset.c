@@ -0,0 +1,500 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__BMI2__)
+    #include <immintrin.h>
+#endif
+
+#include "cbitset.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+// The rank/select index has two levels: the absolute number of set bits before every superblock of 64 words (4096 bits),
+// and the number of set bits before every block of 8 words (512 bits) relative to its superblock, which fits 16 bits.
+// A query then adds two counters and the popcounts of at most 8 words. The index costs 64 bits per 4096 and 16 bits per
+// 512, 1.6% + 3.1% = 4.7% of the bitset.
+#define CBITSET_SUPERBLOCK_WORDS 64
+#define CBITSET_BLOCK_WORDS      8
+
+struct _bitset {
+    uint64_t* words;
+    size_t size;
+    size_t word_count;
+
+    uint64_t* superblocks;      // NULL while the index is not built
+    uint16_t* blocks;
+    size_t total;               // set bits at the time the index was built
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void bitset_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CBITSET_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void bitset_check_null(const bitset* bs) {
+    if (!bs) bitset_error_handling(CBITSET_ERRMSSG_NULL_BITSET,
+                                   CBITSET_ERRCODE_NULL_BITSET);
+}
+
+static void bitset_check_index(const bitset* bs, const size_t index) {
+    if (bs->size <= index) {
+        delete_bitset((bitset*)bs);
+        bitset_error_handling(CBITSET_ERRMSSG_INDEX_OUT_OF_BOUNDS,
+                              CBITSET_ERRCODE_INDEX_OUT_OF_BOUNDS);
+    }
+}
+
+// General warning handling function.
+static void bitset_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CBITSET_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ========= Word helpers ========= */
+/* ================================ */
+
+static inline size_t bitset_popcount(const uint64_t word) {
+    #if defined(__GNUC__) || defined(__clang__)
+        return (size_t)__builtin_popcountll(word);
+    #else
+        uint64_t x = word - ((word >> 1) & 0x5555555555555555ULL);
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return (size_t)((x * 0x0101010101010101ULL) >> 56);
+    #endif
+}
+
+// Index of the lowest set bit of a non-zero word.
+static inline size_t bitset_lowest_bit(const uint64_t word) {
+    #if defined(__GNUC__) || defined(__clang__)
+        return (size_t)__builtin_ctzll(word);
+    #else
+        size_t index = 0;
+        while (!((word >> index) & 1)) index++;
+        return index;
+    #endif
+}
+
+// Index of the set bit of 'word' preceded by 'rank' set bits. 'rank' must be below the popcount of 'word'.
+static inline size_t bitset_select_in_word(uint64_t word, size_t rank) {
+    #if defined(__BMI2__)
+        return bitset_lowest_bit(_pdep_u64((uint64_t)1 << rank, word));
+    #else
+        while (rank-- > 0) word &= word - 1;
+        return bitset_lowest_bit(word);
+    #endif
+}
+
+// Mask of the valid bits of the last word.
+static inline uint64_t bitset_tail_mask(const bitset* bs) {
+    size_t used = bs->size % 64;
+    return used ? ((uint64_t)1 << used) - 1 : ~(uint64_t)0;
+}
+
+// Clears the bits past the size, which every other function relies on.
+static inline void bitset_clear_tail(bitset* bs) {
+    if (bs->word_count > 0) bs->words[bs->word_count - 1] &= bitset_tail_mask(bs);
+}
+
+// Drops the rank/select index after a modification.
+static inline void bitset_invalidate(bitset* bs) {
+    if (!bs->superblocks) return;
+
+    free(bs->superblocks);
+    free(bs->blocks);
+    bs->superblocks = NULL;
+    bs->blocks = NULL;
+}
+
+static bool bitset_check_sizes(const bitset* destination, const bitset* bs1, const bitset* bs2) {
+    bitset_check_null(destination);
+    bitset_check_null(bs1);
+    if (bs2) bitset_check_null(bs2);
+
+    if (destination->size != bs1->size || (bs2 && destination->size != bs2->size)) {
+        bitset_warning_handling(CBITSET_WARNMSG_SIZE_MISMATCH);
+        return false;
+    }
+
+    return true;
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of bitset. Every bit is initialised to 0.
+bitset* new_bitset(const size_t size) {
+    bitset* bs = calloc(1, sizeof(bitset));
+
+    if (!bs) bitset_error_handling(CBITSET_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                   CBITSET_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    bs->size = size;
+    bs->word_count = size / 64 + (size % 64 != 0);
+
+    // One word at least, so that the storage is never a null pointer.
+    bs->words = calloc(bs->word_count > 0 ? bs->word_count : 1, sizeof(uint64_t));
+
+    if (!bs->words) bitset_error_handling(CBITSET_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                          CBITSET_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    return bs;
+}
+
+// Destructor of bitset. Standardised template: void func_name(void* obj).
+void delete_bitset(void* obj) {
+    if (obj) {
+        bitset* bs = (bitset*)obj;
+        bitset_invalidate(bs);
+        free(bs->words);
+        free(bs);
+        bs = NULL;
+        obj = bs;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of bits.
+size_t bitset_get_size(const bitset* bs) {
+    bitset_check_null(bs);
+    return bs->size;
+}
+
+// Getter of the number of 64-bit words of the storage.
+size_t bitset_get_word_count(const bitset* bs) {
+    bitset_check_null(bs);
+    return bs->word_count;
+}
+
+// Returns a pointer to the words; bit 'i' is bit 'i % 64' of word 'i / 64'. The bits past the size are always 0.
+const uint64_t* bitset_get_data(const bitset* bs) {
+    bitset_check_null(bs);
+    return bs->words;
+}
+
+// Returns the bit at the specified index.
+bool bitset_get(const bitset* bs, const size_t index) {
+    bitset_check_null(bs);
+    bitset_check_index(bs, index);
+    return (bs->words[index / 64] >> (index % 64)) & 1;
+}
+
+/* ======================================= */
+/* =============== Setters =============== */
+/* ======================================= */
+
+// Sets the bit at the specified index to 'value'.
+void bitset_set(bitset* bs, const size_t index, const bool value) {
+    bitset_check_null(bs);
+    bitset_check_index(bs, index);
+    bitset_invalidate(bs);
+
+    uint64_t bit = (uint64_t)1 << (index % 64);
+    if (value) bs->words[index / 64] |= bit;
+    else bs->words[index / 64] &= ~bit;
+}
+
+// Inverts the bit at the specified index.
+void bitset_flip(bitset* bs, const size_t index) {
+    bitset_check_null(bs);
+    bitset_check_index(bs, index);
+    bitset_invalidate(bs);
+
+    bs->words[index / 64] ^= (uint64_t)1 << (index % 64);
+}
+
+// Sets the bits in ['begin', 'end') to 'value', whole words at a time.
+void bitset_set_range(bitset* bs, const size_t begin, const size_t end, const bool value) {
+    bitset_check_null(bs);
+    if (begin >= end) return;
+    bitset_check_index(bs, end - 1);
+    bitset_invalidate(bs);
+
+    size_t first = begin / 64, last = (end - 1) / 64;
+    uint64_t first_mask = ~(uint64_t)0 << (begin % 64);
+    uint64_t last_mask = ~(uint64_t)0 >> (63 - (end - 1) % 64);
+
+    if (first == last) first_mask &= last_mask;
+
+    if (value) bs->words[first] |= first_mask;
+    else bs->words[first] &= ~first_mask;
+
+    if (first == last) return;
+
+    memset(bs->words + first + 1, value ? 0xFF : 0x00, (last - first - 1) * sizeof(uint64_t));
+
+    if (value) bs->words[last] |= last_mask;
+    else bs->words[last] &= ~last_mask;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether no bit is set.
+bool bitset_isempty(const bitset* bs) {
+    bitset_check_null(bs);
+
+    for (size_t i = 0; i < bs->word_count; i++) {
+        if (bs->words[i]) return false;
+    }
+
+    return true;
+}
+
+// Checks whether the two bitsets have the same size and bits.
+bool bitset_areequal(const bitset* bs1, const bitset* bs2) {
+    bitset_check_null(bs1);
+    bitset_check_null(bs2);
+
+    return bs1->size == bs2->size && memcmp(bs1->words, bs2->words, bs1->word_count * sizeof(uint64_t)) == 0;
+}
+
+// Returns the number of set bits.
+size_t bitset_count(const bitset* bs) {
+    bitset_check_null(bs);
+
+    if (bs->superblocks) return bs->total;
+
+    size_t count = 0;
+    for (size_t i = 0; i < bs->word_count; i++) count += bitset_popcount(bs->words[i]);
+    return count;
+}
+
+// Returns the index of the first set bit at or after 'index', or 'bitset_get_size()' if there is none.
+size_t bitset_find_next_set(const bitset* bs, const size_t index) {
+    bitset_check_null(bs);
+
+    if (index >= bs->size) return bs->size;
+
+    size_t word_index = index / 64;
+    uint64_t word = bs->words[word_index] & (~(uint64_t)0 << (index % 64));
+
+    while (!word) {
+        if (++word_index == bs->word_count) return bs->size;
+        word = bs->words[word_index];
+    }
+
+    return word_index * 64 + bitset_lowest_bit(word);
+}
+
+// Returns the index of the first clear bit at or after 'index', or 'bitset_get_size()' if there is none.
+size_t bitset_find_next_clear(const bitset* bs, const size_t index) {
+    bitset_check_null(bs);
+
+    if (index >= bs->size) return bs->size;
+
+    size_t word_index = index / 64;
+    uint64_t word = ~bs->words[word_index] & (~(uint64_t)0 << (index % 64));
+
+    while (!word) {
+        if (++word_index == bs->word_count) return bs->size;
+        word = ~bs->words[word_index];
+    }
+
+    // The bits past the size are 0, so their complement may be found in the last word.
+    size_t found = word_index * 64 + bitset_lowest_bit(word);
+    return found < bs->size ? found : bs->size;
+}
+
+/* ======================================= */
+/* ============= Rank, select ============ */
+/* ======================================= */
+
+// Builds the rank/select index, making both queries (nearly) constant time until the next modification.
+void bitset_build_index(bitset* bs) {
+    bitset_check_null(bs);
+    bitset_invalidate(bs);
+
+    // One more entry than needed for the words, so that 'bitset_rank(bs, size)' needs no special case.
+    bs->superblocks = malloc((bs->word_count / CBITSET_SUPERBLOCK_WORDS + 1) * sizeof(uint64_t));
+    bs->blocks = malloc((bs->word_count / CBITSET_BLOCK_WORDS + 1) * sizeof(uint16_t));
+
+    if (!bs->superblocks || !bs->blocks) bitset_error_handling(CBITSET_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                               CBITSET_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    size_t total = 0, superblock_start = 0;
+
+    for (size_t i = 0; i <= bs->word_count; i++) {
+        if (i % CBITSET_SUPERBLOCK_WORDS == 0) {
+            bs->superblocks[i / CBITSET_SUPERBLOCK_WORDS] = total;
+            superblock_start = total;
+        }
+        if (i % CBITSET_BLOCK_WORDS == 0) bs->blocks[i / CBITSET_BLOCK_WORDS] = (uint16_t)(total - superblock_start);
+        if (i < bs->word_count) total += bitset_popcount(bs->words[i]);
+    }
+
+    bs->total = total;
+}
+
+// Checks whether the rank/select index is up to date.
+bool bitset_has_index(const bitset* bs) {
+    bitset_check_null(bs);
+    return bs->superblocks != NULL;
+}
+
+// Returns the number of set bits in [0, 'index'). 'index' can be at most 'bitset_get_size()'.
+size_t bitset_rank(const bitset* bs, const size_t index) {
+    bitset_check_null(bs);
+    if (index > 0) bitset_check_index(bs, index - 1);
+
+    size_t word_index = index / 64, rank = 0, i = 0;
+
+    if (bs->superblocks) {
+        i = word_index / CBITSET_BLOCK_WORDS * CBITSET_BLOCK_WORDS;
+        rank = bs->superblocks[word_index / CBITSET_SUPERBLOCK_WORDS] + bs->blocks[word_index / CBITSET_BLOCK_WORDS];
+    }
+
+    for (; i < word_index; i++) rank += bitset_popcount(bs->words[i]);
+
+    if (index % 64) rank += bitset_popcount(bs->words[word_index] & (((uint64_t)1 << (index % 64)) - 1));
+    return rank;
+}
+
+// Returns the index of the set bit preceded by exactly 'rank' set bits, or 'bitset_get_size()' if there are not enough.
+size_t bitset_select(const bitset* bs, const size_t rank) {
+    bitset_check_null(bs);
+
+    size_t remaining = rank, i = 0;
+
+    if (bs->superblocks) {
+        if (rank >= bs->total) return bs->size;
+
+        // Last superblock starting with at most 'rank' set bits before it, then the last such block inside it.
+        size_t low = 0, high = bs->word_count / CBITSET_SUPERBLOCK_WORDS + 1;
+        while (high - low > 1) {
+            size_t middle = low + (high - low) / 2;
+            if (bs->superblocks[middle] <= rank) low = middle;
+            else high = middle;
+        }
+
+        remaining -= bs->superblocks[low];
+
+        size_t block = low * (CBITSET_SUPERBLOCK_WORDS / CBITSET_BLOCK_WORDS);
+        size_t block_end = block + CBITSET_SUPERBLOCK_WORDS / CBITSET_BLOCK_WORDS;
+        size_t block_limit = bs->word_count / CBITSET_BLOCK_WORDS + 1;
+        if (block_end > block_limit) block_end = block_limit;
+
+        while (block + 1 < block_end && bs->blocks[block + 1] <= remaining) block++;
+
+        remaining -= bs->blocks[block];
+        i = block * CBITSET_BLOCK_WORDS;
+    }
+
+    for (; i < bs->word_count; i++) {
+        size_t count = bitset_popcount(bs->words[i]);
+        if (remaining < count) return i * 64 + bitset_select_in_word(bs->words[i], remaining);
+        remaining -= count;
+    }
+
+    return bs->size;
+}
+
+/* ======================================= */
+/* ========= Logical operations ========== */
+/* ======================================= */
+
+// destination = bs1 & bs2.
+void bitset_and(bitset* destination, const bitset* bs1, const bitset* bs2) {
+    if (!bitset_check_sizes(destination, bs1, bs2)) return;
+    bitset_invalidate(destination);
+
+    for (size_t i = 0; i < destination->word_count; i++) destination->words[i] = bs1->words[i] & bs2->words[i];
+}
+
+// destination = bs1 | bs2.
+void bitset_or(bitset* destination, const bitset* bs1, const bitset* bs2) {
+    if (!bitset_check_sizes(destination, bs1, bs2)) return;
+    bitset_invalidate(destination);
+
+    for (size_t i = 0; i < destination->word_count; i++) destination->words[i] = bs1->words[i] | bs2->words[i];
+}
+
+// destination = bs1 ^ bs2.
+void bitset_xor(bitset* destination, const bitset* bs1, const bitset* bs2) {
+    if (!bitset_check_sizes(destination, bs1, bs2)) return;
+    bitset_invalidate(destination);
+
+    for (size_t i = 0; i < destination->word_count; i++) destination->words[i] = bs1->words[i] ^ bs2->words[i];
+}
+
+// destination = bs1 & ~bs2, the bits of 'bs1' that are not in 'bs2'.
+void bitset_andnot(bitset* destination, const bitset* bs1, const bitset* bs2) {
+    if (!bitset_check_sizes(destination, bs1, bs2)) return;
+    bitset_invalidate(destination);
+
+    for (size_t i = 0; i < destination->word_count; i++) destination->words[i] = bs1->words[i] & ~bs2->words[i];
+}
+
+// destination = ~bs.
+void bitset_not(bitset* destination, const bitset* bs) {
+    if (!bitset_check_sizes(destination, bs, NULL)) return;
+    bitset_invalidate(destination);
+
+    for (size_t i = 0; i < destination->word_count; i++) destination->words[i] = ~bs->words[i];
+    bitset_clear_tail(destination);
+}
+
+/* ====================================================== */
+/* ========== Immutative bitset manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'bs', without the rank/select index.
+bitset* bitset_copy(const bitset* bs) {
+    bitset_check_null(bs);
+
+    bitset* copy = new_bitset(bs->size);
+    memcpy(copy->words, bs->words, bs->word_count * sizeof(uint64_t));
+    return copy;
+}
+
+/* ====================================================== */
+/* =========== Mutative bitset manipulations ============ */
+/* ====================================================== */
+
+// Changes the number of bits. Added bits are 0.
+void bitset_resize(bitset* bs, const size_t size) {
+    bitset_check_null(bs);
+    bitset_invalidate(bs);
+
+    size_t word_count = size / 64 + (size % 64 != 0);
+
+    if (word_count != bs->word_count) {
+        uint64_t* words = realloc(bs->words, (word_count > 0 ? word_count : 1) * sizeof(uint64_t));
+
+        if (!words) bitset_error_handling(CBITSET_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                          CBITSET_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+        if (word_count > bs->word_count) memset(words + bs->word_count, 0, (word_count - bs->word_count) * sizeof(uint64_t));
+        bs->words = words;
+        bs->word_count = word_count;
+    }
+
+    bs->size = size;
+    bitset_clear_tail(bs);
+}
+
+// Clears every bit.
+void bitset_mut_clean(bitset* bs) {
+    bitset_check_null(bs);
+    bitset_invalidate(bs);
+
+    memset(bs->words, 0, bs->word_count * sizeof(uint64_t));
+}
@@ -0,0 +1,164 @@
+#ifndef BITSET_H
+#define BITSET_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'bitset' type is a dense sequence of bits packed into 64-bit words, one bit per index.
+Therefore, it has the following characteristics:
+    - one bit of memory per index, compared to at least one byte per element in an 'array' of 'bool'
+    - the logical operations process 64 indices per instruction, counting uses the hardware popcount when available
+    - rank and select queries can be accelerated by an index built on demand, costing about 5% of extra memory
+Similar in nature to std::bitset and boost::dynamic_bitset in C++.
+
+The rank/select index describes the bits at the time 'bitset_build_index()' is called; every modification drops it,
+and the queries fall back to scanning the words until it is rebuilt.
+*/
+
+// Type definition of 'bitset' type.
+typedef struct _bitset bitset;
+
+// Alternative 'keyword' for type 'bitset'.
+typedef bitset Bitset;
+
+// Alternative 'keyword' for type 'bitset'.
+typedef bitset bitset_t;
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of bitset. Every bit is initialised to 0.
+bitset* new_bitset    (const size_t size);
+
+// Destructor of bitset. Standardised template: void func_name(void* obj).
+void    delete_bitset (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of bits.
+size_t          bitset_get_size       (const bitset* bs);
+
+// Getter of the number of 64-bit words of the storage.
+size_t          bitset_get_word_count (const bitset* bs);
+
+// Returns a pointer to the words; bit 'i' is bit 'i % 64' of word 'i / 64'. The bits past the size are always 0.
+const uint64_t* bitset_get_data       (const bitset* bs);
+
+// Returns the bit at the specified index.
+bool            bitset_get            (const bitset* bs, const size_t index);
+
+/* ======================================= */
+/* =============== Setters =============== */
+/* ======================================= */
+
+// Sets the bit at the specified index to 'value'.
+void bitset_set       (bitset* bs, const size_t index, const bool value);
+
+// Inverts the bit at the specified index.
+void bitset_flip      (bitset* bs, const size_t index);
+
+// Sets the bits in ['begin', 'end') to 'value'.
+void bitset_set_range (bitset* bs, const size_t begin, const size_t end, const bool value);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether no bit is set.
+bool   bitset_isempty         (const bitset* bs);
+
+// Checks whether the two bitsets have the same size and bits.
+bool   bitset_areequal        (const bitset* bs1, const bitset* bs2);
+
+// Returns the number of set bits.
+size_t bitset_count           (const bitset* bs);
+
+// Returns the index of the first set bit at or after 'index', or 'bitset_get_size()' if there is none.
+size_t bitset_find_next_set   (const bitset* bs, const size_t index);
+
+// Returns the index of the first clear bit at or after 'index', or 'bitset_get_size()' if there is none.
+size_t bitset_find_next_clear (const bitset* bs, const size_t index);
+
+/* ======================================= */
+/* ============= Rank, select ============ */
+/* ======================================= */
+
+// Builds the rank/select index, making both queries (nearly) constant time until the next modification.
+void   bitset_build_index (bitset* bs);
+
+// Checks whether the rank/select index is up to date.
+bool   bitset_has_index   (const bitset* bs);
+
+// Returns the number of set bits in [0, 'index'). 'index' can be at most 'bitset_get_size()'.
+size_t bitset_rank        (const bitset* bs, const size_t index);
+
+// Returns the index of the set bit preceded by exactly 'rank' set bits, or 'bitset_get_size()' if there are not enough.
+size_t bitset_select      (const bitset* bs, const size_t rank);
+
+/* ======================================= */
+/* ========= Logical operations ========== */
+/* ======================================= */
+
+// All operands must have the same size; otherwise nothing is changed. 'destination' may be one of the operands.
+
+// destination = bs1 & bs2.
+void bitset_and    (bitset* destination, const bitset* bs1, const bitset* bs2);
+
+// destination = bs1 | bs2.
+void bitset_or     (bitset* destination, const bitset* bs1, const bitset* bs2);
+
+// destination = bs1 ^ bs2.
+void bitset_xor    (bitset* destination, const bitset* bs1, const bitset* bs2);
+
+// destination = bs1 & ~bs2, the bits of 'bs1' that are not in 'bs2'.
+void bitset_andnot (bitset* destination, const bitset* bs1, const bitset* bs2);
+
+// destination = ~bs.
+void bitset_not    (bitset* destination, const bitset* bs);
+
+/* ====================================================== */
+/* ========== Immutative bitset manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'bs', without the rank/select index.
+bitset* bitset_copy (const bitset* bs);
+
+/* ====================================================== */
+/* =========== Mutative bitset manipulations ============ */
+/* ====================================================== */
+
+// Changes the number of bits. Added bits are 0.
+void bitset_resize    (bitset* bs, const size_t size);
+
+// Clears every bit.
+void bitset_mut_clean (bitset* bs);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CBITSET_WARNMSG_SIZE_MISMATCH "Warning: bitsets of different size cannot be combined. No changes have been made."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CBITSET_ERRMSSG_NULL_BITSET "Error: bitset is a null pointer."
+#define CBITSET_ERRCODE_NULL_BITSET -1
+
+#define CBITSET_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CBITSET_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CBITSET_ERRMSSG_INDEX_OUT_OF_BOUNDS "Error: index out of bounds."
+#define CBITSET_ERRCODE_INDEX_OUT_OF_BOUNDS -3
+
+#endif // BITSET_H
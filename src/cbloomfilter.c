@@ -0,0 +1,377 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cbloomfilter.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+#define CBLOOMFILTER_BLOCK_WORDS (CBLOOMFILTER_BLOCK_BYTES / 8)
+#define CBLOOMFILTER_MAX_PROBES  16
+
+// Queries of a batch are split into groups whose blocks are prefetched together.
+#define CBLOOMFILTER_BATCH_GROUP 16
+
+// Serialised layout, every integer little-endian:
+//     magic "CBLM" (4 bytes), version (4), probe count (4), reserved (4), block count (8), item count (8), blocks (64 each).
+#define CBLOOMFILTER_FORMAT_VERSION 1
+#define CBLOOMFILTER_HEADER_BYTES   32
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define CBLOOMFILTER_PREFETCH(address) __builtin_prefetch(address)
+#else
+    #define CBLOOMFILTER_PREFETCH(address) ((void)(address))
+#endif
+
+typedef struct {
+    uint64_t words[CBLOOMFILTER_BLOCK_WORDS];
+} bloomfilter_block;
+
+struct _bloomfilter {
+    bloomfilter_block* blocks;
+    size_t block_count;
+    size_t probe_count;
+    size_t item_count;
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void bloomfilter_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CBLOOMFILTER_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void bloomfilter_check_null(const bloomfilter* bf) {
+    if (!bf) bloomfilter_error_handling(CBLOOMFILTER_ERRMSSG_NULL_BLOOMFILTER,
+                                        CBLOOMFILTER_ERRCODE_NULL_BLOOMFILTER);
+}
+
+// General warning handling function.
+static void bloomfilter_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CBLOOMFILTER_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ======= Sizing, hashing ======== */
+/* ================================ */
+
+// Natural logarithm of a positive number, so that the library does not depend on 'libm'.
+static double bloomfilter_log(double x) {
+    const double ln2 = 0.69314718055994530942;
+    double result = 0.0;
+
+    // Scale into [1, 2), then ln(m) = 2 * atanh((m - 1) / (m + 1)), whose series converges quickly there.
+    while (x >= 2.0) { x /= 2.0; result += ln2; }
+    while (x < 1.0)  { x *= 2.0; result -= ln2; }
+
+    double t = (x - 1.0) / (x + 1.0), t2 = t * t, term = t, series = 0.0;
+    for (int i = 1; i < 40; i += 2) {
+        series += term / i;
+        term *= t2;
+    }
+
+    return result + 2.0 * series;
+}
+
+// Allocates a cleared filter of the given geometry.
+static bloomfilter* bloomfilter_allocate(const size_t block_count, const size_t probe_count) {
+    if (block_count > SIZE_MAX / CBLOOMFILTER_BLOCK_BYTES) {
+        bloomfilter_error_handling(CBLOOMFILTER_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                   CBLOOMFILTER_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    bloomfilter* bf = malloc(sizeof(bloomfilter));
+
+    if (!bf) bloomfilter_error_handling(CBLOOMFILTER_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                        CBLOOMFILTER_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    bf->blocks = aligned_alloc(CBLOOMFILTER_BLOCK_BYTES, block_count * CBLOOMFILTER_BLOCK_BYTES);
+
+    if (!bf->blocks) bloomfilter_error_handling(CBLOOMFILTER_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                CBLOOMFILTER_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    memset(bf->blocks, 0, block_count * CBLOOMFILTER_BLOCK_BYTES);
+    bf->block_count = block_count;
+    bf->probe_count = probe_count;
+    bf->item_count = 0;
+    return bf;
+}
+
+// The high half of the hash picks the block by a multiply-shift, which maps evenly onto any block count below 2^32.
+static inline const bloomfilter_block* bloomfilter_block_of(const bloomfilter* bf, const uint64_t hash) {
+    return bf->blocks + (size_t)(((hash >> 32) * (uint64_t)bf->block_count) >> 32);
+}
+
+// The probes are 9-bit slices of a remixed hash, each addressing one of the 512 bits of the block; 7 slices fit in 64 bits.
+// Returns the mask of the probed bits of every word of the block.
+static inline void bloomfilter_probe_masks(const bloomfilter* bf, const uint64_t hash, uint64_t masks[CBLOOMFILTER_BLOCK_WORDS]) {
+    uint64_t bits = hash * 0x9E3779B97F4A7C15ULL;
+    size_t shift = 64;
+
+    for (size_t i = 0; i < CBLOOMFILTER_BLOCK_WORDS; i++) masks[i] = 0;
+
+    for (size_t probe = 0; probe < bf->probe_count; probe++) {
+        if (shift < 9) {
+            bits = (bits ^ (bits >> 31)) * 0xBF58476D1CE4E5B9ULL;
+            shift = 64;
+        }
+
+        shift -= 9;
+        size_t bit = (size_t)(bits >> shift) & 511;
+        masks[bit / 64] |= (uint64_t)1 << (bit % 64);
+    }
+}
+
+static inline bool bloomfilter_test(const bloomfilter* bf, const bloomfilter_block* block, const uint64_t hash) {
+    uint64_t masks[CBLOOMFILTER_BLOCK_WORDS];
+    bloomfilter_probe_masks(bf, hash, masks);
+
+    uint64_t missing = 0;
+    for (size_t i = 0; i < CBLOOMFILTER_BLOCK_WORDS; i++) missing |= masks[i] & ~block->words[i];
+    return missing == 0;
+}
+
+// Writes the lowest 'bytes' bytes of 'value' in little-endian order.
+static void bloomfilter_store(unsigned char* destination, uint64_t value, const size_t bytes) {
+    for (size_t i = 0; i < bytes; i++, value >>= 8) destination[i] = (unsigned char)value;
+}
+
+// Reads a little-endian integer of 'bytes' bytes.
+static uint64_t bloomfilter_load(const unsigned char* source, const size_t bytes) {
+    uint64_t value = 0;
+    for (size_t i = bytes; i-- > 0;) value = (value << 8) | source[i];
+    return value;
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of Bloom filter sized for 'expected_items' keys at the given false-positive rate, which must be in (0, 1).
+bloomfilter* new_bloomfilter(const size_t expected_items, const double false_positive_rate) {
+    if (!(false_positive_rate > 0.0 && false_positive_rate < 1.0)) {
+        bloomfilter_warning_handling(CBLOOMFILTER_WARNMSG_INVALID_RATE);
+        return NULL;
+    }
+
+    // A classic filter needs -ln(p) / ln(2)^2 bits per key and ln(2) times as many probes. Keys do not spread over
+    // the blocks evenly, and the crowded blocks raise the rate, so the blocked layout gets a few more bits per key.
+    const double ln2 = 0.69314718055994530942;
+    double bits_per_key = -bloomfilter_log(false_positive_rate) / (ln2 * ln2);
+    size_t probe_count = (size_t)(bits_per_key * ln2 + 0.5);
+    if (probe_count < 1) probe_count = 1;
+    if (probe_count > CBLOOMFILTER_MAX_PROBES) probe_count = CBLOOMFILTER_MAX_PROBES;
+
+    bits_per_key *= 1.0 + bits_per_key / 64.0;
+
+    double blocks = (double)(expected_items > 0 ? expected_items : 1) * bits_per_key / (CBLOOMFILTER_BLOCK_BYTES * 8) + 1.0;
+    size_t block_count = blocks < (double)UINT32_MAX ? (size_t)blocks : (size_t)UINT32_MAX;
+
+    return bloomfilter_allocate(block_count, probe_count);
+}
+
+// Constructor of Bloom filter from a buffer written by 'bloomfilter_serialize()'. Returns NULL if the buffer is malformed.
+bloomfilter* new_bloomfilter_from_bytes(const void* buffer, const size_t length) {
+    const unsigned char* bytes = buffer;
+
+    if (!bytes || length < CBLOOMFILTER_HEADER_BYTES || memcmp(bytes, "CBLM", 4) != 0 ||
+        bloomfilter_load(bytes + 4, 4) != CBLOOMFILTER_FORMAT_VERSION) {
+        bloomfilter_warning_handling(CBLOOMFILTER_WARNMSG_INVALID_BUFFER);
+        return NULL;
+    }
+
+    uint64_t probe_count = bloomfilter_load(bytes + 8, 4);
+    uint64_t block_count = bloomfilter_load(bytes + 16, 8);
+
+    if (probe_count < 1 || probe_count > CBLOOMFILTER_MAX_PROBES || block_count < 1 || block_count > UINT32_MAX ||
+        (length - CBLOOMFILTER_HEADER_BYTES) / CBLOOMFILTER_BLOCK_BYTES != block_count ||
+        (length - CBLOOMFILTER_HEADER_BYTES) % CBLOOMFILTER_BLOCK_BYTES != 0) {
+        bloomfilter_warning_handling(CBLOOMFILTER_WARNMSG_INVALID_BUFFER);
+        return NULL;
+    }
+
+    bloomfilter* bf = bloomfilter_allocate((size_t)block_count, (size_t)probe_count);
+    bf->item_count = (size_t)bloomfilter_load(bytes + 24, 8);
+
+    const unsigned char* source = bytes + CBLOOMFILTER_HEADER_BYTES;
+    for (size_t i = 0; i < bf->block_count; i++) {
+        for (size_t j = 0; j < CBLOOMFILTER_BLOCK_WORDS; j++, source += 8) bf->blocks[i].words[j] = bloomfilter_load(source, 8);
+    }
+
+    return bf;
+}
+
+// Destructor of Bloom filter. Standardised template: void func_name(void* obj).
+void delete_bloomfilter(void* obj) {
+    if (obj) {
+        bloomfilter* bf = (bloomfilter*)obj;
+        free(bf->blocks);
+        free(bf);
+        bf = NULL;
+        obj = bf;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of 64-byte blocks.
+size_t bloomfilter_get_block_count(const bloomfilter* bf) {
+    bloomfilter_check_null(bf);
+    return bf->block_count;
+}
+
+// Getter of the number of bits set per key.
+size_t bloomfilter_get_probe_count(const bloomfilter* bf) {
+    bloomfilter_check_null(bf);
+    return bf->probe_count;
+}
+
+// Getter of the number of keys added (including duplicates and the keys of merged filters).
+size_t bloomfilter_get_item_count(const bloomfilter* bf) {
+    bloomfilter_check_null(bf);
+    return bf->item_count;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the string may have been added. False means it certainly was not.
+bool bloomfilter_maycontain(const bloomfilter* bf, const string* str) {
+    return bloomfilter_maycontain_hash(bf, string_get_hash(str));
+}
+
+// Checks whether the viewed characters may have been added.
+bool bloomfilter_maycontain_view(const bloomfilter* bf, const string_view view) {
+    return bloomfilter_maycontain_hash(bf, string_view_hash(view));
+}
+
+// Checks whether a key with the given 'string_hash_data()' hash may have been added.
+bool bloomfilter_maycontain_hash(const bloomfilter* bf, const uint64_t hash) {
+    bloomfilter_check_null(bf);
+    return bloomfilter_test(bf, bloomfilter_block_of(bf, hash), hash);
+}
+
+// Checks 'count' strings at once, storing the answers in 'results'. The blocks of a whole group are prefetched first.
+void bloomfilter_maycontain_n(const bloomfilter* bf, string* const* strings, const size_t count, bool* results) {
+    bloomfilter_check_null(bf);
+
+    uint64_t hashes[CBLOOMFILTER_BATCH_GROUP];
+    const bloomfilter_block* blocks[CBLOOMFILTER_BATCH_GROUP];
+
+    for (size_t start = 0; start < count; start += CBLOOMFILTER_BATCH_GROUP) {
+        size_t group = count - start < CBLOOMFILTER_BATCH_GROUP ? count - start : CBLOOMFILTER_BATCH_GROUP;
+
+        for (size_t i = 0; i < group; i++) {
+            hashes[i] = string_get_hash(strings[start + i]);
+            blocks[i] = bloomfilter_block_of(bf, hashes[i]);
+            CBLOOMFILTER_PREFETCH(blocks[i]);
+        }
+
+        for (size_t i = 0; i < group; i++) results[start + i] = bloomfilter_test(bf, blocks[i], hashes[i]);
+    }
+}
+
+// Checks whether the two filters were created with the same parameters and can be merged.
+bool bloomfilter_arecompatible(const bloomfilter* bf1, const bloomfilter* bf2) {
+    bloomfilter_check_null(bf1);
+    bloomfilter_check_null(bf2);
+    return bf1->block_count == bf2->block_count && bf1->probe_count == bf2->probe_count;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Adds the string to the filter.
+void bloomfilter_add(bloomfilter* bf, const string* str) {
+    bloomfilter_add_hash(bf, string_get_hash(str));
+}
+
+// Adds the viewed characters to the filter.
+void bloomfilter_add_view(bloomfilter* bf, const string_view view) {
+    bloomfilter_add_hash(bf, string_view_hash(view));
+}
+
+// Adds a key given by its 'string_hash_data()' hash.
+void bloomfilter_add_hash(bloomfilter* bf, const uint64_t hash) {
+    bloomfilter_check_null(bf);
+
+    uint64_t masks[CBLOOMFILTER_BLOCK_WORDS];
+    bloomfilter_probe_masks(bf, hash, masks);
+
+    bloomfilter_block* block = (bloomfilter_block*)bloomfilter_block_of(bf, hash);
+    for (size_t i = 0; i < CBLOOMFILTER_BLOCK_WORDS; i++) block->words[i] |= masks[i];
+
+    bf->item_count++;
+}
+
+// Adds every key of 'source' to 'destination'. The filters must be compatible; otherwise nothing is changed.
+void bloomfilter_merge(bloomfilter* destination, const bloomfilter* source) {
+    if (!bloomfilter_arecompatible(destination, source)) {
+        bloomfilter_warning_handling(CBLOOMFILTER_WARNMSG_MERGE_MISMATCH);
+        return;
+    }
+
+    uint64_t* target = destination->blocks->words;
+    const uint64_t* words = source->blocks->words;
+    for (size_t i = 0; i < destination->block_count * CBLOOMFILTER_BLOCK_WORDS; i++) target[i] |= words[i];
+
+    destination->item_count += source->item_count;
+}
+
+/* ======================================= */
+/* ============ Serialisation ============ */
+/* ======================================= */
+
+// Returns the number of bytes 'bloomfilter_serialize()' writes.
+size_t bloomfilter_get_serialized_size(const bloomfilter* bf) {
+    bloomfilter_check_null(bf);
+    return CBLOOMFILTER_HEADER_BYTES + bf->block_count * CBLOOMFILTER_BLOCK_BYTES;
+}
+
+// Writes the filter into 'buffer' in a byte-order independent format. Returns the number of bytes written,
+// or 0 if 'capacity' is smaller than 'bloomfilter_get_serialized_size()'.
+size_t bloomfilter_serialize(const bloomfilter* bf, void* buffer, const size_t capacity) {
+    size_t size = bloomfilter_get_serialized_size(bf);
+    if (!buffer || capacity < size) return 0;
+
+    unsigned char* bytes = buffer;
+    memcpy(bytes, "CBLM", 4);
+    bloomfilter_store(bytes + 4, CBLOOMFILTER_FORMAT_VERSION, 4);
+    bloomfilter_store(bytes + 8, bf->probe_count, 4);
+    bloomfilter_store(bytes + 12, 0, 4);
+    bloomfilter_store(bytes + 16, bf->block_count, 8);
+    bloomfilter_store(bytes + 24, bf->item_count, 8);
+
+    unsigned char* destination = bytes + CBLOOMFILTER_HEADER_BYTES;
+    for (size_t i = 0; i < bf->block_count; i++) {
+        for (size_t j = 0; j < CBLOOMFILTER_BLOCK_WORDS; j++, destination += 8) bloomfilter_store(destination, bf->blocks[i].words[j], 8);
+    }
+
+    return size;
+}
+
+/* ====================================================== */
+/* ======== Mutative Bloom filter manipulations ========= */
+/* ====================================================== */
+
+// Removes every key, resulting in an empty filter.
+void bloomfilter_mut_clean(bloomfilter* bf) {
+    bloomfilter_check_null(bf);
+
+    memset(bf->blocks, 0, bf->block_count * CBLOOMFILTER_BLOCK_BYTES);
+    bf->item_count = 0;
+}
@@ -0,0 +1,137 @@
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cstring.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'bloomfilter' type is a probabilistic set of strings: it may report a string that was never added (a false positive),
+but never misses one that was. It is meant as a cheap pre-check in front of an expensive lookup.
+Therefore, it has the following characteristics:
+    - the bits are split into 64-byte blocks, and all the probes of one key fall into the same block,
+      so a query costs one cache miss regardless of the number of probes
+    - the block and the probes are derived from the 64-bit hash of the string, which 'string' caches
+    - the size and the number of probes are computed from the expected number of keys and the target false-positive rate
+Similar in nature to the blocked Bloom filters of RocksDB or Impala.
+
+Filters created with the same parameters can be merged, and a filter can be serialised into a portable byte buffer.
+*/
+
+// Type definition of 'bloomfilter' type.
+typedef struct _bloomfilter bloomfilter;
+
+// Alternative 'keyword' for type 'bloomfilter'.
+typedef bloomfilter BloomFilter;
+
+// Alternative 'keyword' for type 'bloomfilter'.
+typedef bloomfilter bloomfilter_t;
+
+// Size of one block in bytes: one cache line.
+#define CBLOOMFILTER_BLOCK_BYTES 64
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of Bloom filter sized for 'expected_items' keys at the given false-positive rate, which must be in (0, 1).
+bloomfilter* new_bloomfilter            (const size_t expected_items, const double false_positive_rate);
+
+// Constructor of Bloom filter from a buffer written by 'bloomfilter_serialize()'. Returns NULL if the buffer is malformed.
+bloomfilter* new_bloomfilter_from_bytes (const void* buffer, const size_t length);
+
+// Destructor of Bloom filter. Standardised template: void func_name(void* obj).
+void         delete_bloomfilter         (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of 64-byte blocks.
+size_t bloomfilter_get_block_count (const bloomfilter* bf);
+
+// Getter of the number of bits set per key.
+size_t bloomfilter_get_probe_count (const bloomfilter* bf);
+
+// Getter of the number of keys added (including duplicates and the keys of merged filters).
+size_t bloomfilter_get_item_count  (const bloomfilter* bf);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the string may have been added. False means it certainly was not.
+bool bloomfilter_maycontain      (const bloomfilter* bf, const string* str);
+
+// Checks whether the viewed characters may have been added.
+bool bloomfilter_maycontain_view (const bloomfilter* bf, const string_view view);
+
+// Checks whether a key with the given 'string_hash_data()' hash may have been added.
+bool bloomfilter_maycontain_hash (const bloomfilter* bf, const uint64_t hash);
+
+// Checks 'count' strings at once, storing the answers in 'results'. The blocks of a whole batch are fetched
+// before any of them is tested, so the cache misses overlap instead of being paid one after the other.
+void bloomfilter_maycontain_n    (const bloomfilter* bf, string* const* strings, const size_t count, bool* results);
+
+// Checks whether the two filters were created with the same parameters and can be merged.
+bool bloomfilter_arecompatible   (const bloomfilter* bf1, const bloomfilter* bf2);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Adds the string to the filter.
+void bloomfilter_add      (bloomfilter* bf, const string* str);
+
+// Adds the viewed characters to the filter.
+void bloomfilter_add_view (bloomfilter* bf, const string_view view);
+
+// Adds a key given by its 'string_hash_data()' hash.
+void bloomfilter_add_hash (bloomfilter* bf, const uint64_t hash);
+
+// Adds every key of 'source' to 'destination'. The filters must be compatible; otherwise nothing is changed.
+void bloomfilter_merge    (bloomfilter* destination, const bloomfilter* source);
+
+/* ======================================= */
+/* ============ Serialisation ============ */
+/* ======================================= */
+
+// Returns the number of bytes 'bloomfilter_serialize()' writes.
+size_t bloomfilter_get_serialized_size (const bloomfilter* bf);
+
+// Writes the filter into 'buffer' in a byte-order independent format. Returns the number of bytes written,
+// or 0 if 'capacity' is smaller than 'bloomfilter_get_serialized_size()'.
+size_t bloomfilter_serialize           (const bloomfilter* bf, void* buffer, const size_t capacity);
+
+/* ====================================================== */
+/* ======== Mutative Bloom filter manipulations ========= */
+/* ====================================================== */
+
+// Removes every key, resulting in an empty filter.
+void bloomfilter_mut_clean (bloomfilter* bf);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CBLOOMFILTER_WARNMSG_INVALID_RATE    "Warning: false-positive rate has to be between 0 and 1."
+#define CBLOOMFILTER_WARNMSG_INVALID_BUFFER  "Warning: buffer does not hold a serialised Bloom filter."
+#define CBLOOMFILTER_WARNMSG_MERGE_MISMATCH  "Warning: Bloom filters of different size or probe count cannot be merged. No changes have been made."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CBLOOMFILTER_ERRMSSG_NULL_BLOOMFILTER "Error: Bloom filter is a null pointer."
+#define CBLOOMFILTER_ERRCODE_NULL_BLOOMFILTER -1
+
+#define CBLOOMFILTER_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CBLOOMFILTER_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // BLOOMFILTER_H
@@ -0,0 +1,679 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cbtree.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+// Every node has room for 'order + 1' keys, so an overflowing node can be split after the insertion.
+// Leaves store their values after the keys, inner nodes store 'order + 2' child pointers after the keys.
+typedef struct _btree_node {
+    size_t count;               // keys in the node
+    struct _btree_node* prev;   // leaves only: neighbours in key order
+    struct _btree_node* next;
+    bool leaf;
+    max_align_t data[];
+} btree_node;
+
+// Separator keys are bitwise copies of leaf keys: 'keys[i]' of an inner node is the smallest key of subtree 'i + 1'.
+// Keeping this invariant on removal ensures that a separator never outlives the key it was copied from.
+struct _btree {
+    btree_node* root;
+    btree_node* first;          // leftmost leaf, the start of in-order walks
+    size_t size;
+    size_t height;
+
+    size_t order;               // maximum number of keys per node
+    size_t key_size;
+    size_t value_size;
+    size_t values_offset;       // byte offset of the values in a leaf
+    size_t children_offset;     // byte offset of the child pointers in an inner node
+    unsigned char* separator;   // key pushed up by a split
+
+    int (*compare)(const void*, const void*);
+    void (*key_destructor)(void*);
+    void (*value_destructor)(void*);
+};
+
+#define CBTREE_MINIMUM_ORDER 4
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define CBTREE_PREFETCH(address) __builtin_prefetch(address)
+#else
+    #define CBTREE_PREFETCH(address) ((void)(address))
+#endif
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void btree_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CBTREE_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void btree_check_null(const btree* tree) {
+    if (!tree) btree_error_handling(CBTREE_ERRMSSG_NULL_BTREE,
+                                    CBTREE_ERRCODE_NULL_BTREE);
+}
+
+// General warning handling function.
+static void btree_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CBTREE_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ======= Node management ======== */
+/* ================================ */
+
+static inline size_t btree_align(const size_t bytes) {
+    return (bytes + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t);
+}
+
+static btree_node* btree_allocate_node(const btree* tree, const bool leaf) {
+    size_t payload = leaf ? tree->values_offset + (tree->order + 1) * tree->value_size
+                          : tree->children_offset + (tree->order + 2) * sizeof(btree_node*);
+    btree_node* node = malloc(sizeof(btree_node) + payload);
+
+    if (!node) btree_error_handling(CBTREE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                    CBTREE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    node->count = 0;
+    node->prev = NULL;
+    node->next = NULL;
+    node->leaf = leaf;
+    return node;
+}
+
+static inline unsigned char* btree_key(const btree* tree, const btree_node* node, const size_t index) {
+    return (unsigned char*)node->data + index * tree->key_size;
+}
+
+static inline unsigned char* btree_value(const btree* tree, const btree_node* node, const size_t index) {
+    return (unsigned char*)node->data + tree->values_offset + index * tree->value_size;
+}
+
+static inline btree_node** btree_children(const btree* tree, const btree_node* node) {
+    return (btree_node**)((unsigned char*)node->data + tree->children_offset);
+}
+
+// Moves 'count' keys (and values for leaves) of 'source' starting at 'source_index' to 'destination_index' of 'destination'.
+static void btree_move_elements(const btree* tree, btree_node* destination, const size_t destination_index, const btree_node* source, const size_t source_index, const size_t count) {
+    if (count == 0) return;
+    memmove(btree_key(tree, destination, destination_index), btree_key(tree, source, source_index), count * tree->key_size);
+    if (destination->leaf && tree->value_size > 0) {
+        memmove(btree_value(tree, destination, destination_index), btree_value(tree, source, source_index), count * tree->value_size);
+    }
+}
+
+// Moves 'count' child pointers of 'source' starting at 'source_index' to 'destination_index' of 'destination'.
+static void btree_move_children(const btree* tree, btree_node* destination, const size_t destination_index, const btree_node* source, const size_t source_index, const size_t count) {
+    memmove(btree_children(tree, destination) + destination_index, btree_children(tree, source) + source_index, count * sizeof(btree_node*));
+}
+
+// Frees the subtree, deleting the elements if 'destroy' is set.
+static void btree_free_subtree(btree* tree, btree_node* node, const bool destroy) {
+    if (!node->leaf) {
+        for (size_t i = 0; i <= node->count; i++) btree_free_subtree(tree, btree_children(tree, node)[i], destroy);
+    }
+    else if (destroy) {
+        for (size_t i = 0; i < node->count; i++) {
+            if (tree->key_destructor) tree->key_destructor(btree_key(tree, node, i));
+            if (tree->value_destructor) tree->value_destructor(btree_value(tree, node, i));
+        }
+    }
+
+    free(node);
+}
+
+/* ================================ */
+/* ========= Node searching ======= */
+/* ================================ */
+
+// Index of the first key of the node that does not compare less than 'key'.
+static size_t btree_node_lower_bound(const btree* tree, const btree_node* node, const void* key) {
+    size_t low = 0, high = node->count;
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (tree->compare(btree_key(tree, node, middle), key) < 0) low = middle + 1;
+        else high = middle;
+    }
+
+    return low;
+}
+
+// Index of the first key of the node that compares greater than 'key'. For inner nodes, this is the child to descend to.
+static size_t btree_node_upper_bound(const btree* tree, const btree_node* node, const void* key) {
+    size_t low = 0, high = node->count;
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (tree->compare(btree_key(tree, node, middle), key) <= 0) low = middle + 1;
+        else high = middle;
+    }
+
+    return low;
+}
+
+static btree_node* btree_find_leaf(const btree* tree, const void* key) {
+    btree_node* node = tree->root;
+    while (!node->leaf) node = btree_children(tree, node)[btree_node_upper_bound(tree, node, key)];
+    return node;
+}
+
+static const unsigned char* btree_subtree_minimum(const btree* tree, const btree_node* node) {
+    while (!node->leaf) node = btree_children(tree, node)[0];
+    return btree_key(tree, node, 0);
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of B+-tree. 'key_destructor' and 'value_destructor' can be NULL for trivially copyable keys and values.
+btree* new_btree(const size_t key_size, const size_t value_size, int (*compare)(const void*, const void*), void (*key_destructor)(void*), void (*value_destructor)(void*)) {
+    if (key_size == 0) {
+        btree_warning_handling(CBTREE_WARNMSG_EMPTY_KEY_SIZE);
+        return NULL;
+    }
+
+    if (!compare) {
+        btree_warning_handling(CBTREE_WARNMSG_MISSING_COMPARATOR);
+        return NULL;
+    }
+
+    btree* tree = calloc(1, sizeof(btree));
+
+    if (!tree) btree_error_handling(CBTREE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                    CBTREE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    tree->order = CBTREE_NODE_BYTES / key_size;
+    if (tree->order < CBTREE_MINIMUM_ORDER) tree->order = CBTREE_MINIMUM_ORDER;
+
+    tree->key_size = key_size;
+    tree->value_size = value_size;
+    tree->values_offset = btree_align((tree->order + 1) * key_size);
+    tree->children_offset = tree->values_offset;
+    tree->compare = compare;
+    tree->key_destructor = key_destructor;
+    tree->value_destructor = value_destructor;
+
+    tree->separator = malloc(key_size);
+
+    if (!tree->separator) btree_error_handling(CBTREE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                               CBTREE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    return tree;
+}
+
+// Destructor of B+-tree. Standardised template: void func_name(void* obj).
+void delete_btree(void* obj) {
+    if (obj) {
+        btree* tree = (btree*)obj;
+        btree_mut_clean(tree);
+        free(tree->separator);
+        free(tree);
+        tree = NULL;
+        obj = tree;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t btree_get_size(const btree* tree) {
+    btree_check_null(tree);
+    return tree->size;
+}
+
+// Getter of the number of levels; 0 for an empty tree, 1 if the root is a leaf.
+size_t btree_get_height(const btree* tree) {
+    btree_check_null(tree);
+    return tree->height;
+}
+
+// Getter of the maximum number of keys per node.
+size_t btree_get_node_order(const btree* tree) {
+    btree_check_null(tree);
+    return tree->order;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the tree is empty.
+bool btree_isempty(const btree* tree) {
+    btree_check_null(tree);
+    return tree->size == 0;
+}
+
+// Returns a pointer to the value stored under the key pointed to by 'key', or NULL if there is none.
+void* btree_find(const btree* tree, const void* key) {
+    btree_check_null(tree);
+
+    if (!tree->root) return NULL;
+
+    btree_node* leaf = btree_find_leaf(tree, key);
+    size_t index = btree_node_lower_bound(tree, leaf, key);
+
+    if (index == leaf->count || tree->compare(btree_key(tree, leaf, index), key) != 0) return NULL;
+    return btree_value(tree, leaf, index);
+}
+
+// Checks whether the key pointed to by 'key' is present in the tree.
+bool btree_contains(const btree* tree, const void* key) {
+    return btree_find(tree, key) != NULL;
+}
+
+/* ======================================= */
+/* ============== Insertion ============== */
+/* ======================================= */
+
+// Splits the overflowing 'node', returning the new right half. The key separating the halves is stored in 'tree->separator'.
+static btree_node* btree_split(btree* tree, btree_node* node) {
+    btree_node* right = btree_allocate_node(tree, node->leaf);
+
+    if (node->leaf) {
+        size_t left_count = node->count / 2;
+        right->count = node->count - left_count;
+        btree_move_elements(tree, right, 0, node, left_count, right->count);
+        node->count = left_count;
+
+        right->prev = node;
+        right->next = node->next;
+        if (node->next) node->next->prev = right;
+        node->next = right;
+
+        memcpy(tree->separator, btree_key(tree, right, 0), tree->key_size);
+    }
+    else {
+        // The middle key moves up; it already is the smallest key of the right half.
+        size_t middle = node->count / 2;
+        right->count = node->count - middle - 1;
+        memcpy(tree->separator, btree_key(tree, node, middle), tree->key_size);
+        btree_move_elements(tree, right, 0, node, middle + 1, right->count);
+        btree_move_children(tree, right, 0, node, middle + 1, right->count + 1);
+        node->count = middle;
+    }
+
+    return right;
+}
+
+// Inserts into the subtree of 'node'. Returns the new right sibling if 'node' had to be split, NULL otherwise.
+static btree_node* btree_insert_into(btree* tree, btree_node* node, const void* key, const void* value, void** stored) {
+    if (node->leaf) {
+        size_t index = btree_node_lower_bound(tree, node, key);
+
+        if (index < node->count && tree->compare(btree_key(tree, node, index), key) == 0) {
+            if (tree->value_destructor) tree->value_destructor(btree_value(tree, node, index));
+            if (tree->value_size > 0) memcpy(btree_value(tree, node, index), value, tree->value_size);
+            if (tree->key_destructor) tree->key_destructor((void*)key);
+            *stored = btree_value(tree, node, index);
+            return NULL;
+        }
+
+        btree_move_elements(tree, node, index + 1, node, index, node->count - index);
+        memcpy(btree_key(tree, node, index), key, tree->key_size);
+        if (tree->value_size > 0) memcpy(btree_value(tree, node, index), value, tree->value_size);
+        node->count++;
+        tree->size++;
+
+        if (node->count <= tree->order) {
+            *stored = btree_value(tree, node, index);
+            return NULL;
+        }
+
+        btree_node* right = btree_split(tree, node);
+        *stored = index < node->count ? btree_value(tree, node, index) : btree_value(tree, right, index - node->count);
+        return right;
+    }
+
+    size_t child = btree_node_upper_bound(tree, node, key);
+    btree_node* sibling = btree_insert_into(tree, btree_children(tree, node)[child], key, value, stored);
+
+    if (!sibling) return NULL;
+
+    btree_move_elements(tree, node, child + 1, node, child, node->count - child);
+    btree_move_children(tree, node, child + 2, node, child + 1, node->count - child);
+    memcpy(btree_key(tree, node, child), tree->separator, tree->key_size);
+    btree_children(tree, node)[child + 1] = sibling;
+    node->count++;
+
+    return node->count <= tree->order ? NULL : btree_split(tree, node);
+}
+
+// Moves the key and the value pointed to by 'key' and 'value' into the tree (bitwise, the tree takes ownership of both).
+// If the key is present already, its value is replaced and the passed key is deleted. Returns a pointer to the stored value.
+void* btree_insert(btree* tree, const void* key, const void* value) {
+    btree_check_null(tree);
+
+    if (!tree->root) {
+        tree->root = btree_allocate_node(tree, true);
+        tree->first = tree->root;
+        tree->height = 1;
+    }
+
+    void* stored = NULL;
+    btree_node* sibling = btree_insert_into(tree, tree->root, key, value, &stored);
+
+    if (sibling) {
+        btree_node* root = btree_allocate_node(tree, false);
+        root->count = 1;
+        memcpy(btree_key(tree, root, 0), tree->separator, tree->key_size);
+        btree_children(tree, root)[0] = tree->root;
+        btree_children(tree, root)[1] = sibling;
+        tree->root = root;
+        tree->height++;
+    }
+
+    return stored;
+}
+
+/* ======================================= */
+/* =============== Removal =============== */
+/* ======================================= */
+
+// Moves one element from the left sibling of child 'index' to the front of that child.
+static void btree_borrow_from_left(btree* tree, btree_node* parent, const size_t index) {
+    btree_node* child = btree_children(tree, parent)[index];
+    btree_node* left = btree_children(tree, parent)[index - 1];
+
+    btree_move_elements(tree, child, 1, child, 0, child->count);
+
+    if (child->leaf) {
+        btree_move_elements(tree, child, 0, left, left->count - 1, 1);
+        memcpy(btree_key(tree, parent, index - 1), btree_key(tree, child, 0), tree->key_size);
+    }
+    else {
+        btree_move_children(tree, child, 1, child, 0, child->count + 1);
+        memcpy(btree_key(tree, child, 0), btree_key(tree, parent, index - 1), tree->key_size);
+        btree_children(tree, child)[0] = btree_children(tree, left)[left->count];
+        memcpy(btree_key(tree, parent, index - 1), btree_key(tree, left, left->count - 1), tree->key_size);
+    }
+
+    left->count--;
+    child->count++;
+}
+
+// Moves one element from the right sibling of child 'index' to the back of that child.
+static void btree_borrow_from_right(btree* tree, btree_node* parent, const size_t index) {
+    btree_node* child = btree_children(tree, parent)[index];
+    btree_node* right = btree_children(tree, parent)[index + 1];
+
+    if (child->leaf) {
+        btree_move_elements(tree, child, child->count, right, 0, 1);
+        btree_move_elements(tree, right, 0, right, 1, right->count - 1);
+        memcpy(btree_key(tree, parent, index), btree_key(tree, right, 0), tree->key_size);
+    }
+    else {
+        memcpy(btree_key(tree, child, child->count), btree_key(tree, parent, index), tree->key_size);
+        btree_children(tree, child)[child->count + 1] = btree_children(tree, right)[0];
+        memcpy(btree_key(tree, parent, index), btree_key(tree, right, 0), tree->key_size);
+        btree_move_elements(tree, right, 0, right, 1, right->count - 1);
+        btree_move_children(tree, right, 0, right, 1, right->count);
+    }
+
+    right->count--;
+    child->count++;
+}
+
+// Merges child 'index + 1' into child 'index' and removes it from the parent.
+static void btree_merge_children(btree* tree, btree_node* parent, const size_t index) {
+    btree_node* left = btree_children(tree, parent)[index];
+    btree_node* right = btree_children(tree, parent)[index + 1];
+
+    if (left->leaf) {
+        btree_move_elements(tree, left, left->count, right, 0, right->count);
+        left->count += right->count;
+        left->next = right->next;
+        if (right->next) right->next->prev = left;
+    }
+    else {
+        memcpy(btree_key(tree, left, left->count), btree_key(tree, parent, index), tree->key_size);
+        btree_move_elements(tree, left, left->count + 1, right, 0, right->count);
+        btree_move_children(tree, left, left->count + 1, right, 0, right->count + 1);
+        left->count += right->count + 1;
+    }
+
+    free(right);
+
+    btree_move_elements(tree, parent, index, parent, index + 1, parent->count - index - 1);
+    btree_move_children(tree, parent, index + 1, parent, index + 2, parent->count - index - 1);
+    parent->count--;
+}
+
+// Restores the minimum occupancy of child 'index' by borrowing from a sibling or merging with one.
+static void btree_rebalance(btree* tree, btree_node* parent, const size_t index) {
+    size_t minimum = tree->order / 2;
+    btree_node** children = btree_children(tree, parent);
+
+    if (index > 0 && children[index - 1]->count > minimum) btree_borrow_from_left(tree, parent, index);
+    else if (index < parent->count && children[index + 1]->count > minimum) btree_borrow_from_right(tree, parent, index);
+    else if (index > 0) btree_merge_children(tree, parent, index - 1);
+    else btree_merge_children(tree, parent, index);
+}
+
+// Removes from the subtree of 'node'. Returns whether the key was found.
+static bool btree_remove_from(btree* tree, btree_node* node, const void* key, void* key_destination, void* value_destination) {
+    if (node->leaf) {
+        size_t index = btree_node_lower_bound(tree, node, key);
+
+        if (index == node->count || tree->compare(btree_key(tree, node, index), key) != 0) return false;
+
+        if (key_destination) memcpy(key_destination, btree_key(tree, node, index), tree->key_size);
+        else if (tree->key_destructor) tree->key_destructor(btree_key(tree, node, index));
+
+        if (value_destination && tree->value_size > 0) memcpy(value_destination, btree_value(tree, node, index), tree->value_size);
+        else if (tree->value_destructor) tree->value_destructor(btree_value(tree, node, index));
+
+        btree_move_elements(tree, node, index, node, index + 1, node->count - index - 1);
+        node->count--;
+        tree->size--;
+        return true;
+    }
+
+    size_t child = btree_node_upper_bound(tree, node, key);
+
+    if (!btree_remove_from(tree, btree_children(tree, node)[child], key, key_destination, value_destination)) return false;
+
+    // The removed key may have been the smallest of the child's subtree, leaving 'keys[child - 1]' a copy of a deleted key.
+    // Refresh it before rebalancing, since borrowing and merging copy that separator down into the child.
+    btree_node* removed_from = btree_children(tree, node)[child];
+    if (child > 0 && (!removed_from->leaf || removed_from->count > 0)) {
+        memcpy(btree_key(tree, node, child - 1), btree_subtree_minimum(tree, removed_from), tree->key_size);
+    }
+
+    if (removed_from->count < tree->order / 2) btree_rebalance(tree, node, child);
+
+    // Rebalancing moves keys between the children, so the separators around them are refreshed again.
+    size_t first = child > 1 ? child - 1 : 1;
+    size_t last = child + 1 < node->count ? child + 1 : node->count;
+    for (size_t i = first; i <= last; i++) {
+        memcpy(btree_key(tree, node, i - 1), btree_subtree_minimum(tree, btree_children(tree, node)[i]), tree->key_size);
+    }
+
+    return true;
+}
+
+// Removes the element with the given key, moving its key and value into 'key_destination' and 'value_destination'.
+// Either destination can be NULL, in which case the key or value is deleted instead. Returns whether the key was present.
+bool btree_remove(btree* tree, const void* key, void* key_destination, void* value_destination) {
+    btree_check_null(tree);
+
+    if (!tree->root || !btree_remove_from(tree, tree->root, key, key_destination, value_destination)) return false;
+
+    if (tree->root->count == 0) {
+        btree_node* root = tree->root;
+
+        if (root->leaf) {
+            tree->root = NULL;
+            tree->first = NULL;
+        }
+        else tree->root = btree_children(tree, root)[0];
+
+        tree->height--;
+        free(root);
+    }
+
+    return true;
+}
+
+/* ======================================= */
+/* ============= Bulk loading ============ */
+/* ======================================= */
+
+// Builds the tree from 'count' keys and values stored contiguously, which must be sorted in strictly ascending order.
+// The tree must be empty; it takes ownership of the elements. Returns false (changing nothing) if a precondition fails.
+bool btree_bulk_load(btree* tree, const void* keys, const void* values, const size_t count) {
+    btree_check_null(tree);
+
+    if (tree->root) {
+        btree_warning_handling(CBTREE_WARNMSG_BULK_LOAD_NOT_EMPTY);
+        return false;
+    }
+
+    const unsigned char* key_bytes = keys;
+    const unsigned char* value_bytes = values;
+
+    for (size_t i = 1; i < count; i++) {
+        if (tree->compare(key_bytes + (i - 1) * tree->key_size, key_bytes + i * tree->key_size) >= 0) {
+            btree_warning_handling(CBTREE_WARNMSG_BULK_LOAD_UNSORTED);
+            return false;
+        }
+    }
+
+    if (count == 0) return true;
+
+    // Every level is packed as evenly as possible into the fewest nodes, which keeps each node at least half full.
+    size_t nodes = (count + tree->order - 1) / tree->order;
+    btree_node** level = malloc(nodes * sizeof(btree_node*));
+
+    if (!level) btree_error_handling(CBTREE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                     CBTREE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    btree_node* previous = NULL;
+    for (size_t i = 0, offset = 0; i < nodes; i++) {
+        btree_node* leaf = btree_allocate_node(tree, true);
+        leaf->count = count / nodes + (i < count % nodes);
+        memcpy(btree_key(tree, leaf, 0), key_bytes + offset * tree->key_size, leaf->count * tree->key_size);
+        if (tree->value_size > 0) memcpy(btree_value(tree, leaf, 0), value_bytes + offset * tree->value_size, leaf->count * tree->value_size);
+        offset += leaf->count;
+
+        leaf->prev = previous;
+        if (previous) previous->next = leaf;
+        previous = leaf;
+        level[i] = leaf;
+    }
+
+    tree->first = level[0];
+    tree->height = 1;
+
+    while (nodes > 1) {
+        size_t parents = (nodes + tree->order) / (tree->order + 1);
+
+        for (size_t i = 0, offset = 0; i < parents; i++) {
+            btree_node* parent = btree_allocate_node(tree, false);
+            size_t children = nodes / parents + (i < nodes % parents);
+
+            for (size_t j = 0; j < children; j++) {
+                btree_children(tree, parent)[j] = level[offset + j];
+                if (j > 0) memcpy(btree_key(tree, parent, j - 1), btree_subtree_minimum(tree, level[offset + j]), tree->key_size);
+            }
+
+            parent->count = children - 1;
+            offset += children;
+            level[i] = parent;
+        }
+
+        nodes = parents;
+        tree->height++;
+    }
+
+    tree->root = level[0];
+    tree->size = count;
+    free(level);
+    return true;
+}
+
+/* ======================================= */
+/* ============== Iteration ============== */
+/* ======================================= */
+
+// Returns an iterator positioned at the smallest key.
+btree_iterator btree_begin(const btree* tree) {
+    btree_check_null(tree);
+    return (btree_iterator){ tree, tree->first, 0 };
+}
+
+// Returns an iterator positioned at the first key that does not compare less than 'key'.
+btree_iterator btree_lower_bound(const btree* tree, const void* key) {
+    btree_check_null(tree);
+
+    if (!tree->root) return (btree_iterator){ tree, NULL, 0 };
+
+    btree_node* leaf = btree_find_leaf(tree, key);
+    return (btree_iterator){ tree, leaf, btree_node_lower_bound(tree, leaf, key) };
+}
+
+// Returns an iterator positioned at the first key that compares greater than 'key'.
+btree_iterator btree_upper_bound(const btree* tree, const void* key) {
+    btree_check_null(tree);
+
+    if (!tree->root) return (btree_iterator){ tree, NULL, 0 };
+
+    btree_node* leaf = btree_find_leaf(tree, key);
+    return (btree_iterator){ tree, leaf, btree_node_upper_bound(tree, leaf, key) };
+}
+
+// Stores pointers to the key and the value at the position of the iterator, then advances it to the next key.
+// Returns false at the end of the tree. Either output pointer can be NULL.
+bool btree_next(btree_iterator* iterator, const void** key, void** value) {
+    if (!iterator) return false;
+
+    // A bound may point past the last key of its leaf.
+    while (iterator->leaf && iterator->index == iterator->leaf->count) {
+        iterator->leaf = iterator->leaf->next;
+        iterator->index = 0;
+    }
+
+    btree_node* leaf = iterator->leaf;
+    if (!leaf) return false;
+
+    // Entering a leaf: start loading the next one while this one is processed.
+    if (iterator->index == 0) CBTREE_PREFETCH(leaf->next);
+
+    if (key) *key = btree_key(iterator->owner, leaf, iterator->index);
+    if (value) *value = btree_value(iterator->owner, leaf, iterator->index);
+    iterator->index++;
+    return true;
+}
+
+/* ====================================================== */
+/* ============ Mutative tree manipulations ============== */
+/* ====================================================== */
+
+// Erases all the elements of the tree, resulting in an empty one.
+void btree_mut_clean(btree* tree) {
+    btree_check_null(tree);
+
+    if (tree->root) btree_free_subtree(tree, tree->root, tree->key_destructor || tree->value_destructor);
+
+    tree->root = NULL;
+    tree->first = NULL;
+    tree->size = 0;
+    tree->height = 0;
+}
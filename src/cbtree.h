@@ -0,0 +1,142 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'btree' type is an ordered map implemented as an in-memory B+-tree. Instead of one key per node, every node stores
+a sorted run of keys contiguously, sized to a few cache lines, so a lookup touches 'log_B(n)' nodes instead of 'log_2(n)'.
+Therefore, it has the following characteristics:
+    - the elements live in the leaves; the inner nodes only hold copies of keys that guide the search
+    - the leaves are linked in key order, so range scans walk from leaf to leaf without climbing the tree
+    - a sorted sequence can be bulk loaded bottom-up in O(n) time, without any comparisons beyond checking the order
+Similar in nature to std::map in C++ (absl::btree_map, more precisely).
+
+Keys and values are stored by value in slots of 'key_size' and 'value_size' bytes. Following the conventions of 'array',
+the callbacks receive pointers to the slots: 'compare' follows the convention of 'string_compare()', and the destructors
+release the resources owned by a key or value without freeing the slot. Inserting moves keys and values in bitwise.
+For 'string*' keys, 'compare' is e.g. 'string_compare(*(string* const*)a, *(string* const*)b)'.
+Inserting and removing may move the elements, so pointers into the tree are only valid until the next modification.
+*/
+
+// Type definition of 'btree' type.
+typedef struct _btree btree;
+
+// Alternative 'keyword' for type 'btree'.
+typedef btree BTree;
+
+// Alternative 'keyword' for type 'btree'.
+typedef btree btree_t;
+
+// Position of an in-order walk over the tree. Obtain one by 'btree_begin()' or the bound functions, then call 'btree_next()'.
+typedef struct {
+    const btree* owner;
+    struct _btree_node* leaf;
+    size_t index;
+} btree_iterator;
+
+// Approximate size in bytes of the keys of one node: four cache lines.
+#define CBTREE_NODE_BYTES 256
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of B+-tree. 'key_destructor' and 'value_destructor' can be NULL for trivially copyable keys and values.
+btree* new_btree    (const size_t key_size, const size_t value_size, int (*compare)(const void*, const void*), void (*key_destructor)(void*), void (*value_destructor)(void*));
+
+// Destructor of B+-tree. Standardised template: void func_name(void* obj).
+void   delete_btree (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t btree_get_size       (const btree* tree);
+
+// Getter of the number of levels; 0 for an empty tree, 1 if the root is a leaf.
+size_t btree_get_height     (const btree* tree);
+
+// Getter of the maximum number of keys per node.
+size_t btree_get_node_order (const btree* tree);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the tree is empty.
+bool  btree_isempty  (const btree* tree);
+
+// Returns a pointer to the value stored under the key pointed to by 'key', or NULL if there is none.
+void* btree_find     (const btree* tree, const void* key);
+
+// Checks whether the key pointed to by 'key' is present in the tree.
+bool  btree_contains (const btree* tree, const void* key);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the key and the value pointed to by 'key' and 'value' into the tree (bitwise, the tree takes ownership of both).
+// If the key is present already, its value is replaced and the passed key is deleted. Returns a pointer to the stored value.
+// With a value size of 0, i.e. a set, 'value' may be NULL.
+void* btree_insert    (btree* tree, const void* key, const void* value);
+
+// Removes the element with the given key, moving its key and value into 'key_destination' and 'value_destination'.
+// Either destination can be NULL, in which case the key or value is deleted instead. Returns whether the key was present.
+bool  btree_remove    (btree* tree, const void* key, void* key_destination, void* value_destination);
+
+// Builds the tree from 'count' keys and values stored contiguously, which must be sorted in strictly ascending order.
+// The tree must be empty; it takes ownership of the elements. Returns false (changing nothing) if a precondition fails.
+bool  btree_bulk_load (btree* tree, const void* keys, const void* values, const size_t count);
+
+/* ======================================= */
+/* ============== Iteration ============== */
+/* ======================================= */
+
+// Returns an iterator positioned at the smallest key.
+btree_iterator btree_begin       (const btree* tree);
+
+// Returns an iterator positioned at the first key that does not compare less than 'key'.
+btree_iterator btree_lower_bound (const btree* tree, const void* key);
+
+// Returns an iterator positioned at the first key that compares greater than 'key'.
+btree_iterator btree_upper_bound (const btree* tree, const void* key);
+
+// Stores pointers to the key and the value at the position of the iterator, then advances it to the next key.
+// Returns false at the end of the tree. Either output pointer can be NULL.
+bool           btree_next        (btree_iterator* iterator, const void** key, void** value);
+
+/* ====================================================== */
+/* ============ Mutative tree manipulations ============== */
+/* ====================================================== */
+
+// Erases all the elements of the tree, resulting in an empty one.
+void btree_mut_clean (btree* tree);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CBTREE_WARNMSG_EMPTY_KEY_SIZE      "Warning: key size cannot be 0."
+#define CBTREE_WARNMSG_MISSING_COMPARATOR  "Warning: comparison function cannot be NULL."
+#define CBTREE_WARNMSG_BULK_LOAD_NOT_EMPTY "Warning: bulk loading requires an empty tree. No changes have been made."
+#define CBTREE_WARNMSG_BULK_LOAD_UNSORTED  "Warning: bulk loaded keys have to be sorted in strictly ascending order. No changes have been made."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CBTREE_ERRMSSG_NULL_BTREE "Error: B+-tree is a null pointer."
+#define CBTREE_ERRCODE_NULL_BTREE -1
+
+#define CBTREE_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CBTREE_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // BTREE_H
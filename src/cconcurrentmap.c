@@ -0,0 +1,519 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>  // sched_yield()
+#include <unistd.h> // sysconf()
+
+#include "cconcurrentmap.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+#define CCONCURRENTMAP_CACHE_LINE        64
+#define CCONCURRENTMAP_MIN_BUCKETS       16
+#define CCONCURRENTMAP_SHARDS_PER_CPU    4
+#define CCONCURRENTMAP_RECLAIM_THRESHOLD 64 // retired entries per shard before the writer reclaims them
+
+// Entries are immutable once published, except for 'next'. The value and then the key characters follow the header.
+typedef struct _concurrentmap_node {
+    _Atomic(struct _concurrentmap_node*) next;
+    struct _concurrentmap_node* retired_next;
+    uint64_t hash;
+    size_t length;
+    bool owns_value;    // false for the copies left behind by a resize, which share the value of the new entry
+    max_align_t payload[];
+} concurrentmap_node;
+
+typedef struct _concurrentmap_table {
+    size_t mask;
+    struct _concurrentmap_table* retired_next;
+    _Atomic(concurrentmap_node*) buckets[];
+} concurrentmap_table;
+
+// Every shard starts on a cache line read by every lookup, and keeps the reader counters written by every lookup on a line of their own.
+typedef struct {
+    _Alignas(CCONCURRENTMAP_CACHE_LINE) _Atomic(concurrentmap_table*) table;
+    atomic_uint epoch;            // parity selects the reader counter new readers register with
+    atomic_size_t size;
+
+    pthread_mutex_t lock;         // serialises the writers of the shard, readers never take it
+    pthread_mutex_t reclaim_lock; // serialises the epoch flips, taken after releasing 'lock' so that writers never wait for readers
+    concurrentmap_node* retired_nodes;
+    concurrentmap_table* retired_tables;
+    size_t retired;
+
+    _Alignas(CCONCURRENTMAP_CACHE_LINE) atomic_size_t readers[2];
+} concurrentmap_shard;
+
+// Entries and tables taken out of a shard, freed once no reader can see them.
+typedef struct {
+    concurrentmap_node* nodes;
+    concurrentmap_table* tables;
+} concurrentmap_retired;
+
+struct _concurrentmap {
+    concurrentmap_shard* shards;
+    size_t shard_count;          // power of two
+    unsigned shard_shift;        // the top bits of the hash select the shard, the low bits the bucket
+    size_t value_size;
+    void (*value_destructor)(void*);
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void concurrentmap_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CCONCURRENTMAP_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void concurrentmap_check_null(const concurrentmap* map) {
+    if (!map) concurrentmap_error_handling(CCONCURRENTMAP_ERRMSSG_NULL_CONCURRENTMAP,
+                                           CCONCURRENTMAP_ERRCODE_NULL_CONCURRENTMAP);
+}
+
+// General warning handling function.
+static void concurrentmap_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CCONCURRENTMAP_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+static void* concurrentmap_allocate(const size_t size) {
+    void* memory = malloc(size);
+
+    if (!memory) concurrentmap_error_handling(CCONCURRENTMAP_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                              CCONCURRENTMAP_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    return memory;
+}
+
+/* ================================ */
+/* ========= Entries, tables ====== */
+/* ================================ */
+
+static inline void* concurrentmap_node_value(const concurrentmap_node* node) {
+    return (void*)node->payload;
+}
+
+static inline const char* concurrentmap_node_key(const concurrentmap* map, const concurrentmap_node* node) {
+    return (const char*)node->payload + map->value_size;
+}
+
+static concurrentmap_node* concurrentmap_new_node(const concurrentmap* map, const char* key, const size_t length, const uint64_t hash, const void* value) {
+    concurrentmap_node* node = concurrentmap_allocate(sizeof(concurrentmap_node) + map->value_size + length);
+
+    atomic_init(&node->next, NULL);
+    node->retired_next = NULL;
+    node->hash = hash;
+    node->length = length;
+    node->owns_value = true;
+    memcpy(concurrentmap_node_value(node), value, map->value_size);
+    memcpy((char*)node->payload + map->value_size, key, length);
+
+    return node;
+}
+
+static concurrentmap_table* concurrentmap_new_table(const size_t buckets) {
+    concurrentmap_table* table = concurrentmap_allocate(sizeof(concurrentmap_table) + buckets * sizeof(concurrentmap_node*));
+
+    table->mask = buckets - 1;
+    table->retired_next = NULL;
+    for (size_t i = 0; i < buckets; i++) atomic_init(&table->buckets[i], NULL);
+
+    return table;
+}
+
+static inline concurrentmap_shard* concurrentmap_shard_of(const concurrentmap* map, const uint64_t hash) {
+    return map->shards + (map->shard_shift < 64 ? (size_t)(hash >> map->shard_shift) : 0);
+}
+
+/* ================================ */
+/* ============ Readers =========== */
+/* ================================ */
+
+// Registers a reader with the current epoch of the shard and returns the counter it registered with.
+static size_t concurrentmap_read_lock(concurrentmap_shard* shard) {
+    for (;;) {
+        unsigned epoch = atomic_load(&shard->epoch);
+        size_t parity = epoch & 1;
+
+        atomic_fetch_add(&shard->readers[parity], 1);
+
+        // A writer flipping the epoch in between may already have checked this counter: start over with the new one.
+        if (atomic_load(&shard->epoch) == epoch) return parity;
+        atomic_fetch_sub(&shard->readers[parity], 1);
+    }
+}
+
+static inline void concurrentmap_read_unlock(concurrentmap_shard* shard, const size_t parity) {
+    atomic_fetch_sub_explicit(&shard->readers[parity], 1, memory_order_release);
+}
+
+static concurrentmap_node* concurrentmap_lookup(const concurrentmap* map, const concurrentmap_table* table, const string_view key, const uint64_t hash) {
+    concurrentmap_node* node = atomic_load_explicit(&table->buckets[hash & table->mask], memory_order_acquire);
+
+    for (; node; node = atomic_load_explicit(&node->next, memory_order_acquire)) {
+        if (node->hash == hash && node->length == key.length &&
+            memcmp(concurrentmap_node_key(map, node), key.data, key.length) == 0) return node;
+    }
+
+    return NULL;
+}
+
+/* ================================ */
+/* ============ Writers =========== */
+/* ================================ */
+
+// Takes the retired entries and tables out of the shard once there are enough of them, or whenever 'force' is set.
+// The caller holds the shard lock, and passes the result to 'concurrentmap_reclaim()' after releasing it.
+static concurrentmap_retired concurrentmap_take_retired(concurrentmap_shard* shard, const bool force) {
+    concurrentmap_retired retired = { NULL, NULL };
+    if (!force && shard->retired < CCONCURRENTMAP_RECLAIM_THRESHOLD) return retired;
+
+    retired.nodes = shard->retired_nodes;
+    retired.tables = shard->retired_tables;
+    shard->retired_nodes = NULL;
+    shard->retired_tables = NULL;
+    shard->retired = 0;
+    return retired;
+}
+
+// Waits until no reader can see the retired entries and tables any more, and frees them. The caller does not hold the shard lock,
+// so that the other writers of the shard go on meanwhile.
+static void concurrentmap_reclaim(const concurrentmap* map, concurrentmap_shard* shard, concurrentmap_retired retired) {
+    if (!retired.nodes && !retired.tables) return;
+
+    // Readers that registered before the flip may still see the retired memory; the ones registering after cannot reach it.
+    // Flips are serialised, so that the readers of the previous epoch are gone before the counter is reused.
+    pthread_mutex_lock(&shard->reclaim_lock);
+    unsigned epoch = atomic_fetch_add(&shard->epoch, 1);
+    while (atomic_load(&shard->readers[epoch & 1]) != 0) sched_yield();
+    pthread_mutex_unlock(&shard->reclaim_lock);
+
+    while (retired.nodes) {
+        concurrentmap_node* node = retired.nodes;
+        retired.nodes = node->retired_next;
+        if (node->owns_value && map->value_destructor) map->value_destructor(concurrentmap_node_value(node));
+        free(node);
+    }
+
+    while (retired.tables) {
+        concurrentmap_table* table = retired.tables;
+        retired.tables = table->retired_next;
+        free(table);
+    }
+}
+
+// The caller holds the shard lock.
+static void concurrentmap_retire_node(concurrentmap_shard* shard, concurrentmap_node* node) {
+    node->retired_next = shard->retired_nodes;
+    shard->retired_nodes = node;
+    shard->retired++;
+}
+
+// Doubles the buckets of the shard. Readers may still be walking the old chains, so the entries are copied rather than relinked;
+// the originals are retired without their values, which now belong to the copies. The caller holds the shard lock.
+static void concurrentmap_grow(const concurrentmap* map, concurrentmap_shard* shard) {
+    concurrentmap_table* old_table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    concurrentmap_table* new_table = concurrentmap_new_table((old_table->mask + 1) * 2);
+
+    for (size_t i = 0; i <= old_table->mask; i++) {
+        concurrentmap_node* node = atomic_load_explicit(&old_table->buckets[i], memory_order_relaxed);
+
+        while (node) {
+            concurrentmap_node* next = atomic_load_explicit(&node->next, memory_order_relaxed);
+            concurrentmap_node* copy = concurrentmap_new_node(map, concurrentmap_node_key(map, node), node->length, node->hash,
+                                                              concurrentmap_node_value(node));
+            _Atomic(concurrentmap_node*)* bucket = &new_table->buckets[node->hash & new_table->mask];
+
+            atomic_store_explicit(&copy->next, atomic_load_explicit(bucket, memory_order_relaxed), memory_order_relaxed);
+            atomic_store_explicit(bucket, copy, memory_order_relaxed);
+
+            node->owns_value = false;
+            node->retired_next = shard->retired_nodes;
+            shard->retired_nodes = node;
+            node = next;
+        }
+    }
+
+    atomic_store_explicit(&shard->table, new_table, memory_order_release);
+
+    old_table->retired_next = shard->retired_tables;
+    shard->retired_tables = old_table;
+}
+
+// Finds the link pointing to the entry of 'key' (or the terminating NULL link of its chain). The caller holds the shard lock.
+static _Atomic(concurrentmap_node*)* concurrentmap_find_link(const concurrentmap* map, concurrentmap_table* table, const string_view key, const uint64_t hash) {
+    _Atomic(concurrentmap_node*)* link = &table->buckets[hash & table->mask];
+
+    for (concurrentmap_node* node; (node = atomic_load_explicit(link, memory_order_relaxed)); link = &node->next) {
+        if (node->hash == hash && node->length == key.length &&
+            memcmp(concurrentmap_node_key(map, node), key.data, key.length) == 0) break;
+    }
+
+    return link;
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of concurrent map. 'value_size' is the size of one value in bytes, e.g. 'sizeof(void*)'.
+// 'value_destructor' receives pointers to the value slots and can be NULL.
+// 'shards' is rounded up to a power of two; 0 picks four shards per online CPU.
+concurrentmap* new_concurrentmap(const size_t value_size, void (*value_destructor)(void*), const size_t shards) {
+    if (value_size == 0) {
+        concurrentmap_warning_handling(CCONCURRENTMAP_WARNMSG_EMPTY_VALUE_SIZE);
+        return NULL;
+    }
+
+    size_t requested = shards;
+    if (requested == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        requested = (cpus > 0 ? (size_t)cpus : 1) * CCONCURRENTMAP_SHARDS_PER_CPU;
+    }
+
+    size_t shard_count = 1;
+    unsigned shard_bits = 0;
+    while (shard_count < requested) {
+        shard_count *= 2;
+        shard_bits++;
+    }
+
+    concurrentmap* map = concurrentmap_allocate(sizeof(concurrentmap));
+    map->shards = aligned_alloc(CCONCURRENTMAP_CACHE_LINE, shard_count * sizeof(concurrentmap_shard));
+
+    if (!map->shards) concurrentmap_error_handling(CCONCURRENTMAP_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                   CCONCURRENTMAP_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    map->shard_count = shard_count;
+    map->shard_shift = 64 - shard_bits;
+    map->value_size = value_size;
+    map->value_destructor = value_destructor;
+
+    for (size_t i = 0; i < shard_count; i++) {
+        concurrentmap_shard* shard = map->shards + i;
+        atomic_init(&shard->table, concurrentmap_new_table(CCONCURRENTMAP_MIN_BUCKETS));
+        atomic_init(&shard->epoch, 0);
+        atomic_init(&shard->size, 0);
+        atomic_init(&shard->readers[0], 0);
+        atomic_init(&shard->readers[1], 0);
+        pthread_mutex_init(&shard->lock, NULL);
+        pthread_mutex_init(&shard->reclaim_lock, NULL);
+        shard->retired_nodes = NULL;
+        shard->retired_tables = NULL;
+        shard->retired = 0;
+    }
+
+    return map;
+}
+
+// Destructor of concurrent map. No other thread may use the map any more. Standardised template: void func_name(void* obj).
+void delete_concurrentmap(void* obj) {
+    if (obj) {
+        concurrentmap* map = (concurrentmap*)obj;
+
+        for (size_t i = 0; i < map->shard_count; i++) {
+            concurrentmap_shard* shard = map->shards + i;
+            concurrentmap_reclaim(map, shard, concurrentmap_take_retired(shard, true));
+
+            concurrentmap_table* table = atomic_load(&shard->table);
+            for (size_t j = 0; j <= table->mask; j++) {
+                concurrentmap_node* node = atomic_load(&table->buckets[j]);
+
+                while (node) {
+                    concurrentmap_node* next = atomic_load(&node->next);
+                    if (map->value_destructor) map->value_destructor(concurrentmap_node_value(node));
+                    free(node);
+                    node = next;
+                }
+            }
+
+            free(table);
+            pthread_mutex_destroy(&shard->lock);
+            pthread_mutex_destroy(&shard->reclaim_lock);
+        }
+
+        free(map->shards);
+        free(map);
+        map = NULL;
+        obj = map;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored keys. Only a snapshot while other threads are writing.
+size_t concurrentmap_get_size(const concurrentmap* map) {
+    concurrentmap_check_null(map);
+
+    size_t size = 0;
+    for (size_t i = 0; i < map->shard_count; i++) size += atomic_load_explicit(&map->shards[i].size, memory_order_relaxed);
+    return size;
+}
+
+// Getter of the number of shards.
+size_t concurrentmap_get_shards(const concurrentmap* map) {
+    concurrentmap_check_null(map);
+    return map->shard_count;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the map is empty.
+bool concurrentmap_isempty(const concurrentmap* map) {
+    return concurrentmap_get_size(map) == 0;
+}
+
+// Copies the value stored under 'key' into 'destination' (bitwise). Returns whether the key was present.
+bool concurrentmap_find(const concurrentmap* map, const string_view key, void* destination) {
+    concurrentmap_check_null(map);
+
+    uint64_t hash = string_view_hash(key);
+    concurrentmap_shard* shard = concurrentmap_shard_of(map, hash);
+    size_t parity = concurrentmap_read_lock(shard);
+
+    concurrentmap_table* table = atomic_load_explicit(&shard->table, memory_order_acquire);
+    concurrentmap_node* node = concurrentmap_lookup(map, table, key, hash);
+    if (node && destination) memcpy(destination, concurrentmap_node_value(node), map->value_size);
+
+    concurrentmap_read_unlock(shard, parity);
+    return node != NULL;
+}
+
+// Checks whether 'key' is present in the map.
+bool concurrentmap_contains(const concurrentmap* map, const string_view key) {
+    return concurrentmap_find(map, key, NULL);
+}
+
+// Calls 'function(value, context)' on the value stored under 'key'. The value stays valid until 'function' returns.
+// Returns whether the key was present.
+bool concurrentmap_visit(const concurrentmap* map, const string_view key, void (*function)(const void*, void*), void* context) {
+    concurrentmap_check_null(map);
+
+    uint64_t hash = string_view_hash(key);
+    concurrentmap_shard* shard = concurrentmap_shard_of(map, hash);
+    size_t parity = concurrentmap_read_lock(shard);
+
+    concurrentmap_table* table = atomic_load_explicit(&shard->table, memory_order_acquire);
+    concurrentmap_node* node = concurrentmap_lookup(map, table, key, hash);
+    if (node) function(concurrentmap_node_value(node), context);
+
+    concurrentmap_read_unlock(shard, parity);
+    return node != NULL;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the value pointed to by 'value' into the map if 'key' is not present yet. Returns whether it was inserted.
+bool concurrentmap_insert(concurrentmap* map, const string_view key, const void* value) {
+    concurrentmap_check_null(map);
+
+    uint64_t hash = string_view_hash(key);
+    concurrentmap_shard* shard = concurrentmap_shard_of(map, hash);
+    pthread_mutex_lock(&shard->lock);
+
+    concurrentmap_table* table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    _Atomic(concurrentmap_node*)* link = concurrentmap_find_link(map, table, key, hash);
+    bool inserted = atomic_load_explicit(link, memory_order_relaxed) == NULL;
+    bool grown = false;
+
+    if (inserted) {
+        // New entries are appended to the end of their chain, so the release store publishes a fully built entry.
+        atomic_store_explicit(link, concurrentmap_new_node(map, key.data, key.length, hash, value), memory_order_release);
+
+        size_t size = atomic_load_explicit(&shard->size, memory_order_relaxed) + 1;
+        atomic_store_explicit(&shard->size, size, memory_order_relaxed);
+        if (size > table->mask + 1) {
+            concurrentmap_grow(map, shard);
+            grown = true;
+        }
+    }
+
+    concurrentmap_retired retired = concurrentmap_take_retired(shard, grown);
+    pthread_mutex_unlock(&shard->lock);
+
+    concurrentmap_reclaim(map, shard, retired);
+    return inserted;
+}
+
+// Replaces the value stored under 'key' if the key is present. Returns whether it was replaced.
+bool concurrentmap_update(concurrentmap* map, const string_view key, const void* value) {
+    concurrentmap_check_null(map);
+
+    uint64_t hash = string_view_hash(key);
+    concurrentmap_shard* shard = concurrentmap_shard_of(map, hash);
+    pthread_mutex_lock(&shard->lock);
+
+    concurrentmap_table* table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    _Atomic(concurrentmap_node*)* link = concurrentmap_find_link(map, table, key, hash);
+    concurrentmap_node* old_node = atomic_load_explicit(link, memory_order_relaxed);
+
+    if (old_node) {
+        // Readers see either the old or the new entry as a whole, never a half-written value.
+        concurrentmap_node* new_node = concurrentmap_new_node(map, key.data, key.length, hash, value);
+        atomic_store_explicit(&new_node->next, atomic_load_explicit(&old_node->next, memory_order_relaxed), memory_order_relaxed);
+        atomic_store_explicit(link, new_node, memory_order_release);
+        concurrentmap_retire_node(shard, old_node);
+    }
+
+    concurrentmap_retired retired = concurrentmap_take_retired(shard, false);
+    pthread_mutex_unlock(&shard->lock);
+
+    concurrentmap_reclaim(map, shard, retired);
+    return old_node != NULL;
+}
+
+// Erases the entry of 'key'. Returns whether it was present.
+bool concurrentmap_erase(concurrentmap* map, const string_view key) {
+    concurrentmap_check_null(map);
+
+    uint64_t hash = string_view_hash(key);
+    concurrentmap_shard* shard = concurrentmap_shard_of(map, hash);
+    pthread_mutex_lock(&shard->lock);
+
+    concurrentmap_table* table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    _Atomic(concurrentmap_node*)* link = concurrentmap_find_link(map, table, key, hash);
+    concurrentmap_node* node = atomic_load_explicit(link, memory_order_relaxed);
+
+    if (node) {
+        // The unlinked entry keeps its 'next', so readers standing on it still reach the rest of the chain.
+        atomic_store_explicit(link, atomic_load_explicit(&node->next, memory_order_relaxed), memory_order_release);
+        atomic_store_explicit(&shard->size, atomic_load_explicit(&shard->size, memory_order_relaxed) - 1, memory_order_relaxed);
+        concurrentmap_retire_node(shard, node);
+    }
+
+    concurrentmap_retired retired = concurrentmap_take_retired(shard, false);
+    pthread_mutex_unlock(&shard->lock);
+
+    concurrentmap_reclaim(map, shard, retired);
+    return node != NULL;
+}
+
+// Waits until no reader can see the entries replaced or erased so far, and reclaims them.
+void concurrentmap_synchronize(concurrentmap* map) {
+    concurrentmap_check_null(map);
+
+    for (size_t i = 0; i < map->shard_count; i++) {
+        pthread_mutex_lock(&map->shards[i].lock);
+        concurrentmap_retired retired = concurrentmap_take_retired(map->shards + i, true);
+        pthread_mutex_unlock(&map->shards[i].lock);
+
+        concurrentmap_reclaim(map, map->shards + i, retired);
+    }
+}
@@ -0,0 +1,111 @@
+#ifndef CONCURRENTMAP_H
+#define CONCURRENTMAP_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cstring.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'concurrentmap' type is a hash map from string keys to values of a fixed size that can be shared by many threads:
+    - the keys are spread over independent shards by their hash, every shard serialises its writers by its own mutex
+    - readers never take a lock: they traverse immutable entries that writers replace and unlink, read-copy-update style
+    - replaced and erased entries are reclaimed once every reader that might still see them has left the shard; the writer
+      waiting for these readers has released the shard mutex, so the other writers of the shard are not held up
+Values are copied in bitwise, and the value destructor runs on reclamation, so a value stays valid for as long as a reader can reach it.
+Lookups accept 'string_view' keys (see 'string_get_view()') and never allocate.
+Similar in nature to java.util.concurrent.ConcurrentHashMap or folly::ConcurrentHashMap.
+*/
+
+// Type definition of 'concurrentmap' type.
+typedef struct _concurrentmap concurrentmap;
+
+// Alternative 'keyword' for type 'concurrentmap'.
+typedef concurrentmap ConcurrentMap;
+
+// Alternative 'keyword' for type 'concurrentmap'.
+typedef concurrentmap concurrentmap_t;
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of concurrent map. 'value_size' is the size of one value in bytes, e.g. 'sizeof(void*)'.
+// 'value_destructor' receives pointers to the value slots and can be NULL.
+// 'shards' is rounded up to a power of two; 0 picks four shards per online CPU.
+concurrentmap* new_concurrentmap    (const size_t value_size, void (*value_destructor)(void*), const size_t shards);
+
+// Destructor of concurrent map. No other thread may use the map any more. Standardised template: void func_name(void* obj).
+void           delete_concurrentmap (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored keys. Only a snapshot while other threads are writing.
+size_t concurrentmap_get_size   (const concurrentmap* map);
+
+// Getter of the number of shards.
+size_t concurrentmap_get_shards (const concurrentmap* map);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// The query methods are lock-free and can run concurrently with any other method except the destructor.
+
+// Checks whether the map is empty.
+bool concurrentmap_isempty  (const concurrentmap* map);
+
+// Copies the value stored under 'key' into 'destination' (bitwise). Returns whether the key was present.
+bool concurrentmap_find     (const concurrentmap* map, const string_view key, void* destination);
+
+// Checks whether 'key' is present in the map.
+bool concurrentmap_contains (const concurrentmap* map, const string_view key);
+
+// Calls 'function(value, context)' on the value stored under 'key'. The value stays valid until 'function' returns,
+// even if another thread updates or erases it meanwhile; it must not be modified, and 'function' must not write to the map. Returns whether the key was present.
+bool concurrentmap_visit    (const concurrentmap* map, const string_view key, void (*function)(const void*, void*), void* context);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// The general methods lock the shard of the key only.
+
+// Moves the value pointed to by 'value' into the map (bitwise, the map takes ownership) if 'key' is not present yet.
+// Returns whether it was inserted; if not, the map is unchanged and the caller keeps ownership of the value.
+bool concurrentmap_insert (concurrentmap* map, const string_view key, const void* value);
+
+// Replaces the value stored under 'key' (bitwise, the map takes ownership) if the key is present.
+// Returns whether it was replaced; if not, the caller keeps ownership of the value.
+bool concurrentmap_update (concurrentmap* map, const string_view key, const void* value);
+
+// Erases the entry of 'key'. Returns whether it was present.
+bool concurrentmap_erase  (concurrentmap* map, const string_view key);
+
+// Waits until no reader can see the entries replaced or erased so far, and reclaims them (running the value destructor).
+// Writers do this on their own every now and then; call it to release the memory at a known point.
+void concurrentmap_synchronize (concurrentmap* map);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CCONCURRENTMAP_WARNMSG_EMPTY_VALUE_SIZE "Warning: value size cannot be 0."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CCONCURRENTMAP_ERRMSSG_NULL_CONCURRENTMAP "Error: concurrent map is a null pointer."
+#define CCONCURRENTMAP_ERRCODE_NULL_CONCURRENTMAP -1
+
+#define CCONCURRENTMAP_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CCONCURRENTMAP_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // CONCURRENTMAP_H
@@ -0,0 +1,428 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+#include "ccsvreader.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+#define CCSVREADER_BLOCK 64
+
+#define CCSVREADER_INITIAL_FIELDS 16
+
+struct _csvreader {
+    FILE* source;               // NULL for buffers and mapped files
+    const char* data;           // the input, or 'buffer' for streams
+    size_t length;              // number of characters in 'data'
+    bool end;                   // whether 'data' holds the rest of the input
+    char* buffer;               // characters read from the stream, from the current row on
+    size_t capacity;
+    void* mapping;
+    size_t mapping_length;
+    char delimiter;
+    char quote;
+
+    // Classification of the input, carried from one row, block and chunk to the next.
+    size_t row_start;
+    size_t block;               // start of the classified block
+    bool classified;            // whether 'mask' describes the block at 'block'
+    uint64_t mask;              // delimiters and newlines outside quotes in the block, not yet consumed
+    uint64_t inside;            // all ones if the previous block ended inside quotes
+    size_t rows;
+
+    // Current row: the fields are kept as positions while reading, since the stream buffer moves.
+    size_t* bounds;             // start and end of every field
+    string_view* fields;
+    size_t field_count;
+    size_t field_capacity;
+    char* scratch;              // unescaped quoted fields
+    size_t scratch_capacity;
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void csvreader_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CCSVREADER_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void csvreader_check_null(const csvreader* reader) {
+    if (!reader) csvreader_error_handling(CCSVREADER_ERRMSSG_NULL_CSVREADER,
+                                          CCSVREADER_ERRCODE_NULL_CSVREADER);
+}
+
+static void csvreader_check_index(const csvreader* reader, const size_t index) {
+    if (reader->field_count <= index) {
+        delete_csvreader((csvreader*)reader);
+        csvreader_error_handling(CCSVREADER_ERRMSSG_INDEX_OUT_OF_BOUNDS,
+                                 CCSVREADER_ERRCODE_INDEX_OUT_OF_BOUNDS);
+    }
+}
+
+// General warning handling function.
+static void csvreader_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CCSVREADER_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ======== Classification ======== */
+/* ================================ */
+
+// Returns the mask of the characters of the 64-character block equal to 'character'.
+static inline uint64_t csvreader_equal_mask(const unsigned char* block, const char character) {
+    #if defined(__SSE2__)
+        const __m128i pattern = _mm_set1_epi8(character);
+        uint64_t mask = 0;
+        for (int i = 0; i < 4; i++) {
+            __m128i chunk = _mm_loadu_si128((const __m128i*)(block + 16 * i));
+            mask |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, pattern)) << (16 * i);
+        }
+        return mask;
+    #else
+        uint64_t mask = 0;
+        for (int i = 0; i < CCSVREADER_BLOCK; i++) mask |= (uint64_t)(block[i] == (unsigned char)character) << i;
+        return mask;
+    #endif
+}
+
+// Index of the lowest set bit of a non-zero mask.
+static inline size_t csvreader_lowest_bit(const uint64_t mask) {
+    #if defined(__GNUC__) || defined(__clang__)
+        return (size_t)__builtin_ctzll(mask);
+    #else
+        size_t index = 0;
+        while (!((mask >> index) & 1)) index++;
+        return index;
+    #endif
+}
+
+// Bit i of the result is the parity of the bits 0 to i, i.e. set between an opening quote (included) and a closing one (excluded).
+static inline uint64_t csvreader_prefix_xor(uint64_t mask) {
+    mask ^= mask << 1;
+    mask ^= mask << 2;
+    mask ^= mask << 4;
+    mask ^= mask << 8;
+    mask ^= mask << 16;
+    mask ^= mask << 32;
+    return mask;
+}
+
+// Classifies the block at 'reader->block'. At the end of the input, a shorter block is padded.
+static void csvreader_classify(csvreader* reader) {
+    const unsigned char* block = (const unsigned char*)reader->data + reader->block;
+    size_t available = reader->length - reader->block;
+    unsigned char padded[CCSVREADER_BLOCK];
+    uint64_t valid = ~(uint64_t)0;
+
+    if (available < CCSVREADER_BLOCK) {
+        memset(padded, 0, sizeof(padded));
+        memcpy(padded, block, available);
+        block = padded;
+        valid = ((uint64_t)1 << available) - 1;
+    }
+
+    uint64_t structural = csvreader_equal_mask(block, reader->delimiter) | csvreader_equal_mask(block, '\n');
+    if (reader->quote) {
+        uint64_t quoted = csvreader_prefix_xor(csvreader_equal_mask(block, reader->quote) & valid) ^ reader->inside;
+        reader->inside = (uint64_t)((int64_t)quoted >> 63);
+        structural &= ~quoted;
+    }
+
+    reader->mask = structural & valid;
+    reader->classified = true;
+}
+
+/* ================================ */
+/* ============ Rows ============== */
+/* ================================ */
+
+// Reads the next chunk of the stream, after moving the current row to the start of the buffer.
+static void csvreader_refill(csvreader* reader, size_t* field_start) {
+    if (!reader->source) {
+        reader->end = true;
+        return;
+    }
+
+    size_t shift = reader->row_start;
+    if (shift) {
+        memmove(reader->buffer, reader->buffer + shift, reader->length - shift);
+        reader->length -= shift;
+        reader->row_start = 0;
+        reader->block -= shift;
+        *field_start -= shift;
+        for (size_t i = 0; i < 2 * reader->field_count; i++) reader->bounds[i] -= shift;
+    }
+
+    if (reader->capacity - reader->length < CCSVREADER_CHUNK_SIZE) {
+        size_t capacity = reader->capacity ? reader->capacity : CCSVREADER_CHUNK_SIZE;
+        while (capacity - reader->length < CCSVREADER_CHUNK_SIZE) capacity *= 2;
+
+        char* buffer = realloc(reader->buffer, capacity);
+        if (!buffer) {
+            delete_csvreader(reader);
+            csvreader_error_handling(CCSVREADER_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                     CCSVREADER_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+        }
+        reader->buffer = buffer;
+        reader->capacity = capacity;
+    }
+
+    size_t read = fread(reader->buffer + reader->length, 1, reader->capacity - reader->length, reader->source);
+    reader->length += read;
+    reader->data = reader->buffer;
+    if (read == 0) {
+        if (ferror(reader->source)) csvreader_warning_handling(CCSVREADER_WARNMSG_READ_FAILURE);
+        reader->end = true;
+    }
+}
+
+static void csvreader_add_field(csvreader* reader, const size_t start, const size_t end) {
+    if (reader->field_count == reader->field_capacity) {
+        size_t capacity = reader->field_capacity ? 2 * reader->field_capacity : CCSVREADER_INITIAL_FIELDS;
+        size_t* bounds = realloc(reader->bounds, 2 * capacity * sizeof(size_t));
+        if (bounds) reader->bounds = bounds;
+        string_view* fields = realloc(reader->fields, capacity * sizeof(string_view));
+        if (fields) reader->fields = fields;
+        if (!bounds || !fields) {
+            delete_csvreader(reader);
+            csvreader_error_handling(CCSVREADER_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                     CCSVREADER_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+        }
+        reader->field_capacity = capacity;
+    }
+
+    reader->bounds[2 * reader->field_count] = start;
+    reader->bounds[2 * reader->field_count + 1] = end;
+    reader->field_count++;
+}
+
+// Turns the positions of the fields into views, removing the quotes of the quoted fields.
+static void csvreader_finish_row(csvreader* reader) {
+    const char* data = reader->data;
+    char quote = reader->quote;
+    size_t span = reader->bounds[2 * reader->field_count - 1] - reader->bounds[0];
+    size_t used = 0;
+
+    for (size_t i = 0; i < reader->field_count; i++) {
+        size_t start = reader->bounds[2 * i], end = reader->bounds[2 * i + 1];
+
+        if (quote && start < end && data[start] == quote) {
+            start++;
+            if (start < end && data[end - 1] == quote) end--;
+
+            // Doubled quotes: the unescaped field is shorter than the row, so the scratch buffer grows at most once per row.
+            if (memchr(data + start, quote, end - start)) {
+                if (reader->scratch_capacity < span) {
+                    char* scratch = realloc(reader->scratch, span);
+                    if (!scratch) {
+                        delete_csvreader(reader);
+                        csvreader_error_handling(CCSVREADER_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                 CCSVREADER_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+                    }
+                    reader->scratch = scratch;
+                    reader->scratch_capacity = span;
+                }
+
+                char* destination = reader->scratch + used;
+                size_t length = 0;
+                for (size_t j = start; j < end; j++) {
+                    destination[length++] = data[j];
+                    if (data[j] == quote && j + 1 < end && data[j + 1] == quote) j++;
+                }
+                reader->fields[i] = string_view_from_data(destination, length);
+                used += length;
+                continue;
+            }
+        }
+        reader->fields[i] = string_view_from_data(data + start, end - start);
+    }
+}
+
+/* ================================ */
+/* ===== Constructor, destructor == */
+/* ================================ */
+
+static csvreader* csvreader_allocate(const char delimiter) {
+    csvreader* reader = calloc(1, sizeof(csvreader));
+    if (!reader) csvreader_error_handling(CCSVREADER_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                          CCSVREADER_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    reader->delimiter = delimiter;
+    reader->quote = '"';
+    reader->data = "";
+    return reader;
+}
+
+// Constructor of CSV reader reading from an open stream, which is not closed by the reader.
+csvreader* new_csvreader_from_stream(FILE* source, const char delimiter) {
+    csvreader* reader = csvreader_allocate(delimiter);
+    reader->source = source;
+    reader->end = !source;
+    return reader;
+}
+
+// Constructor of CSV reader over a buffer in memory. The buffer is not copied and has to outlive the reader.
+csvreader* new_csvreader_from_bytes(const void* buffer, const size_t length, const char delimiter) {
+    csvreader* reader = csvreader_allocate(delimiter);
+    if (buffer) {
+        reader->data = (const char*)buffer;
+        reader->length = length;
+    }
+    reader->end = true;
+    return reader;
+}
+
+// Constructor of CSV reader mapping the file at 'path' into memory. Returns NULL if the file cannot be opened.
+csvreader* new_csvreader_from_file(const char* path, const char delimiter) {
+    int file = path ? open(path, O_RDONLY) : -1;
+    struct stat info;
+
+    if (file < 0 || fstat(file, &info) != 0) {
+        if (file >= 0) close(file);
+        csvreader_warning_handling(CCSVREADER_WARNMSG_FILE_NOT_FOUND);
+        return NULL;
+    }
+
+    // An empty file cannot be mapped, and has no rows.
+    size_t length = (size_t)info.st_size;
+    void* mapping = length ? mmap(NULL, length, PROT_READ, MAP_PRIVATE, file, 0) : NULL;
+    close(file);
+
+    if (mapping == MAP_FAILED) {
+        csvreader_warning_handling(CCSVREADER_WARNMSG_FILE_NOT_FOUND);
+        return NULL;
+    }
+
+    csvreader* reader = new_csvreader_from_bytes(mapping, length, delimiter);
+    reader->mapping = mapping;
+    reader->mapping_length = length;
+    return reader;
+}
+
+// Destructor of CSV reader. Standardised template: void func_name(void* obj).
+void delete_csvreader(void* obj) {
+    csvreader* reader = (csvreader*)obj;
+    if (!reader) return;
+
+    if (reader->mapping) munmap(reader->mapping, reader->mapping_length);
+    free(reader->buffer);
+    free(reader->bounds);
+    free(reader->fields);
+    free(reader->scratch);
+    free(reader);
+
+    reader = NULL;
+    obj = reader;
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of fields of the current row.
+size_t csvreader_get_field_count(const csvreader* reader) {
+    csvreader_check_null(reader);
+    return reader->field_count;
+}
+
+// Returns a view of the field of the current row at the specified index.
+string_view csvreader_get_field(const csvreader* reader, const size_t index) {
+    csvreader_check_null(reader);
+    csvreader_check_index(reader, index);
+    return reader->fields[index];
+}
+
+// Returns a copy of the field of the current row at the specified index as a new 'string'.
+string* csvreader_get_string(const csvreader* reader, const size_t index) {
+    return string_view_to_string(csvreader_get_field(reader, index));
+}
+
+// Getter of the number of rows read so far, i.e. the number of the current row starting from 1.
+size_t csvreader_get_row_number(const csvreader* reader) {
+    csvreader_check_null(reader);
+    return reader->rows;
+}
+
+/* ======================================= */
+/* =============== Setters =============== */
+/* ======================================= */
+
+// Setter of the quote character, '"' by default. With '\0', quotes are ordinary characters, as in plain TSV.
+// Has to be called before the first row is read.
+void csvreader_set_quote(csvreader* reader, const char quote) {
+    csvreader_check_null(reader);
+    reader->quote = quote;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Reads the next row. Returns false at the end of the input, or if the stream could not be read.
+bool csvreader_next_row(csvreader* reader) {
+    csvreader_check_null(reader);
+
+    size_t field_start = reader->row_start;
+    reader->field_count = 0;
+
+    for (;;) {
+        while (!reader->mask) {
+            if (reader->classified) {
+                reader->block += CCSVREADER_BLOCK;
+                reader->classified = false;
+            }
+
+            // Only the last block of the input may be classified while shorter than a block, since the
+            // quotes of a block depend on the ones before it but not on the ones after it.
+            if (reader->length - reader->block < CCSVREADER_BLOCK && !reader->end) {
+                csvreader_refill(reader, &field_start);
+                continue;
+            }
+            if (reader->block >= reader->length) {
+                if (field_start >= reader->length && reader->field_count == 0) return false;
+
+                // Last row, without a newline.
+                csvreader_add_field(reader, field_start, reader->length);
+                reader->row_start = reader->length;
+                csvreader_finish_row(reader);
+                reader->rows++;
+                return true;
+            }
+            csvreader_classify(reader);
+        }
+
+        size_t position = reader->block + csvreader_lowest_bit(reader->mask);
+        reader->mask &= reader->mask - 1;
+
+        if (reader->data[position] == reader->delimiter) {
+            csvreader_add_field(reader, field_start, position);
+            field_start = position + 1;
+            continue;
+        }
+
+        size_t end = position;
+        if (end > field_start && reader->data[end - 1] == '\r') end--;
+        csvreader_add_field(reader, field_start, end);
+        reader->row_start = position + 1;
+        csvreader_finish_row(reader);
+        reader->rows++;
+        return true;
+    }
+}
@@ -0,0 +1,113 @@
+#ifndef CSVREADER_H
+#define CSVREADER_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cstring.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'csvreader' type reads the rows of delimiter-separated text (CSV, TSV, ...) one after the other, as views of their fields.
+Therefore, it has the following characteristics:
+    - the input is a stream, a buffer in memory or a memory-mapped file; buffers and files are read in place
+    - a stream is read in chunks of 'CCSVREADER_CHUNK_SIZE' characters, and a row may span any number of chunks
+    - the characters are classified 64 at a time into bitmasks of quotes, delimiters and newlines, with SSE2 where available;
+      the quoted regions are found with a prefix XOR of the quote mask, carried from one block to the next, so that
+      the delimiters and newlines inside quotes are skipped without looking at the characters one by one
+    - a field starting with the quote character is quoted: it may contain delimiters, newlines and doubled quotes ('""'),
+      which stand for one quote; the surrounding quotes are not part of the field
+    - rows end with '\n' or '\r\n'; an empty line is a row with one empty field; the last row does not need a newline
+    - the fields are returned as views into the input, except those with doubled quotes, which are copied once into a buffer
+      of the reader; either way nothing is allocated per field, and the views are valid until the next row is read
+    - malformed input is read leniently: characters after a closing quote are kept, an unclosed quote runs to the end of the input,
+      and a quote in the middle of an unquoted field opens a quoted region like one at its start
+Similar in nature to Python's 'csv.reader', and to the 'simdcsv' parser in its use of bitmasks.
+*/
+
+// Type definition of 'csvreader' type.
+typedef struct _csvreader csvreader;
+
+// Alternative 'keyword' for type 'csvreader'.
+typedef csvreader CsvReader;
+
+// Alternative 'keyword' for type 'csvreader'.
+typedef csvreader csvreader_t;
+
+// Number of characters read from a stream at once. The buffer grows beyond it for longer rows.
+#ifndef CCSVREADER_CHUNK_SIZE
+    #define CCSVREADER_CHUNK_SIZE 65536
+#endif
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of CSV reader reading from an open stream, which is not closed by the reader.
+csvreader* new_csvreader_from_stream (FILE* source, const char delimiter);
+
+// Constructor of CSV reader over a buffer in memory. The buffer is not copied and has to outlive the reader.
+csvreader* new_csvreader_from_bytes  (const void* buffer, const size_t length, const char delimiter);
+
+// Constructor of CSV reader mapping the file at 'path' into memory. Returns NULL if the file cannot be opened.
+csvreader* new_csvreader_from_file   (const char* path, const char delimiter);
+
+// Destructor of CSV reader. Standardised template: void func_name(void* obj).
+void       delete_csvreader          (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of fields of the current row.
+size_t      csvreader_get_field_count (const csvreader* reader);
+
+// Returns a view of the field of the current row at the specified index.
+string_view csvreader_get_field       (const csvreader* reader, const size_t index);
+
+// Returns a copy of the field of the current row at the specified index as a new 'string'.
+string*     csvreader_get_string      (const csvreader* reader, const size_t index);
+
+// Getter of the number of rows read so far, i.e. the number of the current row starting from 1.
+size_t      csvreader_get_row_number  (const csvreader* reader);
+
+/* ======================================= */
+/* =============== Setters =============== */
+/* ======================================= */
+
+// Setter of the quote character, '"' by default. With '\0', quotes are ordinary characters, as in plain TSV.
+// Has to be called before the first row is read.
+void csvreader_set_quote (csvreader* reader, const char quote);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Reads the next row. Returns false at the end of the input, or if the stream could not be read.
+bool csvreader_next_row (csvreader* reader);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CCSVREADER_WARNMSG_FILE_NOT_FOUND "Warning: file could not be opened or mapped."
+#define CCSVREADER_WARNMSG_READ_FAILURE   "Warning: reading from the stream failed. The rows read so far are kept."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CCSVREADER_ERRMSSG_NULL_CSVREADER "Error: CSV reader is a null pointer."
+#define CCSVREADER_ERRCODE_NULL_CSVREADER -1
+
+#define CCSVREADER_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CCSVREADER_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CCSVREADER_ERRMSSG_INDEX_OUT_OF_BOUNDS "Error: index out of bounds."
+#define CCSVREADER_ERRCODE_INDEX_OUT_OF_BOUNDS -3
+
+#endif // CSVREADER_H
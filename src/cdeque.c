@@ -0,0 +1,491 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cdeque.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+struct _deque {
+    unsigned char* data;
+
+    size_t capacity;     // 0 or a power of two
+    size_t mask;         // 'capacity - 1'
+    size_t head;         // index of the front element
+    size_t size;
+    size_t element_size;
+    void (*destructor)(void*);
+    bool (*equality)(const void*, const void*);
+    void (*copy)(void*, const void*);
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void deque_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CDEQUE_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void deque_check_null(const deque* deq) {
+    if (!deq) deque_error_handling(CDEQUE_ERRMSSG_NULL_DEQUE,
+                                   CDEQUE_ERRCODE_NULL_DEQUE);
+}
+
+static void deque_check_index(const deque* deq, const size_t index) {
+    if (deq->size <= index) {
+        delete_deque((deque*)deq);
+        deque_error_handling(CDEQUE_ERRMSSG_INDEX_OUT_OF_BOUNDS,
+                             CDEQUE_ERRCODE_INDEX_OUT_OF_BOUNDS);
+    }
+}
+
+// General warning handling function.
+static void deque_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CDEQUE_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ======= Storage management ===== */
+/* ================================ */
+
+// Returns the address of the element at 'position', counted from the front.
+static inline unsigned char* deque_slot(const deque* deq, const size_t position) {
+    return deq->data + ((deq->head + position) & deq->mask) * deq->element_size;
+}
+
+// Copies 'count' elements starting at 'position' out of the ring into 'destination': at most two runs.
+static void deque_read(const deque* deq, const size_t position, void* destination, const size_t count) {
+    size_t start = (deq->head + position) & deq->mask;
+    size_t first = deq->capacity - start < count ? deq->capacity - start : count;
+
+    memcpy(destination, deq->data + start * deq->element_size, first * deq->element_size);
+    memcpy((unsigned char*)destination + first * deq->element_size, deq->data, (count - first) * deq->element_size);
+}
+
+// Copies 'count' elements from 'source' into the ring starting at 'position': at most two runs.
+static void deque_write(deque* deq, const size_t position, const void* source, const size_t count) {
+    size_t start = (deq->head + position) & deq->mask;
+    size_t first = deq->capacity - start < count ? deq->capacity - start : count;
+
+    memcpy(deq->data + start * deq->element_size, source, first * deq->element_size);
+    memcpy(deq->data, (const unsigned char*)source + first * deq->element_size, (count - first) * deq->element_size);
+}
+
+// Moves the elements into a new buffer of 'capacity' (a power of two, at least the size), unwrapping them to start at index 0.
+static void deque_reallocate(deque* deq, const size_t capacity) {
+    if (capacity > SIZE_MAX / deq->element_size) {
+        deque_error_handling(CDEQUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                             CDEQUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    unsigned char* data = NULL;
+
+    if (capacity > 0) {
+        data = malloc(capacity * deq->element_size);
+
+        if (!data) deque_error_handling(CDEQUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                        CDEQUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+        if (deq->size > 0) deque_read(deq, 0, data, deq->size);
+    }
+
+    free(deq->data);
+    deq->data = data;
+    deq->capacity = capacity;
+    deq->mask = capacity - 1;
+    deq->head = 0;
+}
+
+// Smallest power of two not below 'count', or 0 for 0.
+static size_t deque_round_capacity(const size_t count) {
+    if (count == 0) return 0;
+
+    size_t capacity = 1;
+    while (capacity < count) {
+        if (capacity > SIZE_MAX / 2) deque_error_handling(CDEQUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                          CDEQUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+        capacity *= 2;
+    }
+
+    return capacity;
+}
+
+// Makes room for 'additional' more elements, doubling the capacity as needed.
+static void deque_grow(deque* deq, const size_t additional) {
+    if (additional > SIZE_MAX - deq->size) {
+        deque_error_handling(CDEQUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                             CDEQUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    size_t required = deq->size + additional;
+    if (required <= deq->capacity) return;
+
+    size_t capacity = deque_round_capacity(required);
+    if (capacity < deq->capacity * 2) capacity = deq->capacity * 2;
+    if (capacity < CDEQUE_MINIMUM_CAPACITY) capacity = CDEQUE_MINIMUM_CAPACITY;
+
+    deque_reallocate(deq, capacity);
+}
+
+// Returns the offset of 'obj' from the front element, as if the ring started at index 0, or SIZE_MAX if it does not point
+// to an element of the deque. Elements passed by address may live in the deque itself: a reallocation unwraps the ring,
+// after which they are found again at 'data + offset'.
+static size_t deque_offset_of(const deque* deq, const void* obj) {
+    const unsigned char* address = obj;
+    if (!deq->size || address < deq->data || address >= deq->data + deq->capacity * deq->element_size) return SIZE_MAX;
+
+    size_t offset = (size_t)(address - deq->data);
+    size_t position = (offset / deq->element_size - deq->head) & deq->mask;
+    return position < deq->size ? position * deq->element_size + offset % deq->element_size : SIZE_MAX;
+}
+
+// Same as 'deque_write()' for elements that were at 'offset' (see 'deque_offset_of()') in a ring of 'old_capacity'
+// elements before 'deque_grow()'. If the ring was reallocated, they follow each other modulo the old capacity.
+static void deque_write_own(deque* deq, const size_t position, const void* source, const size_t offset, const size_t old_capacity, const size_t count) {
+    if (offset == SIZE_MAX || deq->capacity == old_capacity) {
+        deque_write(deq, position, source, count);
+        return;
+    }
+
+    size_t first = old_capacity - offset / deq->element_size < count ? old_capacity - offset / deq->element_size : count;
+    deque_write(deq, position, deq->data + offset, first);
+    deque_write(deq, position + first, deq->data, count - first);
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of deque. 'capacity' is rounded up to a power of two and can be 0.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+deque* new_deque(const size_t capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*)) {
+    if (element_size == 0) {
+        deque_warning_handling(CDEQUE_WARNMSG_EMPTY_ELEMENT_SIZE);
+        return NULL;
+    }
+
+    deque* deq = calloc(1, sizeof(deque));
+
+    if (!deq) deque_error_handling(CDEQUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                   CDEQUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    deq->element_size = element_size;
+    deq->destructor = destructor;
+    deq->equality = equality;
+    deq->copy = copy;
+
+    if (capacity > 0) deque_reallocate(deq, deque_round_capacity(capacity));
+
+    return deq;
+}
+
+// Destructor of deque. Standardised template: void func_name(void* obj).
+void delete_deque(void* obj) {
+    if (obj) {
+        deque* deq = (deque*)obj;
+        deque_mut_clean(deq);
+        free(deq->data);
+        free(deq);
+        deq = NULL;
+        obj = deq;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t deque_get_size(const deque* deq) {
+    deque_check_null(deq);
+    return deq->size;
+}
+
+// Getter of the number of elements that fit in the current buffer.
+size_t deque_get_capacity(const deque* deq) {
+    deque_check_null(deq);
+    return deq->capacity;
+}
+
+// Getter of the size of one element in bytes.
+size_t deque_get_element_size(const deque* deq) {
+    deque_check_null(deq);
+    return deq->element_size;
+}
+
+// Returns a pointer to the element at the specified position, counted from the front.
+void* deque_get_item_at(const deque* deq, const size_t index) {
+    deque_check_null(deq);
+    deque_check_index(deq, index);
+    return deque_slot(deq, index);
+}
+
+// Returns a pointer to the first element or NULL if the deque is empty.
+void* deque_get_front(const deque* deq) {
+    deque_check_null(deq);
+    return deq->size > 0 ? deque_slot(deq, 0) : NULL;
+}
+
+// Returns a pointer to the last element or NULL if the deque is empty.
+void* deque_get_back(const deque* deq) {
+    deque_check_null(deq);
+    return deq->size > 0 ? deque_slot(deq, deq->size - 1) : NULL;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the deque is empty.
+bool deque_isempty(const deque* deq) {
+    deque_check_null(deq);
+    return deq->size == 0;
+}
+
+// Checks whether the contents of the two deques are identical. The order of elements matters.
+bool deque_areequal(const deque* deq1, const deque* deq2) {
+    deque_check_null(deq1);
+    deque_check_null(deq2);
+
+    if (deq1->element_size != deq2->element_size ||
+        deq1->destructor != deq2->destructor ||
+        deq1->equality != deq2->equality ||
+        deq1->size != deq2->size) return false;
+
+    for (size_t i = 0; i < deq1->size; i++) {
+        if (deq1->equality ? !deq1->equality(deque_slot(deq1, i), deque_slot(deq2, i))
+                           : memcmp(deque_slot(deq1, i), deque_slot(deq2, i), deq1->element_size) != 0) return false;
+    }
+
+    return true;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' to the front of the deque (bitwise, the deque takes ownership).
+void deque_push_front(deque* deq, const void* obj) {
+    deque_check_null(deq);
+
+    if (deq->size == deq->capacity) {
+        size_t offset = deque_offset_of(deq, obj);
+        deque_grow(deq, 1);
+        if (offset != SIZE_MAX) obj = deq->data + offset;
+    }
+
+    deq->head = (deq->head - 1) & deq->mask;
+    memcpy(deq->data + deq->head * deq->element_size, obj, deq->element_size);
+    deq->size++;
+}
+
+// Moves the element pointed to by 'obj' to the back of the deque (bitwise, the deque takes ownership).
+void deque_push_back(deque* deq, const void* obj) {
+    deque_check_null(deq);
+
+    if (deq->size == deq->capacity) {
+        size_t offset = deque_offset_of(deq, obj);
+        deque_grow(deq, 1);
+        if (offset != SIZE_MAX) obj = deq->data + offset;
+    }
+
+    memcpy(deque_slot(deq, deq->size), obj, deq->element_size);
+    deq->size++;
+}
+
+// Prepends a zeroed slot to the front of the deque and returns it, so that the element can be constructed in place.
+void* deque_emplace_front(deque* deq) {
+    deque_check_null(deq);
+
+    if (deq->size == deq->capacity) deque_grow(deq, 1);
+
+    deq->head = (deq->head - 1) & deq->mask;
+    unsigned char* slot = deq->data + deq->head * deq->element_size;
+    memset(slot, 0, deq->element_size);
+    deq->size++;
+
+    return slot;
+}
+
+// Appends a zeroed slot to the back of the deque and returns it, so that the element can be constructed in place.
+void* deque_emplace_back(deque* deq) {
+    deque_check_null(deq);
+
+    if (deq->size == deq->capacity) deque_grow(deq, 1);
+
+    unsigned char* slot = deque_slot(deq, deq->size);
+    memset(slot, 0, deq->element_size);
+    deq->size++;
+
+    return slot;
+}
+
+// Hands the removed element in 'slot' over to 'destination', or deletes it.
+static void* deque_release(deque* deq, unsigned char* slot, void* destination) {
+    if (destination) {
+        memcpy(destination, slot, deq->element_size);
+        return destination;
+    }
+
+    if (deq->destructor) deq->destructor(slot);
+    return deq;
+}
+
+// Moves the front element into 'destination' and removes it. If 'destination' is NULL, the element is deleted instead.
+void* deque_pop_front(deque* deq, void* destination) {
+    deque_check_null(deq);
+    if (deq->size == 0) return NULL;
+
+    unsigned char* slot = deq->data + deq->head * deq->element_size;
+    deq->head = (deq->head + 1) & deq->mask;
+    deq->size--;
+
+    return deque_release(deq, slot, destination);
+}
+
+// Moves the back element into 'destination' and removes it. Same return values as 'deque_pop_front()'.
+void* deque_pop_back(deque* deq, void* destination) {
+    deque_check_null(deq);
+    if (deq->size == 0) return NULL;
+
+    deq->size--;
+    return deque_release(deq, deque_slot(deq, deq->size), destination);
+}
+
+// Moves 'count' contiguous elements starting at 'elements' to the front of the deque, keeping their order.
+void deque_push_front_n(deque* deq, const void* elements, const size_t count) {
+    deque_check_null(deq);
+    if (count == 0) return;
+
+    size_t offset = deque_offset_of(deq, elements), capacity = deq->capacity;
+    deque_grow(deq, count);
+    deq->head = (deq->head - count) & deq->mask;
+    deque_write_own(deq, 0, elements, offset, capacity, count);
+    deq->size += count;
+}
+
+// Moves 'count' contiguous elements starting at 'elements' to the back of the deque, in order.
+void deque_push_back_n(deque* deq, const void* elements, const size_t count) {
+    deque_check_null(deq);
+    if (count == 0) return;
+
+    size_t offset = deque_offset_of(deq, elements), capacity = deq->capacity;
+    deque_grow(deq, count);
+    deque_write_own(deq, deq->size, elements, offset, capacity, count);
+    deq->size += count;
+}
+
+// Moves up to 'count' elements from the front into the contiguous 'destination', in order. Returns the number of elements popped.
+size_t deque_pop_front_n(deque* deq, void* destination, const size_t count) {
+    deque_check_null(deq);
+
+    size_t popped = count < deq->size ? count : deq->size;
+    if (popped == 0) return 0;
+
+    if (destination) {
+        deque_read(deq, 0, destination, popped);
+    } else if (deq->destructor) {
+        for (size_t i = 0; i < popped; i++) deq->destructor(deque_slot(deq, i));
+    }
+
+    deq->head = (deq->head + popped) & deq->mask;
+    deq->size -= popped;
+    return popped;
+}
+
+// Moves up to 'count' elements from the back into the contiguous 'destination', keeping their order in the deque.
+// Returns the number of elements popped.
+size_t deque_pop_back_n(deque* deq, void* destination, const size_t count) {
+    deque_check_null(deq);
+
+    size_t popped = count < deq->size ? count : deq->size;
+    if (popped == 0) return 0;
+
+    size_t start = deq->size - popped;
+
+    if (destination) {
+        deque_read(deq, start, destination, popped);
+    } else if (deq->destructor) {
+        for (size_t i = start; i < deq->size; i++) deq->destructor(deque_slot(deq, i));
+    }
+
+    deq->size = start;
+    return popped;
+}
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Makes sure that at least 'capacity' elements fit without growing.
+void deque_reserve(deque* deq, const size_t capacity) {
+    deque_check_null(deq);
+    if (capacity > deq->capacity) deque_reallocate(deq, deque_round_capacity(capacity));
+}
+
+// Shrinks the buffer to the smallest power of two holding the elements.
+void deque_shrink_to_fit(deque* deq) {
+    deque_check_null(deq);
+
+    size_t capacity = deque_round_capacity(deq->size);
+    if (capacity < deq->capacity) deque_reallocate(deq, capacity);
+}
+
+/* ====================================================== */
+/* =========== Immutative deque manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'deq'.
+deque* deque_copy(const deque* deq) {
+    deque_check_null(deq);
+
+    deque* copy = new_deque(deq->size, deq->element_size, deq->destructor, deq->equality, deq->copy);
+
+    if (!deq->copy) {
+        if (deq->size > 0) deque_read(deq, 0, copy->data, deq->size);
+    } else {
+        for (size_t i = 0; i < deq->size; i++) deq->copy(copy->data + i * deq->element_size, deque_slot(deq, i));
+    }
+
+    copy->size = deq->size;
+    return copy;
+}
+
+/* ====================================================== */
+/* ============ Mutative deque manipulations ============ */
+/* ====================================================== */
+
+// Erases all the elements of the deque, resulting in an empty one. The capacity is kept.
+void deque_mut_clean(deque* deq) {
+    deque_check_null(deq);
+
+    deque_pop_front_n(deq, NULL, deq->size);
+    deq->head = 0;
+}
+
+// Swaps the contents of two deques in O(1).
+void deque_mut_swap(deque* deq1, deque* deq2) {
+    deque_check_null(deq1);
+    deque_check_null(deq2);
+
+    if (deq1->element_size != deq2->element_size || deq1->destructor != deq2->destructor ||
+        deq1->equality != deq2->equality || deq1->copy != deq2->copy) {
+        deque_warning_handling(CDEQUE_WARNMSG_SWAP_INCOMPATIBLE);
+        return;
+    }
+
+    deque buffer = *deq1;
+    *deq1 = *deq2;
+    *deq2 = buffer;
+}
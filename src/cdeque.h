@@ -0,0 +1,163 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'deque' type is a double-ended queue stored in one contiguous circular buffer, the two-ended counterpart of 'queue'.
+Therefore, it has the following characteristics:
+    - the capacity is always a power of two, so wrapping around is a bit mask instead of a division
+    - pushing and popping at both ends take O(1) time; batches are copied with at most two 'memcpy()' calls
+    - growing doubles the buffer and unwraps its contents once
+Similar in nature to std::deque in C++, although the elements are contiguous apart from the wrap-around.
+
+The callback functions follow the conventions of 'array': they receive pointers to the element slots.
+Growing may move the elements, so pointers into the deque are only valid until the next insertion.
+*/
+
+// Type definition of 'deque' type.
+typedef struct _deque deque;
+
+// Alternative 'keyword' for type 'deque'.
+typedef deque Deque;
+
+// Alternative 'keyword' for type 'deque'.
+typedef deque deque_t;
+
+// Capacity of the first allocation of a deque created with capacity 0.
+#define CDEQUE_MINIMUM_CAPACITY 8
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of deque. 'capacity' is rounded up to a power of two and can be 0.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+deque* new_deque    (const size_t capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*));
+
+// Destructor of deque. Standardised template: void func_name(void* obj).
+void   delete_deque (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t deque_get_size         (const deque* deq);
+
+// Getter of the number of elements that fit in the current buffer.
+size_t deque_get_capacity     (const deque* deq);
+
+// Getter of the size of one element in bytes.
+size_t deque_get_element_size (const deque* deq);
+
+// Returns a pointer to the element at the specified position, counted from the front.
+void*  deque_get_item_at      (const deque* deq, const size_t index);
+
+// Returns a pointer to the first element or NULL if the deque is empty.
+void*  deque_get_front        (const deque* deq);
+
+// Returns a pointer to the last element or NULL if the deque is empty.
+void*  deque_get_back         (const deque* deq);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the deque is empty.
+bool deque_isempty  (const deque* deq);
+
+// Checks whether the contents of the two deques are identical. The order of elements matters.
+bool deque_areequal (const deque* deq1, const deque* deq2);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' to the front of the deque (bitwise, the deque takes ownership).
+void   deque_push_front    (deque* deq, const void* obj);
+
+// Moves the element pointed to by 'obj' to the back of the deque (bitwise, the deque takes ownership).
+void   deque_push_back     (deque* deq, const void* obj);
+
+// Prepends a zeroed slot to the front of the deque and returns it, so that the element can be constructed in place.
+void*  deque_emplace_front (deque* deq);
+
+// Appends a zeroed slot to the back of the deque and returns it, so that the element can be constructed in place.
+void*  deque_emplace_back  (deque* deq);
+
+// Moves the front element into 'destination' and removes it. If 'destination' is NULL, the element is deleted instead.
+// Returns 'destination' (or the deque itself if 'destination' is NULL), or NULL if the deque was empty.
+void*  deque_pop_front     (deque* deq, void* destination);
+
+// Moves the back element into 'destination' and removes it. Same return values as 'deque_pop_front()'.
+void*  deque_pop_back      (deque* deq, void* destination);
+
+// Moves 'count' contiguous elements starting at 'elements' to the front of the deque, keeping their order:
+// 'elements[0]' becomes the new front.
+void   deque_push_front_n  (deque* deq, const void* elements, const size_t count);
+
+// Moves 'count' contiguous elements starting at 'elements' to the back of the deque, in order.
+void   deque_push_back_n   (deque* deq, const void* elements, const size_t count);
+
+// Moves up to 'count' elements from the front into the contiguous 'destination', in order. If 'destination' is NULL,
+// the elements are deleted instead. Returns the number of elements popped.
+size_t deque_pop_front_n   (deque* deq, void* destination, const size_t count);
+
+// Moves up to 'count' elements from the back into the contiguous 'destination', keeping their order in the deque.
+// If 'destination' is NULL, the elements are deleted instead. Returns the number of elements popped.
+size_t deque_pop_back_n    (deque* deq, void* destination, const size_t count);
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Makes sure that at least 'capacity' elements fit without growing.
+void deque_reserve       (deque* deq, const size_t capacity);
+
+// Shrinks the buffer to the smallest power of two holding the elements.
+void deque_shrink_to_fit (deque* deq);
+
+/* ====================================================== */
+/* =========== Immutative deque manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'deq'.
+deque* deque_copy (const deque* deq);
+
+/* ====================================================== */
+/* ============ Mutative deque manipulations ============ */
+/* ====================================================== */
+
+// Erases all the elements of the deque, resulting in an empty one. The capacity is kept.
+void deque_mut_clean (deque* deq);
+
+// Swaps the contents of two deques in O(1).
+void deque_mut_swap  (deque* deq1, deque* deq2);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CDEQUE_WARNMSG_EMPTY_ELEMENT_SIZE "Warning: element size cannot be 0."
+#define CDEQUE_WARNMSG_SWAP_INCOMPATIBLE  "Warning: deques of different element size or callbacks cannot be swapped. No changes have been made."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CDEQUE_ERRMSSG_NULL_DEQUE "Error: deque is a null pointer."
+#define CDEQUE_ERRCODE_NULL_DEQUE -1
+
+#define CDEQUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CDEQUE_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CDEQUE_ERRMSSG_INDEX_OUT_OF_BOUNDS "Error: index out of bounds."
+#define CDEQUE_ERRCODE_INDEX_OUT_OF_BOUNDS -3
+
+#endif // DEQUE_H
@@ -0,0 +1,260 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "ceditdistance.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+// The string compared with the other one 64 characters at a time, prepared once.
+typedef struct {
+    const unsigned char* data;
+    size_t length;
+    size_t words;               // number of 64-bit words per column
+    uint64_t* peq;              // for every character, then every word: the positions of the character in the string
+    uint64_t* vectors;          // for every word: positive and negative vertical differences, and the last diagonal zeros
+    uint64_t single_peq[256];   // storage of the strings of up to 64 characters
+    uint64_t single_vectors[3];
+} editdistance_pattern;
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void editdistance_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CEDITDISTANCE_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void editdistance_check_null(const string* str) {
+    if (!str) editdistance_error_handling(CEDITDISTANCE_ERRMSSG_NULL_STRING,
+                                          CEDITDISTANCE_ERRCODE_NULL_STRING);
+}
+
+/* ================================ */
+/* ======== Bit-parallel DP ======= */
+/* ================================ */
+
+static void editdistance_prepare(editdistance_pattern* pattern, const string_view view) {
+    pattern->data = (const unsigned char*)view.data;
+    pattern->length = view.length;
+    pattern->words = (view.length + 63) / 64;
+    pattern->peq = pattern->single_peq;
+    pattern->vectors = pattern->single_vectors;
+
+    if (pattern->words > 1) {
+        pattern->peq = calloc(256 * pattern->words, sizeof(uint64_t));
+        pattern->vectors = malloc(3 * pattern->words * sizeof(uint64_t));
+        if (!pattern->peq || !pattern->vectors) {
+            free(pattern->peq);
+            free(pattern->vectors);
+            editdistance_error_handling(CEDITDISTANCE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                        CEDITDISTANCE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+        }
+    } else memset(pattern->single_peq, 0, sizeof(pattern->single_peq));
+
+    for (size_t i = 0; i < view.length; i++) {
+        pattern->peq[pattern->data[i] * pattern->words + i / 64] |= (uint64_t)1 << (i % 64);
+    }
+}
+
+static void editdistance_release(editdistance_pattern* pattern) {
+    if (pattern->peq != pattern->single_peq) free(pattern->peq);
+    if (pattern->vectors != pattern->single_vectors) free(pattern->vectors);
+}
+
+// Returns the distance between the pattern and the text if it is at most 'max_distance', and 'max_distance + 1' otherwise.
+// Column j of the matrix holds the distances between the prefixes of the pattern and the first j characters of the text,
+// stored as the differences between consecutive rows: 'positive' and 'negative' bits for +1 and -1, 0 otherwise.
+// The bit operations on a column are additions and left shifts, so the words are processed from the lowest one,
+// passing the carries upwards. Following Hyyrö, a transposition is an extra zero on the diagonal ('transposed').
+static size_t editdistance_run(editdistance_pattern* pattern, const string_view view, const size_t max_distance, const bool damerau) {
+    const unsigned char* text = (const unsigned char*)view.data;
+    const size_t m = pattern->length, n = view.length;
+    const size_t words = pattern->words;
+
+    if ((m > n ? m - n : n - m) > max_distance) return max_distance + 1;
+    if (m == 0 || n == 0) return m + n;
+
+    uint64_t* positive = pattern->vectors;
+    uint64_t* negative = pattern->vectors + words;
+    uint64_t* zeros = pattern->vectors + 2 * words;
+    for (size_t w = 0; w < words; w++) {
+        positive[w] = ~(uint64_t)0;
+        negative[w] = 0;
+        zeros[w] = 0;
+    }
+
+    const uint64_t last_row = (uint64_t)1 << ((m - 1) % 64);
+    const uint64_t* previous_eq = NULL;
+    size_t score = m;
+
+    for (size_t j = 0; j < n; j++) {
+        const uint64_t* eq = pattern->peq + text[j] * words;
+
+        // The first row is the distance to the empty prefix of the pattern, which grows by one per column.
+        uint64_t add_carry = 0, positive_carry = 1, negative_carry = 0, transposed_carry = 0;
+
+        for (size_t w = 0; w < words; w++) {
+            uint64_t match = eq[w], vp = positive[w], vn = negative[w];
+
+            uint64_t transposed = 0;
+            if (damerau && previous_eq) {
+                uint64_t candidates = ~zeros[w] & match;
+                transposed = ((candidates << 1) | transposed_carry) & previous_eq[w];
+                transposed_carry = candidates >> 63;
+            }
+
+            uint64_t masked = match & vp;
+            uint64_t sum = masked + vp;
+            uint64_t carry = sum < masked;
+            sum += add_carry;
+            add_carry = carry | (sum < add_carry);
+
+            uint64_t diagonal = (sum ^ vp) | match | vn | transposed;
+            uint64_t hp = vn | ~(diagonal | vp);
+            uint64_t hn = vp & diagonal;
+
+            if (w == words - 1) {
+                if (hp & last_row) score++;
+                else if (hn & last_row) score--;
+            }
+
+            uint64_t hp_shifted = (hp << 1) | positive_carry;
+            uint64_t hn_shifted = (hn << 1) | negative_carry;
+            positive_carry = hp >> 63;
+            negative_carry = hn >> 63;
+
+            positive[w] = hn_shifted | ~(diagonal | hp_shifted);
+            negative[w] = hp_shifted & diagonal;
+            zeros[w] = diagonal;
+        }
+        previous_eq = eq;
+
+        // Each remaining column lowers the distance by at most one.
+        if (score > max_distance && score - max_distance > n - 1 - j) return max_distance + 1;
+    }
+    return score;
+}
+
+// Prepares the shorter view, which needs fewer words, and runs the other one against it.
+static size_t editdistance_compute(const string_view view1, const string_view view2, const size_t max_distance, const bool damerau) {
+    editdistance_pattern pattern;
+    bool swap = view2.length < view1.length;
+    editdistance_prepare(&pattern, swap ? view2 : view1);
+    size_t distance = editdistance_run(&pattern, swap ? view1 : view2, max_distance, damerau);
+    editdistance_release(&pattern);
+    return distance;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Returns the Levenshtein distance between the strings.
+size_t editdistance_levenshtein(const string* str1, const string* str2) {
+    editdistance_check_null(str1);
+    editdistance_check_null(str2);
+    return editdistance_compute(string_get_view(str1), string_get_view(str2), SIZE_MAX - 1, false);
+}
+
+// Returns the Levenshtein distance between the views.
+size_t editdistance_levenshtein_view(const string_view view1, const string_view view2) {
+    return editdistance_compute(view1, view2, SIZE_MAX - 1, false);
+}
+
+// Returns the Levenshtein distance between the strings if it is at most 'max_distance', and 'max_distance + 1' otherwise.
+size_t editdistance_levenshtein_bounded(const string* str1, const string* str2, const size_t max_distance) {
+    editdistance_check_null(str1);
+    editdistance_check_null(str2);
+    return editdistance_compute(string_get_view(str1), string_get_view(str2), max_distance, false);
+}
+
+// Same as 'editdistance_levenshtein_bounded()' for views.
+size_t editdistance_levenshtein_bounded_view(const string_view view1, const string_view view2, const size_t max_distance) {
+    return editdistance_compute(view1, view2, max_distance, false);
+}
+
+// Returns the Damerau distance (optimal string alignment) between the strings.
+size_t editdistance_damerau(const string* str1, const string* str2) {
+    editdistance_check_null(str1);
+    editdistance_check_null(str2);
+    return editdistance_compute(string_get_view(str1), string_get_view(str2), SIZE_MAX - 1, true);
+}
+
+// Returns the Damerau distance (optimal string alignment) between the views.
+size_t editdistance_damerau_view(const string_view view1, const string_view view2) {
+    return editdistance_compute(view1, view2, SIZE_MAX - 1, true);
+}
+
+// Returns the Damerau distance between the strings if it is at most 'max_distance', and 'max_distance + 1' otherwise.
+size_t editdistance_damerau_bounded(const string* str1, const string* str2, const size_t max_distance) {
+    editdistance_check_null(str1);
+    editdistance_check_null(str2);
+    return editdistance_compute(string_get_view(str1), string_get_view(str2), max_distance, true);
+}
+
+// Same as 'editdistance_damerau_bounded()' for views.
+size_t editdistance_damerau_bounded_view(const string_view view1, const string_view view2, const size_t max_distance) {
+    return editdistance_compute(view1, view2, max_distance, true);
+}
+
+/* ======================================= */
+/* ============ Fuzzy search ============= */
+/* ======================================= */
+
+// The matches are kept sorted, so a string has to beat the last one once 'limit' are kept. The strings are visited by
+// increasing index, so a tie with the last one does not: the bound becomes its distance minus one.
+static size_t editdistance_search_generic(const string* query, string* const* strings, const size_t count, const size_t max_distance,
+                                          editdistance_match* matches, const size_t limit, const bool damerau) {
+    editdistance_check_null(query);
+    if (!limit) return 0;
+
+    editdistance_pattern pattern;
+    editdistance_prepare(&pattern, string_get_view(query));
+
+    size_t found = 0, bound = max_distance;
+    for (size_t i = 0; i < count; i++) {
+        if (!strings[i]) continue;
+
+        size_t distance = editdistance_run(&pattern, string_get_view(strings[i]), bound, damerau);
+        if (distance > bound) continue;
+
+        size_t position = found < limit ? found++ : limit - 1;
+        while (position > 0 && matches[position - 1].distance > distance) {
+            matches[position] = matches[position - 1];
+            position--;
+        }
+        matches[position].index = i;
+        matches[position].distance = distance;
+
+        if (found == limit) {
+            if (matches[limit - 1].distance == 0) break;
+            bound = matches[limit - 1].distance - 1;
+        }
+    }
+
+    editdistance_release(&pattern);
+    return found;
+}
+
+// Finds the strings within Levenshtein distance 'max_distance' of the query, and stores the 'limit' closest ones in 'matches',
+// by increasing distance, then increasing index. NULL entries, e.g. the empty slots of an 'array', are skipped.
+// Returns the number of matches stored.
+size_t editdistance_search(const string* query, string* const* strings, const size_t count, const size_t max_distance,
+                           editdistance_match* matches, const size_t limit) {
+    return editdistance_search_generic(query, strings, count, max_distance, matches, limit, false);
+}
+
+// Same as 'editdistance_search()' with the Damerau distance.
+size_t editdistance_search_damerau(const string* query, string* const* strings, const size_t count, const size_t max_distance,
+                                   editdistance_match* matches, const size_t limit) {
+    return editdistance_search_generic(query, strings, count, max_distance, matches, limit, true);
+}
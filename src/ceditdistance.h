@@ -0,0 +1,85 @@
+#ifndef EDITDISTANCE_H
+#define EDITDISTANCE_H
+
+#include <stddef.h>
+
+#include "cstring.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+Edit distances between strings, and a fuzzy search returning the strings of an array closest to a query.
+    - the Levenshtein distance counts the insertions, deletions and substitutions of characters turning one string into the other
+    - the Damerau distance also counts a transposition of two adjacent characters as one edit; it is the restricted variant
+      (optimal string alignment), in which a transposed pair is not edited again
+    - both are computed with the bit-parallel algorithm of Myers, extended to transpositions by Hyyrö: a column of the
+      dynamic programming matrix is kept as bitmasks of its vertical differences, so that a character of one string is
+      compared with 64 characters of the other in a few word operations; the shorter string is split into as many 64-bit
+      words as needed, so that the time is O(n * ceil(m / 64)) instead of O(n * m)
+    - the bounded variants stop as soon as the distance is known to exceed the bound, e.g. when the lengths differ by more
+    - the fuzzy search prepares the query once for all strings, and lowers the bound to the worst kept match as it goes
+Characters are compared as bytes, so a multi-byte UTF-8 character counts as several characters.
+Similar in nature to the 'edlib' and 'rapidfuzz' libraries.
+*/
+
+// One result of 'editdistance_search()'.
+typedef struct {
+    size_t index;       // index of the string in the searched array
+    size_t distance;
+} editdistance_match;
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Returns the Levenshtein distance between the strings.
+size_t editdistance_levenshtein              (const string* str1, const string* str2);
+
+// Returns the Levenshtein distance between the views.
+size_t editdistance_levenshtein_view         (const string_view view1, const string_view view2);
+
+// Returns the Levenshtein distance between the strings if it is at most 'max_distance', and 'max_distance + 1' otherwise.
+size_t editdistance_levenshtein_bounded      (const string* str1, const string* str2, const size_t max_distance);
+
+// Same as 'editdistance_levenshtein_bounded()' for views.
+size_t editdistance_levenshtein_bounded_view (const string_view view1, const string_view view2, const size_t max_distance);
+
+// Returns the Damerau distance (optimal string alignment) between the strings.
+size_t editdistance_damerau                  (const string* str1, const string* str2);
+
+// Returns the Damerau distance (optimal string alignment) between the views.
+size_t editdistance_damerau_view             (const string_view view1, const string_view view2);
+
+// Returns the Damerau distance between the strings if it is at most 'max_distance', and 'max_distance + 1' otherwise.
+size_t editdistance_damerau_bounded          (const string* str1, const string* str2, const size_t max_distance);
+
+// Same as 'editdistance_damerau_bounded()' for views.
+size_t editdistance_damerau_bounded_view     (const string_view view1, const string_view view2, const size_t max_distance);
+
+/* ======================================= */
+/* ============ Fuzzy search ============= */
+/* ======================================= */
+
+// Finds the strings within Levenshtein distance 'max_distance' of the query, and stores the 'limit' closest ones in 'matches',
+// by increasing distance, then increasing index. NULL entries, e.g. the empty slots of an 'array', are skipped.
+// Returns the number of matches stored.
+size_t editdistance_search         (const string* query, string* const* strings, const size_t count, const size_t max_distance,
+                                    editdistance_match* matches, const size_t limit);
+
+// Same as 'editdistance_search()' with the Damerau distance.
+size_t editdistance_search_damerau (const string* query, string* const* strings, const size_t count, const size_t max_distance,
+                                    editdistance_match* matches, const size_t limit);
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CEDITDISTANCE_ERRMSSG_NULL_STRING "Error: string is a null pointer."
+#define CEDITDISTANCE_ERRCODE_NULL_STRING -1
+
+#define CEDITDISTANCE_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CEDITDISTANCE_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // EDITDISTANCE_H
@@ -0,0 +1,500 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chashmap.h"
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+// Control bytes: negative values mark free slots, full slots hold the low 7 bits of the hash (0..127).
+#define CHASHMAP_CTRL_EMPTY   ((int8_t)-128)
+#define CHASHMAP_CTRL_DELETED ((int8_t)-2)
+
+#if defined(__SSE2__)
+    // One SSE2 register compares 16 control bytes; bit 'i' of a match mask belongs to slot 'i' of the group.
+    #define CHASHMAP_GROUP_WIDTH 16
+    #define CHASHMAP_MASK_SHIFT  0
+    typedef uint32_t hashmap_mask;
+#else
+    // Portable fallback: 8 control bytes in a 64-bit word, the match of slot 'i' is bit '8 * i + 7'.
+    #define CHASHMAP_GROUP_WIDTH 8
+    #define CHASHMAP_MASK_SHIFT  3
+    typedef uint64_t hashmap_mask;
+#endif
+
+struct _hashmap {
+    int8_t* ctrl;          // 'capacity + CHASHMAP_GROUP_WIDTH' control bytes, the tail mirrors the first group
+    string** keys;
+    unsigned char* values;
+
+    size_t capacity;       // 0 or a power of two, at least one group
+    size_t size;
+    size_t growth_left;    // insertions into empty slots left before the table has to grow
+    size_t value_size;
+    void (*value_destructor)(void*);
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void hashmap_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CHASHMAP_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void hashmap_check_null(const hashmap* map) {
+    if (!map) hashmap_error_handling(CHASHMAP_ERRMSSG_NULL_HASHMAP,
+                                     CHASHMAP_ERRCODE_NULL_HASHMAP);
+}
+
+// General warning handling function.
+static void hashmap_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CHASHMAP_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ======= Group operations ======= */
+/* ================================ */
+
+#if defined(__SSE2__)
+
+static inline hashmap_mask hashmap_group_match(const int8_t* ctrl, const int8_t h2) {
+    __m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+    return (hashmap_mask)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(h2)));
+}
+
+static inline hashmap_mask hashmap_group_match_empty(const int8_t* ctrl) {
+    return hashmap_group_match(ctrl, CHASHMAP_CTRL_EMPTY);
+}
+
+// Empty and deleted slots are exactly the ones with the sign bit set.
+static inline hashmap_mask hashmap_group_match_free(const int8_t* ctrl) {
+    return (hashmap_mask)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ctrl));
+}
+
+#else
+
+#define CHASHMAP_LSBS 0x0101010101010101ULL
+#define CHASHMAP_MSBS 0x8080808080808080ULL
+
+static inline uint64_t hashmap_group_load(const int8_t* ctrl) {
+    uint64_t group;
+    memcpy(&group, ctrl, sizeof(group));
+
+    #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        group = __builtin_bswap64(group);
+    #endif
+
+    return group;
+}
+
+// May report false positives above a true match; they are filtered out by the key comparison.
+static inline hashmap_mask hashmap_group_match(const int8_t* ctrl, const int8_t h2) {
+    uint64_t x = hashmap_group_load(ctrl) ^ (CHASHMAP_LSBS * (uint8_t)h2);
+    return (x - CHASHMAP_LSBS) & ~x & CHASHMAP_MSBS;
+}
+
+// Empty (0b10000000) is the only control byte with the sign bit set and bit 1 clear.
+static inline hashmap_mask hashmap_group_match_empty(const int8_t* ctrl) {
+    uint64_t group = hashmap_group_load(ctrl);
+    return group & ~(group << 6) & CHASHMAP_MSBS;
+}
+
+static inline hashmap_mask hashmap_group_match_free(const int8_t* ctrl) {
+    return hashmap_group_load(ctrl) & CHASHMAP_MSBS;
+}
+
+#endif
+
+// Returns the offset of the lowest match within the group.
+static inline size_t hashmap_mask_lowest(const hashmap_mask mask) {
+    return (size_t)__builtin_ctzll((unsigned long long)mask) >> CHASHMAP_MASK_SHIFT;
+}
+
+static inline hashmap_mask hashmap_mask_clear_lowest(const hashmap_mask mask) {
+    return mask & (mask - 1);
+}
+
+/* ================================ */
+/* ======= Slot bookkeeping ======= */
+/* ================================ */
+
+static inline size_t hashmap_h1(const uint64_t hash) {
+    return (size_t)(hash >> 7);
+}
+
+static inline int8_t hashmap_h2(const uint64_t hash) {
+    return (int8_t)(hash & 0x7F);
+}
+
+// Maximum number of keys (including deleted markers) at the given capacity: 7/8 of the slots.
+static inline size_t hashmap_max_load(const size_t capacity) {
+    return capacity - capacity / 8;
+}
+
+// Sets a control byte, keeping the mirrored copy after the end of the table in sync.
+static inline void hashmap_set_ctrl(hashmap* map, const size_t index, const int8_t value) {
+    map->ctrl[index] = value;
+    if (index < CHASHMAP_GROUP_WIDTH) map->ctrl[map->capacity + index] = value;
+}
+
+static inline unsigned char* hashmap_value(const hashmap* map, const size_t index) {
+    return map->values + index * map->value_size;
+}
+
+// Returns the index of the slot holding the key or 'capacity' if it is not present.
+static size_t hashmap_find_index(const hashmap* map, const char* data, const size_t length, const uint64_t hash) {
+    if (map->capacity == 0) return 0;
+
+    size_t mask = map->capacity - 1;
+    size_t position = hashmap_h1(hash) & mask;
+    int8_t h2 = hashmap_h2(hash);
+
+    for (size_t step = 0; ; ) {
+        const int8_t* group = map->ctrl + position;
+
+        for (hashmap_mask match = hashmap_group_match(group, h2); match; match = hashmap_mask_clear_lowest(match)) {
+            size_t index = (position + hashmap_mask_lowest(match)) & mask;
+            if (map->ctrl[index] != h2) continue; // filters the false positives of the SWAR match
+
+            const string* key = map->keys[index];
+
+            // The full cached hash rules out nearly every mismatch before the characters are compared.
+            if (string_get_hash(key) == hash && string_get_length(key) == length &&
+                memcmp(string_get_data(key), data, length) == 0) return index;
+        }
+
+        if (hashmap_group_match_empty(group)) return map->capacity;
+
+        step += CHASHMAP_GROUP_WIDTH;
+        position = (position + step) & mask;
+    }
+}
+
+// Returns the first empty or deleted slot on the probe sequence of 'hash'.
+static size_t hashmap_find_free(const hashmap* map, const uint64_t hash) {
+    size_t mask = map->capacity - 1;
+    size_t position = hashmap_h1(hash) & mask;
+
+    for (size_t step = 0; ; ) {
+        hashmap_mask free_slots = hashmap_group_match_free(map->ctrl + position);
+        if (free_slots) return (position + hashmap_mask_lowest(free_slots)) & mask;
+
+        step += CHASHMAP_GROUP_WIDTH;
+        position = (position + step) & mask;
+    }
+}
+
+// Replaces the storage by an empty table of 'capacity' slots and moves every entry over, reusing the cached hashes.
+static void hashmap_resize(hashmap* map, const size_t capacity) {
+    int8_t* old_ctrl = map->ctrl;
+    string** old_keys = map->keys;
+    unsigned char* old_values = map->values;
+    size_t old_capacity = map->capacity;
+
+    map->ctrl = malloc(capacity + CHASHMAP_GROUP_WIDTH);
+    map->keys = malloc(capacity * sizeof(string*));
+    map->values = malloc(capacity * map->value_size);
+
+    if (!map->ctrl || !map->keys || !map->values) {
+        hashmap_error_handling(CHASHMAP_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                               CHASHMAP_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    memset(map->ctrl, CHASHMAP_CTRL_EMPTY, capacity + CHASHMAP_GROUP_WIDTH);
+    map->capacity = capacity;
+
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_ctrl[i] < 0) continue;
+
+        uint64_t hash = string_get_hash(old_keys[i]);
+        size_t index = hashmap_find_free(map, hash);
+        hashmap_set_ctrl(map, index, hashmap_h2(hash));
+        map->keys[index] = old_keys[i];
+        memcpy(hashmap_value(map, index), old_values + i * map->value_size, map->value_size);
+    }
+
+    map->growth_left = hashmap_max_load(capacity) - map->size;
+
+    free(old_ctrl);
+    free(old_keys);
+    free(old_values);
+}
+
+// Smallest valid capacity holding 'count' keys.
+static size_t hashmap_capacity_for(const size_t count) {
+    size_t capacity = CHASHMAP_GROUP_WIDTH;
+    while (hashmap_max_load(capacity) < count) capacity *= 2;
+    return capacity;
+}
+
+// Called when no empty slot may be used anymore: rebuilds in place if deleted markers take up the room, grows otherwise.
+static void hashmap_make_room(hashmap* map) {
+    if (map->capacity == 0) {
+        hashmap_resize(map, CHASHMAP_GROUP_WIDTH);
+    } else if (map->size <= hashmap_max_load(map->capacity) / 2) {
+        hashmap_resize(map, map->capacity);
+    } else {
+        hashmap_resize(map, map->capacity * 2);
+    }
+}
+
+// Finds the slot of the key, claiming a free one if it is not present. 'inserted' tells which case happened.
+static size_t hashmap_claim(hashmap* map, const char* data, const size_t length, const uint64_t hash, const string* owned_key, bool* inserted) {
+    size_t index = hashmap_find_index(map, data, length, hash);
+
+    if (index < map->capacity) {
+        *inserted = false;
+        return index;
+    }
+
+    if (map->capacity == 0) hashmap_make_room(map);
+
+    index = hashmap_find_free(map, hash);
+
+    // Reusing a deleted slot does not use up any room, an empty one does.
+    if (map->ctrl[index] == CHASHMAP_CTRL_EMPTY && map->growth_left == 0) {
+        hashmap_make_room(map);
+        index = hashmap_find_free(map, hash);
+    }
+
+    if (map->ctrl[index] == CHASHMAP_CTRL_EMPTY) map->growth_left--;
+
+    hashmap_set_ctrl(map, index, hashmap_h2(hash));
+    map->keys[index] = owned_key ? string_copy(owned_key) : string_view_to_string(string_view_from_data(data, length));
+    memset(hashmap_value(map, index), 0, map->value_size);
+    map->size++;
+
+    *inserted = true;
+    return index;
+}
+
+static void hashmap_erase_index(hashmap* map, const size_t index, void* destination) {
+    if (destination) memcpy(destination, hashmap_value(map, index), map->value_size);
+    else if (map->value_destructor) map->value_destructor(hashmap_value(map, index));
+
+    delete_string(map->keys[index]);
+    map->keys[index] = NULL;
+
+    // Probe sequences may run through this slot: it stays marked until the next rebuild of the table.
+    hashmap_set_ctrl(map, index, CHASHMAP_CTRL_DELETED);
+    map->size--;
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of hash map. 'value_size' is the size of one value in bytes, e.g. 'sizeof(void*)'.
+// 'value_destructor' receives pointers to the value slots and can be NULL.
+hashmap* new_hashmap(const size_t value_size, void (*value_destructor)(void*)) {
+    if (value_size == 0) {
+        hashmap_warning_handling(CHASHMAP_WARNMSG_EMPTY_VALUE_SIZE);
+        return NULL;
+    }
+
+    hashmap* map = calloc(1, sizeof(hashmap));
+
+    if (!map) hashmap_error_handling(CHASHMAP_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                     CHASHMAP_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    map->value_size = value_size;
+    map->value_destructor = value_destructor;
+
+    return map;
+}
+
+// Destructor of hash map. Standardised template: void func_name(void* obj).
+void delete_hashmap(void* obj) {
+    if (obj) {
+        hashmap* map = (hashmap*)obj;
+        hashmap_mut_clean(map);
+        free(map->ctrl);
+        free(map->keys);
+        free(map->values);
+        free(map);
+        map = NULL;
+        obj = map;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored keys.
+size_t hashmap_get_size(const hashmap* map) {
+    hashmap_check_null(map);
+    return map->size;
+}
+
+// Getter of the number of slots.
+size_t hashmap_get_capacity(const hashmap* map) {
+    hashmap_check_null(map);
+    return map->capacity;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the map is empty.
+bool hashmap_isempty(const hashmap* map) {
+    hashmap_check_null(map);
+    return map->size == 0;
+}
+
+// Returns a pointer to the value stored under 'key' or NULL if there is none.
+void* hashmap_find(const hashmap* map, const string* key) {
+    hashmap_check_null(map);
+    size_t index = hashmap_find_index(map, string_get_data(key), string_get_length(key), string_get_hash(key));
+    return index < map->capacity ? hashmap_value(map, index) : NULL;
+}
+
+// Same as 'hashmap_find()' for a view key.
+void* hashmap_find_view(const hashmap* map, const string_view key) {
+    hashmap_check_null(map);
+    size_t index = hashmap_find_index(map, key.data, key.length, string_view_hash(key));
+    return index < map->capacity ? hashmap_value(map, index) : NULL;
+}
+
+// Checks whether 'key' is present in the map.
+bool hashmap_contains(const hashmap* map, const string* key) {
+    return hashmap_find(map, key) != NULL;
+}
+
+// Same as 'hashmap_contains()' for a view key.
+bool hashmap_contains_view(const hashmap* map, const string_view key) {
+    return hashmap_find_view(map, key) != NULL;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the value pointed to by 'value' under a copy of 'key' (bitwise, the map takes ownership). An existing value is overwritten.
+// Returns a pointer to the stored value.
+void* hashmap_insert(hashmap* map, const string* key, const void* value) {
+    hashmap_check_null(map);
+
+    bool inserted;
+    size_t index = hashmap_claim(map, string_get_data(key), string_get_length(key), string_get_hash(key), key, &inserted);
+    unsigned char* slot = hashmap_value(map, index);
+
+    if (!inserted && map->value_destructor) map->value_destructor(slot);
+    memcpy(slot, value, map->value_size);
+
+    return slot;
+}
+
+// Same as 'hashmap_insert()' for a view key.
+void* hashmap_insert_view(hashmap* map, const string_view key, const void* value) {
+    hashmap_check_null(map);
+
+    bool inserted;
+    size_t index = hashmap_claim(map, key.data, key.length, string_view_hash(key), NULL, &inserted);
+    unsigned char* slot = hashmap_value(map, index);
+
+    if (!inserted && map->value_destructor) map->value_destructor(slot);
+    memcpy(slot, value, map->value_size);
+
+    return slot;
+}
+
+// Returns the value slot of 'key', inserting a zeroed one first if the key is not present yet. Useful to construct values in place.
+void* hashmap_emplace(hashmap* map, const string_view key) {
+    hashmap_check_null(map);
+
+    bool inserted;
+    return hashmap_value(map, hashmap_claim(map, key.data, key.length, string_view_hash(key), NULL, &inserted));
+}
+
+// Moves the value of 'key' into 'destination' (or deletes it if 'destination' is NULL) and removes the key. Returns whether it was present.
+bool hashmap_remove(hashmap* map, const string* key, void* destination) {
+    hashmap_check_null(map);
+
+    size_t index = hashmap_find_index(map, string_get_data(key), string_get_length(key), string_get_hash(key));
+    if (index >= map->capacity) return false;
+
+    hashmap_erase_index(map, index, destination);
+    return true;
+}
+
+// Same as 'hashmap_remove()' for a view key.
+bool hashmap_remove_view(hashmap* map, const string_view key, void* destination) {
+    hashmap_check_null(map);
+
+    size_t index = hashmap_find_index(map, key.data, key.length, string_view_hash(key));
+    if (index >= map->capacity) return false;
+
+    hashmap_erase_index(map, index, destination);
+    return true;
+}
+
+// Iterates over the entries in no particular order. Start with '*position == 0'; returns false once there are no more entries.
+// The map must not be modified during the iteration.
+bool hashmap_iterate(const hashmap* map, size_t* position, const string** key, void** value) {
+    hashmap_check_null(map);
+
+    while (*position < map->capacity) {
+        size_t index = (*position)++;
+
+        if (map->ctrl[index] >= 0) {
+            if (key) *key = map->keys[index];
+            if (value) *value = hashmap_value(map, index);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Makes sure that 'count' keys fit without growing the table.
+void hashmap_reserve(hashmap* map, const size_t count) {
+    hashmap_check_null(map);
+    if (count > map->size + map->growth_left) hashmap_resize(map, hashmap_capacity_for(count));
+}
+
+// Rebuilds the table at the smallest capacity holding the current keys, discarding the markers left by removals.
+void hashmap_rehash(hashmap* map) {
+    hashmap_check_null(map);
+    if (map->capacity > 0) hashmap_resize(map, hashmap_capacity_for(map->size));
+}
+
+/* ====================================================== */
+/* ============ Mutative hash map manipulations ========= */
+/* ====================================================== */
+
+// Erases all the entries of the map, resulting in an empty one. The capacity is kept.
+void hashmap_mut_clean(hashmap* map) {
+    hashmap_check_null(map);
+
+    for (size_t i = 0; i < map->capacity; i++) {
+        if (map->ctrl[i] < 0) continue;
+
+        if (map->value_destructor) map->value_destructor(hashmap_value(map, i));
+        delete_string(map->keys[i]);
+    }
+
+    if (map->capacity > 0) memset(map->ctrl, CHASHMAP_CTRL_EMPTY, map->capacity + CHASHMAP_GROUP_WIDTH);
+
+    map->size = 0;
+    map->growth_left = map->capacity > 0 ? hashmap_max_load(map->capacity) : 0;
+}
@@ -0,0 +1,130 @@
+#ifndef HASHMAP_H
+#define HASHMAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cstring.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'hashmap' type maps 'string' keys to values of a fixed size, using open addressing in the style of Swiss tables:
+    - every slot has one control byte (empty, deleted, or the low 7 bits of the key's hash)
+    - lookups compare a whole group of control bytes at once (16 with SSE2, otherwise 8 by SWAR) and only touch keys whose bits match
+    - the table holds up to 7/8 of its capacity before growing
+The map owns copies of its keys; their cached hash is reused whenever the table is rehashed. Lookups never allocate and accept
+'string_view' keys as well. Values are stored inline ('value_size' bytes each) and follow the callback conventions of 'array'.
+Similar in nature to std::unordered_map<std::string, T> in C++ (or absl::flat_hash_map).
+*/
+
+// Type definition of 'hashmap' type.
+typedef struct _hashmap hashmap;
+
+// Alternative 'keyword' for type 'hashmap'.
+typedef hashmap HashMap;
+
+// Alternative 'keyword' for type 'hashmap'.
+typedef hashmap hashmap_t;
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of hash map. 'value_size' is the size of one value in bytes, e.g. 'sizeof(void*)'.
+// 'value_destructor' receives pointers to the value slots and can be NULL.
+hashmap* new_hashmap    (const size_t value_size, void (*value_destructor)(void*));
+
+// Destructor of hash map. Standardised template: void func_name(void* obj).
+void     delete_hashmap (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored keys.
+size_t hashmap_get_size     (const hashmap* map);
+
+// Getter of the number of slots.
+size_t hashmap_get_capacity (const hashmap* map);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the map is empty.
+bool  hashmap_isempty       (const hashmap* map);
+
+// Returns a pointer to the value stored under 'key' or NULL if there is none.
+void* hashmap_find          (const hashmap* map, const string* key);
+
+// Same as 'hashmap_find()' for a view key.
+void* hashmap_find_view     (const hashmap* map, const string_view key);
+
+// Checks whether 'key' is present in the map.
+bool  hashmap_contains      (const hashmap* map, const string* key);
+
+// Same as 'hashmap_contains()' for a view key.
+bool  hashmap_contains_view (const hashmap* map, const string_view key);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the value pointed to by 'value' under a copy of 'key' (bitwise, the map takes ownership). An existing value is overwritten.
+// Returns a pointer to the stored value.
+void* hashmap_insert      (hashmap* map, const string* key, const void* value);
+
+// Same as 'hashmap_insert()' for a view key.
+void* hashmap_insert_view (hashmap* map, const string_view key, const void* value);
+
+// Returns the value slot of 'key', inserting a zeroed one first if the key is not present yet. Useful to construct values in place.
+void* hashmap_emplace     (hashmap* map, const string_view key);
+
+// Moves the value of 'key' into 'destination' (or deletes it if 'destination' is NULL) and removes the key. Returns whether it was present.
+bool  hashmap_remove      (hashmap* map, const string* key, void* destination);
+
+// Same as 'hashmap_remove()' for a view key.
+bool  hashmap_remove_view (hashmap* map, const string_view key, void* destination);
+
+// Iterates over the entries in no particular order. Start with '*position == 0'; returns false once there are no more entries.
+// The map must not be modified during the iteration.
+bool  hashmap_iterate     (const hashmap* map, size_t* position, const string** key, void** value);
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Makes sure that 'count' keys fit without growing the table.
+void hashmap_reserve (hashmap* map, const size_t count);
+
+// Rebuilds the table at the smallest capacity holding the current keys, discarding the markers left by removals.
+void hashmap_rehash  (hashmap* map);
+
+/* ====================================================== */
+/* ============ Mutative hash map manipulations ========= */
+/* ====================================================== */
+
+// Erases all the entries of the map, resulting in an empty one. The capacity is kept.
+void hashmap_mut_clean (hashmap* map);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CHASHMAP_WARNMSG_EMPTY_VALUE_SIZE "Warning: value size cannot be 0."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CHASHMAP_ERRMSSG_NULL_HASHMAP "Error: hash map is a null pointer."
+#define CHASHMAP_ERRCODE_NULL_HASHMAP -1
+
+#define CHASHMAP_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CHASHMAP_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // HASHMAP_H
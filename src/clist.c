@@ -0,0 +1,659 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "clist.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+typedef struct _list_node {
+    struct _list_node* prev;
+    struct _list_node* next; // also links the nodes of the free list
+    size_t count;            // the elements occupy the slots [0, count)
+    max_align_t data[];
+} list_node;
+
+struct _list {
+    list_node* head;
+    list_node* tail;
+    list_node* pool;         // free list of unused nodes
+    size_t pooled;
+
+    size_t size;
+    size_t node_capacity;
+    size_t element_size;
+    void (*destructor)(void*);
+    bool (*equality)(const void*, const void*);
+    void (*copy)(void*, const void*);
+};
+
+// Smallest number of elements per node picked by the constructor.
+#define CLIST_MINIMUM_NODE_CAPACITY 4
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define CLIST_PREFETCH(address) __builtin_prefetch(address)
+#else
+    #define CLIST_PREFETCH(address) ((void)(address))
+#endif
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void list_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CLIST_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void list_check_null(const list* lst) {
+    if (!lst) list_error_handling(CLIST_ERRMSSG_NULL_LIST,
+                                  CLIST_ERRCODE_NULL_LIST);
+}
+
+static void list_check_index(const list* lst, const size_t index, const size_t limit) {
+    if (index >= limit) {
+        delete_list((list*)lst);
+        list_error_handling(CLIST_ERRMSSG_INDEX_OUT_OF_BOUNDS,
+                            CLIST_ERRCODE_INDEX_OUT_OF_BOUNDS);
+    }
+}
+
+// General warning handling function.
+static void list_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CLIST_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ======== Node management ======= */
+/* ================================ */
+
+// Returns the address of the slot at 'index' of the node.
+static inline unsigned char* list_slot(const list* lst, const list_node* node, const size_t index) {
+    return (unsigned char*)node->data + index * lst->element_size;
+}
+
+static list_node* list_allocate_node(const list* lst) {
+    list_node* node = malloc(sizeof(list_node) + lst->node_capacity * lst->element_size);
+
+    if (!node) list_error_handling(CLIST_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                   CLIST_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    return node;
+}
+
+// Takes a node from the free list, or allocates one if the free list is empty.
+static list_node* list_acquire_node(list* lst) {
+    list_node* node = lst->pool;
+
+    if (node) {
+        lst->pool = node->next;
+        lst->pooled--;
+    } else {
+        node = list_allocate_node(lst);
+    }
+
+    node->prev = node->next = NULL;
+    node->count = 0;
+    return node;
+}
+
+// Puts an unlinked node on the free list.
+static void list_release_node(list* lst, list_node* node) {
+    node->next = lst->pool;
+    lst->pool = node;
+    lst->pooled++;
+}
+
+// Links 'node' right after 'after', or to the front of the list if 'after' is NULL.
+static void list_link_after(list* lst, list_node* node, list_node* after) {
+    node->prev = after;
+    node->next = after ? after->next : lst->head;
+
+    if (node->next) node->next->prev = node;
+    else lst->tail = node;
+
+    if (after) after->next = node;
+    else lst->head = node;
+}
+
+static void list_unlink(list* lst, list_node* node) {
+    if (node->prev) node->prev->next = node->next;
+    else lst->head = node->next;
+
+    if (node->next) node->next->prev = node->prev;
+    else lst->tail = node->prev;
+}
+
+// Finds the node holding the element at 'index' (which must be smaller than the size) and its offset within the node.
+static list_node* list_locate(const list* lst, size_t index, size_t* offset) {
+    list_node* node;
+
+    if (index < lst->size / 2) {
+        for (node = lst->head; index >= node->count; node = node->next) index -= node->count;
+    } else {
+        size_t remaining = lst->size - index; // position counted from the back, at least 1
+        for (node = lst->tail; remaining > node->count; node = node->prev) remaining -= node->count;
+        index = node->count - remaining;
+    }
+
+    *offset = index;
+    return node;
+}
+
+// Moves the elements [offset, count) of 'node' into a new node linked right after it.
+static list_node* list_split(list* lst, list_node* node, const size_t offset) {
+    list_node* tail = list_acquire_node(lst);
+
+    tail->count = node->count - offset;
+    memcpy(list_slot(lst, tail, 0), list_slot(lst, node, offset), tail->count * lst->element_size);
+    node->count = offset;
+    list_link_after(lst, tail, node);
+
+    return tail;
+}
+
+// Returns the node after which new nodes go to end up at 'index' (NULL for the front), splitting the node 'index' falls into.
+static list_node* list_prepare_gap(list* lst, const size_t index) {
+    if (index == lst->size) return lst->tail;
+    if (index == 0) return NULL;
+
+    size_t offset;
+    list_node* node = list_locate(lst, index, &offset);
+    if (offset == 0) return node->prev;
+
+    list_split(lst, node, offset);
+    return node;
+}
+
+// Keeps the nodes at least half full: merges an underfull node with a neighbour whenever the two fit into one,
+// and otherwise evens the two out, the neighbour then holding more than half a node.
+static void list_rebalance(list* lst, list_node* node) {
+    if (node->count == 0) {
+        list_unlink(lst, node);
+        list_release_node(lst, node);
+        return;
+    }
+
+    if (node->count >= lst->node_capacity / 2) return;
+
+    if (node->next && node->count + node->next->count <= lst->node_capacity) {
+        list_node* next = node->next;
+        memcpy(list_slot(lst, node, node->count), list_slot(lst, next, 0), next->count * lst->element_size);
+        node->count += next->count;
+        list_unlink(lst, next);
+        list_release_node(lst, next);
+    } else if (node->prev && node->prev->count + node->count <= lst->node_capacity) {
+        list_node* prev = node->prev;
+        memcpy(list_slot(lst, prev, prev->count), list_slot(lst, node, 0), node->count * lst->element_size);
+        prev->count += node->count;
+        list_unlink(lst, node);
+        list_release_node(lst, node);
+    } else if (node->next) {
+        list_node* next = node->next;
+        size_t moved = (node->count + next->count) / 2 - node->count;
+        memcpy(list_slot(lst, node, node->count), list_slot(lst, next, 0), moved * lst->element_size);
+        memmove(list_slot(lst, next, 0), list_slot(lst, next, moved), (next->count - moved) * lst->element_size);
+        node->count += moved;
+        next->count -= moved;
+    } else if (node->prev) {
+        list_node* prev = node->prev;
+        size_t moved = (prev->count + node->count) / 2 - node->count;
+        memmove(list_slot(lst, node, moved), list_slot(lst, node, 0), node->count * lst->element_size);
+        memcpy(list_slot(lst, node, 0), list_slot(lst, prev, prev->count - moved), moved * lst->element_size);
+        node->count += moved;
+        prev->count -= moved;
+    }
+}
+
+// Moves the element at 'offset' of 'node' out of the list, into 'destination' or through the destructor.
+static void list_take(list* lst, list_node* node, const size_t offset, void* destination) {
+    unsigned char* slot = list_slot(lst, node, offset);
+
+    if (destination) memcpy(destination, slot, lst->element_size);
+    else if (lst->destructor) lst->destructor(slot);
+
+    memmove(slot, slot + lst->element_size, (node->count - offset - 1) * lst->element_size);
+    node->count--;
+    lst->size--;
+
+    list_rebalance(lst, node);
+}
+
+static bool list_arecompatible(const list* lst1, const list* lst2) {
+    return lst1->element_size == lst2->element_size && lst1->node_capacity == lst2->node_capacity &&
+           lst1->destructor == lst2->destructor && lst1->equality == lst2->equality && lst1->copy == lst2->copy;
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of list. 'node_capacity' is the number of elements per node; 0 fits the nodes into 'CLIST_DEFAULT_NODE_BYTES'.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+list* new_list(const size_t node_capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*)) {
+    if (element_size == 0) {
+        list_warning_handling(CLIST_WARNMSG_EMPTY_ELEMENT_SIZE);
+        return NULL;
+    }
+
+    list* lst = calloc(1, sizeof(list));
+
+    if (!lst) list_error_handling(CLIST_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                  CLIST_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    lst->node_capacity = node_capacity;
+    if (lst->node_capacity == 0) {
+        size_t fitting = (CLIST_DEFAULT_NODE_BYTES - sizeof(list_node)) / element_size;
+        lst->node_capacity = fitting > CLIST_MINIMUM_NODE_CAPACITY ? fitting : CLIST_MINIMUM_NODE_CAPACITY;
+    }
+
+    if (lst->node_capacity > (SIZE_MAX - sizeof(list_node)) / element_size) {
+        list_error_handling(CLIST_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                            CLIST_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    lst->element_size = element_size;
+    lst->destructor = destructor;
+    lst->equality = equality;
+    lst->copy = copy;
+
+    return lst;
+}
+
+// Destructor of list. Standardised template: void func_name(void* obj).
+void delete_list(void* obj) {
+    if (obj) {
+        list* lst = (list*)obj;
+        list_mut_clean(lst);
+        list_release_pool(lst);
+        free(lst);
+        lst = NULL;
+        obj = lst;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t list_get_size(const list* lst) {
+    list_check_null(lst);
+    return lst->size;
+}
+
+// Getter of the size of one element in bytes.
+size_t list_get_element_size(const list* lst) {
+    list_check_null(lst);
+    return lst->element_size;
+}
+
+// Getter of the number of elements one node holds.
+size_t list_get_node_capacity(const list* lst) {
+    list_check_null(lst);
+    return lst->node_capacity;
+}
+
+// Getter of the number of nodes kept on the free list for reuse.
+size_t list_get_pooled_nodes(const list* lst) {
+    list_check_null(lst);
+    return lst->pooled;
+}
+
+// Returns a pointer to the element at the specified index. Walks from the closer end of the list.
+void* list_get_item_at(const list* lst, const size_t index) {
+    list_check_null(lst);
+    list_check_index(lst, index, lst->size);
+
+    size_t offset;
+    list_node* node = list_locate(lst, index, &offset);
+    return list_slot(lst, node, offset);
+}
+
+// Returns a pointer to the first element or NULL if the list is empty.
+void* list_get_front(const list* lst) {
+    list_check_null(lst);
+    return lst->head ? list_slot(lst, lst->head, 0) : NULL;
+}
+
+// Returns a pointer to the last element or NULL if the list is empty.
+void* list_get_back(const list* lst) {
+    list_check_null(lst);
+    return lst->tail ? list_slot(lst, lst->tail, lst->tail->count - 1) : NULL;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the list is empty.
+bool list_isempty(const list* lst) {
+    list_check_null(lst);
+    return lst->size == 0;
+}
+
+// Checks whether the contents of the two lists are identical. The order of elements matters.
+bool list_areequal(const list* lst1, const list* lst2) {
+    list_check_null(lst1);
+    list_check_null(lst2);
+
+    if (lst1->element_size != lst2->element_size ||
+        lst1->destructor != lst2->destructor ||
+        lst1->equality != lst2->equality ||
+        lst1->size != lst2->size) return false;
+
+    // The nodes of the two lists may be filled differently, so the elements are compared one by one.
+    list_iterator it1 = list_begin(lst1), it2 = list_begin(lst2);
+
+    for (void* element1; (element1 = list_next(&it1)); ) {
+        void* element2 = list_next(&it2);
+
+        if (lst1->equality ? !lst1->equality(element1, element2)
+                           : memcmp(element1, element2, lst1->element_size) != 0) return false;
+    }
+
+    return true;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' to the front of the list (bitwise, the list takes ownership).
+void list_push_front(list* lst, const void* obj) {
+    list_check_null(lst);
+
+    if (!lst->head || lst->head->count == lst->node_capacity) list_link_after(lst, list_acquire_node(lst), NULL);
+
+    list_node* head = lst->head;
+    memmove(list_slot(lst, head, 1), list_slot(lst, head, 0), head->count * lst->element_size);
+    memcpy(list_slot(lst, head, 0), obj, lst->element_size);
+    head->count++;
+    lst->size++;
+}
+
+// Moves the element pointed to by 'obj' to the back of the list (bitwise, the list takes ownership).
+void list_push_back(list* lst, const void* obj) {
+    list_check_null(lst);
+
+    if (!lst->tail || lst->tail->count == lst->node_capacity) list_link_after(lst, list_acquire_node(lst), lst->tail);
+
+    memcpy(list_slot(lst, lst->tail, lst->tail->count++), obj, lst->element_size);
+    lst->size++;
+}
+
+// Moves the first element into 'destination' and removes it. Returns 'destination' or NULL if the list was empty.
+void* list_pop_front(list* lst, void* destination) {
+    list_check_null(lst);
+    if (!lst->head) return NULL;
+
+    list_take(lst, lst->head, 0, destination);
+    return destination;
+}
+
+// Moves the last element into 'destination' and removes it. Returns 'destination' or NULL if the list was empty.
+void* list_pop_back(list* lst, void* destination) {
+    list_check_null(lst);
+    if (!lst->tail) return NULL;
+
+    list_take(lst, lst->tail, lst->tail->count - 1, destination);
+    return destination;
+}
+
+// Moves the element pointed to by 'obj' to 'index', shifting the following elements one position towards the back.
+void list_insert_item_to(list* lst, const size_t index, const void* obj) {
+    list_check_null(lst);
+    list_check_index(lst, index, lst->size + 1);
+
+    if (index == lst->size) {
+        list_push_back(lst, obj);
+        return;
+    }
+
+    size_t offset;
+    list_node* node = list_locate(lst, index, &offset);
+
+    // A full node is split in half, which leaves room in both halves for the following insertions.
+    if (node->count == lst->node_capacity) {
+        list_node* tail = list_split(lst, node, node->count / 2);
+
+        if (offset > node->count) {
+            offset -= node->count;
+            node = tail;
+        }
+    }
+
+    unsigned char* slot = list_slot(lst, node, offset);
+    memmove(slot + lst->element_size, slot, (node->count - offset) * lst->element_size);
+    memcpy(slot, obj, lst->element_size);
+    node->count++;
+    lst->size++;
+}
+
+// Moves 'count' contiguous elements starting at 'elements' to 'index'. The new elements fill whole nodes.
+void list_insert_range(list* lst, const size_t index, const void* elements, const size_t count) {
+    list_check_null(lst);
+    list_check_index(lst, index, lst->size + 1);
+    if (count == 0) return;
+
+    const unsigned char* source = elements;
+    size_t remaining = count;
+    list_node* after = list_prepare_gap(lst, index);
+
+    // The new elements follow the last element of 'after', so its free room is used first.
+    if (after && after->count < lst->node_capacity) {
+        size_t fitting = lst->node_capacity - after->count;
+        if (fitting > remaining) fitting = remaining;
+
+        memcpy(list_slot(lst, after, after->count), source, fitting * lst->element_size);
+        after->count += fitting;
+        source += fitting * lst->element_size;
+        remaining -= fitting;
+    }
+
+    while (remaining > 0) {
+        list_node* node = list_acquire_node(lst);
+        node->count = remaining < lst->node_capacity ? remaining : lst->node_capacity;
+
+        memcpy(list_slot(lst, node, 0), source, node->count * lst->element_size);
+        list_link_after(lst, node, after);
+
+        source += node->count * lst->element_size;
+        remaining -= node->count;
+        after = node;
+    }
+
+    lst->size += count;
+}
+
+// Moves the element at 'index' into 'destination' and closes the gap. If 'destination' is NULL, the element is deleted instead.
+void list_remove_item_at(list* lst, const size_t index, void* destination) {
+    list_check_null(lst);
+    list_check_index(lst, index, lst->size);
+
+    size_t offset;
+    list_node* node = list_locate(lst, index, &offset);
+    list_take(lst, node, offset, destination);
+}
+
+// Creates a copy of the object at the specified 'index' in 'destination'. Returns 'destination'.
+void* list_copy_item_from(const list* lst, const size_t index, void* destination) {
+    void* slot = list_get_item_at(lst, index);
+
+    if (lst->copy) lst->copy(destination, slot);
+    else memcpy(destination, slot, lst->element_size);
+
+    return destination;
+}
+
+/* ======================================= */
+/* ============== Iteration ============== */
+/* ======================================= */
+
+// Returns an iterator positioned at the first element.
+list_iterator list_begin(const list* lst) {
+    list_check_null(lst);
+    return (list_iterator){ lst, lst->head, 0 };
+}
+
+// Returns a pointer to the element at the position of the iterator and advances it, or NULL at the end of the list.
+void* list_next(list_iterator* iterator) {
+    list_node* node = iterator->node;
+    if (!node) return NULL;
+
+    // Entering a node: start loading the next one while this one is processed.
+    if (iterator->offset == 0) CLIST_PREFETCH(node->next);
+
+    void* element = list_slot(iterator->owner, node, iterator->offset);
+
+    if (++iterator->offset == node->count) {
+        iterator->node = node->next;
+        iterator->offset = 0;
+    }
+
+    return element;
+}
+
+// Calls 'function(element, context)' on every element from front to back.
+void list_for_each(list* lst, void (*function)(void*, void*), void* context) {
+    list_check_null(lst);
+
+    for (list_node* node = lst->head; node; node = node->next) {
+        CLIST_PREFETCH(node->next);
+        for (size_t i = 0; i < node->count; i++) function(list_slot(lst, node, i), context);
+    }
+}
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Fills the free list so that 'count' more elements can be inserted without allocation.
+void list_reserve(list* lst, const size_t count) {
+    list_check_null(lst);
+
+    size_t nodes = count / lst->node_capacity + (count % lst->node_capacity != 0);
+    while (lst->pooled < nodes) list_release_node(lst, list_allocate_node(lst));
+}
+
+// Releases the nodes kept on the free list.
+void list_release_pool(list* lst) {
+    list_check_null(lst);
+
+    while (lst->pool) {
+        list_node* node = lst->pool;
+        lst->pool = node->next;
+        free(node);
+    }
+
+    lst->pooled = 0;
+}
+
+/* ====================================================== */
+/* ============ Immutative list manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'lst'. The copy has densely packed nodes.
+list* list_copy(const list* lst) {
+    list_check_null(lst);
+
+    list* copy = new_list(lst->node_capacity, lst->element_size, lst->destructor, lst->equality, lst->copy);
+    list_iterator it = list_begin(lst);
+
+    for (void* element; (element = list_next(&it)); ) {
+        if (!copy->tail || copy->tail->count == copy->node_capacity) list_link_after(copy, list_acquire_node(copy), copy->tail);
+
+        unsigned char* slot = list_slot(copy, copy->tail, copy->tail->count++);
+        if (lst->copy) lst->copy(slot, element);
+        else memcpy(slot, element, lst->element_size);
+    }
+
+    copy->size = lst->size;
+    return copy;
+}
+
+/* ====================================================== */
+/* ============= Mutative list manipulations ============ */
+/* ====================================================== */
+
+// Erases all the elements of the list, resulting in an empty one. The nodes go to the free list.
+void list_mut_clean(list* lst) {
+    list_check_null(lst);
+
+    while (lst->head) {
+        list_node* node = lst->head;
+        lst->head = node->next;
+
+        if (lst->destructor) {
+            for (size_t i = 0; i < node->count; i++) lst->destructor(list_slot(lst, node, i));
+        }
+
+        list_release_node(lst, node);
+    }
+
+    lst->tail = NULL;
+    lst->size = 0;
+}
+
+// Moves every element of 'source' to 'index' of 'destination' by relinking the nodes, leaving 'source' empty.
+void list_splice(list* destination, const size_t index, list* source) {
+    list_check_null(destination);
+    list_check_null(source);
+    list_check_index(destination, index, destination->size + 1);
+
+    if (!list_arecompatible(destination, source)) {
+        list_warning_handling(CLIST_WARNMSG_INCOMPATIBLE);
+        return;
+    }
+
+    if (destination == source || !source->head) return;
+
+    list_node* after = list_prepare_gap(destination, index);
+    list_node* before = after ? after->next : destination->head;
+    list_node* first = source->head;
+    list_node* last = source->tail;
+
+    first->prev = after;
+    last->next = before;
+
+    if (after) after->next = first;
+    else destination->head = first;
+
+    if (before) before->prev = last;
+    else destination->tail = last;
+
+    destination->size += source->size;
+    source->head = source->tail = NULL;
+    source->size = 0;
+
+    // The halves of a split node and the end nodes of 'source' may be underfull. Going from right to left, a rebalanced node
+    // only ever releases itself or its successor, so the nodes still to be visited stay valid.
+    if (before) list_rebalance(destination, before);
+    list_rebalance(destination, last);
+    if (first != last) list_rebalance(destination, first);
+    if (after) list_rebalance(destination, after);
+}
+
+// Swaps the contents of two lists in O(1).
+void list_mut_swap(list* lst1, list* lst2) {
+    list_check_null(lst1);
+    list_check_null(lst2);
+
+    if (lst1->element_size != lst2->element_size || lst1->destructor != lst2->destructor ||
+        lst1->equality != lst2->equality || lst1->copy != lst2->copy) {
+        list_warning_handling(CLIST_WARNMSG_INCOMPATIBLE);
+        return;
+    }
+
+    list buffer = *lst1;
+    *lst1 = *lst2;
+    *lst2 = buffer;
+}
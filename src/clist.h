@@ -0,0 +1,182 @@
+#ifndef LIST_H
+#define LIST_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'list' type is a doubly linked list of elements, unrolled for the sake of the cache: every node stores a fixed-size block of
+elements by value instead of a single one. Therefore, it has the following characteristics:
+    - inserting and removing at both ends takes O(1) time, in the middle O(n / B) to find the node and O(B) to shift inside it
+    - splicing a whole list into another one takes O(B) time: at most one node is split, and only the nodes next to the two
+      junctions are merged or evened out, so that every node stays at least half full
+    - walking the list touches 'size / B' nodes, and the iterator prefetches the next node while the current one is processed
+    - unused nodes are kept on a per-list free list and reused, so a list that shrinks and grows again does not hit 'malloc()'
+Similar in nature to std::list in C++, or plf::colony / unrolled lists in spirit.
+
+The callback functions follow the conventions of 'array': they receive pointers to the element slots.
+Inserting or removing elements may move the other elements of the same node, so pointers into the list are only valid until then.
+*/
+
+// Type definition of 'list' type.
+typedef struct _list list;
+
+// Alternative 'keyword' for type 'list'.
+typedef list List;
+
+// Alternative 'keyword' for type 'list'.
+typedef list list_t;
+
+// Position of a walk over the list. Obtain one by 'list_begin()', then call 'list_next()' until it returns NULL.
+typedef struct {
+    const list* owner;
+    struct _list_node* node;
+    size_t offset;
+} list_iterator;
+
+// Approximate size of one node in bytes when the constructor picks the number of elements per node.
+#define CLIST_DEFAULT_NODE_BYTES 256
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of list. 'node_capacity' is the number of elements per node; 0 fits the nodes into 'CLIST_DEFAULT_NODE_BYTES'.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+list* new_list    (const size_t node_capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*));
+
+// Destructor of list. Standardised template: void func_name(void* obj).
+void  delete_list (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t list_get_size          (const list* lst);
+
+// Getter of the size of one element in bytes.
+size_t list_get_element_size  (const list* lst);
+
+// Getter of the number of elements one node holds.
+size_t list_get_node_capacity (const list* lst);
+
+// Getter of the number of nodes kept on the free list for reuse.
+size_t list_get_pooled_nodes  (const list* lst);
+
+// Returns a pointer to the element at the specified index. Walks from the closer end of the list.
+void*  list_get_item_at       (const list* lst, const size_t index);
+
+// Returns a pointer to the first element or NULL if the list is empty.
+void*  list_get_front         (const list* lst);
+
+// Returns a pointer to the last element or NULL if the list is empty.
+void*  list_get_back          (const list* lst);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the list is empty.
+bool list_isempty  (const list* lst);
+
+// Checks whether the contents of the two lists are identical. The order of elements matters.
+bool list_areequal (const list* lst1, const list* lst2);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' to the front of the list (bitwise, the list takes ownership).
+void  list_push_front     (list* lst, const void* obj);
+
+// Moves the element pointed to by 'obj' to the back of the list (bitwise, the list takes ownership).
+void  list_push_back      (list* lst, const void* obj);
+
+// Moves the first element into 'destination' and removes it. Returns 'destination' or NULL if the list was empty.
+void* list_pop_front      (list* lst, void* destination);
+
+// Moves the last element into 'destination' and removes it. Returns 'destination' or NULL if the list was empty.
+void* list_pop_back       (list* lst, void* destination);
+
+// Moves the element pointed to by 'obj' to 'index', shifting the following elements one position towards the back.
+void  list_insert_item_to (list* lst, const size_t index, const void* obj);
+
+// Moves 'count' contiguous elements starting at 'elements' to 'index'. The new elements fill whole nodes.
+void  list_insert_range   (list* lst, const size_t index, const void* elements, const size_t count);
+
+// Moves the element at 'index' into 'destination' and closes the gap. If 'destination' is NULL, the element is deleted instead.
+void  list_remove_item_at (list* lst, const size_t index, void* destination);
+
+// Creates a copy of the object at the specified 'index' in 'destination'. Returns 'destination'.
+void* list_copy_item_from (const list* lst, const size_t index, void* destination);
+
+/* ======================================= */
+/* ============== Iteration ============== */
+/* ======================================= */
+
+// Returns an iterator positioned at the first element.
+list_iterator list_begin (const list* lst);
+
+// Returns a pointer to the element at the position of the iterator and advances it, or NULL at the end of the list.
+void*         list_next  (list_iterator* iterator);
+
+// Calls 'function(element, context)' on every element from front to back.
+void          list_for_each (list* lst, void (*function)(void*, void*), void* context);
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Fills the free list so that 'count' more elements can be inserted without allocation.
+void list_reserve      (list* lst, const size_t count);
+
+// Releases the nodes kept on the free list.
+void list_release_pool (list* lst);
+
+/* ====================================================== */
+/* ============ Immutative list manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'lst'. The copy has densely packed nodes.
+list* list_copy (const list* lst);
+
+/* ====================================================== */
+/* ============= Mutative list manipulations ============ */
+/* ====================================================== */
+
+// Erases all the elements of the list, resulting in an empty one. The nodes go to the free list.
+void list_mut_clean (list* lst);
+
+// Moves every element of 'source' to 'index' of 'destination' by relinking the nodes, leaving 'source' empty.
+// The lists must have the same element size, node capacity and callbacks.
+void list_splice    (list* destination, const size_t index, list* source);
+
+// Swaps the contents of two lists in O(1).
+void list_mut_swap  (list* lst1, list* lst2);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CLIST_WARNMSG_EMPTY_ELEMENT_SIZE "Warning: element size cannot be 0."
+#define CLIST_WARNMSG_INCOMPATIBLE       "Warning: lists of different element size, node capacity or callbacks cannot be combined. No changes have been made."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CLIST_ERRMSSG_NULL_LIST "Error: list is a null pointer."
+#define CLIST_ERRCODE_NULL_LIST -1
+
+#define CLIST_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CLIST_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CLIST_ERRMSSG_INDEX_OUT_OF_BOUNDS "Error: index out of bounds."
+#define CLIST_ERRCODE_INDEX_OUT_OF_BOUNDS -3
+
+#endif // LIST_H
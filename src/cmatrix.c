@@ -0,0 +1,604 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cmatrix.h"
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+struct _matrix {
+    double* data;
+    size_t depth;
+    size_t rows;
+    size_t columns;
+    size_t size;
+    size_t tile_size;
+};
+
+// Edge length below which the recursive transposition copies the block directly.
+#define CMATRIX_TRANSPOSE_BLOCK 16
+
+// Rows of the destination computed together by the multiplication kernel, sharing every load of the right operand.
+#define CMATRIX_KERNEL_ROWS 4
+
+/* ================================ */
+/* ======== SIMD primitives ======= */
+/* ================================ */
+
+#if defined(__AVX__)
+
+#define CMATRIX_LANES 4
+typedef __m256d matrix_vector;
+
+static inline matrix_vector matrix_vector_load(const double* source)                    { return _mm256_loadu_pd(source); }
+static inline void          matrix_vector_store(double* destination, matrix_vector v)   { _mm256_storeu_pd(destination, v); }
+static inline matrix_vector matrix_vector_broadcast(const double value)                 { return _mm256_set1_pd(value); }
+static inline matrix_vector matrix_vector_add(matrix_vector a, matrix_vector b)         { return _mm256_add_pd(a, b); }
+static inline matrix_vector matrix_vector_subtract(matrix_vector a, matrix_vector b)    { return _mm256_sub_pd(a, b); }
+static inline matrix_vector matrix_vector_multiply(matrix_vector a, matrix_vector b)    { return _mm256_mul_pd(a, b); }
+static inline matrix_vector matrix_vector_min(matrix_vector a, matrix_vector b)         { return _mm256_min_pd(a, b); }
+static inline matrix_vector matrix_vector_max(matrix_vector a, matrix_vector b)         { return _mm256_max_pd(a, b); }
+
+#if defined(__FMA__)
+static inline matrix_vector matrix_vector_madd(matrix_vector a, matrix_vector b, matrix_vector c) { return _mm256_fmadd_pd(a, b, c); }
+#else
+static inline matrix_vector matrix_vector_madd(matrix_vector a, matrix_vector b, matrix_vector c) { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+#endif
+
+#elif defined(__SSE2__)
+
+#define CMATRIX_LANES 2
+typedef __m128d matrix_vector;
+
+static inline matrix_vector matrix_vector_load(const double* source)                    { return _mm_loadu_pd(source); }
+static inline void          matrix_vector_store(double* destination, matrix_vector v)   { _mm_storeu_pd(destination, v); }
+static inline matrix_vector matrix_vector_broadcast(const double value)                 { return _mm_set1_pd(value); }
+static inline matrix_vector matrix_vector_add(matrix_vector a, matrix_vector b)         { return _mm_add_pd(a, b); }
+static inline matrix_vector matrix_vector_subtract(matrix_vector a, matrix_vector b)    { return _mm_sub_pd(a, b); }
+static inline matrix_vector matrix_vector_multiply(matrix_vector a, matrix_vector b)    { return _mm_mul_pd(a, b); }
+static inline matrix_vector matrix_vector_min(matrix_vector a, matrix_vector b)         { return _mm_min_pd(a, b); }
+static inline matrix_vector matrix_vector_max(matrix_vector a, matrix_vector b)         { return _mm_max_pd(a, b); }
+static inline matrix_vector matrix_vector_madd(matrix_vector a, matrix_vector b, matrix_vector c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+
+#else
+
+// Portable fallback: one lane, left to the auto-vectoriser of the compiler.
+#define CMATRIX_LANES 1
+typedef double matrix_vector;
+
+static inline matrix_vector matrix_vector_load(const double* source)                    { return *source; }
+static inline void          matrix_vector_store(double* destination, matrix_vector v)   { *destination = v; }
+static inline matrix_vector matrix_vector_broadcast(const double value)                 { return value; }
+static inline matrix_vector matrix_vector_add(matrix_vector a, matrix_vector b)         { return a + b; }
+static inline matrix_vector matrix_vector_subtract(matrix_vector a, matrix_vector b)    { return a - b; }
+static inline matrix_vector matrix_vector_multiply(matrix_vector a, matrix_vector b)    { return a * b; }
+static inline matrix_vector matrix_vector_min(matrix_vector a, matrix_vector b)         { return b < a ? b : a; }
+static inline matrix_vector matrix_vector_max(matrix_vector a, matrix_vector b)         { return b > a ? b : a; }
+static inline matrix_vector matrix_vector_madd(matrix_vector a, matrix_vector b, matrix_vector c) { return a * b + c; }
+
+#endif
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void matrix_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CMATRIX_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void matrix_check_null(const matrix* mat) {
+    if (!mat) matrix_error_handling(CMATRIX_ERRMSSG_NULL_MATRIX,
+                                    CMATRIX_ERRCODE_NULL_MATRIX);
+}
+
+static void matrix_check_index(const matrix* mat, const size_t layer, const size_t row, const size_t column) {
+    if (mat->depth <= layer || mat->rows <= row || mat->columns <= column) {
+        delete_matrix((matrix*)mat);
+        matrix_error_handling(CMATRIX_ERRMSSG_INDEX_OUT_OF_BOUNDS,
+                              CMATRIX_ERRCODE_INDEX_OUT_OF_BOUNDS);
+    }
+}
+
+// General warning handling function.
+static void matrix_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CMATRIX_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+// Checks that every operand has the shape of 'destination', warning otherwise.
+static bool matrix_check_shapes(const matrix* destination, const matrix* mat1, const matrix* mat2) {
+    matrix_check_null(destination);
+    matrix_check_null(mat1);
+    if (mat2) matrix_check_null(mat2);
+
+    if (!matrix_haveequalshape(destination, mat1) || (mat2 && !matrix_haveequalshape(destination, mat2))) {
+        matrix_warning_handling(CMATRIX_WARNMSG_SHAPE_MISMATCH);
+        return false;
+    }
+
+    return true;
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of 2D matrix. Every element is initialised to 0.
+matrix* new_matrix(const size_t rows, const size_t columns) {
+    return new_matrix_3d(1, rows, columns);
+}
+
+// Constructor of 3D matrix: 'depth' layers of 'rows' x 'columns' elements. Every element is initialised to 0.
+matrix* new_matrix_3d(const size_t depth, const size_t rows, const size_t columns) {
+    if (depth == 0 || rows == 0 || columns == 0) {
+        matrix_warning_handling(CMATRIX_WARNMSG_EMPTY_DIMENSION);
+        return NULL;
+    }
+
+    if (rows > SIZE_MAX / columns || rows * columns > SIZE_MAX / depth ||
+        depth * rows * columns > (SIZE_MAX - CMATRIX_ALIGNMENT) / sizeof(double)) {
+        matrix_error_handling(CMATRIX_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                              CMATRIX_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    matrix* mat = malloc(sizeof(matrix));
+
+    if (!mat) matrix_error_handling(CMATRIX_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                    CMATRIX_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    mat->depth = depth;
+    mat->rows = rows;
+    mat->columns = columns;
+    mat->size = depth * rows * columns;
+    mat->tile_size = CMATRIX_DEFAULT_TILE_SIZE;
+
+    // 'aligned_alloc()' requires the size to be a multiple of the alignment.
+    size_t bytes = (mat->size * sizeof(double) + CMATRIX_ALIGNMENT - 1) / CMATRIX_ALIGNMENT * CMATRIX_ALIGNMENT;
+    mat->data = aligned_alloc(CMATRIX_ALIGNMENT, bytes);
+
+    if (!mat->data) matrix_error_handling(CMATRIX_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                          CMATRIX_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    memset(mat->data, 0, bytes);
+    return mat;
+}
+
+// Destructor of matrix. Standardised template: void func_name(void* obj).
+void delete_matrix(void* obj) {
+    if (obj) {
+        matrix* mat = (matrix*)obj;
+        free(mat->data);
+        free(mat);
+        mat = NULL;
+        obj = mat;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of layers; 1 for a 2D matrix.
+size_t matrix_get_depth(const matrix* mat) {
+    matrix_check_null(mat);
+    return mat->depth;
+}
+
+// Getter of the number of rows of one layer.
+size_t matrix_get_rows(const matrix* mat) {
+    matrix_check_null(mat);
+    return mat->rows;
+}
+
+// Getter of the number of columns of one layer.
+size_t matrix_get_columns(const matrix* mat) {
+    matrix_check_null(mat);
+    return mat->columns;
+}
+
+// Getter of the total number of elements.
+size_t matrix_get_size(const matrix* mat) {
+    matrix_check_null(mat);
+    return mat->size;
+}
+
+// Returns a pointer to the contiguous, row-major storage.
+double* matrix_get_data(const matrix* mat) {
+    matrix_check_null(mat);
+    return mat->data;
+}
+
+// Returns the element at the specified position of a 2D matrix (of the first layer of a 3D matrix).
+double matrix_get_item_at(const matrix* mat, const size_t row, const size_t column) {
+    return matrix_get_item_at_3d(mat, 0, row, column);
+}
+
+// Returns the element at the specified position.
+double matrix_get_item_at_3d(const matrix* mat, const size_t layer, const size_t row, const size_t column) {
+    matrix_check_null(mat);
+    matrix_check_index(mat, layer, row, column);
+    return mat->data[(layer * mat->rows + row) * mat->columns + column];
+}
+
+// Getter of the tile size used when this matrix is the destination of 'matrix_multiply()'.
+size_t matrix_get_tile_size(const matrix* mat) {
+    matrix_check_null(mat);
+    return mat->tile_size;
+}
+
+/* ======================================= */
+/* =============== Setters =============== */
+/* ======================================= */
+
+// Sets the element at the specified position of a 2D matrix (of the first layer of a 3D matrix).
+void matrix_set_item_at(matrix* mat, const size_t row, const size_t column, const double value) {
+    matrix_set_item_at_3d(mat, 0, row, column, value);
+}
+
+// Sets the element at the specified position.
+void matrix_set_item_at_3d(matrix* mat, const size_t layer, const size_t row, const size_t column, const double value) {
+    matrix_check_null(mat);
+    matrix_check_index(mat, layer, row, column);
+    mat->data[(layer * mat->rows + row) * mat->columns + column] = value;
+}
+
+// Sets the tile size used when this matrix is the destination of 'matrix_multiply()'. Rounded up to a multiple of 8.
+void matrix_set_tile_size(matrix* mat, const size_t tile_size) {
+    matrix_check_null(mat);
+    mat->tile_size = tile_size < 8 ? 8 : (tile_size + 7) / 8 * 8;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the two matrices have the same depth, rows and columns.
+bool matrix_haveequalshape(const matrix* mat1, const matrix* mat2) {
+    matrix_check_null(mat1);
+    matrix_check_null(mat2);
+    return mat1->depth == mat2->depth && mat1->rows == mat2->rows && mat1->columns == mat2->columns;
+}
+
+// Checks whether the two matrices have the same shape and elements.
+bool matrix_areequal(const matrix* mat1, const matrix* mat2) {
+    if (!matrix_haveequalshape(mat1, mat2)) return false;
+
+    for (size_t i = 0; i < mat1->size; i++) {
+        if (mat1->data[i] != mat2->data[i]) return false;
+    }
+
+    return true;
+}
+
+/* ====================================================== */
+/* ========== Immutative matrix manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'mat'.
+matrix* matrix_copy(const matrix* mat) {
+    matrix_check_null(mat);
+
+    matrix* copy = new_matrix_3d(mat->depth, mat->rows, mat->columns);
+    memcpy(copy->data, mat->data, mat->size * sizeof(double));
+    copy->tile_size = mat->tile_size;
+    return copy;
+}
+
+/* ======================================= */
+/* ======== Elementwise operations ======= */
+/* ======================================= */
+
+// Sets every element to 'value'.
+void matrix_fill(matrix* mat, const double value) {
+    matrix_check_null(mat);
+
+    matrix_vector filler = matrix_vector_broadcast(value);
+    size_t i = 0;
+
+    for (; i + CMATRIX_LANES <= mat->size; i += CMATRIX_LANES) matrix_vector_store(mat->data + i, filler);
+    for (; i < mat->size; i++) mat->data[i] = value;
+}
+
+// Defines the kernel of an elementwise binary operation: whole registers first, then the remaining elements one by one.
+#define CMATRIX_ELEMENTWISE_KERNEL(name, vector_operation, scalar_operator)                                           \
+    static void name(double* destination, const double* source1, const double* source2, const size_t size) {          \
+        size_t i = 0;                                                                                                 \
+        for (; i + CMATRIX_LANES <= size; i += CMATRIX_LANES) {                                                       \
+            matrix_vector_store(destination + i, vector_operation(matrix_vector_load(source1 + i),                     \
+                                                                  matrix_vector_load(source2 + i)));                  \
+        }                                                                                                             \
+        for (; i < size; i++) destination[i] = source1[i] scalar_operator source2[i];                                 \
+    }
+
+CMATRIX_ELEMENTWISE_KERNEL(matrix_add_kernel,      matrix_vector_add,      +)
+CMATRIX_ELEMENTWISE_KERNEL(matrix_subtract_kernel, matrix_vector_subtract, -)
+CMATRIX_ELEMENTWISE_KERNEL(matrix_hadamard_kernel, matrix_vector_multiply, *)
+
+// destination = mat1 + mat2.
+void matrix_add(matrix* destination, const matrix* mat1, const matrix* mat2) {
+    if (matrix_check_shapes(destination, mat1, mat2)) matrix_add_kernel(destination->data, mat1->data, mat2->data, destination->size);
+}
+
+// destination = mat1 - mat2.
+void matrix_subtract(matrix* destination, const matrix* mat1, const matrix* mat2) {
+    if (matrix_check_shapes(destination, mat1, mat2)) matrix_subtract_kernel(destination->data, mat1->data, mat2->data, destination->size);
+}
+
+// destination = mat1 * mat2, elementwise (Hadamard product).
+void matrix_hadamard(matrix* destination, const matrix* mat1, const matrix* mat2) {
+    if (matrix_check_shapes(destination, mat1, mat2)) matrix_hadamard_kernel(destination->data, mat1->data, mat2->data, destination->size);
+}
+
+// destination = factor * mat.
+void matrix_scale(matrix* destination, const matrix* mat, const double factor) {
+    if (!matrix_check_shapes(destination, mat, NULL)) return;
+
+    matrix_vector multiplier = matrix_vector_broadcast(factor);
+    size_t i = 0;
+
+    for (; i + CMATRIX_LANES <= mat->size; i += CMATRIX_LANES) {
+        matrix_vector_store(destination->data + i, matrix_vector_multiply(matrix_vector_load(mat->data + i), multiplier));
+    }
+    for (; i < mat->size; i++) destination->data[i] = mat->data[i] * factor;
+}
+
+// destination[i] = function(mat[i], context) for every element.
+void matrix_apply(matrix* destination, const matrix* mat, double (*function)(double, void*), void* context) {
+    if (!matrix_check_shapes(destination, mat, NULL)) return;
+
+    for (size_t i = 0; i < mat->size; i++) destination->data[i] = function(mat->data[i], context);
+}
+
+/* ======================================= */
+/* ============== Reductions ============= */
+/* ======================================= */
+
+// Folds the lanes of a register with 'operation'.
+static double matrix_vector_reduce(const matrix_vector v, double (*operation)(double, double)) {
+    double lanes[CMATRIX_LANES];
+    matrix_vector_store(lanes, v);
+
+    double result = lanes[0];
+    for (size_t i = 1; i < CMATRIX_LANES; i++) result = operation(result, lanes[i]);
+    return result;
+}
+
+static double matrix_scalar_add(double a, double b) { return a + b; }
+static double matrix_scalar_min(double a, double b) { return b < a ? b : a; }
+static double matrix_scalar_max(double a, double b) { return b > a ? b : a; }
+
+// Returns the sum of the elements.
+double matrix_sum(const matrix* mat) {
+    matrix_check_null(mat);
+
+    matrix_vector accumulator = matrix_vector_broadcast(0.0);
+    size_t i = 0;
+
+    for (; i + CMATRIX_LANES <= mat->size; i += CMATRIX_LANES) accumulator = matrix_vector_add(accumulator, matrix_vector_load(mat->data + i));
+
+    double sum = matrix_vector_reduce(accumulator, matrix_scalar_add);
+    for (; i < mat->size; i++) sum += mat->data[i];
+    return sum;
+}
+
+// Returns the smallest element.
+double matrix_min(const matrix* mat) {
+    matrix_check_null(mat);
+
+    matrix_vector accumulator = matrix_vector_broadcast(mat->data[0]);
+    size_t i = 0;
+
+    for (; i + CMATRIX_LANES <= mat->size; i += CMATRIX_LANES) accumulator = matrix_vector_min(accumulator, matrix_vector_load(mat->data + i));
+
+    double min = matrix_vector_reduce(accumulator, matrix_scalar_min);
+    for (; i < mat->size; i++) min = matrix_scalar_min(min, mat->data[i]);
+    return min;
+}
+
+// Returns the largest element.
+double matrix_max(const matrix* mat) {
+    matrix_check_null(mat);
+
+    matrix_vector accumulator = matrix_vector_broadcast(mat->data[0]);
+    size_t i = 0;
+
+    for (; i + CMATRIX_LANES <= mat->size; i += CMATRIX_LANES) accumulator = matrix_vector_max(accumulator, matrix_vector_load(mat->data + i));
+
+    double max = matrix_vector_reduce(accumulator, matrix_scalar_max);
+    for (; i < mat->size; i++) max = matrix_scalar_max(max, mat->data[i]);
+    return max;
+}
+
+// Returns the sum of the elementwise products of two matrices of the same shape (0 if the shapes differ).
+double matrix_dot(const matrix* mat1, const matrix* mat2) {
+    if (!matrix_check_shapes(mat1, mat2, NULL)) return 0.0;
+
+    matrix_vector accumulator = matrix_vector_broadcast(0.0);
+    size_t i = 0;
+
+    for (; i + CMATRIX_LANES <= mat1->size; i += CMATRIX_LANES) {
+        accumulator = matrix_vector_madd(matrix_vector_load(mat1->data + i), matrix_vector_load(mat2->data + i), accumulator);
+    }
+
+    double dot = matrix_vector_reduce(accumulator, matrix_scalar_add);
+    for (; i < mat1->size; i++) dot += mat1->data[i] * mat2->data[i];
+    return dot;
+}
+
+/* ======================================= */
+/* ============ Linear algebra =========== */
+/* ======================================= */
+
+// One multiplication, cut into tasks of 'tile' rows of one layer.
+typedef struct {
+    const double* left;
+    const double* right;
+    double* product;
+    size_t n, k, m;             // shape of one layer: (n x k) x (k x m)
+    size_t tile;
+    size_t row_tiles;           // tasks per layer
+} matrix_multiply_job;
+
+// Accumulates rows [0, 'count') of 'left' times the tile (['k_begin', 'k_end') x ['j_begin', 'j_end')) of 'right' into 'product'.
+// 'count' is at most 'CMATRIX_KERNEL_ROWS'. The partial sums of one register per row stay in registers across the whole tile depth.
+static void matrix_multiply_kernel(const matrix_multiply_job* job, const double* left, const double* right, double* product, const size_t count,
+                                   const size_t k_begin, const size_t k_end, const size_t j_begin, const size_t j_end) {
+    const size_t k = job->k, m = job->m;
+    size_t j = j_begin;
+
+    for (; j + CMATRIX_LANES <= j_end; j += CMATRIX_LANES) {
+        matrix_vector sums[CMATRIX_KERNEL_ROWS];
+        for (size_t r = 0; r < count; r++) sums[r] = matrix_vector_load(product + r * m + j);
+
+        for (size_t p = k_begin; p < k_end; p++) {
+            matrix_vector b = matrix_vector_load(right + p * m + j);
+            for (size_t r = 0; r < count; r++) sums[r] = matrix_vector_madd(matrix_vector_broadcast(left[r * k + p]), b, sums[r]);
+        }
+
+        for (size_t r = 0; r < count; r++) matrix_vector_store(product + r * m + j, sums[r]);
+    }
+
+    for (; j < j_end; j++) {
+        for (size_t r = 0; r < count; r++) {
+            double sum = product[r * m + j];
+            for (size_t p = k_begin; p < k_end; p++) sum += left[r * k + p] * right[p * m + j];
+            product[r * m + j] = sum;
+        }
+    }
+}
+
+// Computes rows ['row_begin', 'row_end') of one layer of the product, tile by tile, so that the tile of 'right' stays cached.
+static void matrix_multiply_rows(const matrix_multiply_job* job, const size_t layer, const size_t row_begin, const size_t row_end) {
+    const size_t n = job->n, k = job->k, m = job->m, tile = job->tile;
+    const double* left = job->left + layer * n * k;
+    const double* right = job->right + layer * k * m;
+    double* product = job->product + layer * n * m;
+
+    memset(product + row_begin * m, 0, (row_end - row_begin) * m * sizeof(double));
+
+    for (size_t k_begin = 0; k_begin < k; k_begin += tile) {
+        size_t k_end = k_begin + tile < k ? k_begin + tile : k;
+
+        for (size_t j_begin = 0; j_begin < m; j_begin += tile) {
+            size_t j_end = j_begin + tile < m ? j_begin + tile : m;
+
+            for (size_t i = row_begin; i < row_end; i += CMATRIX_KERNEL_ROWS) {
+                size_t count = row_end - i < CMATRIX_KERNEL_ROWS ? row_end - i : CMATRIX_KERNEL_ROWS;
+                matrix_multiply_kernel(job, left + i * k, right, product + i * m, count, k_begin, k_end, j_begin, j_end);
+            }
+        }
+    }
+}
+
+static void matrix_multiply_task(void* argument, size_t index) {
+    const matrix_multiply_job* job = (const matrix_multiply_job*)argument;
+    size_t layer = index / job->row_tiles;
+    size_t row_begin = (index % job->row_tiles) * job->tile;
+    size_t row_end = row_begin + job->tile < job->n ? row_begin + job->tile : job->n;
+
+    matrix_multiply_rows(job, layer, row_begin, row_end);
+}
+
+// Validates the operands of a multiplication and fills in 'job'.
+static bool matrix_multiply_prepare(matrix_multiply_job* job, matrix* destination, const matrix* mat1, const matrix* mat2) {
+    matrix_check_null(destination);
+    matrix_check_null(mat1);
+    matrix_check_null(mat2);
+
+    if (destination == mat1 || destination == mat2) {
+        matrix_warning_handling(CMATRIX_WARNMSG_ALIASING);
+        return false;
+    }
+
+    if (mat1->depth != mat2->depth || destination->depth != mat1->depth || mat1->columns != mat2->rows ||
+        destination->rows != mat1->rows || destination->columns != mat2->columns) {
+        matrix_warning_handling(CMATRIX_WARNMSG_SHAPE_MISMATCH);
+        return false;
+    }
+
+    job->left = mat1->data;
+    job->right = mat2->data;
+    job->product = destination->data;
+    job->n = mat1->rows;
+    job->k = mat1->columns;
+    job->m = mat2->columns;
+    job->tile = destination->tile_size;
+    job->row_tiles = (job->n + job->tile - 1) / job->tile;
+    return true;
+}
+
+// destination = mat1 x mat2 for every layer. 'mat1' is depth x n x k, 'mat2' is depth x k x m and 'destination' is depth x n x m.
+void matrix_multiply(matrix* destination, const matrix* mat1, const matrix* mat2) {
+    matrix_multiply_job job;
+    if (!matrix_multiply_prepare(&job, destination, mat1, mat2)) return;
+
+    for (size_t layer = 0; layer < destination->depth; layer++) matrix_multiply_rows(&job, layer, 0, job.n);
+}
+
+// Same as 'matrix_multiply()', with the row tiles spread over the workers of 'pool' (NULL: default pool).
+void matrix_parallel_multiply(matrix* destination, const matrix* mat1, const matrix* mat2, threadpool* pool) {
+    matrix_multiply_job job;
+    if (!matrix_multiply_prepare(&job, destination, mat1, mat2)) return;
+
+    threadpool_run(pool ? pool : threadpool_get_default(), matrix_multiply_task, &job, destination->depth * job.row_tiles);
+}
+
+// Transposes the block ['row_begin', 'row_end') x ['column_begin', 'column_end') of a 'rows' x 'columns' layer.
+// Halving the longer side until the block is small makes both the reads and the writes cache-friendly at every cache level.
+static void matrix_transpose_block(const double* source, double* destination, const size_t rows, const size_t columns,
+                                   const size_t row_begin, const size_t row_end, const size_t column_begin, const size_t column_end) {
+    size_t height = row_end - row_begin, width = column_end - column_begin;
+
+    if (height <= CMATRIX_TRANSPOSE_BLOCK && width <= CMATRIX_TRANSPOSE_BLOCK) {
+        for (size_t i = row_begin; i < row_end; i++) {
+            for (size_t j = column_begin; j < column_end; j++) destination[j * rows + i] = source[i * columns + j];
+        }
+    }
+    else if (height >= width) {
+        size_t middle = row_begin + height / 2;
+        matrix_transpose_block(source, destination, rows, columns, row_begin, middle, column_begin, column_end);
+        matrix_transpose_block(source, destination, rows, columns, middle, row_end, column_begin, column_end);
+    }
+    else {
+        size_t middle = column_begin + width / 2;
+        matrix_transpose_block(source, destination, rows, columns, row_begin, row_end, column_begin, middle);
+        matrix_transpose_block(source, destination, rows, columns, row_begin, row_end, middle, column_end);
+    }
+}
+
+// Transposes every layer of 'mat' (depth x n x m) into 'destination' (depth x m x n), with a cache-oblivious recursion.
+void matrix_transpose(matrix* destination, const matrix* mat) {
+    matrix_check_null(destination);
+    matrix_check_null(mat);
+
+    if (destination == mat) {
+        matrix_warning_handling(CMATRIX_WARNMSG_ALIASING);
+        return;
+    }
+
+    if (destination->depth != mat->depth || destination->rows != mat->columns || destination->columns != mat->rows) {
+        matrix_warning_handling(CMATRIX_WARNMSG_SHAPE_MISMATCH);
+        return;
+    }
+
+    size_t layer_size = mat->rows * mat->columns;
+    for (size_t layer = 0; layer < mat->depth; layer++) {
+        matrix_transpose_block(mat->data + layer * layer_size, destination->data + layer * layer_size,
+                               mat->rows, mat->columns, 0, mat->rows, 0, mat->columns);
+    }
+}
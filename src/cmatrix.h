@@ -0,0 +1,189 @@
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cthreadpool.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'matrix' type is a dense 2D or 3D array of 'double' values, stored in one contiguous, 64-byte aligned block in row-major order:
+the element at ('layer', 'row', 'column') is found at index '(layer * rows + row) * columns + column' of 'matrix_get_data()'.
+Therefore, it has the following characteristics:
+    - not resizeable, the shape is fixed by the constructor
+    - a 2D matrix is a 3D matrix of depth 1; the linear algebra operates on every layer independently
+    - the kernels work on cache-sized tiles and use SIMD registers (AVX or SSE2) when the compiler targets them
+Similar in nature to Eigen::Matrix in C++ or numpy.ndarray in Python.
+
+Operations write their result into a destination matrix of the appropriate shape, so buffers can be reused between calls.
+Elementwise operations accept the destination as one of their operands; 'matrix_multiply()' and 'matrix_transpose()' do not.
+*/
+
+// Type definition of 'matrix' type.
+typedef struct _matrix matrix;
+
+// Alternative 'keyword' for type 'matrix'.
+typedef matrix Matrix;
+
+// Alternative 'keyword' for type 'matrix'.
+typedef matrix matrix_t;
+
+// Alignment of the storage in bytes.
+#define CMATRIX_ALIGNMENT 64
+
+// Default edge length of the square tiles processed by 'matrix_multiply()'.
+#define CMATRIX_DEFAULT_TILE_SIZE 64
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of 2D matrix. Every element is initialised to 0.
+matrix* new_matrix    (const size_t rows, const size_t columns);
+
+// Constructor of 3D matrix: 'depth' layers of 'rows' x 'columns' elements. Every element is initialised to 0.
+matrix* new_matrix_3d (const size_t depth, const size_t rows, const size_t columns);
+
+// Destructor of matrix. Standardised template: void func_name(void* obj).
+void    delete_matrix (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of layers; 1 for a 2D matrix.
+size_t  matrix_get_depth        (const matrix* mat);
+
+// Getter of the number of rows of one layer.
+size_t  matrix_get_rows         (const matrix* mat);
+
+// Getter of the number of columns of one layer.
+size_t  matrix_get_columns      (const matrix* mat);
+
+// Getter of the total number of elements.
+size_t  matrix_get_size         (const matrix* mat);
+
+// Returns a pointer to the contiguous, row-major storage.
+double* matrix_get_data         (const matrix* mat);
+
+// Returns the element at the specified position of a 2D matrix (of the first layer of a 3D matrix).
+double  matrix_get_item_at      (const matrix* mat, const size_t row, const size_t column);
+
+// Returns the element at the specified position.
+double  matrix_get_item_at_3d   (const matrix* mat, const size_t layer, const size_t row, const size_t column);
+
+// Getter of the tile size used when this matrix is the destination of 'matrix_multiply()'.
+size_t  matrix_get_tile_size    (const matrix* mat);
+
+/* ======================================= */
+/* =============== Setters =============== */
+/* ======================================= */
+
+// Sets the element at the specified position of a 2D matrix (of the first layer of a 3D matrix).
+void matrix_set_item_at    (matrix* mat, const size_t row, const size_t column, const double value);
+
+// Sets the element at the specified position.
+void matrix_set_item_at_3d (matrix* mat, const size_t layer, const size_t row, const size_t column, const double value);
+
+// Sets the tile size used when this matrix is the destination of 'matrix_multiply()'. Rounded up to a multiple of 8.
+void matrix_set_tile_size  (matrix* mat, const size_t tile_size);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the two matrices have the same depth, rows and columns.
+bool matrix_haveequalshape (const matrix* mat1, const matrix* mat2);
+
+// Checks whether the two matrices have the same shape and elements.
+bool matrix_areequal       (const matrix* mat1, const matrix* mat2);
+
+/* ====================================================== */
+/* ========== Immutative matrix manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'mat'.
+matrix* matrix_copy (const matrix* mat);
+
+/* ======================================= */
+/* ======== Elementwise operations ======= */
+/* ======================================= */
+
+// All operands must have the same shape; otherwise nothing is changed. 'destination' may be one of the operands.
+
+// Sets every element to 'value'.
+void matrix_fill     (matrix* mat, const double value);
+
+// destination = mat1 + mat2.
+void matrix_add      (matrix* destination, const matrix* mat1, const matrix* mat2);
+
+// destination = mat1 - mat2.
+void matrix_subtract (matrix* destination, const matrix* mat1, const matrix* mat2);
+
+// destination = mat1 * mat2, elementwise (Hadamard product).
+void matrix_hadamard (matrix* destination, const matrix* mat1, const matrix* mat2);
+
+// destination = factor * mat.
+void matrix_scale    (matrix* destination, const matrix* mat, const double factor);
+
+// destination[i] = function(mat[i], context) for every element.
+void matrix_apply    (matrix* destination, const matrix* mat, double (*function)(double, void*), void* context);
+
+/* ======================================= */
+/* ============== Reductions ============= */
+/* ======================================= */
+
+// Returns the sum of the elements.
+double matrix_sum (const matrix* mat);
+
+// Returns the smallest element.
+double matrix_min (const matrix* mat);
+
+// Returns the largest element.
+double matrix_max (const matrix* mat);
+
+// Returns the sum of the elementwise products of two matrices of the same shape (0 if the shapes differ).
+double matrix_dot (const matrix* mat1, const matrix* mat2);
+
+/* ======================================= */
+/* ============ Linear algebra =========== */
+/* ======================================= */
+
+// destination = mat1 x mat2 for every layer. 'mat1' is depth x n x k, 'mat2' is depth x k x m and 'destination' is depth x n x m.
+// 'destination' must not share storage with the operands; otherwise nothing is changed.
+void matrix_multiply          (matrix* destination, const matrix* mat1, const matrix* mat2);
+
+// Same as 'matrix_multiply()', with the row tiles spread over the workers of 'pool'. If 'pool' is NULL, the shared pool
+// returned by 'threadpool_get_default()' is used.
+void matrix_parallel_multiply (matrix* destination, const matrix* mat1, const matrix* mat2, threadpool* pool);
+
+// Transposes every layer of 'mat' (depth x n x m) into 'destination' (depth x m x n), with a cache-oblivious recursion.
+// 'destination' must not be 'mat'; otherwise nothing is changed.
+void matrix_transpose         (matrix* destination, const matrix* mat);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CMATRIX_WARNMSG_EMPTY_DIMENSION "Warning: matrix dimensions cannot be 0."
+#define CMATRIX_WARNMSG_SHAPE_MISMATCH  "Warning: matrix shapes are incompatible with the operation. No changes have been made."
+#define CMATRIX_WARNMSG_ALIASING        "Warning: destination matrix cannot be an operand of the operation. No changes have been made."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CMATRIX_ERRMSSG_NULL_MATRIX "Error: matrix is a null pointer."
+#define CMATRIX_ERRCODE_NULL_MATRIX -1
+
+#define CMATRIX_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CMATRIX_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CMATRIX_ERRMSSG_INDEX_OUT_OF_BOUNDS "Error: index out of bounds."
+#define CMATRIX_ERRCODE_INDEX_OUT_OF_BOUNDS -3
+
+#endif // MATRIX_H
@@ -0,0 +1,232 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "cmpmcqueue.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+#define CMPMCQUEUE_CACHE_LINE 64
+
+// A cell at slot 'position & mask' is free for the producer of 'position' when its sequence equals 'position',
+// and holds an element for the consumer of 'position' when its sequence equals 'position + 1'.
+struct _mpmcqueue {
+    _Alignas(CMPMCQUEUE_CACHE_LINE) atomic_size_t enqueue_position;
+    _Alignas(CMPMCQUEUE_CACHE_LINE) atomic_size_t dequeue_position;
+
+    _Alignas(CMPMCQUEUE_CACHE_LINE) atomic_size_t* sequences;
+    unsigned char* data;
+    size_t capacity;
+    size_t mask;
+    size_t element_size;
+    void (*destructor)(void*);
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void mpmcqueue_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CMPMCQUEUE_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void mpmcqueue_check_null(const mpmcqueue* que) {
+    if (!que) mpmcqueue_error_handling(CMPMCQUEUE_ERRMSSG_NULL_MPMCQUEUE,
+                                       CMPMCQUEUE_ERRCODE_NULL_MPMCQUEUE);
+}
+
+// General warning handling function.
+static void mpmcqueue_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CMPMCQUEUE_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ========= Cell helpers ========= */
+/* ================================ */
+
+static inline unsigned char* mpmcqueue_slot(const mpmcqueue* que, const size_t position) {
+    return que->data + (position & que->mask) * que->element_size;
+}
+
+// Signed distance between a cell's sequence and the expected one: 0 means ready, negative means not yet, positive means stale position.
+static inline intptr_t mpmcqueue_lag(const mpmcqueue* que, const size_t position, const size_t expected) {
+    return (intptr_t)(atomic_load_explicit(&que->sequences[position & que->mask], memory_order_acquire) - expected);
+}
+
+// Claims up to 'count' consecutive positions on 'counter' whose cells have the sequence 'position + offset'.
+// Returns the number of positions claimed and stores the first one in 'first'.
+static size_t mpmcqueue_claim(mpmcqueue* que, atomic_size_t* counter, const size_t offset, const size_t count, size_t* first) {
+    size_t position = atomic_load_explicit(counter, memory_order_relaxed);
+
+    for (;;) {
+        size_t ready = 0;
+        while (ready < count && mpmcqueue_lag(que, position + ready, position + ready + offset) == 0) ready++;
+
+        if (ready == 0) {
+            // The first cell is not ready: the queue is full (or empty), unless another thread has moved the counter meanwhile.
+            if (mpmcqueue_lag(que, position, position + offset) < 0) return 0;
+            position = atomic_load_explicit(counter, memory_order_relaxed);
+            continue;
+        }
+
+        // Only the thread winning the counter can change the checked cells, so they stay ready after a successful swap.
+        if (atomic_compare_exchange_weak_explicit(counter, &position, position + ready, memory_order_relaxed, memory_order_relaxed)) {
+            *first = position;
+            return ready;
+        }
+    }
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of multi-producer, multi-consumer queue. 'capacity' is rounded up to a power of two, at least 2.
+mpmcqueue* new_mpmcqueue(const size_t capacity, const size_t element_size, void (*destructor)(void*)) {
+    if (capacity == 0) {
+        mpmcqueue_warning_handling(CMPMCQUEUE_WARNMSG_EMPTY_CAPACITY);
+        return NULL;
+    }
+
+    if (element_size == 0) {
+        mpmcqueue_warning_handling(CMPMCQUEUE_WARNMSG_EMPTY_ELEMENT_SIZE);
+        return NULL;
+    }
+
+    size_t rounded = 2;
+    while (rounded < capacity && rounded <= SIZE_MAX / 2) rounded *= 2;
+
+    mpmcqueue* que = aligned_alloc(CMPMCQUEUE_CACHE_LINE, sizeof(mpmcqueue));
+
+    if (!que || rounded < capacity || rounded > SIZE_MAX / element_size || rounded > SIZE_MAX / sizeof(atomic_size_t)) {
+        mpmcqueue_error_handling(CMPMCQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                 CMPMCQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    que->sequences = malloc(rounded * sizeof(atomic_size_t));
+    que->data = malloc(rounded * element_size);
+
+    if (!que->sequences || !que->data) mpmcqueue_error_handling(CMPMCQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                                CMPMCQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    for (size_t i = 0; i < rounded; i++) atomic_init(&que->sequences[i], i);
+
+    atomic_init(&que->enqueue_position, 0);
+    atomic_init(&que->dequeue_position, 0);
+    que->capacity = rounded;
+    que->mask = rounded - 1;
+    que->element_size = element_size;
+    que->destructor = destructor;
+
+    return que;
+}
+
+// Destructor of queue. No other thread may use the queue any more. Standardised template: void func_name(void* obj).
+void delete_mpmcqueue(void* obj) {
+    if (obj) {
+        mpmcqueue* que = (mpmcqueue*)obj;
+
+        if (que->destructor) {
+            size_t tail = atomic_load(&que->enqueue_position);
+            for (size_t position = atomic_load(&que->dequeue_position); position != tail; position++) que->destructor(mpmcqueue_slot(que, position));
+        }
+
+        free(que->sequences);
+        free(que->data);
+        free(que);
+        que = NULL;
+        obj = que;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements, counting the ones being pushed or popped. Only a snapshot while other threads are active.
+size_t mpmcqueue_get_size(const mpmcqueue* que) {
+    mpmcqueue_check_null(que);
+
+    size_t head = atomic_load(&que->dequeue_position);
+    size_t tail = atomic_load(&que->enqueue_position);
+    return tail - head < que->capacity ? tail - head : que->capacity;
+}
+
+// Getter of the maximum number of stored elements.
+size_t mpmcqueue_get_capacity(const mpmcqueue* que) {
+    mpmcqueue_check_null(que);
+    return que->capacity;
+}
+
+// Getter of the size of one element in bytes.
+size_t mpmcqueue_get_element_size(const mpmcqueue* que) {
+    mpmcqueue_check_null(que);
+    return que->element_size;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the queue is empty. Only a snapshot while other threads are active.
+bool mpmcqueue_isempty(const mpmcqueue* que) {
+    return mpmcqueue_get_size(que) == 0;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' into the queue. Returns false (keeping the element) if the queue is full.
+bool mpmcqueue_try_push(mpmcqueue* que, const void* obj) {
+    return mpmcqueue_push_n(que, obj, 1) == 1;
+}
+
+// Moves the front element into 'destination'. Returns false if the queue is empty.
+bool mpmcqueue_try_pop(mpmcqueue* que, void* destination) {
+    return mpmcqueue_pop_n(que, destination, 1) == 1;
+}
+
+// Moves up to 'count' contiguous elements starting at 'elements' into the queue. Returns the number of elements pushed.
+size_t mpmcqueue_push_n(mpmcqueue* que, const void* elements, const size_t count) {
+    mpmcqueue_check_null(que);
+    if (count == 0) return 0;
+
+    size_t first;
+    size_t pushed = mpmcqueue_claim(que, &que->enqueue_position, 0, count, &first);
+
+    for (size_t i = 0; i < pushed; i++) {
+        memcpy(mpmcqueue_slot(que, first + i), (const unsigned char*)elements + i * que->element_size, que->element_size);
+        atomic_store_explicit(&que->sequences[(first + i) & que->mask], first + i + 1, memory_order_release);
+    }
+
+    return pushed;
+}
+
+// Moves up to 'count' consecutive elements into the contiguous 'destination', in order. Returns the number of elements popped.
+size_t mpmcqueue_pop_n(mpmcqueue* que, void* destination, const size_t count) {
+    mpmcqueue_check_null(que);
+    if (count == 0) return 0;
+
+    size_t first;
+    size_t popped = mpmcqueue_claim(que, &que->dequeue_position, 1, count, &first);
+
+    // Releasing a cell hands it to the producer of the same slot in the next lap.
+    for (size_t i = 0; i < popped; i++) {
+        memcpy((unsigned char*)destination + i * que->element_size, mpmcqueue_slot(que, first + i), que->element_size);
+        atomic_store_explicit(&que->sequences[(first + i) & que->mask], first + i + que->capacity, memory_order_release);
+    }
+
+    return popped;
+}
@@ -0,0 +1,99 @@
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'mpmcqueue' type is a bounded first-in, first-out ring buffer that any number of threads can push to and pop from at once.
+It follows Dmitry Vyukov's design:
+    - every cell carries a sequence number telling whether it is ready to be written or read in the current lap of the ring
+    - producers and consumers claim positions with a compare-and-swap on their own counter, without locks
+    - the producer and the consumer counters live on separate cache lines, so the two sides do not contend with each other
+    - batches claim a run of ready cells with a single compare-and-swap
+The capacity is fixed and rounded up to a power of two (at least 2); pushing into a full queue fails instead of blocking.
+Similar in nature to boost::lockfree::queue (bounded) or rigtorp::MPMCQueue.
+
+Elements are moved in and out bitwise, e.g. 'string*' records handed over between threads.
+The destructor (which can be NULL) follows the conventions of 'array' and only runs on the elements left over when the queue is deleted.
+*/
+
+// Type definition of 'mpmcqueue' type.
+typedef struct _mpmcqueue mpmcqueue;
+
+// Alternative 'keyword' for type 'mpmcqueue'.
+typedef mpmcqueue MpmcQueue;
+
+// Alternative 'keyword' for type 'mpmcqueue'.
+typedef mpmcqueue mpmcqueue_t;
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of multi-producer, multi-consumer queue. 'capacity' is rounded up to a power of two, at least 2.
+mpmcqueue* new_mpmcqueue    (const size_t capacity, const size_t element_size, void (*destructor)(void*));
+
+// Destructor of queue. No other thread may use the queue any more. Standardised template: void func_name(void* obj).
+void       delete_mpmcqueue (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements, counting the ones being pushed or popped. Only a snapshot while other threads are active.
+size_t mpmcqueue_get_size         (const mpmcqueue* que);
+
+// Getter of the maximum number of stored elements.
+size_t mpmcqueue_get_capacity     (const mpmcqueue* que);
+
+// Getter of the size of one element in bytes.
+size_t mpmcqueue_get_element_size (const mpmcqueue* que);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the queue is empty. Only a snapshot while other threads are active.
+bool mpmcqueue_isempty (const mpmcqueue* que);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' into the queue. Returns false (keeping the element) if the queue is full.
+bool   mpmcqueue_try_push (mpmcqueue* que, const void* obj);
+
+// Moves the front element into 'destination'. Returns false if the queue is empty.
+bool   mpmcqueue_try_pop  (mpmcqueue* que, void* destination);
+
+// Moves up to 'count' contiguous elements starting at 'elements' into the queue, claiming the cells with one compare-and-swap.
+// The pushed elements stay contiguous in the queue. Returns the number of elements pushed, the first ones of 'elements'.
+size_t mpmcqueue_push_n   (mpmcqueue* que, const void* elements, const size_t count);
+
+// Moves up to 'count' consecutive elements into the contiguous 'destination', in order, claiming them with one compare-and-swap.
+// Returns the number of elements popped.
+size_t mpmcqueue_pop_n    (mpmcqueue* que, void* destination, const size_t count);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CMPMCQUEUE_WARNMSG_EMPTY_CAPACITY     "Warning: capacity cannot be 0."
+#define CMPMCQUEUE_WARNMSG_EMPTY_ELEMENT_SIZE "Warning: element size cannot be 0."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CMPMCQUEUE_ERRMSSG_NULL_MPMCQUEUE "Error: queue is a null pointer."
+#define CMPMCQUEUE_ERRCODE_NULL_MPMCQUEUE -1
+
+#define CMPMCQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CMPMCQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // MPMCQUEUE_H
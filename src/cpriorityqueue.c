@@ -0,0 +1,445 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cpriorityqueue.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+// The children of the node at position 'i' are at positions 'arity * i + 1' to 'arity * i + arity'.
+// Sifting keeps the moving element in 'hole' and shifts the others into the gap, so every step copies one element instead of swapping two.
+struct _priorityqueue {
+    unsigned char* data;
+    unsigned char* hole;        // scratch slot holding the element being sifted
+    size_t size;
+    size_t capacity;
+    size_t element_size;
+    size_t arity;
+    int (*compare)(const void*, const void*);
+    void (*destructor)(void*);
+
+    // Position tracking, all NULL for a queue without handles. Every array has room for 'capacity' entries:
+    // a new handle is only created when every existing one is in use, so there are never more handles than elements.
+    size_t* handle_at;          // handle of the element at every position
+    size_t* positions;          // position of the element of every handle, 'CPRIORITYQUEUE_NO_HANDLE' if released
+    size_t* free_handles;       // released handles, reused before new ones are created
+    size_t handle_count;
+    size_t free_count;
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void priorityqueue_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CPRIORITYQUEUE_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void priorityqueue_check_null(const priorityqueue* pq) {
+    if (!pq) priorityqueue_error_handling(CPRIORITYQUEUE_ERRMSSG_NULL_PRIORITYQUEUE,
+                                          CPRIORITYQUEUE_ERRCODE_NULL_PRIORITYQUEUE);
+}
+
+// General warning handling function.
+static void priorityqueue_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CPRIORITYQUEUE_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ====== Storage management ====== */
+/* ================================ */
+
+static void* priorityqueue_reallocate_block(void* block, const size_t count, const size_t size) {
+    if (count > SIZE_MAX / size) priorityqueue_error_handling(CPRIORITYQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                              CPRIORITYQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    void* reallocated = realloc(block, count * size);
+
+    if (!reallocated) priorityqueue_error_handling(CPRIORITYQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                   CPRIORITYQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    return reallocated;
+}
+
+static void priorityqueue_reallocate(priorityqueue* pq, const size_t capacity) {
+    pq->data = priorityqueue_reallocate_block(pq->data, capacity, pq->element_size);
+
+    if (pq->positions) {
+        pq->handle_at = priorityqueue_reallocate_block(pq->handle_at, capacity, sizeof(size_t));
+        pq->positions = priorityqueue_reallocate_block(pq->positions, capacity, sizeof(size_t));
+        pq->free_handles = priorityqueue_reallocate_block(pq->free_handles, capacity, sizeof(size_t));
+    }
+
+    pq->capacity = capacity;
+}
+
+// Makes room for 'additional' more elements, doubling the capacity as needed.
+static void priorityqueue_grow(priorityqueue* pq, const size_t additional) {
+    if (additional > SIZE_MAX - pq->size) {
+        priorityqueue_error_handling(CPRIORITYQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                     CPRIORITYQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    size_t required = pq->size + additional;
+    if (required <= pq->capacity) return;
+
+    size_t capacity = pq->capacity > SIZE_MAX / 2 ? SIZE_MAX : pq->capacity * 2;
+    if (capacity < required) capacity = required;
+    if (capacity < CPRIORITYQUEUE_MINIMUM_CAPACITY) capacity = CPRIORITYQUEUE_MINIMUM_CAPACITY;
+
+    priorityqueue_reallocate(pq, capacity);
+}
+
+static inline unsigned char* priorityqueue_slot(const priorityqueue* pq, const size_t position) {
+    return pq->data + position * pq->element_size;
+}
+
+static priorityqueue_handle priorityqueue_acquire_handle(priorityqueue* pq) {
+    if (!pq->positions) return CPRIORITYQUEUE_NO_HANDLE;
+    if (pq->free_count > 0) return pq->free_handles[--pq->free_count];
+    return pq->handle_count++;
+}
+
+static void priorityqueue_release_handle(priorityqueue* pq, const priorityqueue_handle handle) {
+    pq->positions[handle] = CPRIORITYQUEUE_NO_HANDLE;
+    pq->free_handles[pq->free_count++] = handle;
+}
+
+// Position of the element of 'handle', or 'CPRIORITYQUEUE_NO_HANDLE' if the handle is not in use. Warns if handles are disabled.
+static size_t priorityqueue_position_of(const priorityqueue* pq, const priorityqueue_handle handle) {
+    if (!pq->positions) {
+        priorityqueue_warning_handling(CPRIORITYQUEUE_WARNMSG_HANDLES_DISABLED);
+        return CPRIORITYQUEUE_NO_HANDLE;
+    }
+
+    return handle < pq->handle_count ? pq->positions[handle] : CPRIORITYQUEUE_NO_HANDLE;
+}
+
+/* ================================ */
+/* =========== Sifting ============ */
+/* ================================ */
+
+// Copies 'source' (an element or the hole) to 'position', keeping the handle table in sync.
+static inline void priorityqueue_place(priorityqueue* pq, const size_t position, const void* source, const priorityqueue_handle handle) {
+    memcpy(priorityqueue_slot(pq, position), source, pq->element_size);
+
+    if (pq->positions) {
+        pq->handle_at[position] = handle;
+        pq->positions[handle] = position;
+    }
+}
+
+static inline priorityqueue_handle priorityqueue_handle_at(const priorityqueue* pq, const size_t position) {
+    return pq->positions ? pq->handle_at[position] : CPRIORITYQUEUE_NO_HANDLE;
+}
+
+// Moves the element in the hole up from the gap at 'position' until its parent does not compare greater. Returns its final position.
+static size_t priorityqueue_sift_up(priorityqueue* pq, size_t position, const priorityqueue_handle handle) {
+    while (position > 0) {
+        size_t parent = (position - 1) / pq->arity;
+        if (pq->compare(pq->hole, priorityqueue_slot(pq, parent)) >= 0) break;
+
+        priorityqueue_place(pq, position, priorityqueue_slot(pq, parent), priorityqueue_handle_at(pq, parent));
+        position = parent;
+    }
+
+    priorityqueue_place(pq, position, pq->hole, handle);
+    return position;
+}
+
+// Moves the element in the hole down from the gap at 'position' until no child compares smaller.
+static void priorityqueue_sift_down(priorityqueue* pq, size_t position, const priorityqueue_handle handle) {
+    for (;;) {
+        size_t first = position * pq->arity + 1;
+        if (first >= pq->size || first < position) break;
+
+        size_t last = pq->size - first > pq->arity ? first + pq->arity : pq->size;
+        size_t smallest = first;
+
+        for (size_t child = first + 1; child < last; child++) {
+            if (pq->compare(priorityqueue_slot(pq, child), priorityqueue_slot(pq, smallest)) < 0) smallest = child;
+        }
+
+        if (pq->compare(priorityqueue_slot(pq, smallest), pq->hole) >= 0) break;
+
+        priorityqueue_place(pq, position, priorityqueue_slot(pq, smallest), priorityqueue_handle_at(pq, smallest));
+        position = smallest;
+    }
+
+    priorityqueue_place(pq, position, pq->hole, handle);
+}
+
+// Sifts the element in the hole from the gap at 'position' in whichever direction restores the heap.
+static void priorityqueue_sift(priorityqueue* pq, const size_t position, const priorityqueue_handle handle) {
+    if (priorityqueue_sift_up(pq, position, handle) == position) {
+        memcpy(pq->hole, priorityqueue_slot(pq, position), pq->element_size);
+        priorityqueue_sift_down(pq, position, handle);
+    }
+}
+
+// Takes the element at 'position' out of the heap into 'destination' (deletes it if NULL) and fills the gap with the last element.
+static void priorityqueue_extract(priorityqueue* pq, const size_t position, void* destination) {
+    unsigned char* slot = priorityqueue_slot(pq, position);
+
+    if (destination) memcpy(destination, slot, pq->element_size);
+    else if (pq->destructor) pq->destructor(slot);
+
+    if (pq->positions) priorityqueue_release_handle(pq, pq->handle_at[position]);
+
+    size_t last = --pq->size;
+    if (position == last) return;
+
+    memcpy(pq->hole, priorityqueue_slot(pq, last), pq->element_size);
+    priorityqueue_sift(pq, position, priorityqueue_handle_at(pq, last));
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of priority queue. 'arity' is the number of children per node; 0 picks 'CPRIORITYQUEUE_DEFAULT_ARITY'.
+// 'destructor' can be NULL for trivially copyable elements. 'handles' enables the position tracking of the elements.
+priorityqueue* new_priorityqueue(const size_t capacity, const size_t element_size, const size_t arity, int (*compare)(const void*, const void*), void (*destructor)(void*), const bool handles) {
+    if (element_size == 0) {
+        priorityqueue_warning_handling(CPRIORITYQUEUE_WARNMSG_EMPTY_ELEMENT_SIZE);
+        return NULL;
+    }
+
+    if (arity == 1) {
+        priorityqueue_warning_handling(CPRIORITYQUEUE_WARNMSG_INVALID_ARITY);
+        return NULL;
+    }
+
+    if (!compare) {
+        priorityqueue_warning_handling(CPRIORITYQUEUE_WARNMSG_MISSING_COMPARATOR);
+        return NULL;
+    }
+
+    priorityqueue* pq = calloc(1, sizeof(priorityqueue));
+
+    if (!pq) priorityqueue_error_handling(CPRIORITYQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                          CPRIORITYQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    pq->element_size = element_size;
+    pq->arity = arity > 0 ? arity : CPRIORITYQUEUE_DEFAULT_ARITY;
+    pq->compare = compare;
+    pq->destructor = destructor;
+    pq->hole = priorityqueue_reallocate_block(NULL, 1, element_size);
+
+    // A non-NULL 'positions' marks the handles as enabled, even before the first allocation.
+    if (handles) pq->positions = priorityqueue_reallocate_block(NULL, 1, sizeof(size_t));
+
+    priorityqueue_reallocate(pq, capacity > 0 ? capacity : CPRIORITYQUEUE_MINIMUM_CAPACITY);
+    return pq;
+}
+
+// Destructor of priority queue. Standardised template: void func_name(void* obj).
+void delete_priorityqueue(void* obj) {
+    if (obj) {
+        priorityqueue* pq = (priorityqueue*)obj;
+        priorityqueue_mut_clean(pq);
+        free(pq->data);
+        free(pq->hole);
+        free(pq->handle_at);
+        free(pq->positions);
+        free(pq->free_handles);
+        free(pq);
+        pq = NULL;
+        obj = pq;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t priorityqueue_get_size(const priorityqueue* pq) {
+    priorityqueue_check_null(pq);
+    return pq->size;
+}
+
+// Getter of the number of elements that fit in the current buffer.
+size_t priorityqueue_get_capacity(const priorityqueue* pq) {
+    priorityqueue_check_null(pq);
+    return pq->capacity;
+}
+
+// Getter of the size of one element in bytes.
+size_t priorityqueue_get_element_size(const priorityqueue* pq) {
+    priorityqueue_check_null(pq);
+    return pq->element_size;
+}
+
+// Getter of the number of children per node.
+size_t priorityqueue_get_arity(const priorityqueue* pq) {
+    priorityqueue_check_null(pq);
+    return pq->arity;
+}
+
+// Returns a pointer to the element on the top (the smallest one) or NULL if the queue is empty.
+void* priorityqueue_get_top(const priorityqueue* pq) {
+    priorityqueue_check_null(pq);
+    return pq->size > 0 ? pq->data : NULL;
+}
+
+// Returns a pointer to the element identified by 'handle' or NULL if it is not in the queue.
+void* priorityqueue_get_item(const priorityqueue* pq, const priorityqueue_handle handle) {
+    priorityqueue_check_null(pq);
+
+    size_t position = priorityqueue_position_of(pq, handle);
+    return position != CPRIORITYQUEUE_NO_HANDLE ? priorityqueue_slot(pq, position) : NULL;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the queue is empty.
+bool priorityqueue_isempty(const priorityqueue* pq) {
+    priorityqueue_check_null(pq);
+    return pq->size == 0;
+}
+
+// Checks whether the element identified by 'handle' is in the queue.
+bool priorityqueue_contains(const priorityqueue* pq, const priorityqueue_handle handle) {
+    return priorityqueue_get_item(pq, handle) != NULL;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' into the queue (bitwise, the queue takes ownership). Returns its handle.
+priorityqueue_handle priorityqueue_push(priorityqueue* pq, const void* obj) {
+    priorityqueue_check_null(pq);
+
+    if (pq->size == pq->capacity) priorityqueue_grow(pq, 1);
+
+    priorityqueue_handle handle = priorityqueue_acquire_handle(pq);
+    memcpy(pq->hole, obj, pq->element_size);
+    priorityqueue_sift_up(pq, pq->size++, handle);
+    return handle;
+}
+
+// Moves 'count' contiguous elements into the queue and restores the heap property in one pass if the batch is large.
+// If 'handles' is not NULL, the handles of the elements are stored in it.
+void priorityqueue_push_n(priorityqueue* pq, const void* elements, const size_t count, priorityqueue_handle* handles) {
+    priorityqueue_check_null(pq);
+
+    if (count == 0) return;
+
+    priorityqueue_grow(pq, count);
+
+    const unsigned char* source = elements;
+    size_t old_size = pq->size;
+
+    // Sifting every element up costs O(count * log(n)); rebuilding the whole heap bottom-up costs O(n), which wins for large batches.
+    bool rebuild = count >= old_size;
+
+    for (size_t i = 0; i < count; i++) {
+        priorityqueue_handle handle = priorityqueue_acquire_handle(pq);
+        if (handles) handles[i] = handle;
+
+        if (rebuild) priorityqueue_place(pq, pq->size++, source + i * pq->element_size, handle);
+        else {
+            memcpy(pq->hole, source + i * pq->element_size, pq->element_size);
+            priorityqueue_sift_up(pq, pq->size++, handle);
+        }
+    }
+
+    if (!rebuild || pq->size < 2) return;
+
+    for (size_t parent = (pq->size - 2) / pq->arity + 1; parent-- > 0;) {
+        memcpy(pq->hole, priorityqueue_slot(pq, parent), pq->element_size);
+        priorityqueue_sift_down(pq, parent, priorityqueue_handle_at(pq, parent));
+    }
+}
+
+// Moves the top element into 'destination' (deletes it if 'destination' is NULL).
+// Returns 'destination' (or the queue if 'destination' is NULL), or NULL if the queue is empty.
+void* priorityqueue_pop(priorityqueue* pq, void* destination) {
+    priorityqueue_check_null(pq);
+
+    if (pq->size == 0) return NULL;
+
+    priorityqueue_extract(pq, 0, destination);
+    return destination ? destination : (void*)pq;
+}
+
+// Replaces the element identified by 'handle' with the one pointed to by 'obj', which must not compare greater.
+// The old element is deleted. Returns whether the handle was valid.
+bool priorityqueue_decrease_key(priorityqueue* pq, const priorityqueue_handle handle, const void* obj) {
+    priorityqueue_check_null(pq);
+
+    size_t position = priorityqueue_position_of(pq, handle);
+    if (position == CPRIORITYQUEUE_NO_HANDLE) return false;
+
+    if (pq->destructor) pq->destructor(priorityqueue_slot(pq, position));
+    memcpy(pq->hole, obj, pq->element_size);
+    priorityqueue_sift_up(pq, position, handle);
+    return true;
+}
+
+// Replaces the element identified by 'handle' with the one pointed to by 'obj', which may compare greater or smaller.
+// The old element is deleted. Returns whether the handle was valid.
+bool priorityqueue_update(priorityqueue* pq, const priorityqueue_handle handle, const void* obj) {
+    priorityqueue_check_null(pq);
+
+    size_t position = priorityqueue_position_of(pq, handle);
+    if (position == CPRIORITYQUEUE_NO_HANDLE) return false;
+
+    if (pq->destructor) pq->destructor(priorityqueue_slot(pq, position));
+    memcpy(pq->hole, obj, pq->element_size);
+    priorityqueue_sift(pq, position, handle);
+    return true;
+}
+
+// Moves the element identified by 'handle' into 'destination' (deletes it if 'destination' is NULL).
+// Returns whether the handle was valid.
+bool priorityqueue_remove(priorityqueue* pq, const priorityqueue_handle handle, void* destination) {
+    priorityqueue_check_null(pq);
+
+    size_t position = priorityqueue_position_of(pq, handle);
+    if (position == CPRIORITYQUEUE_NO_HANDLE) return false;
+
+    priorityqueue_extract(pq, position, destination);
+    return true;
+}
+
+/* ======================================= */
+/* ========= Capacity management ========= */
+/* ======================================= */
+
+// Makes sure that at least 'capacity' elements fit without growing.
+void priorityqueue_reserve(priorityqueue* pq, const size_t capacity) {
+    priorityqueue_check_null(pq);
+    if (capacity > pq->capacity) priorityqueue_reallocate(pq, capacity);
+}
+
+/* ====================================================== */
+/* ======== Mutative priority queue manipulations ======= */
+/* ====================================================== */
+
+// Erases all the elements of the queue, resulting in an empty one. Every handle is released.
+void priorityqueue_mut_clean(priorityqueue* pq) {
+    priorityqueue_check_null(pq);
+
+    if (pq->destructor) {
+        for (size_t i = 0; i < pq->size; i++) pq->destructor(priorityqueue_slot(pq, i));
+    }
+
+    pq->size = 0;
+    pq->handle_count = 0;
+    pq->free_count = 0;
+}
@@ -0,0 +1,153 @@
+#ifndef PRIORITYQUEUE_H
+#define PRIORITYQUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'priorityqueue' type is a d-ary min-heap stored in one contiguous buffer: the element that compares smallest is on the top.
+Therefore, it has the following characteristics:
+    - peeking takes O(1) time, pushing and popping O(log_d(n)) time
+    - with 4 children per node (the default), the tree is half as deep as a binary heap and the children of a node share
+      a cache line or two, so sifting down touches fewer lines for the same number of comparisons
+    - a batch of elements is heapified in O(n) time instead of being pushed one by one
+Similar in nature to std::priority_queue in C++ (with a greater-than comparator).
+
+The callback functions follow the conventions of 'array': 'compare' follows the convention of 'string_compare()' and
+receives pointers to the slots. Pushing moves elements in bitwise.
+
+If the queue is created with handles, every push returns a handle which identifies the element for as long as it is in the queue,
+wherever sifting moves it. Handles make 'priorityqueue_decrease_key()' and 'priorityqueue_remove()' possible, at the price of
+one extra write per element moved. Handles of popped or removed elements are recycled.
+*/
+
+// Type definition of 'priorityqueue' type.
+typedef struct _priorityqueue priorityqueue;
+
+// Alternative 'keyword' for type 'priorityqueue'.
+typedef priorityqueue PriorityQueue;
+
+// Alternative 'keyword' for type 'priorityqueue'.
+typedef priorityqueue priorityqueue_t;
+
+// Identifier of an element of a queue created with handles.
+typedef size_t priorityqueue_handle;
+
+// Handle returned by queues created without handles.
+#define CPRIORITYQUEUE_NO_HANDLE SIZE_MAX
+
+// Number of children per node of a queue created with arity 0.
+#define CPRIORITYQUEUE_DEFAULT_ARITY 4
+
+// Capacity of the first allocation of a queue created with capacity 0.
+#define CPRIORITYQUEUE_MINIMUM_CAPACITY 8
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of priority queue. 'arity' is the number of children per node; 0 picks 'CPRIORITYQUEUE_DEFAULT_ARITY'.
+// 'destructor' can be NULL for trivially copyable elements. 'handles' enables the position tracking of the elements.
+priorityqueue* new_priorityqueue    (const size_t capacity, const size_t element_size, const size_t arity, int (*compare)(const void*, const void*), void (*destructor)(void*), const bool handles);
+
+// Destructor of priority queue. Standardised template: void func_name(void* obj).
+void           delete_priorityqueue (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t priorityqueue_get_size         (const priorityqueue* pq);
+
+// Getter of the number of elements that fit in the current buffer.
+size_t priorityqueue_get_capacity     (const priorityqueue* pq);
+
+// Getter of the size of one element in bytes.
+size_t priorityqueue_get_element_size (const priorityqueue* pq);
+
+// Getter of the number of children per node.
+size_t priorityqueue_get_arity        (const priorityqueue* pq);
+
+// Returns a pointer to the element on the top (the smallest one) or NULL if the queue is empty.
+void*  priorityqueue_get_top          (const priorityqueue* pq);
+
+// Returns a pointer to the element identified by 'handle' or NULL if it is not in the queue.
+void*  priorityqueue_get_item         (const priorityqueue* pq, const priorityqueue_handle handle);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the queue is empty.
+bool priorityqueue_isempty  (const priorityqueue* pq);
+
+// Checks whether the element identified by 'handle' is in the queue.
+bool priorityqueue_contains (const priorityqueue* pq, const priorityqueue_handle handle);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' into the queue (bitwise, the queue takes ownership). Returns its handle.
+priorityqueue_handle priorityqueue_push         (priorityqueue* pq, const void* obj);
+
+// Moves 'count' contiguous elements into the queue and restores the heap property in one pass if the batch is large.
+// If 'handles' is not NULL, the handles of the elements are stored in it.
+void                 priorityqueue_push_n       (priorityqueue* pq, const void* elements, const size_t count, priorityqueue_handle* handles);
+
+// Moves the top element into 'destination' (deletes it if 'destination' is NULL).
+// Returns 'destination' (or the queue if 'destination' is NULL), or NULL if the queue is empty.
+void*                priorityqueue_pop          (priorityqueue* pq, void* destination);
+
+// Replaces the element identified by 'handle' with the one pointed to by 'obj', which must not compare greater.
+// The old element is deleted. Returns whether the handle was valid.
+bool                 priorityqueue_decrease_key (priorityqueue* pq, const priorityqueue_handle handle, const void* obj);
+
+// Replaces the element identified by 'handle' with the one pointed to by 'obj', which may compare greater or smaller.
+// The old element is deleted. Returns whether the handle was valid.
+bool                 priorityqueue_update       (priorityqueue* pq, const priorityqueue_handle handle, const void* obj);
+
+// Moves the element identified by 'handle' into 'destination' (deletes it if 'destination' is NULL).
+// Returns whether the handle was valid.
+bool                 priorityqueue_remove       (priorityqueue* pq, const priorityqueue_handle handle, void* destination);
+
+/* ======================================= */
+/* ========= Capacity management ========= */
+/* ======================================= */
+
+// Makes sure that at least 'capacity' elements fit without growing.
+void priorityqueue_reserve (priorityqueue* pq, const size_t capacity);
+
+/* ====================================================== */
+/* ======== Mutative priority queue manipulations ======= */
+/* ====================================================== */
+
+// Erases all the elements of the queue, resulting in an empty one. Every handle is released.
+void priorityqueue_mut_clean (priorityqueue* pq);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CPRIORITYQUEUE_WARNMSG_EMPTY_ELEMENT_SIZE "Warning: element size cannot be 0."
+#define CPRIORITYQUEUE_WARNMSG_INVALID_ARITY      "Warning: arity has to be at least 2."
+#define CPRIORITYQUEUE_WARNMSG_MISSING_COMPARATOR "Warning: comparison function cannot be NULL."
+#define CPRIORITYQUEUE_WARNMSG_HANDLES_DISABLED   "Warning: the priority queue was created without handles. No changes have been made."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CPRIORITYQUEUE_ERRMSSG_NULL_PRIORITYQUEUE "Error: priority queue is a null pointer."
+#define CPRIORITYQUEUE_ERRCODE_NULL_PRIORITYQUEUE -1
+
+#define CPRIORITYQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CPRIORITYQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // PRIORITYQUEUE_H
@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cqueue.h"
+#include "cdeque.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+// A queue is a deque used from both ends in one direction only: 'struct _queue' is never defined, and every queue
+// pointer is the pointer of the deque holding its elements. The ring buffer lives in 'cdeque.c' alone.
+static inline deque* queue_deque(const queue* que) {
+    return (deque*)que;
+}
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void queue_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CQUEUE_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void queue_check_null(const queue* que) {
+    if (!que) queue_error_handling(CQUEUE_ERRMSSG_NULL_QUEUE,
+                                   CQUEUE_ERRCODE_NULL_QUEUE);
+}
+
+static void queue_check_index(const queue* que, const size_t index) {
+    if (deque_get_size(queue_deque(que)) <= index) {
+        delete_queue((queue*)que);
+        queue_error_handling(CQUEUE_ERRMSSG_INDEX_OUT_OF_BOUNDS,
+                             CQUEUE_ERRCODE_INDEX_OUT_OF_BOUNDS);
+    }
+}
+
+// General warning handling function.
+static void queue_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CQUEUE_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of queue. 'capacity' is rounded up to a power of two and can be 0.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+queue* new_queue(const size_t capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*)) {
+    if (element_size == 0) {
+        queue_warning_handling(CQUEUE_WARNMSG_EMPTY_ELEMENT_SIZE);
+        return NULL;
+    }
+
+    return (queue*)new_deque(capacity, element_size, destructor, equality, copy);
+}
+
+// Destructor of queue. Standardised template: void func_name(void* obj).
+void delete_queue(void* obj) {
+    delete_deque(obj);
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t queue_get_size(const queue* que) {
+    queue_check_null(que);
+    return deque_get_size(queue_deque(que));
+}
+
+// Getter of the number of elements that fit in the current buffer.
+size_t queue_get_capacity(const queue* que) {
+    queue_check_null(que);
+    return deque_get_capacity(queue_deque(que));
+}
+
+// Getter of the size of one element in bytes.
+size_t queue_get_element_size(const queue* que) {
+    queue_check_null(que);
+    return deque_get_element_size(queue_deque(que));
+}
+
+// Returns a pointer to the element at the specified position, counted from the front.
+void* queue_get_item_at(const queue* que, const size_t index) {
+    queue_check_null(que);
+    queue_check_index(que, index);
+    return deque_get_item_at(queue_deque(que), index);
+}
+
+// Returns a pointer to the first element (the next one to be dequeued) or NULL if the queue is empty.
+void* queue_get_front(const queue* que) {
+    queue_check_null(que);
+    return deque_get_front(queue_deque(que));
+}
+
+// Returns a pointer to the last element (the one enqueued most recently) or NULL if the queue is empty.
+void* queue_get_back(const queue* que) {
+    queue_check_null(que);
+    return deque_get_back(queue_deque(que));
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the queue is empty.
+bool queue_isempty(const queue* que) {
+    queue_check_null(que);
+    return deque_isempty(queue_deque(que));
+}
+
+// Checks whether the contents of the two queues are identical. The order of elements matters.
+bool queue_areequal(const queue* que1, const queue* que2) {
+    queue_check_null(que1);
+    queue_check_null(que2);
+    return deque_areequal(queue_deque(que1), queue_deque(que2));
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' to the back of the queue (bitwise, the queue takes ownership).
+void queue_enqueue(queue* que, const void* obj) {
+    queue_check_null(que);
+    deque_push_back(queue_deque(que), obj);
+}
+
+// Appends a zeroed slot to the back of the queue and returns it, so that the element can be constructed in place.
+void* queue_emplace(queue* que) {
+    queue_check_null(que);
+    return deque_emplace_back(queue_deque(que));
+}
+
+// Moves the front element into 'destination' and removes it. If 'destination' is NULL, the element is deleted instead.
+// Returns 'destination' (or the queue itself if 'destination' is NULL), or NULL if the queue was empty.
+void* queue_dequeue(queue* que, void* destination) {
+    queue_check_null(que);
+    return deque_pop_front(queue_deque(que), destination);
+}
+
+// Moves 'count' contiguous elements starting at 'elements' to the back of the queue, in order.
+void queue_enqueue_n(queue* que, const void* elements, const size_t count) {
+    queue_check_null(que);
+    deque_push_back_n(queue_deque(que), elements, count);
+}
+
+// Moves up to 'count' elements from the front into the contiguous 'destination', in order. If 'destination' is NULL,
+// the elements are deleted instead. Returns the number of elements dequeued.
+size_t queue_dequeue_n(queue* que, void* destination, const size_t count) {
+    queue_check_null(que);
+    return deque_pop_front_n(queue_deque(que), destination, count);
+}
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Makes sure that at least 'capacity' elements fit without growing.
+void queue_reserve(queue* que, const size_t capacity) {
+    queue_check_null(que);
+    deque_reserve(queue_deque(que), capacity);
+}
+
+// Shrinks the buffer to the smallest power of two holding the elements.
+void queue_shrink_to_fit(queue* que) {
+    queue_check_null(que);
+    deque_shrink_to_fit(queue_deque(que));
+}
+
+/* ====================================================== */
+/* =========== Immutative queue manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'que'.
+queue* queue_copy(const queue* que) {
+    queue_check_null(que);
+    return (queue*)deque_copy(queue_deque(que));
+}
+
+/* ====================================================== */
+/* ============ Mutative queue manipulations ============ */
+/* ====================================================== */
+
+// Erases all the elements of the queue, resulting in an empty one. The capacity is kept.
+void queue_mut_clean(queue* que) {
+    queue_check_null(que);
+    deque_mut_clean(queue_deque(que));
+}
+
+// Swaps the contents of two queues in O(1). Queues of different element size or callbacks are left unchanged, with the warning of 'deque_mut_swap()'.
+void queue_mut_swap(queue* que1, queue* que2) {
+    queue_check_null(que1);
+    queue_check_null(que2);
+    deque_mut_swap(queue_deque(que1), queue_deque(que2));
+}
@@ -0,0 +1,146 @@
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'queue' type is a first-in, first-out container stored in one contiguous circular buffer: the ring buffer of 'deque',
+which it adapts by enqueueing at the back and dequeueing at the front only.
+Therefore, it has the following characteristics:
+    - the capacity is always a power of two, so wrapping around is a bit mask instead of a division
+    - enqueueing and dequeueing take O(1) time; batches are copied with at most two 'memcpy()' calls
+    - growing doubles the buffer and unwraps its contents once
+Similar in nature to std::queue in C++ (on top of std::deque).
+
+The callback functions follow the conventions of 'array': they receive pointers to the element slots.
+Growing may move the elements, so pointers into the queue are only valid until the next insertion.
+*/
+
+// Type definition of 'queue' type.
+typedef struct _queue queue;
+
+// Alternative 'keyword' for type 'queue'.
+typedef queue Queue;
+
+// Alternative 'keyword' for type 'queue'.
+typedef queue queue_t;
+
+// Capacity of the first allocation of a queue created with capacity 0.
+#define CQUEUE_MINIMUM_CAPACITY 8
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of queue. 'capacity' is rounded up to a power of two and can be 0.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+queue* new_queue    (const size_t capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*));
+
+// Destructor of queue. Standardised template: void func_name(void* obj).
+void   delete_queue (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t queue_get_size         (const queue* que);
+
+// Getter of the number of elements that fit in the current buffer.
+size_t queue_get_capacity     (const queue* que);
+
+// Getter of the size of one element in bytes.
+size_t queue_get_element_size (const queue* que);
+
+// Returns a pointer to the element at the specified position, counted from the front.
+void*  queue_get_item_at      (const queue* que, const size_t index);
+
+// Returns a pointer to the first element (the next one to be dequeued) or NULL if the queue is empty.
+void*  queue_get_front        (const queue* que);
+
+// Returns a pointer to the last element (the one enqueued most recently) or NULL if the queue is empty.
+void*  queue_get_back         (const queue* que);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the queue is empty.
+bool queue_isempty  (const queue* que);
+
+// Checks whether the contents of the two queues are identical. The order of elements matters.
+bool queue_areequal (const queue* que1, const queue* que2);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' to the back of the queue (bitwise, the queue takes ownership).
+void   queue_enqueue   (queue* que, const void* obj);
+
+// Appends a zeroed slot to the back of the queue and returns it, so that the element can be constructed in place.
+void*  queue_emplace   (queue* que);
+
+// Moves the front element into 'destination' and removes it. If 'destination' is NULL, the element is deleted instead.
+// Returns 'destination' (or the queue itself if 'destination' is NULL), or NULL if the queue was empty.
+void*  queue_dequeue   (queue* que, void* destination);
+
+// Moves 'count' contiguous elements starting at 'elements' to the back of the queue, in order.
+void   queue_enqueue_n (queue* que, const void* elements, const size_t count);
+
+// Moves up to 'count' elements from the front into the contiguous 'destination', in order. If 'destination' is NULL,
+// the elements are deleted instead. Returns the number of elements dequeued.
+size_t queue_dequeue_n (queue* que, void* destination, const size_t count);
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Makes sure that at least 'capacity' elements fit without growing.
+void queue_reserve       (queue* que, const size_t capacity);
+
+// Shrinks the buffer to the smallest power of two holding the elements.
+void queue_shrink_to_fit (queue* que);
+
+/* ====================================================== */
+/* =========== Immutative queue manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'que'.
+queue* queue_copy (const queue* que);
+
+/* ====================================================== */
+/* ============ Mutative queue manipulations ============ */
+/* ====================================================== */
+
+// Erases all the elements of the queue, resulting in an empty one. The capacity is kept.
+void queue_mut_clean (queue* que);
+
+// Swaps the contents of two queues in O(1). Queues of different element size or callbacks are left unchanged, with the warning of 'deque_mut_swap()'.
+void queue_mut_swap  (queue* que1, queue* que2);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CQUEUE_WARNMSG_EMPTY_ELEMENT_SIZE "Warning: element size cannot be 0."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CQUEUE_ERRMSSG_NULL_QUEUE "Error: queue is a null pointer."
+#define CQUEUE_ERRCODE_NULL_QUEUE -1
+
+#define CQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CQUEUE_ERRMSSG_INDEX_OUT_OF_BOUNDS "Error: index out of bounds."
+#define CQUEUE_ERRCODE_INDEX_OUT_OF_BOUNDS -3
+
+#endif // QUEUE_H
@@ -0,0 +1,845 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "cradixtree.h"
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+enum { RADIXTREE_NODE4, RADIXTREE_NODE16, RADIXTREE_NODE48, RADIXTREE_NODE256, RADIXTREE_LEAF };
+
+// Nodes shrink to the next smaller layout only well below its capacity, so that alternating insertions
+// and removals around a boundary do not reallocate every time.
+#define CRADIXTREE_SHRINK16  3
+#define CRADIXTREE_SHRINK48  12
+#define CRADIXTREE_SHRINK256 37
+
+// Every node starts with its type.
+typedef struct {
+    uint8_t type;
+} radixtree_node;
+
+// A leaf holds the value and, right after it, the whole key.
+typedef struct {
+    uint8_t type;
+    size_t length;
+    max_align_t data[];
+} radixtree_leaf;
+
+// Header of the inner nodes. The 'prefix_length' bytes of the compressed path are stored after the node's own layout.
+typedef struct {
+    uint8_t type;
+    uint16_t count;
+    size_t prefix_length;
+    radixtree_leaf* terminal;   // the key ending at this node, if any
+} radixtree_inner;
+
+typedef struct {
+    radixtree_inner header;
+    uint8_t keys[4];            // sorted
+    radixtree_node* children[4];
+} radixtree_node4;
+
+typedef struct {
+    radixtree_inner header;
+    uint8_t keys[16];           // sorted
+    radixtree_node* children[16];
+} radixtree_node16;
+
+typedef struct {
+    radixtree_inner header;
+    uint8_t index[256];         // slot + 1 of the child of every byte, 0 if there is none
+    radixtree_node* children[48];
+} radixtree_node48;
+
+typedef struct {
+    radixtree_inner header;
+    radixtree_node* children[256];
+} radixtree_node256;
+
+static const size_t radixtree_node_sizes[] = {
+    sizeof(radixtree_node4), sizeof(radixtree_node16), sizeof(radixtree_node48), sizeof(radixtree_node256)
+};
+
+struct _radixtree {
+    radixtree_node* root;
+    size_t size;
+    size_t value_size;
+    void (*value_destructor)(void*);
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void radixtree_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CRADIXTREE_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void radixtree_check_null(const radixtree* tree) {
+    if (!tree) radixtree_error_handling(CRADIXTREE_ERRMSSG_NULL_RADIXTREE,
+                                        CRADIXTREE_ERRCODE_NULL_RADIXTREE);
+}
+
+static void* radixtree_allocate(const size_t size) {
+    void* memory = malloc(size);
+
+    if (!memory) radixtree_error_handling(CRADIXTREE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                          CRADIXTREE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    return memory;
+}
+
+/* ================================ */
+/* ============ Leaves ============ */
+/* ================================ */
+
+static inline unsigned char* radixtree_leaf_value(radixtree_leaf* leaf) {
+    return (unsigned char*)leaf->data;
+}
+
+static inline const unsigned char* radixtree_leaf_key(const radixtree* tree, const radixtree_leaf* leaf) {
+    return (const unsigned char*)leaf->data + tree->value_size;
+}
+
+static radixtree_leaf* radixtree_new_leaf(const radixtree* tree, const unsigned char* key, const size_t length, const void* value) {
+    radixtree_leaf* leaf = radixtree_allocate(sizeof(radixtree_leaf) + tree->value_size + length);
+
+    leaf->type = RADIXTREE_LEAF;
+    leaf->length = length;
+    memcpy(radixtree_leaf_value(leaf), value, tree->value_size);
+    if (length) memcpy((unsigned char*)leaf->data + tree->value_size, key, length);
+    return leaf;
+}
+
+// Checks whether the leaf holds exactly the given key.
+static inline bool radixtree_leaf_matches(const radixtree* tree, const radixtree_leaf* leaf, const unsigned char* key, const size_t length) {
+    return leaf->length == length && (!length || !memcmp(radixtree_leaf_key(tree, leaf), key, length));
+}
+
+// Moves the value out of the leaf (or deletes it) and frees the leaf.
+static void radixtree_release_leaf(const radixtree* tree, radixtree_leaf* leaf, void* destination) {
+    if (destination) memcpy(destination, radixtree_leaf_value(leaf), tree->value_size);
+    else if (tree->value_destructor) tree->value_destructor(radixtree_leaf_value(leaf));
+    free(leaf);
+}
+
+/* ================================ */
+/* ========= Inner nodes ========== */
+/* ================================ */
+
+static inline unsigned char* radixtree_prefix(radixtree_inner* inner) {
+    return (unsigned char*)inner + radixtree_node_sizes[inner->type];
+}
+
+static radixtree_inner* radixtree_new_inner(const uint8_t type, const unsigned char* prefix, const size_t prefix_length) {
+    radixtree_inner* inner = radixtree_allocate(radixtree_node_sizes[type] + prefix_length);
+
+    memset(inner, 0, radixtree_node_sizes[type]);
+    inner->type = type;
+    inner->prefix_length = prefix_length;
+    if (prefix_length) memcpy(radixtree_prefix(inner), prefix, prefix_length);
+    return inner;
+}
+
+// Returns the number of leading bytes of the node's prefix that match the key from 'depth' on.
+static inline size_t radixtree_prefix_mismatch(radixtree_inner* inner, const unsigned char* key, const size_t length, const size_t depth) {
+    const unsigned char* prefix = radixtree_prefix(inner);
+    size_t limit = inner->prefix_length < length - depth ? inner->prefix_length : length - depth;
+    size_t i = 0;
+
+    while (i < limit && prefix[i] == key[depth + i]) i++;
+    return i;
+}
+
+// Returns the position of 'byte' among the first 'count' keys of a node16, or 16 if it is absent.
+static inline unsigned radixtree_node16_search(const radixtree_node16* node, const uint8_t byte) {
+    #if defined(__SSE2__)
+        __m128i keys = _mm_loadu_si128((const __m128i*)node->keys);
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(keys, _mm_set1_epi8((char)byte)));
+
+        mask &= (1u << node->header.count) - 1;
+        return mask ? (unsigned)__builtin_ctz(mask) : 16;
+    #else
+        for (unsigned i = 0; i < node->header.count; i++) {
+            if (node->keys[i] == byte) return i;
+        }
+        return 16;
+    #endif
+}
+
+// Returns the reference to the child of the given byte, or NULL if there is none.
+static radixtree_node** radixtree_find_child(radixtree_inner* inner, const uint8_t byte) {
+    switch (inner->type) {
+        case RADIXTREE_NODE4: {
+            radixtree_node4* node = (radixtree_node4*)inner;
+            for (unsigned i = 0; i < inner->count; i++) {
+                if (node->keys[i] == byte) return &node->children[i];
+            }
+            return NULL;
+        }
+        case RADIXTREE_NODE16: {
+            radixtree_node16* node = (radixtree_node16*)inner;
+            unsigned i = radixtree_node16_search(node, byte);
+            return i < 16 ? &node->children[i] : NULL;
+        }
+        case RADIXTREE_NODE48: {
+            radixtree_node48* node = (radixtree_node48*)inner;
+            return node->index[byte] ? &node->children[node->index[byte] - 1] : NULL;
+        }
+        default: {
+            radixtree_node256* node = (radixtree_node256*)inner;
+            return node->children[byte] ? &node->children[byte] : NULL;
+        }
+    }
+}
+
+// Reallocates the node into the given layout, moving its header, children and prefix. The old node is freed.
+static radixtree_inner* radixtree_change_layout(radixtree_inner* inner, const uint8_t type) {
+    radixtree_inner* result = radixtree_new_inner(type, radixtree_prefix(inner), inner->prefix_length);
+    uint8_t bytes[256];
+    radixtree_node* children[256];
+    unsigned count = 0;
+
+    result->terminal = inner->terminal;
+
+    // Gather the children in byte order.
+    switch (inner->type) {
+        case RADIXTREE_NODE4: {
+            radixtree_node4* node = (radixtree_node4*)inner;
+            for (; count < inner->count; count++) { bytes[count] = node->keys[count]; children[count] = node->children[count]; }
+            break;
+        }
+        case RADIXTREE_NODE16: {
+            radixtree_node16* node = (radixtree_node16*)inner;
+            for (; count < inner->count; count++) { bytes[count] = node->keys[count]; children[count] = node->children[count]; }
+            break;
+        }
+        case RADIXTREE_NODE48: {
+            radixtree_node48* node = (radixtree_node48*)inner;
+            for (unsigned byte = 0; byte < 256; byte++) {
+                if (node->index[byte]) { bytes[count] = (uint8_t)byte; children[count++] = node->children[node->index[byte] - 1]; }
+            }
+            break;
+        }
+        default: {
+            radixtree_node256* node = (radixtree_node256*)inner;
+            for (unsigned byte = 0; byte < 256; byte++) {
+                if (node->children[byte]) { bytes[count] = (uint8_t)byte; children[count++] = node->children[byte]; }
+            }
+            break;
+        }
+    }
+
+    switch (type) {
+        case RADIXTREE_NODE4: {
+            radixtree_node4* node = (radixtree_node4*)result;
+            memcpy(node->keys, bytes, count);
+            memcpy(node->children, children, count * sizeof(radixtree_node*));
+            break;
+        }
+        case RADIXTREE_NODE16: {
+            radixtree_node16* node = (radixtree_node16*)result;
+            memcpy(node->keys, bytes, count);
+            memcpy(node->children, children, count * sizeof(radixtree_node*));
+            break;
+        }
+        case RADIXTREE_NODE48: {
+            radixtree_node48* node = (radixtree_node48*)result;
+            for (unsigned i = 0; i < count; i++) { node->index[bytes[i]] = (uint8_t)(i + 1); node->children[i] = children[i]; }
+            break;
+        }
+        default: {
+            radixtree_node256* node = (radixtree_node256*)result;
+            for (unsigned i = 0; i < count; i++) node->children[bytes[i]] = children[i];
+            break;
+        }
+    }
+
+    result->count = (uint16_t)count;
+    free(inner);
+    return result;
+}
+
+// Inserts a child into a sorted key array of 'count' entries.
+static inline void radixtree_sorted_insert(uint8_t* keys, radixtree_node** children, const unsigned count,
+                                           const uint8_t byte, radixtree_node* child) {
+    unsigned position = 0;
+    while (position < count && keys[position] < byte) position++;
+
+    memmove(keys + position + 1, keys + position, count - position);
+    memmove(children + position + 1, children + position, (count - position) * sizeof(radixtree_node*));
+    keys[position] = byte;
+    children[position] = child;
+}
+
+// Adds a child for a byte that has none, growing the node (and updating '*ref') when it is full.
+static void radixtree_add_child(radixtree_node** ref, const uint8_t byte, radixtree_node* child) {
+    radixtree_inner* inner = (radixtree_inner*)*ref;
+
+    if ((inner->type == RADIXTREE_NODE4 && inner->count == 4) || (inner->type == RADIXTREE_NODE16 && inner->count == 16) ||
+        (inner->type == RADIXTREE_NODE48 && inner->count == 48)) {
+        inner = radixtree_change_layout(inner, (uint8_t)(inner->type + 1));
+        *ref = (radixtree_node*)inner;
+    }
+
+    switch (inner->type) {
+        case RADIXTREE_NODE4: {
+            radixtree_node4* node = (radixtree_node4*)inner;
+            radixtree_sorted_insert(node->keys, node->children, inner->count, byte, child);
+            break;
+        }
+        case RADIXTREE_NODE16: {
+            radixtree_node16* node = (radixtree_node16*)inner;
+            radixtree_sorted_insert(node->keys, node->children, inner->count, byte, child);
+            break;
+        }
+        case RADIXTREE_NODE48: {
+            // The slots are kept dense, removals move the last slot into the hole.
+            radixtree_node48* node = (radixtree_node48*)inner;
+            node->children[inner->count] = child;
+            node->index[byte] = (uint8_t)(inner->count + 1);
+            break;
+        }
+        default:
+            ((radixtree_node256*)inner)->children[byte] = child;
+            break;
+    }
+
+    inner->count++;
+}
+
+// Removes the child of a byte that has one. The node is not shrunk here.
+static void radixtree_remove_child(radixtree_inner* inner, const uint8_t byte) {
+    switch (inner->type) {
+        case RADIXTREE_NODE4:
+        case RADIXTREE_NODE16: {
+            uint8_t* keys = inner->type == RADIXTREE_NODE4 ? ((radixtree_node4*)inner)->keys : ((radixtree_node16*)inner)->keys;
+            radixtree_node** children = inner->type == RADIXTREE_NODE4 ? ((radixtree_node4*)inner)->children
+                                                                        : ((radixtree_node16*)inner)->children;
+            unsigned position = 0;
+            while (keys[position] != byte) position++;
+
+            memmove(keys + position, keys + position + 1, inner->count - position - 1);
+            memmove(children + position, children + position + 1, (inner->count - position - 1) * sizeof(radixtree_node*));
+            break;
+        }
+        case RADIXTREE_NODE48: {
+            radixtree_node48* node = (radixtree_node48*)inner;
+            unsigned slot = node->index[byte] - 1u, last = inner->count - 1u;
+
+            node->index[byte] = 0;
+            if (slot != last) {
+                node->children[slot] = node->children[last];
+                for (unsigned other = 0; other < 256; other++) {
+                    if (node->index[other] == last + 1) { node->index[other] = (uint8_t)(slot + 1); break; }
+                }
+            }
+            break;
+        }
+        default:
+            ((radixtree_node256*)inner)->children[byte] = NULL;
+            break;
+    }
+
+    inner->count--;
+}
+
+// Restores the invariants of a node after a removal below it: a node without children is replaced by its terminal leaf,
+// a node with a single child and no terminal is merged into the child, and sparse nodes move to a smaller layout.
+static void radixtree_normalize(radixtree_node** ref) {
+    radixtree_inner* inner = (radixtree_inner*)*ref;
+
+    if (inner->count == 0) {
+        *ref = (radixtree_node*)inner->terminal;
+        free(inner);
+        return;
+    }
+
+    if (inner->count == 1 && !inner->terminal) {
+        uint8_t byte = 0;
+        radixtree_node* child = NULL;
+
+        for (unsigned candidate = 0; candidate < 256 && !child; candidate++) {
+            radixtree_node** found = radixtree_find_child(inner, (uint8_t)candidate);
+            if (found) { byte = (uint8_t)candidate; child = *found; }
+        }
+
+        if (child->type != RADIXTREE_LEAF) {
+            // The child's prefix becomes this node's prefix, the branching byte, then its own prefix.
+            radixtree_inner* below = (radixtree_inner*)child;
+            size_t length = inner->prefix_length + 1 + below->prefix_length;
+            radixtree_inner* merged = realloc(below, radixtree_node_sizes[below->type] + length);
+
+            if (!merged) radixtree_error_handling(CRADIXTREE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                  CRADIXTREE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+            unsigned char* prefix = radixtree_prefix(merged);
+            memmove(prefix + inner->prefix_length + 1, prefix, merged->prefix_length);
+            memcpy(prefix, radixtree_prefix(inner), inner->prefix_length);
+            prefix[inner->prefix_length] = byte;
+            merged->prefix_length = length;
+            child = (radixtree_node*)merged;
+        }
+
+        *ref = child;
+        free(inner);
+        return;
+    }
+
+    if ((inner->type == RADIXTREE_NODE16 && inner->count <= CRADIXTREE_SHRINK16) ||
+        (inner->type == RADIXTREE_NODE48 && inner->count <= CRADIXTREE_SHRINK48) ||
+        (inner->type == RADIXTREE_NODE256 && inner->count <= CRADIXTREE_SHRINK256)) {
+        *ref = (radixtree_node*)radixtree_change_layout(inner, (uint8_t)(inner->type - 1));
+    }
+}
+
+// Frees a subtree, deleting its values.
+static void radixtree_free_node(const radixtree* tree, radixtree_node* node) {
+    if (!node) return;
+
+    if (node->type == RADIXTREE_LEAF) {
+        radixtree_release_leaf(tree, (radixtree_leaf*)node, NULL);
+        return;
+    }
+
+    radixtree_inner* inner = (radixtree_inner*)node;
+    if (inner->terminal) radixtree_release_leaf(tree, inner->terminal, NULL);
+
+    switch (inner->type) {
+        case RADIXTREE_NODE4:
+            for (unsigned i = 0; i < inner->count; i++) radixtree_free_node(tree, ((radixtree_node4*)inner)->children[i]);
+            break;
+        case RADIXTREE_NODE16:
+            for (unsigned i = 0; i < inner->count; i++) radixtree_free_node(tree, ((radixtree_node16*)inner)->children[i]);
+            break;
+        case RADIXTREE_NODE48:
+            for (unsigned i = 0; i < inner->count; i++) radixtree_free_node(tree, ((radixtree_node48*)inner)->children[i]);
+            break;
+        default:
+            for (unsigned i = 0; i < 256; i++) radixtree_free_node(tree, ((radixtree_node256*)inner)->children[i]);
+            break;
+    }
+
+    free(inner);
+}
+
+/* ================================ */
+/* ========== Traversals ========== */
+/* ================================ */
+
+// Returns the leaf of the key, or NULL.
+static radixtree_leaf* radixtree_lookup(const radixtree* tree, const unsigned char* key, const size_t length) {
+    radixtree_node* node = tree->root;
+    size_t depth = 0;
+
+    while (node) {
+        if (node->type == RADIXTREE_LEAF) {
+            radixtree_leaf* leaf = (radixtree_leaf*)node;
+            return radixtree_leaf_matches(tree, leaf, key, length) ? leaf : NULL;
+        }
+
+        radixtree_inner* inner = (radixtree_inner*)node;
+        if (radixtree_prefix_mismatch(inner, key, length, depth) != inner->prefix_length) return NULL;
+
+        depth += inner->prefix_length;
+        if (depth == length) return inner->terminal;
+
+        radixtree_node** child = radixtree_find_child(inner, key[depth++]);
+        node = child ? *child : NULL;
+    }
+
+    return NULL;
+}
+
+// Walks down along 'key' and calls 'visitor' with every stored prefix of it, shortest first.
+// Returns the last (longest) one, or NULL; stops early if the visitor returns false.
+static radixtree_leaf* radixtree_walk_prefixes(const radixtree* tree, const unsigned char* key, const size_t length,
+                                               radixtree_visitor visitor, void* context) {
+    radixtree_node* node = tree->root;
+    radixtree_leaf* best = NULL;
+    size_t depth = 0;
+
+    while (node) {
+        if (node->type == RADIXTREE_LEAF) {
+            // Every byte before 'depth' has already been matched on the way down.
+            radixtree_leaf* leaf = (radixtree_leaf*)node;
+            if (leaf->length <= length && !memcmp(radixtree_leaf_key(tree, leaf) + depth, key + depth, leaf->length - depth)) {
+                best = leaf;
+                if (visitor) visitor(string_view_from_data((const char*)radixtree_leaf_key(tree, leaf), leaf->length),
+                                     radixtree_leaf_value(leaf), context);
+            }
+            break;
+        }
+
+        radixtree_inner* inner = (radixtree_inner*)node;
+        if (radixtree_prefix_mismatch(inner, key, length, depth) != inner->prefix_length) break;
+
+        depth += inner->prefix_length;
+        if (inner->terminal) {
+            best = inner->terminal;
+            if (visitor && !visitor(string_view_from_data((const char*)key, depth), radixtree_leaf_value(best), context)) break;
+        }
+        if (depth == length) break;
+
+        radixtree_node** child = radixtree_find_child(inner, key[depth++]);
+        node = child ? *child : NULL;
+    }
+
+    return best;
+}
+
+// Visits a subtree in lexicographic order: the key ending at a node precedes its extensions. Returns false if stopped.
+static bool radixtree_visit_node(const radixtree* tree, radixtree_node* node, radixtree_visitor visitor, void* context) {
+    if (node->type == RADIXTREE_LEAF) {
+        radixtree_leaf* leaf = (radixtree_leaf*)node;
+        return visitor(string_view_from_data((const char*)radixtree_leaf_key(tree, leaf), leaf->length),
+                       radixtree_leaf_value(leaf), context);
+    }
+
+    radixtree_inner* inner = (radixtree_inner*)node;
+    if (inner->terminal && !radixtree_visit_node(tree, (radixtree_node*)inner->terminal, visitor, context)) return false;
+
+    switch (inner->type) {
+        case RADIXTREE_NODE4:
+            for (unsigned i = 0; i < inner->count; i++) {
+                if (!radixtree_visit_node(tree, ((radixtree_node4*)inner)->children[i], visitor, context)) return false;
+            }
+            break;
+        case RADIXTREE_NODE16:
+            for (unsigned i = 0; i < inner->count; i++) {
+                if (!radixtree_visit_node(tree, ((radixtree_node16*)inner)->children[i], visitor, context)) return false;
+            }
+            break;
+        case RADIXTREE_NODE48: {
+            radixtree_node48* node48 = (radixtree_node48*)inner;
+            for (unsigned byte = 0; byte < 256; byte++) {
+                if (node48->index[byte] && !radixtree_visit_node(tree, node48->children[node48->index[byte] - 1], visitor, context)) {
+                    return false;
+                }
+            }
+            break;
+        }
+        default: {
+            radixtree_node256* node256 = (radixtree_node256*)inner;
+            for (unsigned byte = 0; byte < 256; byte++) {
+                if (node256->children[byte] && !radixtree_visit_node(tree, node256->children[byte], visitor, context)) return false;
+            }
+            break;
+        }
+    }
+
+    return true;
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of radix tree. 'value_size' is the size of one value in bytes, e.g. 'sizeof(void*)'.
+// 'value_destructor' receives pointers to the value slots and can be NULL.
+radixtree* new_radixtree(const size_t value_size, void (*value_destructor)(void*)) {
+    radixtree* tree = radixtree_allocate(sizeof(radixtree));
+
+    tree->root = NULL;
+    tree->size = 0;
+    tree->value_size = value_size;
+    tree->value_destructor = value_destructor;
+    return tree;
+}
+
+// Destructor of radix tree. Standardised template: void func_name(void* obj).
+void delete_radixtree(void* obj) {
+    radixtree* tree = (radixtree*)obj;
+    if (!tree) return;
+
+    radixtree_free_node(tree, tree->root);
+    free(tree);
+
+    tree = NULL;
+    obj = tree;
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored keys.
+size_t radixtree_get_size(const radixtree* tree) {
+    radixtree_check_null(tree);
+    return tree->size;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the tree is empty.
+bool radixtree_isempty(const radixtree* tree) {
+    radixtree_check_null(tree);
+    return tree->size == 0;
+}
+
+// Returns a pointer to the value of 'key' or NULL if the key is not present.
+void* radixtree_find(const radixtree* tree, const string* key) {
+    return radixtree_find_view(tree, string_get_view(key));
+}
+
+// Same as 'radixtree_find()' for a view key.
+void* radixtree_find_view(const radixtree* tree, const string_view key) {
+    radixtree_check_null(tree);
+
+    radixtree_leaf* leaf = radixtree_lookup(tree, (const unsigned char*)key.data, key.length);
+    return leaf ? radixtree_leaf_value(leaf) : NULL;
+}
+
+// Checks whether 'key' is present.
+bool radixtree_contains(const radixtree* tree, const string* key) {
+    return radixtree_find_view(tree, string_get_view(key)) != NULL;
+}
+
+// Same as 'radixtree_contains()' for a view key.
+bool radixtree_contains_view(const radixtree* tree, const string_view key) {
+    return radixtree_find_view(tree, key) != NULL;
+}
+
+/* ======================================= */
+/* =========== Prefix queries ============ */
+/* ======================================= */
+
+// Returns the value of the longest stored key that is a prefix of 'str' (or equal to it), or NULL if there is none.
+// If 'length' is not NULL, the length of that key is stored in it.
+void* radixtree_longest_prefix(const radixtree* tree, const string_view str, size_t* length) {
+    radixtree_check_null(tree);
+
+    radixtree_leaf* leaf = radixtree_walk_prefixes(tree, (const unsigned char*)str.data, str.length, NULL, NULL);
+    if (!leaf) return NULL;
+
+    if (length) *length = leaf->length;
+    return radixtree_leaf_value(leaf);
+}
+
+// Calls 'visitor' with every stored key that is a prefix of 'str' (or equal to it), shortest first.
+void radixtree_visit_prefixes(const radixtree* tree, const string_view str, radixtree_visitor visitor, void* context) {
+    radixtree_check_null(tree);
+    if (visitor) radixtree_walk_prefixes(tree, (const unsigned char*)str.data, str.length, visitor, context);
+}
+
+// Calls 'visitor' with every stored key that starts with 'prefix', in lexicographic order. An empty prefix visits every key.
+void radixtree_visit_range(const radixtree* tree, const string_view prefix, radixtree_visitor visitor, void* context) {
+    radixtree_check_null(tree);
+    if (!visitor) return;
+
+    const unsigned char* key = (const unsigned char*)prefix.data;
+    radixtree_node* node = tree->root;
+    size_t depth = 0;
+
+    // Descend until the prefix is used up; the subtree below that point is exactly the range.
+    while (node && depth < prefix.length) {
+        if (node->type == RADIXTREE_LEAF) {
+            radixtree_leaf* leaf = (radixtree_leaf*)node;
+            if (leaf->length < prefix.length ||
+                memcmp(radixtree_leaf_key(tree, leaf) + depth, key + depth, prefix.length - depth)) return;
+            break;
+        }
+
+        radixtree_inner* inner = (radixtree_inner*)node;
+        size_t matched = radixtree_prefix_mismatch(inner, key, prefix.length, depth);
+
+        if (depth + matched == prefix.length) break;
+        if (matched != inner->prefix_length) return;
+
+        depth += inner->prefix_length;
+        radixtree_node** child = radixtree_find_child(inner, key[depth++]);
+        node = child ? *child : NULL;
+    }
+
+    if (node) radixtree_visit_node(tree, node, visitor, context);
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the value pointed to by 'value' under a copy of 'key' (bitwise, the tree takes ownership). An existing value is overwritten.
+// Returns a pointer to the stored value.
+void* radixtree_insert(radixtree* tree, const string* key, const void* value) {
+    return radixtree_insert_view(tree, string_get_view(key), value);
+}
+
+// Same as 'radixtree_insert()' for a view key.
+void* radixtree_insert_view(radixtree* tree, const string_view key_view, const void* value) {
+    radixtree_check_null(tree);
+
+    const unsigned char* key = (const unsigned char*)key_view.data;
+    const size_t length = key_view.length;
+    radixtree_node** ref = &tree->root;
+    size_t depth = 0;
+
+    for (;;) {
+        radixtree_node* node = *ref;
+
+        if (!node) {
+            radixtree_leaf* leaf = radixtree_new_leaf(tree, key, length, value);
+            *ref = (radixtree_node*)leaf;
+            tree->size++;
+            return radixtree_leaf_value(leaf);
+        }
+
+        if (node->type == RADIXTREE_LEAF) {
+            radixtree_leaf* existing = (radixtree_leaf*)node;
+            const unsigned char* existing_key = radixtree_leaf_key(tree, existing);
+
+            if (radixtree_leaf_matches(tree, existing, key, length)) {
+                if (tree->value_destructor) tree->value_destructor(radixtree_leaf_value(existing));
+                memcpy(radixtree_leaf_value(existing), value, tree->value_size);
+                return radixtree_leaf_value(existing);
+            }
+
+            // Split the leaf: a new node holds the common part, each key hangs below it or ends at it.
+            size_t common = depth, limit = length < existing->length ? length : existing->length;
+            while (common < limit && key[common] == existing_key[common]) common++;
+
+            radixtree_node** inner_ref = ref;
+            radixtree_leaf* leaf = radixtree_new_leaf(tree, key, length, value);
+            radixtree_inner* inner = radixtree_new_inner(RADIXTREE_NODE4, key + depth, common - depth);
+            *inner_ref = (radixtree_node*)inner;
+
+            if (existing->length == common) inner->terminal = existing;
+            else radixtree_add_child(inner_ref, existing_key[common], node);
+
+            if (length == common) ((radixtree_inner*)*inner_ref)->terminal = leaf;
+            else radixtree_add_child(inner_ref, key[common], (radixtree_node*)leaf);
+
+            tree->size++;
+            return radixtree_leaf_value(leaf);
+        }
+
+        radixtree_inner* inner = (radixtree_inner*)node;
+        size_t matched = radixtree_prefix_mismatch(inner, key, length, depth);
+
+        if (matched < inner->prefix_length) {
+            // Split the compressed path: a new node takes the matching part, the old node keeps what follows the branching byte.
+            radixtree_inner* parent = radixtree_new_inner(RADIXTREE_NODE4, radixtree_prefix(inner), matched);
+            uint8_t byte = radixtree_prefix(inner)[matched];
+            size_t rest = inner->prefix_length - matched - 1;
+
+            memmove(radixtree_prefix(inner), radixtree_prefix(inner) + matched + 1, rest);
+            inner->prefix_length = rest;
+            radixtree_inner* shrunk = realloc(inner, radixtree_node_sizes[inner->type] + rest);
+            if (shrunk) inner = shrunk;
+
+            *ref = (radixtree_node*)parent;
+            radixtree_add_child(ref, byte, (radixtree_node*)inner);
+
+            radixtree_leaf* leaf = radixtree_new_leaf(tree, key, length, value);
+            if (depth + matched == length) parent->terminal = leaf;
+            else radixtree_add_child(ref, key[depth + matched], (radixtree_node*)leaf);
+
+            tree->size++;
+            return radixtree_leaf_value(leaf);
+        }
+
+        depth += inner->prefix_length;
+
+        if (depth == length) {
+            if (inner->terminal) {
+                unsigned char* slot = radixtree_leaf_value(inner->terminal);
+                if (tree->value_destructor) tree->value_destructor(slot);
+                memcpy(slot, value, tree->value_size);
+                return slot;
+            }
+
+            inner->terminal = radixtree_new_leaf(tree, key, length, value);
+            tree->size++;
+            return radixtree_leaf_value(inner->terminal);
+        }
+
+        radixtree_node** child = radixtree_find_child(inner, key[depth]);
+
+        if (!child) {
+            radixtree_leaf* leaf = radixtree_new_leaf(tree, key, length, value);
+            radixtree_add_child(ref, key[depth], (radixtree_node*)leaf);
+            tree->size++;
+            return radixtree_leaf_value(leaf);
+        }
+
+        ref = child;
+        depth++;
+    }
+}
+
+// Removes the key from the subtree at 'ref', restoring the invariants of every node on the way back up.
+static bool radixtree_remove_at(radixtree* tree, radixtree_node** ref, const unsigned char* key, const size_t length,
+                                size_t depth, void* destination) {
+    radixtree_node* node = *ref;
+    if (!node) return false;
+
+    if (node->type == RADIXTREE_LEAF) {
+        if (!radixtree_leaf_matches(tree, (radixtree_leaf*)node, key, length)) return false;
+
+        radixtree_release_leaf(tree, (radixtree_leaf*)node, destination);
+        *ref = NULL;
+        return true;
+    }
+
+    radixtree_inner* inner = (radixtree_inner*)node;
+    if (radixtree_prefix_mismatch(inner, key, length, depth) != inner->prefix_length) return false;
+    depth += inner->prefix_length;
+
+    if (depth == length) {
+        if (!inner->terminal) return false;
+
+        radixtree_release_leaf(tree, inner->terminal, destination);
+        inner->terminal = NULL;
+    }
+    else {
+        radixtree_node** child = radixtree_find_child(inner, key[depth]);
+        if (!child || !radixtree_remove_at(tree, child, key, length, depth + 1, destination)) return false;
+
+        if (!*child) radixtree_remove_child(inner, key[depth]);
+    }
+
+    radixtree_normalize(ref);
+    return true;
+}
+
+// Moves the value of 'key' into 'destination' (or deletes it if 'destination' is NULL) and removes the key. Returns whether it was present.
+bool radixtree_remove(radixtree* tree, const string* key, void* destination) {
+    return radixtree_remove_view(tree, string_get_view(key), destination);
+}
+
+// Same as 'radixtree_remove()' for a view key.
+bool radixtree_remove_view(radixtree* tree, const string_view key, void* destination) {
+    radixtree_check_null(tree);
+
+    if (!radixtree_remove_at(tree, &tree->root, (const unsigned char*)key.data, key.length, 0, destination)) return false;
+
+    tree->size--;
+    return true;
+}
+
+/* ====================================================== */
+/* =========== Mutative tree manipulations ============== */
+/* ====================================================== */
+
+// Erases all the keys of the tree, resulting in an empty one.
+void radixtree_mut_clean(radixtree* tree) {
+    radixtree_check_null(tree);
+
+    radixtree_free_node(tree, tree->root);
+    tree->root = NULL;
+    tree->size = 0;
+}
@@ -0,0 +1,125 @@
+#ifndef RADIXTREE_H
+#define RADIXTREE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cstring.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'radixtree' type maps 'string' keys to values of a fixed size, organised by the bytes of the keys (an adaptive radix tree).
+Therefore, it has the following characteristics:
+    - every inner node branches on one byte, and picks the smallest of four layouts for its number of children:
+      up to 4 or 16 children in sorted arrays, up to 48 through a 256-byte index, or a direct table of 256 children
+    - chains of nodes with a single child are collapsed into a prefix stored in their descendant (path compression),
+      so the memory grows with the number of distinct key bytes rather than with the alphabet
+    - a lookup visits one node per distinguishing byte and compares the whole key only at the leaf
+    - besides exact lookups, it finds the stored keys that are prefixes of a string (e.g. routing tables),
+      and the stored keys that start with a prefix (e.g. autocompletion), in lexicographic order
+Similar in nature to the ART index of HyPer and DuckDB.
+
+The tree owns copies of its keys. Values are stored inline ('value_size' bytes each) and follow the callback conventions of 'hashmap'.
+*/
+
+// Type definition of 'radixtree' type.
+typedef struct _radixtree radixtree;
+
+// Alternative 'keyword' for type 'radixtree'.
+typedef radixtree RadixTree;
+
+// Alternative 'keyword' for type 'radixtree'.
+typedef radixtree radixtree_t;
+
+// Callback of the visiting functions, called with every matching key and its value. Returning false stops the visit.
+typedef bool (*radixtree_visitor)(const string_view key, void* value, void* context);
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of radix tree. 'value_size' is the size of one value in bytes, e.g. 'sizeof(void*)'.
+// 'value_destructor' receives pointers to the value slots and can be NULL.
+radixtree* new_radixtree    (const size_t value_size, void (*value_destructor)(void*));
+
+// Destructor of radix tree. Standardised template: void func_name(void* obj).
+void       delete_radixtree (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored keys.
+size_t radixtree_get_size (const radixtree* tree);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the tree is empty.
+bool  radixtree_isempty       (const radixtree* tree);
+
+// Returns a pointer to the value of 'key' or NULL if the key is not present.
+void* radixtree_find          (const radixtree* tree, const string* key);
+
+// Same as 'radixtree_find()' for a view key.
+void* radixtree_find_view     (const radixtree* tree, const string_view key);
+
+// Checks whether 'key' is present.
+bool  radixtree_contains      (const radixtree* tree, const string* key);
+
+// Same as 'radixtree_contains()' for a view key.
+bool  radixtree_contains_view (const radixtree* tree, const string_view key);
+
+/* ======================================= */
+/* =========== Prefix queries ============ */
+/* ======================================= */
+
+// Returns the value of the longest stored key that is a prefix of 'str' (or equal to it), or NULL if there is none.
+// If 'length' is not NULL, the length of that key is stored in it.
+void* radixtree_longest_prefix  (const radixtree* tree, const string_view str, size_t* length);
+
+// Calls 'visitor' with every stored key that is a prefix of 'str' (or equal to it), shortest first.
+void  radixtree_visit_prefixes  (const radixtree* tree, const string_view str, radixtree_visitor visitor, void* context);
+
+// Calls 'visitor' with every stored key that starts with 'prefix', in lexicographic order. An empty prefix visits every key.
+void  radixtree_visit_range     (const radixtree* tree, const string_view prefix, radixtree_visitor visitor, void* context);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the value pointed to by 'value' under a copy of 'key' (bitwise, the tree takes ownership). An existing value is overwritten.
+// Returns a pointer to the stored value.
+void* radixtree_insert      (radixtree* tree, const string* key, const void* value);
+
+// Same as 'radixtree_insert()' for a view key.
+void* radixtree_insert_view (radixtree* tree, const string_view key, const void* value);
+
+// Moves the value of 'key' into 'destination' (or deletes it if 'destination' is NULL) and removes the key. Returns whether it was present.
+bool  radixtree_remove      (radixtree* tree, const string* key, void* destination);
+
+// Same as 'radixtree_remove()' for a view key.
+bool  radixtree_remove_view (radixtree* tree, const string_view key, void* destination);
+
+/* ====================================================== */
+/* =========== Mutative tree manipulations ============== */
+/* ====================================================== */
+
+// Erases all the keys of the tree, resulting in an empty one.
+void radixtree_mut_clean (radixtree* tree);
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CRADIXTREE_ERRMSSG_NULL_RADIXTREE "Error: radix tree is a null pointer."
+#define CRADIXTREE_ERRCODE_NULL_RADIXTREE -1
+
+#define CRADIXTREE_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CRADIXTREE_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // RADIXTREE_H
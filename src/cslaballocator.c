@@ -0,0 +1,588 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "cslaballocator.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+// Slabs are carved out of chunks of this many slabs, mapped from the system at once. A slab per 'aligned_alloc()' would cost
+// the heap about twice its size in alignment padding.
+#define CSLABALLOCATOR_CHUNK_SLABS 64
+
+// Released slabs kept ready for reuse with their memory. Beyond them, the memory of released slabs is given back to the system.
+#define CSLABALLOCATOR_SPARE_SLABS 16
+
+// Number of free blocks a thread cache keeps per class. An empty cache is refilled, and a full one flushed, by half of it.
+#define CSLABALLOCATOR_CACHE_BLOCKS 32
+
+// Block sizes of the classes: steps of 16 bytes up to 128, then four classes per doubling.
+static const uint16_t slaballocator_class_sizes[CSLABALLOCATOR_CLASS_COUNT] = {
+    16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512
+};
+
+// The slab header sits at the start of the slab, the blocks follow it.
+typedef struct slaballocator_slab {
+    struct slaballocator_slab* next;
+    struct slaballocator_slab* prev;
+    void* free;                 // blocks freed into this slab, linked through their first word
+    uint16_t used;
+    uint16_t carved;            // blocks handed out at least once; the rest of the slab has never been touched
+    uint8_t class_index;
+} slaballocator_slab;
+
+// Offset of the first block, keeping the blocks aligned for any type.
+#define CSLABALLOCATOR_HEADER_BYTES \
+    ((sizeof(slaballocator_slab) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t))
+
+typedef struct {
+    slaballocator_slab* partial;    // slabs with at least one free block
+    slaballocator_slab* full;
+    size_t capacity;                // blocks per slab
+    size_t slab_count;
+    size_t empty_count;             // slabs of 'partial' without blocks in use; one is kept to absorb alternating alloc/free
+    size_t objects_in_use;
+    size_t allocations;
+} slaballocator_class;
+
+// Free blocks of one thread, per class.
+typedef struct slaballocator_cache {
+    struct slaballocator_cache* next;
+    struct slaballocator_cache* prev;
+    slaballocator* owner;
+    size_t counts[CSLABALLOCATOR_CLASS_COUNT];
+    void* blocks[CSLABALLOCATOR_CLASS_COUNT][CSLABALLOCATOR_CACHE_BLOCKS];
+} slaballocator_cache;
+
+struct _slaballocator {
+    slaballocator_class classes[CSLABALLOCATOR_CLASS_COUNT];
+    slaballocator_mode mode;
+    pthread_mutex_t lock;           // guards the classes and the list of caches, unless the mode is local
+    pthread_key_t cache_key;        // the cache of the calling thread, in thread cache mode
+    slaballocator_cache* caches;
+
+    // Chunks mapped so far, unmapped when the allocator is cleaned or deleted.
+    void** chunks;
+    size_t chunk_count;
+    size_t chunk_capacity;
+    unsigned char* carve;           // next never used slab of the last chunk
+    size_t carve_left;
+
+    // Slabs no class uses, mapped but possibly without memory; reused before carving new ones.
+    void** spares;
+    size_t spare_count;
+    size_t spare_capacity;
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void slaballocator_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CSLABALLOCATOR_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void slaballocator_check_null(const slaballocator* sa) {
+    if (!sa) slaballocator_error_handling(CSLABALLOCATOR_ERRMSSG_NULL_SLABALLOCATOR,
+                                          CSLABALLOCATOR_ERRCODE_NULL_SLABALLOCATOR);
+}
+
+// General warning handling function.
+static void slaballocator_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CSLABALLOCATOR_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ======== Slabs, classes ======== */
+/* ================================ */
+
+// Returns the class serving 'size' bytes, which must be at most 'CSLABALLOCATOR_MAX_SIZE'.
+static inline size_t slaballocator_class_of(const size_t size) {
+    // Indexed by the size in 16-byte units, rounded up.
+    static const uint8_t classes[CSLABALLOCATOR_MAX_SIZE / 16 + 1] = {
+        0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 9, 10, 10, 11, 11,
+        12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15
+    };
+
+    return classes[(size + 15) / 16];
+}
+
+// Returns the slab a block belongs to: slabs are aligned to their size.
+static inline slaballocator_slab* slaballocator_slab_of(const void* block) {
+    return (slaballocator_slab*)((uintptr_t)block & ~(uintptr_t)(CSLABALLOCATOR_SLAB_BYTES - 1));
+}
+
+static inline void slaballocator_lock(slaballocator* sa) {
+    if (sa->mode != SLABALLOCATOR_LOCAL) pthread_mutex_lock(&sa->lock);
+}
+
+static inline void slaballocator_unlock(slaballocator* sa) {
+    if (sa->mode != SLABALLOCATOR_LOCAL) pthread_mutex_unlock(&sa->lock);
+}
+
+static inline void slaballocator_list_push(slaballocator_slab** list, slaballocator_slab* slab) {
+    slab->prev = NULL;
+    slab->next = *list;
+    if (*list) (*list)->prev = slab;
+    *list = slab;
+}
+
+static inline void slaballocator_list_unlink(slaballocator_slab** list, slaballocator_slab* slab) {
+    if (slab->prev) slab->prev->next = slab->next;
+    else *list = slab->next;
+    if (slab->next) slab->next->prev = slab->prev;
+}
+
+// Gives the memory of a slab back to the system. The slab stays mapped, and reads as zeros when it is used again.
+static void slaballocator_discard(void* slab) {
+    #if defined(MADV_DONTNEED)
+        madvise(slab, CSLABALLOCATOR_SLAB_BYTES, MADV_DONTNEED);
+    #else
+        (void)slab;
+    #endif
+}
+
+// Returns an unused slab: a spare one, or one carved out of the last chunk, mapping a new chunk if needed. The caller holds the lock.
+static void* slaballocator_slab_acquire(slaballocator* sa) {
+    if (sa->spare_count) return sa->spares[--sa->spare_count];
+
+    if (!sa->carve_left) {
+        if (sa->chunk_count == sa->chunk_capacity) {
+            size_t capacity = sa->chunk_capacity ? 2 * sa->chunk_capacity : 8;
+            void** chunks = realloc(sa->chunks, capacity * sizeof(void*));
+
+            if (!chunks) slaballocator_error_handling(CSLABALLOCATOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                      CSLABALLOCATOR_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+            sa->chunks = chunks;
+            sa->chunk_capacity = capacity;
+        }
+
+        // Mappings are page-aligned, and a slab is one page, so the slabs are aligned to their size.
+        void* chunk = mmap(NULL, CSLABALLOCATOR_CHUNK_SLABS * CSLABALLOCATOR_SLAB_BYTES, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (chunk == MAP_FAILED) slaballocator_error_handling(CSLABALLOCATOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                              CSLABALLOCATOR_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+        sa->chunks[sa->chunk_count++] = chunk;
+        sa->carve = chunk;
+        sa->carve_left = CSLABALLOCATOR_CHUNK_SLABS;
+    }
+
+    void* slab = sa->carve;
+    sa->carve += CSLABALLOCATOR_SLAB_BYTES;
+    sa->carve_left--;
+    return slab;
+}
+
+// Keeps a slab no class uses anymore for reuse. The caller holds the lock.
+static void slaballocator_slab_release(slaballocator* sa, void* slab) {
+    if (sa->spare_count == sa->spare_capacity) {
+        size_t capacity = sa->spare_capacity ? 2 * sa->spare_capacity : 16;
+        void** spares = realloc(sa->spares, capacity * sizeof(void*));
+
+        if (!spares) slaballocator_error_handling(CSLABALLOCATOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                  CSLABALLOCATOR_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+        sa->spares = spares;
+        sa->spare_capacity = capacity;
+    }
+
+    if (sa->spare_count >= CSLABALLOCATOR_SPARE_SLABS) slaballocator_discard(slab);
+    sa->spares[sa->spare_count++] = slab;
+}
+
+// Unmaps every chunk, releasing all slabs at once. The caller holds the lock.
+static void slaballocator_unmap_all(slaballocator* sa) {
+    for (size_t i = 0; i < sa->chunk_count; i++) munmap(sa->chunks[i], CSLABALLOCATOR_CHUNK_SLABS * CSLABALLOCATOR_SLAB_BYTES);
+    sa->chunk_count = 0;
+    sa->carve = NULL;
+    sa->carve_left = 0;
+    sa->spare_count = 0;
+}
+
+// Takes a block from the slabs of a class. The caller holds the lock.
+static void* slaballocator_class_alloc(slaballocator* sa, const size_t class_index) {
+    slaballocator_class* cls = &sa->classes[class_index];
+    slaballocator_slab* slab = cls->partial;
+
+    if (!slab) {
+        slab = slaballocator_slab_acquire(sa);
+        slab->free = NULL;
+        slab->used = 0;
+        slab->carved = 0;
+        slab->class_index = (uint8_t)class_index;
+        slaballocator_list_push(&cls->partial, slab);
+        cls->slab_count++;
+        cls->empty_count++;
+    }
+
+    if (slab->used == 0) cls->empty_count--;
+
+    void* block;
+    if (slab->free) {
+        block = slab->free;
+        slab->free = *(void**)block;
+    }
+    else {
+        block = (unsigned char*)slab + CSLABALLOCATOR_HEADER_BYTES + (size_t)slab->carved * slaballocator_class_sizes[class_index];
+        slab->carved++;
+    }
+
+    if (++slab->used == cls->capacity) {
+        slaballocator_list_unlink(&cls->partial, slab);
+        slaballocator_list_push(&cls->full, slab);
+    }
+
+    cls->objects_in_use++;
+    cls->allocations++;
+    return block;
+}
+
+// Returns a block to its slab. The caller holds the lock.
+static void slaballocator_class_free(slaballocator* sa, void* block) {
+    slaballocator_slab* slab = slaballocator_slab_of(block);
+    slaballocator_class* cls = &sa->classes[slab->class_index];
+
+    if (slab->used == cls->capacity) {
+        slaballocator_list_unlink(&cls->full, slab);
+        slaballocator_list_push(&cls->partial, slab);
+    }
+
+    *(void**)block = slab->free;
+    slab->free = block;
+    cls->objects_in_use--;
+
+    if (--slab->used == 0) {
+        // Keep one empty slab per class, so that a block allocated and freed in a loop does not map a page every time.
+        if (cls->empty_count) {
+            slaballocator_list_unlink(&cls->partial, slab);
+            cls->slab_count--;
+            slaballocator_slab_release(sa, slab);
+        }
+        else cls->empty_count++;
+    }
+}
+
+/* ================================ */
+/* ======== Thread caches ========= */
+/* ================================ */
+
+// Gives the blocks of a cache back to the slabs. The caller holds the lock.
+static void slaballocator_cache_flush(slaballocator_cache* cache) {
+    for (size_t c = 0; c < CSLABALLOCATOR_CLASS_COUNT; c++) {
+        for (size_t i = 0; i < cache->counts[c]; i++) slaballocator_class_free(cache->owner, cache->blocks[c][i]);
+        cache->counts[c] = 0;
+    }
+}
+
+// Called when a thread exits: its cached blocks become available to the other threads.
+static void slaballocator_cache_destructor(void* obj) {
+    slaballocator_cache* cache = obj;
+    slaballocator* sa = cache->owner;
+
+    pthread_mutex_lock(&sa->lock);
+    slaballocator_cache_flush(cache);
+    if (cache->prev) cache->prev->next = cache->next;
+    else sa->caches = cache->next;
+    if (cache->next) cache->next->prev = cache->prev;
+    pthread_mutex_unlock(&sa->lock);
+
+    free(cache);
+}
+
+// Returns the cache of the calling thread, creating it on first use.
+static slaballocator_cache* slaballocator_get_cache(slaballocator* sa) {
+    slaballocator_cache* cache = pthread_getspecific(sa->cache_key);
+    if (cache) return cache;
+
+    cache = calloc(1, sizeof(slaballocator_cache));
+
+    if (!cache) slaballocator_error_handling(CSLABALLOCATOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                             CSLABALLOCATOR_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    cache->owner = sa;
+
+    pthread_mutex_lock(&sa->lock);
+    cache->next = sa->caches;
+    if (sa->caches) sa->caches->prev = cache;
+    sa->caches = cache;
+    pthread_mutex_unlock(&sa->lock);
+
+    pthread_setspecific(sa->cache_key, cache);
+    return cache;
+}
+
+static void* slaballocator_cache_alloc(slaballocator* sa, const size_t class_index) {
+    slaballocator_cache* cache = slaballocator_get_cache(sa);
+    void** blocks = cache->blocks[class_index];
+
+    if (cache->counts[class_index] == 0) {
+        pthread_mutex_lock(&sa->lock);
+        for (size_t i = 0; i < CSLABALLOCATOR_CACHE_BLOCKS / 2; i++) blocks[i] = slaballocator_class_alloc(sa, class_index);
+        pthread_mutex_unlock(&sa->lock);
+        cache->counts[class_index] = CSLABALLOCATOR_CACHE_BLOCKS / 2;
+    }
+
+    return blocks[--cache->counts[class_index]];
+}
+
+static void slaballocator_cache_free(slaballocator* sa, void* block) {
+    slaballocator_cache* cache = slaballocator_get_cache(sa);
+    size_t class_index = slaballocator_slab_of(block)->class_index;
+    void** blocks = cache->blocks[class_index];
+
+    if (cache->counts[class_index] == CSLABALLOCATOR_CACHE_BLOCKS) {
+        // Give back the least recently freed half, keeping the blocks most likely to be in the cache.
+        const size_t half = CSLABALLOCATOR_CACHE_BLOCKS / 2;
+
+        pthread_mutex_lock(&sa->lock);
+        for (size_t i = 0; i < half; i++) slaballocator_class_free(sa, blocks[i]);
+        pthread_mutex_unlock(&sa->lock);
+
+        memmove(blocks, blocks + half, (CSLABALLOCATOR_CACHE_BLOCKS - half) * sizeof(void*));
+        cache->counts[class_index] -= half;
+    }
+
+    blocks[cache->counts[class_index]++] = block;
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of slab allocator.
+slaballocator* new_slaballocator(const slaballocator_mode mode) {
+    slaballocator* sa = calloc(1, sizeof(slaballocator));
+
+    if (!sa) slaballocator_error_handling(CSLABALLOCATOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                          CSLABALLOCATOR_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    for (size_t c = 0; c < CSLABALLOCATOR_CLASS_COUNT; c++) {
+        sa->classes[c].capacity = (CSLABALLOCATOR_SLAB_BYTES - CSLABALLOCATOR_HEADER_BYTES) / slaballocator_class_sizes[c];
+    }
+
+    sa->mode = mode;
+    if (mode != SLABALLOCATOR_LOCAL) pthread_mutex_init(&sa->lock, NULL);
+
+    if (mode == SLABALLOCATOR_THREAD_CACHE && pthread_key_create(&sa->cache_key, slaballocator_cache_destructor) != 0) {
+        slaballocator_error_handling(CSLABALLOCATOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                     CSLABALLOCATOR_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    return sa;
+}
+
+// Destructor of slab allocator. Releases every slab, so every block allocated from it becomes invalid.
+// No other thread may use the allocator anymore. Standardised template: void func_name(void* obj).
+void delete_slaballocator(void* obj) {
+    slaballocator* sa = (slaballocator*)obj;
+    if (!sa) return;
+
+    if (sa->mode == SLABALLOCATOR_THREAD_CACHE) {
+        // Deleting the key first ensures no exiting thread runs the cache destructor anymore.
+        pthread_key_delete(sa->cache_key);
+
+        while (sa->caches) {
+            slaballocator_cache* next = sa->caches->next;
+            free(sa->caches);
+            sa->caches = next;
+        }
+    }
+
+    slaballocator_unmap_all(sa);
+    free(sa->chunks);
+    free(sa->spares);
+
+    if (sa->mode != SLABALLOCATOR_LOCAL) pthread_mutex_destroy(&sa->lock);
+    free(sa);
+
+    sa = NULL;
+    obj = sa;
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the mode of the allocator.
+slaballocator_mode slaballocator_get_mode(const slaballocator* sa) {
+    slaballocator_check_null(sa);
+    return sa->mode;
+}
+
+// Returns the size of the class a request of 'size' bytes is served from, or 0 if it is larger than 'CSLABALLOCATOR_MAX_SIZE'.
+size_t slaballocator_get_class_size(const size_t size) {
+    return size > CSLABALLOCATOR_MAX_SIZE ? 0 : slaballocator_class_sizes[slaballocator_class_of(size)];
+}
+
+// Returns the usage figures of the whole allocator.
+slaballocator_stats slaballocator_get_stats(slaballocator* sa) {
+    slaballocator_check_null(sa);
+
+    slaballocator_stats total = { 0 };
+    for (size_t c = 0; c < CSLABALLOCATOR_CLASS_COUNT; c++) {
+        slaballocator_stats stats = slaballocator_get_class_stats(sa, c);
+        total.slab_count += stats.slab_count;
+        total.reserved_bytes += stats.reserved_bytes;
+        total.objects_in_use += stats.objects_in_use;
+        total.bytes_in_use += stats.bytes_in_use;
+        total.allocations += stats.allocations;
+    }
+
+    return total;
+}
+
+// Returns the usage figures of the 'class_index'-th size class, in ascending order of size.
+slaballocator_stats slaballocator_get_class_stats(slaballocator* sa, const size_t class_index) {
+    slaballocator_check_null(sa);
+
+    if (class_index >= CSLABALLOCATOR_CLASS_COUNT) {
+        slaballocator_error_handling(CSLABALLOCATOR_ERRMSSG_INDEX_OUT_OF_BOUNDS,
+                                     CSLABALLOCATOR_ERRCODE_INDEX_OUT_OF_BOUNDS);
+    }
+
+    slaballocator_stats stats;
+    slaballocator_lock(sa);
+
+    const slaballocator_class* cls = &sa->classes[class_index];
+    stats.object_size = slaballocator_class_sizes[class_index];
+    stats.slab_count = cls->slab_count;
+    stats.reserved_bytes = cls->slab_count * CSLABALLOCATOR_SLAB_BYTES;
+    stats.objects_in_use = cls->objects_in_use;
+    stats.bytes_in_use = cls->objects_in_use * stats.object_size;
+    stats.allocations = cls->allocations;
+
+    slaballocator_unlock(sa);
+    return stats;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Returns a block of at least 'size' bytes, or NULL if 'size' is larger than 'CSLABALLOCATOR_MAX_SIZE'.
+void* slaballocator_alloc(slaballocator* sa, const size_t size) {
+    slaballocator_check_null(sa);
+
+    if (size > CSLABALLOCATOR_MAX_SIZE) {
+        slaballocator_warning_handling(CSLABALLOCATOR_WARNMSG_SIZE_TOO_LARGE);
+        return NULL;
+    }
+
+    size_t class_index = slaballocator_class_of(size);
+    if (sa->mode == SLABALLOCATOR_THREAD_CACHE) return slaballocator_cache_alloc(sa, class_index);
+
+    slaballocator_lock(sa);
+    void* block = slaballocator_class_alloc(sa, class_index);
+    slaballocator_unlock(sa);
+
+    return block;
+}
+
+// Same as 'slaballocator_alloc()', but the block is zeroed.
+void* slaballocator_calloc(slaballocator* sa, const size_t size) {
+    void* block = slaballocator_alloc(sa, size);
+    if (block) memset(block, 0, size);
+    return block;
+}
+
+// Returns a block to the allocator it was allocated from. Does nothing if 'block' is NULL.
+void slaballocator_free(slaballocator* sa, void* block) {
+    slaballocator_check_null(sa);
+    if (!block) return;
+
+    if (sa->mode == SLABALLOCATOR_THREAD_CACHE) {
+        slaballocator_cache_free(sa, block);
+        return;
+    }
+
+    slaballocator_lock(sa);
+    slaballocator_class_free(sa, block);
+    slaballocator_unlock(sa);
+}
+
+/* ====================================================== */
+/* ======== Mutative slab allocator manipulations ======= */
+/* ====================================================== */
+
+// Gives the blocks cached by the calling thread back to the slabs, so that 'slaballocator_mut_shrink()' can release them.
+// Does nothing unless the allocator is in thread cache mode.
+void slaballocator_flush_cache(slaballocator* sa) {
+    slaballocator_check_null(sa);
+    if (sa->mode != SLABALLOCATOR_THREAD_CACHE) return;
+
+    slaballocator_cache* cache = pthread_getspecific(sa->cache_key);
+    if (!cache) return;
+
+    pthread_mutex_lock(&sa->lock);
+    slaballocator_cache_flush(cache);
+    pthread_mutex_unlock(&sa->lock);
+}
+
+// Returns the memory of the slabs without blocks in use to the system. The other slabs are kept.
+// In thread cache mode, flushes the cache of the calling thread first; the blocks cached by other threads keep their slabs
+// until these threads call 'slaballocator_flush_cache()' or exit.
+void slaballocator_mut_shrink(slaballocator* sa) {
+    slaballocator_check_null(sa);
+    slaballocator_flush_cache(sa);
+    slaballocator_lock(sa);
+
+    for (size_t c = 0; c < CSLABALLOCATOR_CLASS_COUNT; c++) {
+        slaballocator_class* cls = &sa->classes[c];
+        slaballocator_slab* slab = cls->partial;
+
+        while (slab && cls->empty_count) {
+            slaballocator_slab* next = slab->next;
+
+            if (slab->used == 0) {
+                slaballocator_list_unlink(&cls->partial, slab);
+                slaballocator_slab_release(sa, slab);
+                cls->slab_count--;
+                cls->empty_count--;
+            }
+
+            slab = next;
+        }
+    }
+
+    for (size_t i = 0; i < sa->spare_count; i++) slaballocator_discard(sa->spares[i]);
+
+    slaballocator_unlock(sa);
+}
+
+// Releases every slab at once, so every block allocated from the allocator becomes invalid.
+// Useful to free a whole structure without visiting its nodes. No other thread may use the allocator meanwhile.
+void slaballocator_mut_clean(slaballocator* sa) {
+    slaballocator_check_null(sa);
+    slaballocator_lock(sa);
+
+    // Cached blocks live in the slabs about to be released.
+    for (slaballocator_cache* cache = sa->caches; cache; cache = cache->next) {
+        memset(cache->counts, 0, sizeof(cache->counts));
+    }
+
+    for (size_t c = 0; c < CSLABALLOCATOR_CLASS_COUNT; c++) {
+        slaballocator_class* cls = &sa->classes[c];
+
+        cls->partial = cls->full = NULL;
+        cls->slab_count = cls->empty_count = cls->objects_in_use = cls->allocations = 0;
+    }
+
+    slaballocator_unmap_all(sa);
+
+    slaballocator_unlock(sa);
+}
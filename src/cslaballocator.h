@@ -0,0 +1,138 @@
+#ifndef SLABALLOCATOR_H
+#define SLABALLOCATOR_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'slaballocator' type hands out small blocks of memory, e.g. the nodes of lists, trees and queues, without a 'malloc()' per block.
+Therefore, it has the following characteristics:
+    - requests are rounded up to one of a few size classes, and every class carves its blocks out of page-sized slabs,
+      themselves carved out of larger chunks mapped from the system
+    - freed blocks go to the free list of their slab and are reused first, so the nodes of one structure stay close in memory
+    - allocation and release are a few pointer operations, and the slab of a block is found from its address alone
+    - a shared allocator is protected by a lock, which an optional per-thread cache of blocks keeps off the common path
+    - every block can be released at once by cleaning the allocator, instead of walking the structure that used them
+Similar in nature to the slab allocators of the Linux and Solaris kernels, and to the object pools of game engines.
+
+Blocks are aligned for any type and can be at most 'CSLABALLOCATOR_MAX_SIZE' bytes; larger requests fail with a warning.
+In thread cache mode, the blocks a thread keeps in its cache hold on to their slabs: shrinking the allocator only releases them
+after the thread flushes its cache or exits.
+*/
+
+// Type definition of 'slaballocator' type.
+typedef struct _slaballocator slaballocator;
+
+// Alternative 'keyword' for type 'slaballocator'.
+typedef slaballocator SlabAllocator;
+
+// Alternative 'keyword' for type 'slaballocator'.
+typedef slaballocator slaballocator_t;
+
+// Size of one slab in bytes: one page. Slabs are aligned to their size.
+#define CSLABALLOCATOR_SLAB_BYTES 4096
+
+// Largest block that can be allocated.
+#define CSLABALLOCATOR_MAX_SIZE   512
+
+// Number of size classes.
+#define CSLABALLOCATOR_CLASS_COUNT 16
+
+// How an allocator may be used from several threads.
+typedef enum {
+    SLABALLOCATOR_LOCAL,        // used by one thread at a time, no locking
+    SLABALLOCATOR_SHARED,       // used by any thread, every call takes the lock
+    SLABALLOCATOR_THREAD_CACHE  // used by any thread, each thread keeps a few free blocks per class and rarely takes the lock
+} slaballocator_mode;
+
+// Usage figures of an allocator or of one of its size classes.
+typedef struct {
+    size_t object_size;         // size of the blocks of the class (0 for the whole allocator)
+    size_t slab_count;          // slabs currently held
+    size_t reserved_bytes;      // memory held in slabs
+    size_t objects_in_use;      // blocks handed out and not yet freed; blocks in thread caches count as handed out
+    size_t bytes_in_use;        // the same, in bytes of the size classes
+    size_t allocations;         // number of blocks handed out by the slabs since creation or the last cleaning
+} slaballocator_stats;
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of slab allocator.
+slaballocator* new_slaballocator    (const slaballocator_mode mode);
+
+// Destructor of slab allocator. Releases every slab, so every block allocated from it becomes invalid.
+// No other thread may use the allocator anymore. Standardised template: void func_name(void* obj).
+void           delete_slaballocator (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the mode of the allocator.
+slaballocator_mode  slaballocator_get_mode        (const slaballocator* sa);
+
+// Returns the size of the class a request of 'size' bytes is served from, or 0 if it is larger than 'CSLABALLOCATOR_MAX_SIZE'.
+size_t              slaballocator_get_class_size  (const size_t size);
+
+// Returns the usage figures of the whole allocator.
+slaballocator_stats slaballocator_get_stats       (slaballocator* sa);
+
+// Returns the usage figures of the 'class_index'-th size class, in ascending order of size.
+slaballocator_stats slaballocator_get_class_stats (slaballocator* sa, const size_t class_index);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Returns a block of at least 'size' bytes, or NULL if 'size' is larger than 'CSLABALLOCATOR_MAX_SIZE'.
+void* slaballocator_alloc  (slaballocator* sa, const size_t size);
+
+// Same as 'slaballocator_alloc()', but the block is zeroed.
+void* slaballocator_calloc (slaballocator* sa, const size_t size);
+
+// Returns a block to the allocator it was allocated from. Does nothing if 'block' is NULL.
+void  slaballocator_free   (slaballocator* sa, void* block);
+
+/* ====================================================== */
+/* ======== Mutative slab allocator manipulations ======= */
+/* ====================================================== */
+
+// Gives the blocks cached by the calling thread back to the slabs, so that 'slaballocator_mut_shrink()' can release them.
+// Does nothing unless the allocator is in thread cache mode.
+void slaballocator_flush_cache (slaballocator* sa);
+
+// Returns the memory of the slabs without blocks in use to the system. The other slabs are kept.
+// In thread cache mode, flushes the cache of the calling thread first; the blocks cached by other threads keep their slabs
+// until these threads call 'slaballocator_flush_cache()' or exit.
+void slaballocator_mut_shrink  (slaballocator* sa);
+
+// Releases every slab at once, so every block allocated from the allocator becomes invalid.
+// Useful to free a whole structure without visiting its nodes. No other thread may use the allocator meanwhile.
+void slaballocator_mut_clean   (slaballocator* sa);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CSLABALLOCATOR_WARNMSG_SIZE_TOO_LARGE "Warning: requested block is larger than the largest size class. NULL is returned."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CSLABALLOCATOR_ERRMSSG_NULL_SLABALLOCATOR "Error: slab allocator is a null pointer."
+#define CSLABALLOCATOR_ERRCODE_NULL_SLABALLOCATOR -1
+
+#define CSLABALLOCATOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CSLABALLOCATOR_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CSLABALLOCATOR_ERRMSSG_INDEX_OUT_OF_BOUNDS "Error: size class index out of bounds."
+#define CSLABALLOCATOR_ERRCODE_INDEX_OUT_OF_BOUNDS -3
+
+#endif // SLABALLOCATOR_H
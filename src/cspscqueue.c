@@ -0,0 +1,258 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "cspscqueue.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+#define CSPSCQUEUE_CACHE_LINE 64
+
+// The positions grow without wrapping; the slot of a position is 'position & mask'. Each side owns one cache line.
+struct _spscqueue {
+    _Alignas(CSPSCQUEUE_CACHE_LINE) atomic_size_t tail; // next position to write, advanced by the producer
+    size_t cached_head;                                 // producer's last view of 'head'
+
+    _Alignas(CSPSCQUEUE_CACHE_LINE) atomic_size_t head; // next position to read, advanced by the consumer
+    size_t cached_tail;                                 // consumer's last view of 'tail'
+
+    _Alignas(CSPSCQUEUE_CACHE_LINE) unsigned char* data;
+    size_t capacity;
+    size_t mask;
+    size_t element_size;
+    void (*destructor)(void*);
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void spscqueue_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CSPSCQUEUE_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void spscqueue_check_null(const spscqueue* que) {
+    if (!que) spscqueue_error_handling(CSPSCQUEUE_ERRMSSG_NULL_SPSCQUEUE,
+                                       CSPSCQUEUE_ERRCODE_NULL_SPSCQUEUE);
+}
+
+// General warning handling function.
+static void spscqueue_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CSPSCQUEUE_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ========= Ring helpers ========= */
+/* ================================ */
+
+static inline unsigned char* spscqueue_slot(const spscqueue* que, const size_t position) {
+    return que->data + (position & que->mask) * que->element_size;
+}
+
+// Copies 'count' elements into the ring starting at 'position': at most two runs.
+static void spscqueue_write(spscqueue* que, const size_t position, const unsigned char* source, const size_t count) {
+    size_t start = position & que->mask;
+    size_t first = que->capacity - start < count ? que->capacity - start : count;
+
+    memcpy(que->data + start * que->element_size, source, first * que->element_size);
+    memcpy(que->data, source + first * que->element_size, (count - first) * que->element_size);
+}
+
+// Copies 'count' elements out of the ring starting at 'position': at most two runs.
+static void spscqueue_read(const spscqueue* que, const size_t position, unsigned char* destination, const size_t count) {
+    size_t start = position & que->mask;
+    size_t first = que->capacity - start < count ? que->capacity - start : count;
+
+    memcpy(destination, que->data + start * que->element_size, first * que->element_size);
+    memcpy(destination + first * que->element_size, que->data, (count - first) * que->element_size);
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of single-producer, single-consumer queue. 'capacity' is rounded up to a power of two.
+spscqueue* new_spscqueue(const size_t capacity, const size_t element_size, void (*destructor)(void*)) {
+    if (capacity == 0) {
+        spscqueue_warning_handling(CSPSCQUEUE_WARNMSG_EMPTY_CAPACITY);
+        return NULL;
+    }
+
+    if (element_size == 0) {
+        spscqueue_warning_handling(CSPSCQUEUE_WARNMSG_EMPTY_ELEMENT_SIZE);
+        return NULL;
+    }
+
+    size_t rounded = 1;
+    while (rounded < capacity && rounded <= SIZE_MAX / 2) rounded *= 2;
+
+    spscqueue* que = aligned_alloc(CSPSCQUEUE_CACHE_LINE, sizeof(spscqueue));
+
+    if (!que || rounded < capacity || rounded > SIZE_MAX / element_size) {
+        spscqueue_error_handling(CSPSCQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                 CSPSCQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    que->data = malloc(rounded * element_size);
+
+    if (!que->data) spscqueue_error_handling(CSPSCQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                             CSPSCQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    atomic_init(&que->tail, 0);
+    atomic_init(&que->head, 0);
+    que->cached_head = 0;
+    que->cached_tail = 0;
+    que->capacity = rounded;
+    que->mask = rounded - 1;
+    que->element_size = element_size;
+    que->destructor = destructor;
+
+    return que;
+}
+
+// Destructor of queue. Neither thread may use the queue any more. Standardised template: void func_name(void* obj).
+void delete_spscqueue(void* obj) {
+    if (obj) {
+        spscqueue* que = (spscqueue*)obj;
+
+        if (que->destructor) {
+            size_t tail = atomic_load(&que->tail);
+            for (size_t position = atomic_load(&que->head); position != tail; position++) que->destructor(spscqueue_slot(que, position));
+        }
+
+        free(que->data);
+        free(que);
+        que = NULL;
+        obj = que;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements. Only a snapshot while the other thread is active.
+size_t spscqueue_get_size(const spscqueue* que) {
+    spscqueue_check_null(que);
+
+    // Reading 'head' first keeps the difference from going below 0, but the producer may refill the queue before 'tail'
+    // is read: the difference is clamped to the capacity.
+    size_t head = atomic_load_explicit(&que->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&que->tail, memory_order_acquire);
+    return tail - head < que->capacity ? tail - head : que->capacity;
+}
+
+// Getter of the maximum number of stored elements.
+size_t spscqueue_get_capacity(const spscqueue* que) {
+    spscqueue_check_null(que);
+    return que->capacity;
+}
+
+// Getter of the size of one element in bytes.
+size_t spscqueue_get_element_size(const spscqueue* que) {
+    spscqueue_check_null(que);
+    return que->element_size;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the queue is empty. Only a snapshot while the other thread is active.
+bool spscqueue_isempty(const spscqueue* que) {
+    return spscqueue_get_size(que) == 0;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Producer: moves the element pointed to by 'obj' into the queue. Returns false (keeping the element) if the queue is full.
+bool spscqueue_try_push(spscqueue* que, const void* obj) {
+    spscqueue_check_null(que);
+
+    size_t tail = atomic_load_explicit(&que->tail, memory_order_relaxed);
+
+    if (tail - que->cached_head == que->capacity) {
+        que->cached_head = atomic_load_explicit(&que->head, memory_order_acquire);
+        if (tail - que->cached_head == que->capacity) return false;
+    }
+
+    memcpy(spscqueue_slot(que, tail), obj, que->element_size);
+    atomic_store_explicit(&que->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+// Consumer: moves the front element into 'destination'. If 'destination' is NULL, the element is deleted instead.
+// Returns false if the queue is empty.
+bool spscqueue_try_pop(spscqueue* que, void* destination) {
+    spscqueue_check_null(que);
+
+    size_t head = atomic_load_explicit(&que->head, memory_order_relaxed);
+
+    if (head == que->cached_tail) {
+        que->cached_tail = atomic_load_explicit(&que->tail, memory_order_acquire);
+        if (head == que->cached_tail) return false;
+    }
+
+    if (destination) memcpy(destination, spscqueue_slot(que, head), que->element_size);
+    else if (que->destructor) que->destructor(spscqueue_slot(que, head));
+    atomic_store_explicit(&que->head, head + 1, memory_order_release);
+    return true;
+}
+
+// Producer: moves up to 'count' contiguous elements starting at 'elements' into the queue. Returns the number of elements pushed.
+size_t spscqueue_push_n(spscqueue* que, const void* elements, const size_t count) {
+    spscqueue_check_null(que);
+
+    size_t tail = atomic_load_explicit(&que->tail, memory_order_relaxed);
+    size_t available = que->capacity - (tail - que->cached_head);
+
+    if (available < count) {
+        que->cached_head = atomic_load_explicit(&que->head, memory_order_acquire);
+        available = que->capacity - (tail - que->cached_head);
+    }
+
+    size_t pushed = count < available ? count : available;
+    if (pushed == 0) return 0;
+
+    spscqueue_write(que, tail, elements, pushed);
+    atomic_store_explicit(&que->tail, tail + pushed, memory_order_release);
+    return pushed;
+}
+
+// Consumer: moves up to 'count' elements into the contiguous 'destination', in order. If 'destination' is NULL, the elements
+// are deleted instead. Returns the number of elements popped.
+size_t spscqueue_pop_n(spscqueue* que, void* destination, const size_t count) {
+    spscqueue_check_null(que);
+
+    size_t head = atomic_load_explicit(&que->head, memory_order_relaxed);
+    size_t available = que->cached_tail - head;
+
+    if (available < count) {
+        que->cached_tail = atomic_load_explicit(&que->tail, memory_order_acquire);
+        available = que->cached_tail - head;
+    }
+
+    size_t popped = count < available ? count : available;
+    if (popped == 0) return 0;
+
+    if (destination) {
+        spscqueue_read(que, head, destination, popped);
+    } else if (que->destructor) {
+        for (size_t i = 0; i < popped; i++) que->destructor(spscqueue_slot(que, head + i));
+    }
+    atomic_store_explicit(&que->head, head + popped, memory_order_release);
+    return popped;
+}
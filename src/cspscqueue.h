@@ -0,0 +1,100 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'spscqueue' type is a bounded first-in, first-out ring buffer for exactly one producer thread and one consumer thread.
+Therefore, it has the following characteristics:
+    - pushing and popping are wait-free: no locks, no retries, one release store per operation (or per batch)
+    - the producer and the consumer positions live on separate cache lines, and each side caches the other's position,
+      so the two threads only exchange cache lines when the queue looks full or empty
+    - the capacity is fixed and rounded up to a power of two; pushing into a full queue fails instead of blocking
+Similar in nature to boost::lockfree::spsc_queue or folly::ProducerConsumerQueue.
+
+Elements are moved in and out bitwise, e.g. 'string*' records handed over from one thread to another.
+The destructor (which can be NULL) follows the conventions of 'array' and only runs on the elements left over when the queue is deleted.
+Only the push functions may be called by the producer and only the pop functions by the consumer; the getters may be called by both.
+*/
+
+// Type definition of 'spscqueue' type.
+typedef struct _spscqueue spscqueue;
+
+// Alternative 'keyword' for type 'spscqueue'.
+typedef spscqueue SpscQueue;
+
+// Alternative 'keyword' for type 'spscqueue'.
+typedef spscqueue spscqueue_t;
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of single-producer, single-consumer queue. 'capacity' is rounded up to a power of two.
+spscqueue* new_spscqueue    (const size_t capacity, const size_t element_size, void (*destructor)(void*));
+
+// Destructor of queue. Neither thread may use the queue any more. Standardised template: void func_name(void* obj).
+void       delete_spscqueue (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements. Only a snapshot while the other thread is active.
+size_t spscqueue_get_size         (const spscqueue* que);
+
+// Getter of the maximum number of stored elements.
+size_t spscqueue_get_capacity     (const spscqueue* que);
+
+// Getter of the size of one element in bytes.
+size_t spscqueue_get_element_size (const spscqueue* que);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the queue is empty. Only a snapshot while the other thread is active.
+bool spscqueue_isempty (const spscqueue* que);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Producer: moves the element pointed to by 'obj' into the queue. Returns false (keeping the element) if the queue is full.
+bool   spscqueue_try_push (spscqueue* que, const void* obj);
+
+// Consumer: moves the front element into 'destination'. If 'destination' is NULL, the element is deleted instead.
+// Returns false if the queue is empty.
+bool   spscqueue_try_pop  (spscqueue* que, void* destination);
+
+// Producer: moves up to 'count' contiguous elements starting at 'elements' into the queue with at most two 'memcpy()' calls
+// and a single publication. Returns the number of elements pushed, the first ones of 'elements'.
+size_t spscqueue_push_n   (spscqueue* que, const void* elements, const size_t count);
+
+// Consumer: moves up to 'count' elements into the contiguous 'destination', in order. If 'destination' is NULL, the elements
+// are deleted instead. Returns the number of elements popped.
+size_t spscqueue_pop_n    (spscqueue* que, void* destination, const size_t count);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CSPSCQUEUE_WARNMSG_EMPTY_CAPACITY     "Warning: capacity cannot be 0."
+#define CSPSCQUEUE_WARNMSG_EMPTY_ELEMENT_SIZE "Warning: element size cannot be 0."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CSPSCQUEUE_ERRMSSG_NULL_SPSCQUEUE "Error: queue is a null pointer."
+#define CSPSCQUEUE_ERRCODE_NULL_SPSCQUEUE -1
+
+#define CSPSCQUEUE_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CSPSCQUEUE_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // SPSCQUEUE_H
@@ -0,0 +1,462 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cstack.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+// Every segment below the top one is full.
+typedef struct _stack_segment {
+    struct _stack_segment* below;
+    size_t capacity;
+    max_align_t data[];
+} stack_segment;
+
+struct _stack {
+    stack_segment* top;
+    unsigned char* top_data;  // data of the top segment, cached for the push and pop fast paths
+    size_t top_count;         // elements in the top segment, which may be empty
+    stack_segment* spare;     // emptied segment kept for the next growth
+    bool keep_spare;
+
+    size_t size;
+    size_t capacity;
+    size_t element_size;
+    void (*destructor)(void*);
+    bool (*equality)(const void*, const void*);
+    void (*copy)(void*, const void*);
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void stack_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CSTACK_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void stack_check_null(const stack* stk) {
+    if (!stk) stack_error_handling(CSTACK_ERRMSSG_NULL_STACK,
+                                   CSTACK_ERRCODE_NULL_STACK);
+}
+
+// General warning handling function.
+static void stack_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CSTACK_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ====== Segment management ====== */
+/* ================================ */
+
+static stack_segment* stack_allocate_segment(const stack* stk, const size_t capacity) {
+    if (capacity > (SIZE_MAX - sizeof(stack_segment)) / stk->element_size) {
+        stack_error_handling(CSTACK_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                             CSTACK_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    stack_segment* segment = malloc(sizeof(stack_segment) + capacity * stk->element_size);
+
+    if (!segment) stack_error_handling(CSTACK_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                       CSTACK_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    segment->capacity = capacity;
+    return segment;
+}
+
+// Makes 'segment' the (empty) top segment.
+static inline void stack_set_top(stack* stk, stack_segment* segment, const size_t count) {
+    stk->top = segment;
+    stk->top_data = (unsigned char*)segment->data;
+    stk->top_count = count;
+}
+
+// Called when the top segment is full: continues in the spare segment or in a new one twice as large.
+static void stack_step_up(stack* stk) {
+    stack_segment* segment = stk->spare;
+    stk->spare = NULL;
+
+    // A spare left over from a deeper stack may be too small to keep the growth geometric.
+    if (segment && segment->capacity < stk->top->capacity) {
+        free(segment);
+        segment = NULL;
+    }
+
+    if (!segment) segment = stack_allocate_segment(stk, stk->top->capacity * 2);
+
+    segment->below = stk->top;
+    stk->capacity += segment->capacity;
+    stack_set_top(stk, segment, 0);
+}
+
+// Called when the top segment is empty: continues in the full segment below it, keeping the emptied one as a spare.
+static void stack_step_down(stack* stk) {
+    stack_segment* emptied = stk->top;
+
+    stk->capacity -= emptied->capacity;
+    stack_set_top(stk, emptied->below, emptied->below->capacity);
+
+    if (stk->keep_spare) {
+        free(stk->spare);
+        stk->spare = emptied;
+    } else {
+        free(emptied);
+    }
+}
+
+static inline void stack_destroy_slot(const stack* stk, void* slot) {
+    if (stk->destructor) stk->destructor(slot);
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of stack. 'capacity' is the number of elements of the first segment; 0 picks 'CSTACK_MINIMUM_CAPACITY'.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+stack* new_stack(const size_t capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*)) {
+    if (element_size == 0) {
+        stack_warning_handling(CSTACK_WARNMSG_EMPTY_ELEMENT_SIZE);
+        return NULL;
+    }
+
+    stack* stk = calloc(1, sizeof(stack));
+
+    if (!stk) stack_error_handling(CSTACK_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                   CSTACK_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    stk->element_size = element_size;
+    stk->keep_spare = true;
+    stk->destructor = destructor;
+    stk->equality = equality;
+    stk->copy = copy;
+
+    stack_segment* bottom = stack_allocate_segment(stk, capacity > 0 ? capacity : CSTACK_MINIMUM_CAPACITY);
+    bottom->below = NULL;
+    stk->capacity = bottom->capacity;
+    stack_set_top(stk, bottom, 0);
+
+    return stk;
+}
+
+// Destructor of stack. Standardised template: void func_name(void* obj).
+void delete_stack(void* obj) {
+    if (obj) {
+        stack* stk = (stack*)obj;
+        stack_mut_clean(stk);
+        free(stk->top);
+        free(stk->spare);
+        free(stk);
+        stk = NULL;
+        obj = stk;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t stack_get_size(const stack* stk) {
+    stack_check_null(stk);
+    return stk->size;
+}
+
+// Getter of the number of elements that fit in the allocated segments, the spare segment not included.
+size_t stack_get_capacity(const stack* stk) {
+    stack_check_null(stk);
+    return stk->capacity;
+}
+
+// Getter of the size of one element in bytes.
+size_t stack_get_element_size(const stack* stk) {
+    stack_check_null(stk);
+    return stk->element_size;
+}
+
+// Returns a pointer to the element on the top of the stack or NULL if the stack is empty.
+void* stack_get_top(const stack* stk) {
+    stack_check_null(stk);
+
+    if (stk->size == 0) return NULL;
+    if (stk->top_count == 0) return (unsigned char*)stk->top->below->data + (stk->top->below->capacity - 1) * stk->element_size;
+    return stk->top_data + (stk->top_count - 1) * stk->element_size;
+}
+
+// Checks whether an emptied segment is kept as a spare.
+bool stack_get_keep_spare(const stack* stk) {
+    stack_check_null(stk);
+    return stk->keep_spare;
+}
+
+// Sets whether an emptied segment is kept as a spare (the default). Turning it off releases the current spare.
+void stack_set_keep_spare(stack* stk, const bool keep_spare) {
+    stack_check_null(stk);
+
+    stk->keep_spare = keep_spare;
+    if (!keep_spare) {
+        free(stk->spare);
+        stk->spare = NULL;
+    }
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the stack is empty.
+bool stack_isempty(const stack* stk) {
+    stack_check_null(stk);
+    return stk->size == 0;
+}
+
+// Checks whether the contents of the two stacks are identical.
+bool stack_areequal(const stack* stk1, const stack* stk2) {
+    stack_check_null(stk1);
+    stack_check_null(stk2);
+
+    if (stk1->element_size != stk2->element_size ||
+        stk1->destructor != stk2->destructor ||
+        stk1->equality != stk2->equality ||
+        stk1->size != stk2->size) return false;
+
+    // The segments of the two stacks may be sized differently: walk both from the top down, one run of common length at a time.
+    const stack_segment* segment1 = stk1->top;
+    const stack_segment* segment2 = stk2->top;
+    size_t count1 = stk1->top_count, count2 = stk2->top_count;
+    size_t remaining = stk1->size;
+
+    while (remaining > 0) {
+        if (count1 == 0) {
+            segment1 = segment1->below;
+            count1 = segment1->capacity;
+        }
+        if (count2 == 0) {
+            segment2 = segment2->below;
+            count2 = segment2->capacity;
+        }
+
+        size_t run = count1 < count2 ? count1 : count2;
+        const unsigned char* run1 = (const unsigned char*)segment1->data + (count1 - run) * stk1->element_size;
+        const unsigned char* run2 = (const unsigned char*)segment2->data + (count2 - run) * stk1->element_size;
+
+        if (!stk1->equality) {
+            if (memcmp(run1, run2, run * stk1->element_size) != 0) return false;
+        } else {
+            for (size_t i = 0; i < run; i++) {
+                if (!stk1->equality(run1 + i * stk1->element_size, run2 + i * stk1->element_size)) return false;
+            }
+        }
+
+        count1 -= run;
+        count2 -= run;
+        remaining -= run;
+    }
+
+    return true;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' onto the top of the stack (bitwise, the stack takes ownership).
+void stack_push(stack* stk, const void* obj) {
+    stack_check_null(stk);
+
+    if (stk->top_count == stk->top->capacity) stack_step_up(stk);
+
+    memcpy(stk->top_data + stk->top_count * stk->element_size, obj, stk->element_size);
+    stk->top_count++;
+    stk->size++;
+}
+
+// Pushes a zeroed slot onto the top of the stack and returns it, so that the element can be constructed in place.
+void* stack_emplace(stack* stk) {
+    stack_check_null(stk);
+
+    if (stk->top_count == stk->top->capacity) stack_step_up(stk);
+
+    unsigned char* slot = stk->top_data + stk->top_count * stk->element_size;
+    memset(slot, 0, stk->element_size);
+    stk->top_count++;
+    stk->size++;
+
+    return slot;
+}
+
+// Moves the top element into 'destination' and removes it. If 'destination' is NULL, the element is deleted instead.
+void* stack_pop(stack* stk, void* destination) {
+    stack_check_null(stk);
+    if (stk->size == 0) return NULL;
+
+    // An emptied segment is only left once an element below it is needed, so alternating pushes and pops stay in one segment.
+    if (stk->top_count == 0) stack_step_down(stk);
+
+    unsigned char* slot = stk->top_data + (--stk->top_count) * stk->element_size;
+    stk->size--;
+
+    if (destination) {
+        memcpy(destination, slot, stk->element_size);
+        return destination;
+    }
+
+    stack_destroy_slot(stk, slot);
+    return stk;
+}
+
+// Moves 'count' contiguous elements starting at 'elements' onto the stack, in order: the last one ends up on the top.
+void stack_push_n(stack* stk, const void* elements, const size_t count) {
+    stack_check_null(stk);
+
+    const unsigned char* source = elements;
+    size_t remaining = count;
+
+    while (remaining > 0) {
+        if (stk->top_count == stk->top->capacity) stack_step_up(stk);
+
+        size_t run = stk->top->capacity - stk->top_count;
+        if (run > remaining) run = remaining;
+
+        memcpy(stk->top_data + stk->top_count * stk->element_size, source, run * stk->element_size);
+        stk->top_count += run;
+        source += run * stk->element_size;
+        remaining -= run;
+    }
+
+    stk->size += count;
+}
+
+// Moves the top 'count' elements into the contiguous 'destination' in the order they were pushed.
+// Returns the number of elements popped.
+size_t stack_pop_n(stack* stk, void* destination, const size_t count) {
+    stack_check_null(stk);
+
+    size_t popped = count < stk->size ? count : stk->size;
+    size_t remaining = popped;
+
+    // The destination is filled from its end, since the top of the stack is the last element pushed.
+    while (remaining > 0) {
+        if (stk->top_count == 0) stack_step_down(stk);
+
+        size_t run = stk->top_count < remaining ? stk->top_count : remaining;
+        unsigned char* source = stk->top_data + (stk->top_count - run) * stk->element_size;
+
+        if (destination) {
+            memcpy((unsigned char*)destination + (remaining - run) * stk->element_size, source, run * stk->element_size);
+        } else if (stk->destructor) {
+            for (size_t i = run; i > 0; i--) stk->destructor(source + (i - 1) * stk->element_size);
+        }
+
+        stk->top_count -= run;
+        remaining -= run;
+    }
+
+    stk->size -= popped;
+    return popped;
+}
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Releases the spare segment and the empty segments above the top element.
+void stack_shrink_to_fit(stack* stk) {
+    stack_check_null(stk);
+
+    free(stk->spare);
+    stk->spare = NULL;
+
+    if (stk->top_count == 0 && stk->top->below) {
+        stack_segment* emptied = stk->top;
+        stk->capacity -= emptied->capacity;
+        stack_set_top(stk, emptied->below, emptied->below->capacity);
+        free(emptied);
+    }
+}
+
+/* ====================================================== */
+/* =========== Immutative stack manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'stk'. The copy stores the elements in a single segment.
+stack* stack_copy(const stack* stk) {
+    stack_check_null(stk);
+
+    stack* copy = new_stack(stk->size, stk->element_size, stk->destructor, stk->equality, stk->copy);
+    copy->keep_spare = stk->keep_spare;
+
+    // Collect the segments bottom-up first: the chain only links downwards.
+    size_t segments = 0;
+    for (const stack_segment* segment = stk->top; segment; segment = segment->below) segments++;
+
+    const stack_segment** chain = malloc(segments * sizeof(stack_segment*));
+
+    if (!chain) stack_error_handling(CSTACK_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                     CSTACK_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    size_t i = segments;
+    for (const stack_segment* segment = stk->top; segment; segment = segment->below) chain[--i] = segment;
+
+    for (i = 0; i < segments; i++) {
+        size_t count = i + 1 == segments ? stk->top_count : chain[i]->capacity;
+        const unsigned char* source = (const unsigned char*)chain[i]->data;
+
+        if (!stk->copy) {
+            stack_push_n(copy, source, count);
+            continue;
+        }
+
+        for (size_t j = 0; j < count; j++) stk->copy(stack_emplace(copy), source + j * stk->element_size);
+    }
+
+    free(chain);
+    return copy;
+}
+
+/* ====================================================== */
+/* ============ Mutative stack manipulations ============ */
+/* ====================================================== */
+
+// Erases all the elements of the stack, resulting in an empty one. The first segment is kept.
+void stack_mut_clean(stack* stk) {
+    stack_check_null(stk);
+
+    stack_pop_n(stk, NULL, stk->size);
+
+    while (stk->top->below) {
+        stack_segment* emptied = stk->top;
+        stk->top = emptied->below;
+        stk->capacity -= emptied->capacity;
+        free(emptied);
+    }
+
+    stack_set_top(stk, stk->top, 0);
+}
+
+// Swaps the contents of two stacks in O(1).
+void stack_mut_swap(stack* stk1, stack* stk2) {
+    stack_check_null(stk1);
+    stack_check_null(stk2);
+
+    if (stk1->element_size != stk2->element_size || stk1->destructor != stk2->destructor ||
+        stk1->equality != stk2->equality || stk1->copy != stk2->copy) {
+        stack_warning_handling(CSTACK_WARNMSG_SWAP_INCOMPATIBLE);
+        return;
+    }
+
+    stack buffer = *stk1;
+    *stk1 = *stk2;
+    *stk2 = buffer;
+}
@@ -0,0 +1,140 @@
+#ifndef STACK_H
+#define STACK_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'stack' type is a last-in, first-out container built from a chain of array segments, each twice as large as the previous one.
+Therefore, it has the following characteristics:
+    - pushing and popping take O(1) time, and growing never copies the existing elements (no reallocation spikes)
+    - pointers to the elements stay valid until the element is popped
+    - one emptied segment can be kept as a spare, so pushing and popping around a segment boundary does not hit 'malloc()'
+Similar in nature to std::stack in C++ (on top of a segmented container such as std::deque).
+
+The callback functions follow the conventions of 'array': they receive pointers to the element slots.
+*/
+
+// Type definition of 'stack' type.
+typedef struct _stack stack;
+
+// Alternative 'keyword' for type 'stack'.
+typedef stack Stack;
+
+// Alternative 'keyword' for type 'stack'.
+typedef stack stack_t;
+
+// Capacity of the first segment of a stack created with capacity 0.
+#define CSTACK_MINIMUM_CAPACITY 16
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of stack. 'capacity' is the number of elements of the first segment; 0 picks 'CSTACK_MINIMUM_CAPACITY'.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+stack* new_stack    (const size_t capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*));
+
+// Destructor of stack. Standardised template: void func_name(void* obj).
+void   delete_stack (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of stored elements.
+size_t stack_get_size         (const stack* stk);
+
+// Getter of the number of elements that fit in the allocated segments, the spare segment not included.
+size_t stack_get_capacity     (const stack* stk);
+
+// Getter of the size of one element in bytes.
+size_t stack_get_element_size (const stack* stk);
+
+// Returns a pointer to the element on the top of the stack or NULL if the stack is empty.
+void*  stack_get_top          (const stack* stk);
+
+// Checks whether an emptied segment is kept as a spare.
+bool   stack_get_keep_spare   (const stack* stk);
+
+// Sets whether an emptied segment is kept as a spare (the default). Turning it off releases the current spare.
+void   stack_set_keep_spare   (stack* stk, const bool keep_spare);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the stack is empty.
+bool stack_isempty  (const stack* stk);
+
+// Checks whether the contents of the two stacks are identical.
+bool stack_areequal (const stack* stk1, const stack* stk2);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' onto the top of the stack (bitwise, the stack takes ownership).
+void   stack_push    (stack* stk, const void* obj);
+
+// Pushes a zeroed slot onto the top of the stack and returns it, so that the element can be constructed in place.
+void*  stack_emplace (stack* stk);
+
+// Moves the top element into 'destination' and removes it. If 'destination' is NULL, the element is deleted instead.
+// Returns 'destination' (or the stack itself if 'destination' is NULL), or NULL if the stack was empty.
+void*  stack_pop     (stack* stk, void* destination);
+
+// Moves 'count' contiguous elements starting at 'elements' onto the stack, in order: the last one ends up on the top.
+void   stack_push_n  (stack* stk, const void* elements, const size_t count);
+
+// Moves the top 'count' elements into the contiguous 'destination' in the order they were pushed, so that
+// 'stack_pop_n()' undoes 'stack_push_n()'. If 'destination' is NULL, the elements are deleted instead.
+// Returns the number of elements popped, which is smaller than 'count' if the stack runs empty.
+size_t stack_pop_n   (stack* stk, void* destination, const size_t count);
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Releases the spare segment and the empty segments above the top element.
+void stack_shrink_to_fit (stack* stk);
+
+/* ====================================================== */
+/* =========== Immutative stack manipulations =========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'stk'.
+stack* stack_copy (const stack* stk);
+
+/* ====================================================== */
+/* ============ Mutative stack manipulations ============ */
+/* ====================================================== */
+
+// Erases all the elements of the stack, resulting in an empty one. The first segment is kept.
+void stack_mut_clean (stack* stk);
+
+// Swaps the contents of two stacks in O(1).
+void stack_mut_swap  (stack* stk1, stack* stk2);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CSTACK_WARNMSG_EMPTY_ELEMENT_SIZE "Warning: element size cannot be 0."
+#define CSTACK_WARNMSG_SWAP_INCOMPATIBLE  "Warning: stacks of different element size or callbacks cannot be swapped. No changes have been made."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CSTACK_ERRMSSG_NULL_STACK "Error: stack is a null pointer."
+#define CSTACK_ERRCODE_NULL_STACK -1
+
+#define CSTACK_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CSTACK_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // STACK_H
@@ -4,6 +4,8 @@
 #include <stdbool.h>
 #include <ctype.h> // toupper(), tolower(), etc.
 #include <stdarg.h>
+#include <stdint.h>
+#include <stdatomic.h>
 
 #include "cstring.h"
 
@@ -13,6 +15,7 @@ const char PUNCTUATION_MARKS[] = " ,.;:\t\n\v\f\r";
 struct _string {
     char* data;
     size_t length;
+    _Atomic uint64_t hash; // cached result of 'string_get_hash()', 0 if not computed yet
 };
 
 /* ================================ */
@@ -107,6 +110,27 @@ char string_get_char_at(const string* str, const size_t index) {
     return str->data[index];
 }
 
+// Returns the 64-bit hash of the string. It is computed on the first call and cached until the string is modified.
+// Several threads may hash the same string at once, as long as none of them modifies it.
+uint64_t string_get_hash(const string* str) {
+    string_check_null_string(str);
+
+    // The cache is atomic so that concurrent readers may fill it: they all store the same value, so relaxed order suffices.
+    uint64_t hash = atomic_load_explicit(&str->hash, memory_order_relaxed);
+    if (hash == 0) {
+        hash = string_hash_data(str->data, str->length);
+        atomic_store_explicit(&((string*)str)->hash, hash, memory_order_relaxed);
+    }
+    return hash;
+}
+
+// Returns a view of the characters of the string. It is valid until the string is modified or deleted.
+string_view string_get_view(const string* str) {
+    string_check_null_string(str);
+    string_view view = { str->data, str->length };
+    return view;
+}
+
 /* ======================================= */
 /* ============ Query methods ============ */
 /* ======================================= */
@@ -455,6 +479,7 @@ void string_mut_char_at(string* str, char character, const size_t index) {
     string_check_null_string(str);
     string_check_index(str, index);
     str->data[index] = character;
+    atomic_store_explicit(&str->hash, 0, memory_order_relaxed);
 }
 
 // Overwrites the original contents of the string.
@@ -470,6 +495,7 @@ void string_mut_overwrite(string* str, const char* new_str) {
     size_t new_length = strlen(new_str);
     str->data = calloc(new_length + 1, sizeof(char));
     str->length = new_length;
+    atomic_store_explicit(&str->hash, 0, memory_order_relaxed);
     strncpy(str->data, new_str, str->length + 1);
 }
 
@@ -491,6 +517,7 @@ void string_mut_concatenate(string* str1, const string* str2) {
 
     str1->data[length] = '\0';
     str1->length = length;
+    atomic_store_explicit(&str1->hash, 0, memory_order_relaxed);
 }
 
 // Creates a substring based on the indices and returns it as a new object.
@@ -509,6 +536,7 @@ void string_mut_to_substring(string* str, const size_t start_index, const size_t
     free(str->data);
     str->data = calloc(new_length + 1, sizeof(char));
     str->length = new_length;
+    atomic_store_explicit(&str->hash, 0, memory_order_relaxed);
     strncpy(str->data, proto_string, str->length + 1);
 }
 
@@ -519,6 +547,8 @@ void string_mut_to_lower_case(string* str) {
     for (size_t i = 0; i < str->length + 1; i++) {
         str->data[i] = (char)tolower(str->data[i]);
     }
+
+    atomic_store_explicit(&str->hash, 0, memory_order_relaxed);
 }
 
 // Converts all lower-caseletters to upper-case letters.
@@ -528,12 +558,15 @@ void string_mut_to_upper_case(string* str) {
     for (size_t i = 0; i < str->length + 1; i++) {
         str->data[i] = (char)toupper(str->data[i]);
     }
+
+    atomic_store_explicit(&str->hash, 0, memory_order_relaxed);
 }
 
 // Capitalises the first character of the string.
 void string_mut_capitalise(string* str) {
     string_check_null_string(str);
     str->data[0] = (char)toupper(str->data[0]);
+    atomic_store_explicit(&str->hash, 0, memory_order_relaxed);
 }
 
 // Removes leading and trailing whitespaces.
@@ -834,3 +867,100 @@ char string_convert_to_char (const string* str) {
     string_check_null_string(str);
     return str->data[0];
 }
+
+/* ================================================================ */
+/* === String views: non-owning references to character ranges === */
+/* ================================================================ */
+
+// Reads 8 bytes in native order without alignment requirements.
+static inline uint64_t string_load_word(const unsigned char* bytes) {
+    uint64_t word;
+    memcpy(&word, bytes, sizeof(word));
+    return word;
+}
+
+// Final mixing step (from SplitMix64) spreading every input bit over the whole hash.
+static inline uint64_t string_mix(uint64_t hash) {
+    hash ^= hash >> 30;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+    return hash;
+}
+
+// Computes the 64-bit hash of 'length' bytes. 'string_get_hash()' and 'string_view_hash()' use it as well, so the results are interchangeable.
+// Never returns 0, which marks a string whose hash has not been computed yet.
+uint64_t string_hash_data(const char* data, const size_t length) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (length * 0xC2B2AE3D27D4EB4FULL);
+    size_t i = 0;
+
+    // Eight bytes per round, the tail is padded with zeros.
+    for (; i + 8 <= length; i += 8) {
+        hash = (hash ^ string_load_word(bytes + i)) * 0x9FB21C651E98DF25ULL;
+        hash ^= hash >> 29;
+    }
+
+    if (i < length) {
+        unsigned char tail[8] = { 0 };
+        memcpy(tail, bytes + i, length - i);
+        hash = (hash ^ string_load_word(tail)) * 0x9FB21C651E98DF25ULL;
+    }
+
+    hash = string_mix(hash);
+    return hash != 0 ? hash : 1;
+}
+
+// Creates a view of a null-terminated character array.
+string_view string_view_from(const char* source) {
+    string_view view = { source, source ? strlen(source) : 0 };
+    return view;
+}
+
+// Creates a view of 'length' characters starting at 'data'.
+string_view string_view_from_data(const char* data, const size_t length) {
+    string_view view = { data, length };
+    return view;
+}
+
+// Computes the hash of the viewed characters. Equal to 'string_get_hash()' of a string with the same contents.
+uint64_t string_view_hash(const string_view view) {
+    return string_hash_data(view.data, view.length);
+}
+
+// Checks whether two views refer to identical character sequences.
+bool string_view_areequal(const string_view view1, const string_view view2) {
+    return view1.length == view2.length && (view1.length == 0 || memcmp(view1.data, view2.data, view1.length) == 0);
+}
+
+// Compares two views like 'string_compare()'. A view that is a prefix of the other is the smaller one.
+int string_view_compare(const string_view view1, const string_view view2) {
+    size_t length = view1.length < view2.length ? view1.length : view2.length;
+    int result = length > 0 ? memcmp(view1.data, view2.data, length) : 0;
+
+    if (result != 0) return result;
+    return (view1.length > view2.length) - (view1.length < view2.length);
+}
+
+// Creates a new string holding a copy of the viewed characters.
+string* string_view_to_string(const string_view view) {
+    string* str = calloc(1, sizeof(string));
+
+    if (!str) string_error_handling(CSTRING_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                    CSTRING_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    str->length = view.length;
+    str->data   = malloc(view.length + 1);
+
+    if (!str->data) {
+        free(str);
+        string_error_handling(CSTRING_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                              CSTRING_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    if (view.length > 0) memcpy(str->data, view.data, view.length);
+    str->data[view.length] = '\0';
+
+    return str;
+}
@@ -1,7 +1,9 @@
 #ifndef CSTRING_H
 #define CSTRING_H
 
+#include <stdio.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
 
 /* ======================================= */
@@ -17,6 +19,12 @@ typedef string String;
 // Alternative 'keyword' for type 'string'.
 typedef string string_t;
 
+// Non-owning reference to 'length' characters starting at 'data'. Not necessarily null-terminated.
+typedef struct {
+    const char* data;
+    size_t length;
+} string_view;
+
 /* ======================================= */
 /* ======== Constructor, destructor ====== */
 /* ======================================= */
@@ -40,6 +48,13 @@ const char* string_get_data    (const string* str);
 // Returns the character at the specified index.
 char        string_get_char_at (const string* str, const size_t index);
 
+// Returns the 64-bit hash of the string. It is computed on the first call and cached until the string is modified.
+// Several threads may hash the same string at once, as long as none of them modifies it.
+uint64_t    string_get_hash    (const string* str);
+
+// Returns a view of the characters of the string. It is valid until the string is modified or deleted.
+string_view string_get_view    (const string* str);
+
 /* ======================================= */
 /* ============ Query methods ============ */
 /* ======================================= */
@@ -239,6 +254,31 @@ string* string_convert_bool                 (const bool boolean);
 /* === String splitting: converting from and to arrays and, or lists === */
 /* ===================================================================== */
 
+/* ================================================================ */
+/* === String views: non-owning references to character ranges === */
+/* ================================================================ */
+
+// Computes the 64-bit hash of 'length' bytes. 'string_get_hash()' and 'string_view_hash()' use it as well, so the results are interchangeable.
+uint64_t    string_hash_data       (const char* data, const size_t length);
+
+// Creates a view of a null-terminated character array.
+string_view string_view_from       (const char* source);
+
+// Creates a view of 'length' characters starting at 'data'.
+string_view string_view_from_data  (const char* data, const size_t length);
+
+// Computes the hash of the viewed characters. Equal to 'string_get_hash()' of a string with the same contents.
+uint64_t    string_view_hash       (const string_view view);
+
+// Checks whether two views refer to identical character sequences.
+bool        string_view_areequal   (const string_view view1, const string_view view2);
+
+// Compares two views like 'string_compare()'. A view that is a prefix of the other is the smaller one.
+int         string_view_compare    (const string_view view1, const string_view view2);
+
+// Creates a new string holding a copy of the viewed characters.
+string*     string_view_to_string  (const string_view view);
+
 /* ====================================== */
 /* ========== Warning messages ========== */
 /* ====================================== */
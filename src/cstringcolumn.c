@@ -0,0 +1,464 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "cstringcolumn.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+// Largest number of characters addressed with 32-bit offsets. Can be lowered at compile time to exercise the 64-bit offsets.
+#ifndef CSTRINGCOLUMN_NARROW_LIMIT
+    #define CSTRINGCOLUMN_NARROW_LIMIT UINT32_MAX
+#endif
+
+#define CSTRINGCOLUMN_MIN_CAPACITY      8
+#define CSTRINGCOLUMN_MIN_BYTE_CAPACITY 64
+
+struct _stringcolumn {
+    char* bytes;
+    size_t byte_size;
+    size_t byte_capacity;
+
+    void* offsets;          // 'capacity + 1' entries of 'uint32_t', or 'uint64_t' if 'wide'; string 'i' is [offsets[i], offsets[i + 1])
+    size_t size;
+    size_t capacity;
+    bool wide;
+};
+
+// Sort item: the first 8 characters in big-endian order, so that comparing the integers compares the characters.
+typedef struct {
+    uint64_t key;
+    size_t index;
+} stringcolumn_sort_item;
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void stringcolumn_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CSTRINGCOLUMN_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void stringcolumn_check_null(const stringcolumn* col) {
+    if (!col) stringcolumn_error_handling(CSTRINGCOLUMN_ERRMSSG_NULL_STRINGCOLUMN,
+                                          CSTRINGCOLUMN_ERRCODE_NULL_STRINGCOLUMN);
+}
+
+static void stringcolumn_check_index(const stringcolumn* col, const size_t index) {
+    if (col->size <= index) {
+        delete_stringcolumn((stringcolumn*)col);
+        stringcolumn_error_handling(CSTRINGCOLUMN_ERRMSSG_INDEX_OUT_OF_BOUNDS,
+                                    CSTRINGCOLUMN_ERRCODE_INDEX_OUT_OF_BOUNDS);
+    }
+}
+
+static void* stringcolumn_allocate(void* memory, const size_t count, const size_t size) {
+    if (size && count > SIZE_MAX / size) {
+        stringcolumn_error_handling(CSTRINGCOLUMN_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                    CSTRINGCOLUMN_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    void* result = realloc(memory, count && size ? count * size : 1);
+
+    if (!result) stringcolumn_error_handling(CSTRINGCOLUMN_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                             CSTRINGCOLUMN_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    return result;
+}
+
+/* ================================ */
+/* =========== Offsets ============ */
+/* ================================ */
+
+static inline size_t stringcolumn_offset(const stringcolumn* col, const size_t index) {
+    return col->wide ? (size_t)((const uint64_t*)col->offsets)[index] : ((const uint32_t*)col->offsets)[index];
+}
+
+static inline void stringcolumn_set_offset(stringcolumn* col, const size_t index, const size_t offset) {
+    if (col->wide) ((uint64_t*)col->offsets)[index] = offset;
+    else ((uint32_t*)col->offsets)[index] = (uint32_t)offset;
+}
+
+static inline size_t stringcolumn_offset_width(const bool wide) {
+    return wide ? sizeof(uint64_t) : sizeof(uint32_t);
+}
+
+// Switches to 64-bit offsets.
+static void stringcolumn_widen(stringcolumn* col) {
+    uint64_t* wide = stringcolumn_allocate(NULL, col->capacity + 1, sizeof(uint64_t));
+    const uint32_t* narrow = col->offsets;
+
+    for (size_t i = 0; i <= col->size; i++) wide[i] = narrow[i];
+
+    free(col->offsets);
+    col->offsets = wide;
+    col->wide = true;
+}
+
+static inline string_view stringcolumn_view(const stringcolumn* col, const size_t index) {
+    size_t begin = stringcolumn_offset(col, index);
+    return string_view_from_data(col->bytes + begin, stringcolumn_offset(col, index + 1) - begin);
+}
+
+// Appends 'length' characters without checking the capacities.
+static inline void stringcolumn_push(stringcolumn* col, const char* data, const size_t length) {
+    if (length) memcpy(col->bytes + col->byte_size, data, length);
+    col->byte_size += length;
+    stringcolumn_set_offset(col, ++col->size, col->byte_size);
+}
+
+// Makes room for 'length' more characters, at least doubling the byte capacity when it has to grow.
+static void stringcolumn_make_byte_room(stringcolumn* col, const size_t length) {
+    if (length > SIZE_MAX - col->byte_size) {
+        stringcolumn_error_handling(CSTRINGCOLUMN_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                    CSTRINGCOLUMN_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    if (col->byte_size + length > col->byte_capacity) {
+        size_t byte_capacity = col->byte_capacity < CSTRINGCOLUMN_MIN_BYTE_CAPACITY ? CSTRINGCOLUMN_MIN_BYTE_CAPACITY : col->byte_capacity * 2;
+        if (byte_capacity < col->byte_size + length) byte_capacity = col->byte_size + length;
+        stringcolumn_reserve(col, col->capacity, byte_capacity);
+    }
+    if (!col->wide && col->byte_size + length > CSTRINGCOLUMN_NARROW_LIMIT) stringcolumn_widen(col);
+}
+
+// Makes room for one more string of 'length' characters.
+static void stringcolumn_make_room(stringcolumn* col, const size_t length) {
+    if (col->size == col->capacity) {
+        stringcolumn_reserve(col, col->capacity < CSTRINGCOLUMN_MIN_CAPACITY ? CSTRINGCOLUMN_MIN_CAPACITY : col->capacity * 2,
+                             col->byte_capacity);
+    }
+    stringcolumn_make_byte_room(col, length);
+}
+
+/* ================================ */
+/* =========== Sorting ============ */
+/* ================================ */
+
+static inline uint64_t stringcolumn_sort_key(const string_view view) {
+    uint64_t key = 0;
+    size_t length = view.length < 8 ? view.length : 8;
+
+    for (size_t i = 0; i < length; i++) key |= (uint64_t)(unsigned char)view.data[i] << (56 - 8 * i);
+    return key;
+}
+
+static inline bool stringcolumn_sort_less(const stringcolumn* col, const stringcolumn_sort_item* a, const stringcolumn_sort_item* b) {
+    if (a->key != b->key) return a->key < b->key;
+    return string_view_compare(stringcolumn_view(col, a->index), stringcolumn_view(col, b->index)) < 0;
+}
+
+// Bottom-up merge sort, stable. Runs of 16 are sorted by insertion first.
+static void stringcolumn_sort_items(const stringcolumn* col, stringcolumn_sort_item* items, const size_t count) {
+    const size_t run = 16;
+
+    for (size_t begin = 0; begin < count; begin += run) {
+        size_t end = begin + run < count ? begin + run : count;
+        for (size_t i = begin + 1; i < end; i++) {
+            stringcolumn_sort_item item = items[i];
+            size_t j = i;
+            for (; j > begin && stringcolumn_sort_less(col, &item, &items[j - 1]); j--) items[j] = items[j - 1];
+            items[j] = item;
+        }
+    }
+
+    if (count <= run) return;
+
+    stringcolumn_sort_item* buffer = stringcolumn_allocate(NULL, count, sizeof(stringcolumn_sort_item));
+    stringcolumn_sort_item* source = items;
+    stringcolumn_sort_item* destination = buffer;
+
+    for (size_t width = run; width < count; width *= 2) {
+        for (size_t begin = 0; begin < count; begin += 2 * width) {
+            size_t middle = begin + width < count ? begin + width : count;
+            size_t end = begin + 2 * width < count ? begin + 2 * width : count;
+            size_t i = begin, j = middle, k = begin;
+
+            while (i < middle && j < end) destination[k++] = stringcolumn_sort_less(col, &source[j], &source[i]) ? source[j++] : source[i++];
+            while (i < middle) destination[k++] = source[i++];
+            while (j < end) destination[k++] = source[j++];
+        }
+
+        stringcolumn_sort_item* swap = source;
+        source = destination;
+        destination = swap;
+    }
+
+    if (source != items) memcpy(items, source, count * sizeof(stringcolumn_sort_item));
+    free(buffer);
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of string column with room for 'capacity' strings of 'byte_capacity' characters in total.
+stringcolumn* new_stringcolumn(const size_t capacity, const size_t byte_capacity) {
+    stringcolumn* col = calloc(1, sizeof(stringcolumn));
+
+    if (!col) stringcolumn_error_handling(CSTRINGCOLUMN_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                          CSTRINGCOLUMN_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    col->wide = byte_capacity > CSTRINGCOLUMN_NARROW_LIMIT;
+    col->offsets = stringcolumn_allocate(NULL, capacity + 1, stringcolumn_offset_width(col->wide));
+    col->capacity = capacity;
+    col->bytes = stringcolumn_allocate(NULL, byte_capacity, 1);
+    col->byte_capacity = byte_capacity;
+    stringcolumn_set_offset(col, 0, 0);
+    return col;
+}
+
+// Destructor of string column. Standardised template: void func_name(void* obj).
+void delete_stringcolumn(void* obj) {
+    stringcolumn* col = (stringcolumn*)obj;
+    if (!col) return;
+
+    free(col->bytes);
+    free(col->offsets);
+    free(col);
+
+    col = NULL;
+    obj = col;
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of strings.
+size_t stringcolumn_get_size(const stringcolumn* col) {
+    stringcolumn_check_null(col);
+    return col->size;
+}
+
+// Getter of the number of characters of all the strings together.
+size_t stringcolumn_get_byte_size(const stringcolumn* col) {
+    stringcolumn_check_null(col);
+    return col->byte_size;
+}
+
+// Getter of the size of one offset in bytes: 4, or 8 once the characters do not fit 32-bit offsets.
+size_t stringcolumn_get_offset_width(const stringcolumn* col) {
+    stringcolumn_check_null(col);
+    return stringcolumn_offset_width(col->wide);
+}
+
+// Returns the number of bytes allocated by the column, including the unused capacity.
+size_t stringcolumn_get_memory_usage(const stringcolumn* col) {
+    stringcolumn_check_null(col);
+    return sizeof(stringcolumn) + col->byte_capacity + (col->capacity + 1) * stringcolumn_offset_width(col->wide);
+}
+
+// Returns a view of the string at the specified index.
+string_view stringcolumn_get_view(const stringcolumn* col, const size_t index) {
+    stringcolumn_check_null(col);
+    stringcolumn_check_index(col, index);
+    return stringcolumn_view(col, index);
+}
+
+// Returns a copy of the string at the specified index as a new 'string'.
+string* stringcolumn_get_string(const stringcolumn* col, const size_t index) {
+    return string_view_to_string(stringcolumn_get_view(col, index));
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the column is empty.
+bool stringcolumn_isempty(const stringcolumn* col) {
+    stringcolumn_check_null(col);
+    return col->size == 0;
+}
+
+// Checks whether the two columns hold the same strings in the same order.
+bool stringcolumn_areequal(const stringcolumn* col1, const stringcolumn* col2) {
+    stringcolumn_check_null(col1);
+    stringcolumn_check_null(col2);
+
+    if (col1->size != col2->size || col1->byte_size != col2->byte_size) return false;
+
+    // Both columns are contiguous: equal boundaries and equal characters mean equal strings.
+    for (size_t i = 1; i <= col1->size; i++) {
+        if (stringcolumn_offset(col1, i) != stringcolumn_offset(col2, i)) return false;
+    }
+
+    return !col1->byte_size || !memcmp(col1->bytes, col2->bytes, col1->byte_size);
+}
+
+// Fills 'permutation' (of 'stringcolumn_get_size()' indices) so that the strings it lists are in ascending order,
+// following 'string_view_compare()'. The sort is stable and the column is not modified.
+void stringcolumn_sort_permutation(const stringcolumn* col, size_t* permutation) {
+    stringcolumn_check_null(col);
+    if (!col->size) return;
+
+    // Most comparisons are decided by the cached first characters, without touching the strings.
+    stringcolumn_sort_item* items = stringcolumn_allocate(NULL, col->size, sizeof(stringcolumn_sort_item));
+    for (size_t i = 0; i < col->size; i++) {
+        items[i].key = stringcolumn_sort_key(stringcolumn_view(col, i));
+        items[i].index = i;
+    }
+
+    stringcolumn_sort_items(col, items, col->size);
+
+    for (size_t i = 0; i < col->size; i++) permutation[i] = items[i].index;
+    free(items);
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Appends a copy of the string.
+void stringcolumn_append(stringcolumn* col, const string* str) {
+    stringcolumn_append_view(col, string_get_view(str));
+}
+
+// Appends a copy of the viewed characters, which may belong to the column itself.
+void stringcolumn_append_view(stringcolumn* col, const string_view view) {
+    stringcolumn_check_null(col);
+
+    const char* data = view.data;
+    bool inside = view.length && data >= col->bytes && data < col->bytes + col->byte_size;
+    size_t position = inside ? (size_t)(data - col->bytes) : 0;
+
+    stringcolumn_make_room(col, view.length);
+    stringcolumn_push(col, inside ? col->bytes + position : data, view.length);
+}
+
+// Splits 'text' at every character of 'delimiters' and appends the pieces, skipping the empty ones unless 'keep_empty' is set.
+// Returns the number of strings appended. The pieces are copied straight into the column, without intermediate strings.
+size_t stringcolumn_append_split(stringcolumn* col, const string_view text, const char* delimiters, const bool keep_empty) {
+    stringcolumn_check_null(col);
+
+    const char* data = text.data;
+    bool inside = text.length && data >= col->bytes && data < col->bytes + col->byte_size;
+    size_t position = inside ? (size_t)(data - col->bytes) : 0;
+
+    // The pieces take at most the characters of the text, so a single reservation covers them.
+    stringcolumn_make_byte_room(col, text.length);
+    if (inside) data = col->bytes + position;
+
+    bool is_delimiter[256] = { false };
+    size_t delimiter_count = 0;
+    for (const char* d = delimiters ? delimiters : ""; *d; d++, delimiter_count++) is_delimiter[(unsigned char)*d] = true;
+
+    size_t appended = 0, begin = 0;
+    for (;;) {
+        size_t end = begin;
+
+        if (delimiter_count == 1) {
+            const char* found = begin < text.length ? memchr(data + begin, delimiters[0], text.length - begin) : NULL;
+            end = found ? (size_t)(found - data) : text.length;
+        }
+        else {
+            while (end < text.length && !is_delimiter[(unsigned char)data[end]]) end++;
+        }
+
+        if (end > begin || keep_empty) {
+            stringcolumn_make_room(col, end - begin);
+            stringcolumn_push(col, data + begin, end - begin);
+            appended++;
+        }
+
+        if (end == text.length) break;
+        begin = end + 1;
+    }
+
+    return appended;
+}
+
+/* ======================================= */
+/* ========= Capacity management ========= */
+/* ======================================= */
+
+// Makes room for at least 'capacity' strings of 'byte_capacity' characters in total.
+void stringcolumn_reserve(stringcolumn* col, const size_t capacity, const size_t byte_capacity) {
+    stringcolumn_check_null(col);
+
+    if (capacity > col->capacity) {
+        col->offsets = stringcolumn_allocate(col->offsets, capacity + 1, stringcolumn_offset_width(col->wide));
+        col->capacity = capacity;
+    }
+
+    if (byte_capacity > col->byte_capacity) {
+        col->bytes = stringcolumn_allocate(col->bytes, byte_capacity, 1);
+        col->byte_capacity = byte_capacity;
+    }
+}
+
+/* ====================================================== */
+/* ======== Immutative string column manipulations ====== */
+/* ====================================================== */
+
+// Copies the entire contents of 'col' without the unused capacity.
+stringcolumn* stringcolumn_copy(const stringcolumn* col) {
+    stringcolumn_check_null(col);
+
+    stringcolumn* copy = new_stringcolumn(col->size, col->byte_size);
+    if (col->byte_size) memcpy(copy->bytes, col->bytes, col->byte_size);
+    for (size_t i = 1; i <= col->size; i++) stringcolumn_set_offset(copy, i, stringcolumn_offset(col, i));
+
+    copy->size = col->size;
+    copy->byte_size = col->byte_size;
+    return copy;
+}
+
+/* ====================================================== */
+/* ========= Mutative string column manipulations ======= */
+/* ====================================================== */
+
+// Lays the column out again with the strings at 'indices[0]', ..., 'indices[count - 1]', in this order.
+// Strings not listed are dropped, listed ones can be repeated. The buffers are shrunk to fit, with 32-bit offsets if possible.
+void stringcolumn_mut_rebuild(stringcolumn* col, const size_t* indices, const size_t count) {
+    stringcolumn_check_null(col);
+
+    size_t byte_size = 0;
+    for (size_t i = 0; i < count; i++) {
+        stringcolumn_check_index(col, indices[i]);
+
+        size_t length = stringcolumn_view(col, indices[i]).length;
+        if (length > SIZE_MAX - byte_size) {
+            stringcolumn_error_handling(CSTRINGCOLUMN_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                        CSTRINGCOLUMN_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+        }
+        byte_size += length;
+    }
+
+    stringcolumn* result = new_stringcolumn(count, byte_size);
+    for (size_t i = 0; i < count; i++) {
+        string_view view = stringcolumn_view(col, indices[i]);
+        stringcolumn_push(result, view.data, view.length);
+    }
+
+    free(col->bytes);
+    free(col->offsets);
+    *col = *result;
+    free(result);
+}
+
+// Sorts the strings in ascending order: a permutation followed by a rebuild.
+void stringcolumn_mut_sort(stringcolumn* col) {
+    stringcolumn_check_null(col);
+
+    size_t* permutation = stringcolumn_allocate(NULL, col->size, sizeof(size_t));
+    stringcolumn_sort_permutation(col, permutation);
+    stringcolumn_mut_rebuild(col, permutation, col->size);
+    free(permutation);
+}
+
+// Erases every string, keeping the capacity.
+void stringcolumn_mut_clean(stringcolumn* col) {
+    stringcolumn_check_null(col);
+
+    col->size = 0;
+    col->byte_size = 0;
+}
@@ -0,0 +1,137 @@
+#ifndef STRINGCOLUMN_H
+#define STRINGCOLUMN_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cstring.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'stringcolumn' type is an append-only sequence of strings packed into a single buffer of characters.
+Therefore, it has the following characteristics:
+    - the characters of every string are stored one after the other, and string 'i' spans from offset 'i' to offset 'i + 1'
+    - the offsets take 4 bytes per string, and switch to 8 bytes automatically once the characters exceed 4 GiB,
+      compared to two allocations and a 'string' header per string when storing 'string*'
+    - the strings are returned as views into the buffer, so reading never allocates
+    - sorting produces a permutation of the indices instead of moving characters, and a rebuild lays the strings out again
+      in any order, dropping the ones not selected and the unused capacity
+Similar in nature to the string columns of Apache Arrow and of column stores in general.
+
+The views are not null-terminated, and they are invalidated by any function that appends to or rebuilds the column.
+*/
+
+// Type definition of 'stringcolumn' type.
+typedef struct _stringcolumn stringcolumn;
+
+// Alternative 'keyword' for type 'stringcolumn'.
+typedef stringcolumn StringColumn;
+
+// Alternative 'keyword' for type 'stringcolumn'.
+typedef stringcolumn stringcolumn_t;
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of string column with room for 'capacity' strings of 'byte_capacity' characters in total.
+stringcolumn* new_stringcolumn    (const size_t capacity, const size_t byte_capacity);
+
+// Destructor of string column. Standardised template: void func_name(void* obj).
+void          delete_stringcolumn (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of strings.
+size_t      stringcolumn_get_size         (const stringcolumn* col);
+
+// Getter of the number of characters of all the strings together.
+size_t      stringcolumn_get_byte_size    (const stringcolumn* col);
+
+// Getter of the size of one offset in bytes: 4, or 8 once the characters do not fit 32-bit offsets.
+size_t      stringcolumn_get_offset_width (const stringcolumn* col);
+
+// Returns the number of bytes allocated by the column, including the unused capacity.
+size_t      stringcolumn_get_memory_usage (const stringcolumn* col);
+
+// Returns a view of the string at the specified index.
+string_view stringcolumn_get_view         (const stringcolumn* col, const size_t index);
+
+// Returns a copy of the string at the specified index as a new 'string'.
+string*     stringcolumn_get_string       (const stringcolumn* col, const size_t index);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the column is empty.
+bool stringcolumn_isempty   (const stringcolumn* col);
+
+// Checks whether the two columns hold the same strings in the same order.
+bool stringcolumn_areequal  (const stringcolumn* col1, const stringcolumn* col2);
+
+// Fills 'permutation' (of 'stringcolumn_get_size()' indices) so that the strings it lists are in ascending order,
+// following 'string_view_compare()'. The sort is stable and the column is not modified.
+void stringcolumn_sort_permutation (const stringcolumn* col, size_t* permutation);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Appends a copy of the string.
+void   stringcolumn_append       (stringcolumn* col, const string* str);
+
+// Appends a copy of the viewed characters, which may belong to the column itself.
+void   stringcolumn_append_view  (stringcolumn* col, const string_view view);
+
+// Splits 'text' at every character of 'delimiters' and appends the pieces, skipping the empty ones unless 'keep_empty' is set.
+// Returns the number of strings appended. The pieces are copied straight into the column, without intermediate strings.
+size_t stringcolumn_append_split (stringcolumn* col, const string_view text, const char* delimiters, const bool keep_empty);
+
+/* ======================================= */
+/* ========= Capacity management ========= */
+/* ======================================= */
+
+// Makes room for at least 'capacity' strings of 'byte_capacity' characters in total.
+void stringcolumn_reserve (stringcolumn* col, const size_t capacity, const size_t byte_capacity);
+
+/* ====================================================== */
+/* ======== Immutative string column manipulations ====== */
+/* ====================================================== */
+
+// Copies the entire contents of 'col' without the unused capacity.
+stringcolumn* stringcolumn_copy (const stringcolumn* col);
+
+/* ====================================================== */
+/* ========= Mutative string column manipulations ======= */
+/* ====================================================== */
+
+// Lays the column out again with the strings at 'indices[0]', ..., 'indices[count - 1]', in this order.
+// Strings not listed are dropped, listed ones can be repeated. The buffers are shrunk to fit, with 32-bit offsets if possible.
+void stringcolumn_mut_rebuild (stringcolumn* col, const size_t* indices, const size_t count);
+
+// Sorts the strings in ascending order: a permutation followed by a rebuild.
+void stringcolumn_mut_sort    (stringcolumn* col);
+
+// Erases every string, keeping the capacity.
+void stringcolumn_mut_clean   (stringcolumn* col);
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CSTRINGCOLUMN_ERRMSSG_NULL_STRINGCOLUMN "Error: string column is a null pointer."
+#define CSTRINGCOLUMN_ERRCODE_NULL_STRINGCOLUMN -1
+
+#define CSTRINGCOLUMN_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CSTRINGCOLUMN_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CSTRINGCOLUMN_ERRMSSG_INDEX_OUT_OF_BOUNDS "Error: index out of bounds."
+#define CSTRINGCOLUMN_ERRCODE_INDEX_OUT_OF_BOUNDS -3
+
+#endif // STRINGCOLUMN_H
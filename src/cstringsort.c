@@ -0,0 +1,445 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "cstringsort.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+// Strings per classification chunk of the parallel sorts.
+#define CSTRINGSORT_PARALLEL_CHUNK 65536
+
+// Ranges per worker, and sampled strings per range, of the parallel sorts.
+#define CSTRINGSORT_RANGES_PER_WORKER 4
+#define CSTRINGSORT_OVERSAMPLING      16
+
+// A string being sorted, with the 8 characters at the current depth cached as a big-endian integer (zero padded),
+// so that comparing two keys compares those characters.
+typedef struct {
+    uint64_t key;
+    const unsigned char* data;
+    size_t length;
+    string* origin;             // the sorted string, NULL when sorting views
+} stringsort_item;
+
+// Shared state of a parallel sort.
+typedef struct {
+    stringsort_item* items;
+    stringsort_item* output;
+    size_t count;
+
+    const stringsort_item* splitters;
+    size_t ranges;              // number of splitters + 1
+    uint32_t* range_of;         // range of every item
+    size_t* positions;          // per chunk and range: where the chunk's items of the range go in 'output'
+    size_t* bounds;             // 'ranges + 1' boundaries of the ranges in 'output'
+} stringsort_job;
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void stringsort_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CSTRINGSORT_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void* stringsort_allocate(const size_t count, const size_t size) {
+    if (size && count > SIZE_MAX / size) {
+        stringsort_error_handling(CSTRINGSORT_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                  CSTRINGSORT_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    void* memory = malloc(count && size ? count * size : 1);
+
+    if (!memory) stringsort_error_handling(CSTRINGSORT_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                           CSTRINGSORT_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    return memory;
+}
+
+/* ================================ */
+/* ======= Multikey quicksort ===== */
+/* ================================ */
+
+// Returns the characters [depth, depth + 8) of the string as a big-endian integer, padded with zeros.
+static inline uint64_t stringsort_key(const unsigned char* data, const size_t length, const size_t depth) {
+    if (depth >= length) return 0;
+
+    size_t available = length - depth;
+    uint64_t key = 0;
+
+    if (available >= 8) {
+        #if (defined(__GNUC__) || defined(__clang__)) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            memcpy(&key, data + depth, 8);
+            return __builtin_bswap64(key);
+        #else
+            available = 8;
+        #endif
+    }
+
+    for (size_t i = 0; i < available; i++) key |= (uint64_t)data[depth + i] << (56 - 8 * i);
+    return key;
+}
+
+// Compares two items whose characters before 'depth' are equal and whose keys are cached at 'depth'.
+static inline int stringsort_compare(const stringsort_item* a, const stringsort_item* b, const size_t depth) {
+    if (a->key != b->key) return a->key < b->key ? -1 : 1;
+
+    // Equal keys: the characters up to 'depth + 8' are equal, except for the padding of a string ending before.
+    size_t common = a->length < b->length ? a->length : b->length;
+    if (depth + 8 < common) {
+        int result = memcmp(a->data + depth + 8, b->data + depth + 8, common - depth - 8);
+        if (result) return result;
+    }
+
+    return (a->length > b->length) - (a->length < b->length);
+}
+
+static inline void stringsort_swap(stringsort_item* a, stringsort_item* b) {
+    stringsort_item swap = *a;
+    *a = *b;
+    *b = swap;
+}
+
+static void stringsort_insertion(stringsort_item* items, const size_t count, const size_t depth) {
+    for (size_t i = 1; i < count; i++) {
+        stringsort_item item = items[i];
+        size_t j = i;
+
+        for (; j > 0 && stringsort_compare(&item, &items[j - 1], depth) < 0; j--) items[j] = items[j - 1];
+        items[j] = item;
+    }
+}
+
+static inline uint64_t stringsort_median(uint64_t a, uint64_t b, uint64_t c) {
+    if (a > b) { uint64_t swap = a; a = b; b = swap; }
+    if (b > c) b = c;
+    return a > b ? a : b;
+}
+
+static void stringsort_sift_down(stringsort_item* items, size_t root, const size_t count, const size_t depth) {
+    while (2 * root + 1 < count) {
+        size_t child = 2 * root + 1;
+        if (child + 1 < count && stringsort_compare(&items[child], &items[child + 1], depth) < 0) child++;
+        if (stringsort_compare(&items[root], &items[child], depth) >= 0) return;
+
+        stringsort_swap(&items[root], &items[child]);
+        root = child;
+    }
+}
+
+// Fallback of the multikey quicksort once a group is partitioned badly too often, guaranteeing O(n log n) comparisons.
+static void stringsort_heap_sort(stringsort_item* items, const size_t count, const size_t depth) {
+    for (size_t i = count / 2; i > 0; i--) stringsort_sift_down(items, i - 1, count, depth);
+
+    for (size_t end = count - 1; end > 0; end--) {
+        stringsort_swap(&items[0], &items[end]);
+        stringsort_sift_down(items, 0, end, depth);
+    }
+}
+
+// Number of partitions of a group of 'count' items at one depth before the heapsort takes over, as in 'array_sort()'.
+static size_t stringsort_partition_limit(const size_t count) {
+    size_t limit = 0;
+    for (size_t n = count; n > 1; n >>= 1) limit += 2;
+    return limit;
+}
+
+// Orders the group of items whose keys at 'depth' are all equal: strings ending within these 8 characters are prefixes
+// of the others and come first, shortest first. The rest get their keys at the next depth. Returns the number of the first.
+static size_t stringsort_finish_prefixes(stringsort_item* equal, const size_t equal_count, const size_t depth) {
+    size_t finished = 0;
+
+    for (size_t j = 0; j < equal_count; j++) {
+        if (equal[j].length <= depth + 8) stringsort_swap(&equal[finished++], &equal[j]);
+    }
+
+    if (finished > 1) {
+        size_t ordered = 0;
+        for (size_t length = depth; length <= depth + 8 && ordered < finished; length++) {
+            for (size_t j = ordered; j < finished; j++) {
+                if (equal[j].length == length) stringsort_swap(&equal[ordered++], &equal[j]);
+            }
+        }
+    }
+
+    for (size_t j = finished; j < equal_count; j++) equal[j].key = stringsort_key(equal[j].data, equal[j].length, depth + 8);
+    return finished;
+}
+
+// Sorts items whose characters before 'depth' are equal, with their keys cached at 'depth'. After 'limit' partitions
+// at the same depth, the group is heapsorted.
+static void stringsort_multikey_limited(stringsort_item* items, size_t count, size_t depth, size_t limit) {
+    while (count > CSTRINGSORT_INSERTION_THRESHOLD) {
+        if (limit == 0) {
+            stringsort_heap_sort(items, count, depth);
+            return;
+        }
+
+        limit--;
+
+        // Pivot: median of three, or of three medians of three for large groups.
+        uint64_t pivot;
+        if (count > 1024) {
+            size_t step = count / 8;
+            pivot = stringsort_median(stringsort_median(items[0].key, items[step].key, items[2 * step].key),
+                                      stringsort_median(items[3 * step].key, items[count / 2].key, items[5 * step].key),
+                                      stringsort_median(items[6 * step].key, items[7 * step].key, items[count - 1].key));
+        }
+        else pivot = stringsort_median(items[0].key, items[count / 2].key, items[count - 1].key);
+
+        // Three-way partition: [0, less) < pivot, [less, greater) == pivot, [greater, count) > pivot.
+        size_t less = 0, i = 0, greater = count;
+        while (i < greater) {
+            if (items[i].key < pivot) stringsort_swap(&items[less++], &items[i++]);
+            else if (items[i].key > pivot) stringsort_swap(&items[i], &items[--greater]);
+            else i++;
+        }
+
+        stringsort_item* equal = items + less;
+        size_t equal_count = greater - less, greater_count = count - greater;
+
+        // Recurse into the two smaller groups, iterate over the largest one, so that the recursion depth stays logarithmic.
+        if (equal_count >= less && equal_count >= greater_count) {
+            stringsort_multikey_limited(items, less, depth, limit);
+            stringsort_multikey_limited(items + greater, greater_count, depth, limit);
+
+            size_t finished = stringsort_finish_prefixes(equal, equal_count, depth);
+            items = equal + finished;
+            count = equal_count - finished;
+            depth += 8;
+            limit = stringsort_partition_limit(count);
+            continue;
+        }
+
+        size_t finished = stringsort_finish_prefixes(equal, equal_count, depth);
+        stringsort_multikey_limited(equal + finished, equal_count - finished, depth + 8, stringsort_partition_limit(equal_count - finished));
+
+        if (less < greater_count) {
+            stringsort_multikey_limited(items, less, depth, limit);
+            items += greater;
+            count = greater_count;
+        } else {
+            stringsort_multikey_limited(items + greater, greater_count, depth, limit);
+            count = less;
+        }
+    }
+
+    stringsort_insertion(items, count, depth);
+}
+
+// Sorts items whose characters before 'depth' are equal, with their keys cached at 'depth'.
+static void stringsort_multikey(stringsort_item* items, const size_t count, const size_t depth) {
+    stringsort_multikey_limited(items, count, depth, stringsort_partition_limit(count));
+}
+
+/* ================================ */
+/* ========= Parallel sort ======== */
+/* ================================ */
+
+// Returns the range of an item: the number of splitters not greater than it.
+static inline uint32_t stringsort_range_of(const stringsort_job* job, const stringsort_item* item) {
+    size_t low = 0, high = job->ranges - 1;
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (stringsort_compare(&job->splitters[middle], item, 0) <= 0) low = middle + 1;
+        else high = middle;
+    }
+
+    return (uint32_t)low;
+}
+
+static void stringsort_classify_chunk(void* argument, size_t index) {
+    stringsort_job* job = (stringsort_job*)argument;
+    size_t begin = index * CSTRINGSORT_PARALLEL_CHUNK;
+    size_t end = begin + CSTRINGSORT_PARALLEL_CHUNK < job->count ? begin + CSTRINGSORT_PARALLEL_CHUNK : job->count;
+    size_t* counts = job->positions + index * job->ranges;
+
+    for (size_t i = begin; i < end; i++) {
+        uint32_t range = stringsort_range_of(job, &job->items[i]);
+        job->range_of[i] = range;
+        counts[range]++;
+    }
+}
+
+static void stringsort_scatter_chunk(void* argument, size_t index) {
+    stringsort_job* job = (stringsort_job*)argument;
+    size_t begin = index * CSTRINGSORT_PARALLEL_CHUNK;
+    size_t end = begin + CSTRINGSORT_PARALLEL_CHUNK < job->count ? begin + CSTRINGSORT_PARALLEL_CHUNK : job->count;
+    size_t* positions = job->positions + index * job->ranges;
+
+    for (size_t i = begin; i < end; i++) job->output[positions[job->range_of[i]]++] = job->items[i];
+}
+
+static void stringsort_sort_range(void* argument, size_t index) {
+    stringsort_job* job = (stringsort_job*)argument;
+    stringsort_multikey(job->output + job->bounds[index], job->bounds[index + 1] - job->bounds[index], 0);
+}
+
+// Sorts the items (keys cached at depth 0) into 'output'.
+static void stringsort_parallel(stringsort_item* items, stringsort_item* output, const size_t count, threadpool* pool) {
+    pool = pool ? pool : threadpool_get_default();
+    size_t workers = threadpool_get_workers(pool);
+
+    if (workers < 2 || count < CSTRINGSORT_PARALLEL_THRESHOLD) {
+        stringsort_multikey(items, count, 0);
+        memcpy(output, items, count * sizeof(stringsort_item));
+        return;
+    }
+
+    // Splitters: evenly spaced strings of a sorted sample.
+    size_t ranges = workers * CSTRINGSORT_RANGES_PER_WORKER;
+    size_t sample_count = ranges * CSTRINGSORT_OVERSAMPLING;
+    stringsort_item* sample = stringsort_allocate(sample_count, sizeof(stringsort_item));
+
+    for (size_t i = 0; i < sample_count; i++) sample[i] = items[i * count / sample_count];
+    stringsort_multikey(sample, sample_count, 0);
+
+    stringsort_item* splitters = stringsort_allocate(ranges - 1, sizeof(stringsort_item));
+    for (size_t i = 1; i < ranges; i++) {
+        // Sorting the sample cached the keys of its equal groups at deeper depths: the items are classified at depth 0.
+        splitters[i - 1] = sample[i * CSTRINGSORT_OVERSAMPLING];
+        splitters[i - 1].key = stringsort_key(splitters[i - 1].data, splitters[i - 1].length, 0);
+    }
+    free(sample);
+
+    size_t chunks = (count + CSTRINGSORT_PARALLEL_CHUNK - 1) / CSTRINGSORT_PARALLEL_CHUNK;
+    stringsort_job job = { 0 };
+    job.items = items;
+    job.output = output;
+    job.count = count;
+    job.splitters = splitters;
+    job.ranges = ranges;
+    job.range_of = stringsort_allocate(count, sizeof(uint32_t));
+    job.positions = calloc(chunks * ranges, sizeof(size_t));
+    job.bounds = stringsort_allocate(ranges + 1, sizeof(size_t));
+
+    if (!job.positions) stringsort_error_handling(CSTRINGSORT_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                                  CSTRINGSORT_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    threadpool_run(pool, stringsort_classify_chunk, &job, chunks);
+
+    // Turn the counts into the starting positions of every chunk within every range.
+    size_t position = 0;
+    for (size_t range = 0; range < ranges; range++) {
+        job.bounds[range] = position;
+        for (size_t chunk = 0; chunk < chunks; chunk++) {
+            size_t items_of_chunk = job.positions[chunk * ranges + range];
+            job.positions[chunk * ranges + range] = position;
+            position += items_of_chunk;
+        }
+    }
+    job.bounds[ranges] = position;
+
+    threadpool_run(pool, stringsort_scatter_chunk, &job, chunks);
+    threadpool_run(pool, stringsort_sort_range, &job, ranges);
+
+    free(job.bounds);
+    free(job.positions);
+    free(job.range_of);
+    free(splitters);
+}
+
+/* ================================ */
+/* ========= Entry points ========= */
+/* ================================ */
+
+// Moves the NULL entries to the end and returns the items of the others.
+static stringsort_item* stringsort_items_of_strings(string** strings, const size_t count, size_t* item_count) {
+    stringsort_item* items = stringsort_allocate(count, sizeof(stringsort_item));
+    size_t filled = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        if (!strings[i]) continue;
+
+        stringsort_item* item = &items[filled++];
+        item->data = (const unsigned char*)string_get_data(strings[i]);
+        item->length = string_get_length(strings[i]);
+        item->origin = strings[i];
+        item->key = stringsort_key(item->data, item->length, 0);
+    }
+
+    for (size_t i = filled; i < count; i++) strings[i] = NULL;
+    *item_count = filled;
+    return items;
+}
+
+static stringsort_item* stringsort_items_of_views(const string_view* views, const size_t count) {
+    stringsort_item* items = stringsort_allocate(count, sizeof(stringsort_item));
+
+    for (size_t i = 0; i < count; i++) {
+        items[i].data = (const unsigned char*)views[i].data;
+        items[i].length = views[i].length;
+        items[i].origin = NULL;
+        items[i].key = stringsort_key(items[i].data, items[i].length, 0);
+    }
+
+    return items;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Sorts the strings in ascending order. NULL entries, e.g. the empty slots of an 'array', are moved to the end.
+void stringsort_strings(string** strings, const size_t count) {
+    if (!strings || count < 2) return;
+
+    size_t item_count;
+    stringsort_item* items = stringsort_items_of_strings(strings, count, &item_count);
+
+    stringsort_multikey(items, item_count, 0);
+    for (size_t i = 0; i < item_count; i++) strings[i] = items[i].origin;
+
+    free(items);
+}
+
+// Sorts the views in ascending order.
+void stringsort_views(string_view* views, const size_t count) {
+    if (!views || count < 2) return;
+
+    stringsort_item* items = stringsort_items_of_views(views, count);
+
+    stringsort_multikey(items, count, 0);
+    for (size_t i = 0; i < count; i++) views[i] = string_view_from_data((const char*)items[i].data, items[i].length);
+
+    free(items);
+}
+
+// Same as 'stringsort_strings()', using the workers of 'pool' (NULL: the default pool).
+void stringsort_parallel_strings(string** strings, const size_t count, threadpool* pool) {
+    if (!strings || count < 2) return;
+
+    size_t item_count;
+    stringsort_item* items = stringsort_items_of_strings(strings, count, &item_count);
+    stringsort_item* output = stringsort_allocate(item_count, sizeof(stringsort_item));
+
+    stringsort_parallel(items, output, item_count, pool);
+    for (size_t i = 0; i < item_count; i++) strings[i] = output[i].origin;
+
+    free(output);
+    free(items);
+}
+
+// Same as 'stringsort_views()', using the workers of 'pool' (NULL: the default pool).
+void stringsort_parallel_views(string_view* views, const size_t count, threadpool* pool) {
+    if (!views || count < 2) return;
+
+    stringsort_item* items = stringsort_items_of_views(views, count);
+    stringsort_item* output = stringsort_allocate(count, sizeof(stringsort_item));
+
+    stringsort_parallel(items, output, count, pool);
+    for (size_t i = 0; i < count; i++) views[i] = string_view_from_data((const char*)output[i].data, output[i].length);
+
+    free(output);
+    free(items);
+}
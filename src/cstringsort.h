@@ -0,0 +1,59 @@
+#ifndef STRINGSORT_H
+#define STRINGSORT_H
+
+#include <stddef.h>
+
+#include "cstring.h"
+#include "cthreadpool.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+Sorting functions specialised for strings, ordering them like 'string_compare()' and 'string_view_compare()'.
+A comparison sort calls 'strcmp()' O(n log n) times, and every call reads the common prefix of the two strings again.
+These functions use a multikey quicksort instead:
+    - the strings are partitioned by the characters at the current depth, and only the group sharing those characters
+      goes on to the next depth, so every character is examined a small number of times
+    - the characters are taken 8 at a time and cached next to the string as one integer, so the partitioning compares
+      integers in a contiguous array instead of following pointers to the characters
+    - groups of fewer than 'CSTRINGSORT_INSERTION_THRESHOLD' strings are finished by an insertion sort
+    - like 'array_sort()', only the smaller groups are sorted recursively, and a group partitioned badly too often at
+      one depth is finished by a heapsort, so that the recursion depth is O(log n) and adversarial inputs stay O(n log n)
+The parallel variants split the strings into balanced ranges by sampling, then sort the ranges on the workers of a thread pool.
+Similar in nature to the string sorts of Bentley and Sedgewick, and of the 'parallel-string-sorting' library.
+
+The sorts are not stable. They use O(n) extra memory.
+*/
+
+// Below this many strings a group is sorted by insertion.
+#define CSTRINGSORT_INSERTION_THRESHOLD 16
+
+// Below this many strings the parallel variants sort on the calling thread.
+#define CSTRINGSORT_PARALLEL_THRESHOLD 16384
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Sorts the strings in ascending order. NULL entries, e.g. the empty slots of an 'array', are moved to the end.
+void stringsort_strings          (string** strings, const size_t count);
+
+// Sorts the views in ascending order.
+void stringsort_views            (string_view* views, const size_t count);
+
+// Same as 'stringsort_strings()', using the workers of 'pool' (NULL: the default pool).
+void stringsort_parallel_strings (string** strings, const size_t count, threadpool* pool);
+
+// Same as 'stringsort_views()', using the workers of 'pool' (NULL: the default pool).
+void stringsort_parallel_views   (string_view* views, const size_t count, threadpool* pool);
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CSTRINGSORT_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CSTRINGSORT_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // STRINGSORT_H
@@ -0,0 +1,364 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "cstringtable.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+#define CSTRINGTABLE_HEADER_BYTES 64
+
+// Strings are written to a stream in chunks of this many offsets.
+#define CSTRINGTABLE_WRITE_CHUNK 512
+
+struct _stringtable {
+    const unsigned char* base;      // the whole snapshot
+    size_t length;
+    const unsigned char* offsets;   // 'count + 1' little-endian offsets
+    const unsigned char* characters;
+    size_t characters_length;
+    size_t count;
+    bool mapped;                    // whether 'base' has to be unmapped
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void stringtable_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CSTRINGTABLE_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void stringtable_check_null(const stringtable* st) {
+    if (!st) stringtable_error_handling(CSTRINGTABLE_ERRMSSG_NULL_STRINGTABLE,
+                                        CSTRINGTABLE_ERRCODE_NULL_STRINGTABLE);
+}
+
+static void stringtable_check_index(const stringtable* st, const size_t index) {
+    if (st->count <= index) {
+        delete_stringtable((stringtable*)st);
+        stringtable_error_handling(CSTRINGTABLE_ERRMSSG_INDEX_OUT_OF_BOUNDS,
+                                   CSTRINGTABLE_ERRCODE_INDEX_OUT_OF_BOUNDS);
+    }
+}
+
+// General warning handling function.
+static void stringtable_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CSTRINGTABLE_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ========= Byte layout ========== */
+/* ================================ */
+
+// Writes a little-endian integer of 'bytes' bytes.
+static void stringtable_store(unsigned char* destination, uint64_t value, const size_t bytes) {
+    for (size_t i = 0; i < bytes; i++, value >>= 8) destination[i] = (unsigned char)value;
+}
+
+// Reads a little-endian 64-bit integer. On little-endian machines this is a single unaligned load.
+static inline uint64_t stringtable_load(const unsigned char* source) {
+    #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        uint64_t value;
+        memcpy(&value, source, sizeof(value));
+        return value;
+    #else
+        uint64_t value = 0;
+        for (size_t i = 8; i-- > 0;) value = (value << 8) | source[i];
+        return value;
+    #endif
+}
+
+static inline size_t stringtable_length_of(const string* str) {
+    return str ? string_get_length(str) : 0;
+}
+
+// Returns the size of the characters section: every string and its terminating '\0'. Sets 'overflow' if it does not fit a 'size_t'.
+static size_t stringtable_characters_length(string* const* strings, const size_t count, bool* overflow) {
+    size_t total = 0;
+    *overflow = false;
+
+    for (size_t i = 0; i < count; i++) {
+        size_t length = stringtable_length_of(strings[i]) + 1;
+        if (total > SIZE_MAX - length) *overflow = true;
+        total += length;
+    }
+
+    return total;
+}
+
+static void stringtable_write_header(unsigned char* header, const size_t count, const size_t characters_length) {
+    memset(header, 0, CSTRINGTABLE_HEADER_BYTES);
+    memcpy(header, "CSTT", 4);
+    stringtable_store(header + 4, CSTRINGTABLE_FORMAT_VERSION, 4);
+    stringtable_store(header + 8, count, 8);
+    stringtable_store(header + 16, CSTRINGTABLE_HEADER_BYTES, 8);
+    stringtable_store(header + 24, CSTRINGTABLE_HEADER_BYTES + (count + 1) * 8, 8);
+    stringtable_store(header + 32, characters_length, 8);
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of string table over a snapshot in memory, e.g. written by 'stringtable_serialize()'. The buffer is not copied
+// and has to outlive the table. Returns NULL if the buffer is not a snapshot.
+stringtable* new_stringtable_from_bytes(const void* buffer, const size_t length) {
+    const unsigned char* bytes = buffer;
+
+    if (!bytes || length < CSTRINGTABLE_HEADER_BYTES || memcmp(bytes, "CSTT", 4) ||
+        (stringtable_load(bytes + 4) & 0xFFFFFFFFu) != CSTRINGTABLE_FORMAT_VERSION) {
+        stringtable_warning_handling(CSTRINGTABLE_WARNMSG_INVALID_SNAPSHOT);
+        return NULL;
+    }
+
+    uint64_t count = stringtable_load(bytes + 8);
+    uint64_t offsets_at = stringtable_load(bytes + 16);
+    uint64_t characters_at = stringtable_load(bytes + 24);
+    uint64_t characters_length = stringtable_load(bytes + 32);
+
+    // Only the sections are checked here, the offsets are checked when used.
+    if (count >= length / 8 || offsets_at < CSTRINGTABLE_HEADER_BYTES || offsets_at > length ||
+        (count + 1) * 8 > length - offsets_at || characters_at < offsets_at + (count + 1) * 8 || characters_at > length ||
+        characters_length > length - characters_at) {
+        stringtable_warning_handling(CSTRINGTABLE_WARNMSG_INVALID_SNAPSHOT);
+        return NULL;
+    }
+
+    stringtable* st = malloc(sizeof(stringtable));
+
+    if (!st) stringtable_error_handling(CSTRINGTABLE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                        CSTRINGTABLE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    st->base = bytes;
+    st->length = length;
+    st->offsets = bytes + offsets_at;
+    st->characters = bytes + characters_at;
+    st->characters_length = (size_t)characters_length;
+    st->count = (size_t)count;
+    st->mapped = false;
+    return st;
+}
+
+// Constructor of string table mapping the snapshot file at 'path'. Returns NULL if the file cannot be mapped or is not a snapshot.
+stringtable* new_stringtable_from_file(const char* path) {
+    int file = path ? open(path, O_RDONLY) : -1;
+    struct stat info;
+
+    if (file < 0 || fstat(file, &info) != 0 || info.st_size <= 0) {
+        if (file >= 0) close(file);
+        stringtable_warning_handling(CSTRINGTABLE_WARNMSG_FILE_NOT_FOUND);
+        return NULL;
+    }
+
+    size_t length = (size_t)info.st_size;
+    void* mapping = mmap(NULL, length, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+
+    if (mapping == MAP_FAILED) {
+        stringtable_warning_handling(CSTRINGTABLE_WARNMSG_FILE_NOT_FOUND);
+        return NULL;
+    }
+
+    stringtable* st = new_stringtable_from_bytes(mapping, length);
+    if (!st) {
+        munmap(mapping, length);
+        return NULL;
+    }
+
+    st->mapped = true;
+    return st;
+}
+
+// Destructor of string table. Unmaps the file; the views returned by the table become invalid. Standardised template: void func_name(void* obj).
+void delete_stringtable(void* obj) {
+    stringtable* st = (stringtable*)obj;
+    if (!st) return;
+
+    if (st->mapped) munmap((void*)st->base, st->length);
+    free(st);
+
+    st = NULL;
+    obj = st;
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of strings.
+size_t stringtable_get_size(const stringtable* st) {
+    stringtable_check_null(st);
+    return st->count;
+}
+
+// Returns a view of the string at the specified index, pointing into the snapshot.
+string_view stringtable_get_view(const stringtable* st, const size_t index) {
+    stringtable_check_null(st);
+    stringtable_check_index(st, index);
+
+    uint64_t begin = stringtable_load(st->offsets + index * 8);
+    uint64_t end = stringtable_load(st->offsets + index * 8 + 8);
+
+    // 'end' includes the terminating '\0' of the string.
+    if (begin >= end || end > st->characters_length) {
+        stringtable_warning_handling(CSTRINGTABLE_WARNMSG_DAMAGED_SNAPSHOT);
+        return string_view_from_data("", 0);
+    }
+
+    return string_view_from_data((const char*)st->characters + begin, (size_t)(end - begin - 1));
+}
+
+// Returns a copy of the string at the specified index as a new 'string'.
+string* stringtable_get_string(const stringtable* st, const size_t index) {
+    return string_view_to_string(stringtable_get_view(st, index));
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks every offset of the snapshot. Opening only checks the header, so a damaged file is detected here, at a cost linear in its size.
+// The getters never read outside the snapshot either way.
+bool stringtable_verify(const stringtable* st) {
+    stringtable_check_null(st);
+
+    uint64_t previous = stringtable_load(st->offsets);
+    if (previous != 0) return false;
+
+    for (size_t i = 1; i <= st->count; i++) {
+        uint64_t offset = stringtable_load(st->offsets + i * 8);
+        if (offset <= previous || offset > st->characters_length || st->characters[offset - 1] != '\0') return false;
+        previous = offset;
+    }
+
+    return previous == st->characters_length;
+}
+
+/* ======================================= */
+/* ============ Serialisation ============ */
+/* ======================================= */
+
+// Returns the number of bytes of the snapshot of the strings.
+size_t stringtable_get_serialized_size(string* const* strings, const size_t count) {
+    bool overflow;
+    size_t characters = stringtable_characters_length(strings, count, &overflow);
+
+    if (overflow || count >= (SIZE_MAX - CSTRINGTABLE_HEADER_BYTES) / 8 - 1 ||
+        characters > SIZE_MAX - CSTRINGTABLE_HEADER_BYTES - (count + 1) * 8) {
+        stringtable_error_handling(CSTRINGTABLE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                   CSTRINGTABLE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    return CSTRINGTABLE_HEADER_BYTES + (count + 1) * 8 + characters;
+}
+
+// Writes the snapshot into 'buffer'. Returns the number of bytes written, or 0 if 'capacity' is too small.
+size_t stringtable_serialize(string* const* strings, const size_t count, void* buffer, const size_t capacity) {
+    size_t size = stringtable_get_serialized_size(strings, count);
+    if (!buffer || capacity < size) return 0;
+
+    unsigned char* bytes = buffer;
+    unsigned char* offsets = bytes + CSTRINGTABLE_HEADER_BYTES;
+    unsigned char* characters = offsets + (count + 1) * 8;
+    size_t offset = 0;
+
+    stringtable_write_header(bytes, count, size - CSTRINGTABLE_HEADER_BYTES - (count + 1) * 8);
+
+    for (size_t i = 0; i < count; i++) {
+        size_t length = stringtable_length_of(strings[i]);
+
+        stringtable_store(offsets + i * 8, offset, 8);
+        if (length) memcpy(characters + offset, string_get_data(strings[i]), length);
+        characters[offset + length] = '\0';
+        offset += length + 1;
+    }
+    stringtable_store(offsets + count * 8, offset, 8);
+
+    return size;
+}
+
+// Writes the snapshot into an open stream. Returns whether every byte could be written.
+bool stringtable_write(FILE* destination, string* const* strings, const size_t count) {
+    if (!destination) {
+        stringtable_warning_handling(CSTRINGTABLE_WARNMSG_FILE_NOT_FOUND);
+        return false;
+    }
+
+    size_t size = stringtable_get_serialized_size(strings, count);
+    unsigned char header[CSTRINGTABLE_HEADER_BYTES];
+    unsigned char chunk[CSTRINGTABLE_WRITE_CHUNK * 8];
+
+    stringtable_write_header(header, count, size - CSTRINGTABLE_HEADER_BYTES - (count + 1) * 8);
+    bool ok = fwrite(header, 1, sizeof(header), destination) == sizeof(header);
+
+    // The offsets are computed from the lengths, so the strings are visited twice instead of being buffered.
+    size_t offset = 0, filled = 0;
+    for (size_t i = 0; i <= count && ok; i++) {
+        stringtable_store(chunk + filled * 8, offset, 8);
+        if (i < count) offset += stringtable_length_of(strings[i]) + 1;
+
+        if (++filled == CSTRINGTABLE_WRITE_CHUNK || i == count) {
+            ok = fwrite(chunk, 8, filled, destination) == filled;
+            filled = 0;
+        }
+    }
+
+    for (size_t i = 0; i < count && ok; i++) {
+        size_t length = stringtable_length_of(strings[i]);
+        if (length) ok = fwrite(string_get_data(strings[i]), 1, length, destination) == length;
+        if (ok) ok = fputc('\0', destination) != EOF;
+    }
+
+    return ok;
+}
+
+// Writes the snapshot into the file at 'path', replacing it. Returns whether the file could be written.
+// The snapshot is written to 'path' followed by ".tmp", then renamed over 'path', so that tables still mapping the previous
+// file keep reading it, and the file at 'path' is always a whole snapshot.
+bool stringtable_save(const char* path, string* const* strings, const size_t count) {
+    if (!path) {
+        stringtable_warning_handling(CSTRINGTABLE_WARNMSG_FILE_NOT_FOUND);
+        return false;
+    }
+
+    size_t path_length = strlen(path);
+    char* temporary = malloc(path_length + sizeof(".tmp"));
+
+    if (!temporary) stringtable_error_handling(CSTRINGTABLE_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                               CSTRINGTABLE_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    memcpy(temporary, path, path_length);
+    memcpy(temporary + path_length, ".tmp", sizeof(".tmp"));
+
+    FILE* file = fopen(temporary, "wb");
+
+    if (!file) {
+        stringtable_warning_handling(CSTRINGTABLE_WARNMSG_FILE_NOT_FOUND);
+        free(temporary);
+        return false;
+    }
+
+    bool ok = stringtable_write(file, strings, count);
+    ok = fflush(file) == 0 && ok;
+    ok = ok && fsync(fileno(file)) == 0;
+    ok = fclose(file) == 0 && ok;
+    ok = ok && rename(temporary, path) == 0;
+
+    if (!ok) remove(temporary);
+    free(temporary);
+    return ok;
+}
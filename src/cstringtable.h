@@ -0,0 +1,117 @@
+#ifndef STRINGTABLE_H
+#define STRINGTABLE_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cstring.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'stringtable' type is a read-only sequence of strings backed by a snapshot file or buffer, used in place without parsing.
+Therefore, it has the following characteristics:
+    - a snapshot holds a header, a table of offsets and the characters of every string one after the other
+    - opening a snapshot maps the file into memory and checks the header only, so it takes the same time for any number of strings;
+      the pages are read by the system when they are first touched
+    - the strings are returned as views pointing into the snapshot, nothing is allocated or copied per string
+    - every string is followed by a '\0' in the snapshot, so the views can also be passed to functions expecting C strings
+Similar in nature to the string pools of compiled resource files and to the memory-mapped tables of search engines.
+
+Snapshot layout, every integer little-endian, so that the files can be moved between machines:
+    magic "CSTT" (4 bytes), version (4), string count (8), offset of the offsets table (8), offset of the characters (8),
+    length of the characters (8), reserved (24); then 'count + 1' offsets of 8 bytes into the characters; then the characters.
+*/
+
+// Type definition of 'stringtable' type.
+typedef struct _stringtable stringtable;
+
+// Alternative 'keyword' for type 'stringtable'.
+typedef stringtable StringTable;
+
+// Alternative 'keyword' for type 'stringtable'.
+typedef stringtable stringtable_t;
+
+// Current version of the snapshot format.
+#define CSTRINGTABLE_FORMAT_VERSION 1
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of string table mapping the snapshot file at 'path'. Returns NULL if the file cannot be mapped or is not a snapshot.
+stringtable* new_stringtable_from_file  (const char* path);
+
+// Constructor of string table over a snapshot in memory, e.g. written by 'stringtable_serialize()'. The buffer is not copied
+// and has to outlive the table. Returns NULL if the buffer is not a snapshot.
+stringtable* new_stringtable_from_bytes (const void* buffer, const size_t length);
+
+// Destructor of string table. Unmaps the file; the views returned by the table become invalid. Standardised template: void func_name(void* obj).
+void         delete_stringtable         (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of strings.
+size_t      stringtable_get_size   (const stringtable* st);
+
+// Returns a view of the string at the specified index, pointing into the snapshot.
+string_view stringtable_get_view   (const stringtable* st, const size_t index);
+
+// Returns a copy of the string at the specified index as a new 'string'.
+string*     stringtable_get_string (const stringtable* st, const size_t index);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks every offset of the snapshot. Opening only checks the header, so a damaged file is detected here, at a cost linear in its size.
+// The getters never read outside the snapshot either way.
+bool stringtable_verify (const stringtable* st);
+
+/* ======================================= */
+/* ============ Serialisation ============ */
+/* ======================================= */
+
+// The functions below write 'count' strings into a snapshot. NULL entries, e.g. the empty slots of an 'array', are written as empty strings.
+
+// Returns the number of bytes of the snapshot of the strings.
+size_t stringtable_get_serialized_size (string* const* strings, const size_t count);
+
+// Writes the snapshot into 'buffer'. Returns the number of bytes written, or 0 if 'capacity' is too small.
+size_t stringtable_serialize           (string* const* strings, const size_t count, void* buffer, const size_t capacity);
+
+// Writes the snapshot into an open stream. Returns whether every byte could be written.
+bool   stringtable_write               (FILE* destination, string* const* strings, const size_t count);
+
+// Writes the snapshot into the file at 'path', replacing it. Returns whether the file could be written.
+// The snapshot is written to 'path' followed by ".tmp", then renamed over 'path', so that tables still mapping the previous
+// file keep reading it, and the file at 'path' is always a whole snapshot.
+bool   stringtable_save                (const char* path, string* const* strings, const size_t count);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CSTRINGTABLE_WARNMSG_FILE_NOT_FOUND   "Warning: snapshot file could not be opened or mapped."
+#define CSTRINGTABLE_WARNMSG_INVALID_SNAPSHOT "Warning: data is not a string table snapshot of a supported version."
+#define CSTRINGTABLE_WARNMSG_DAMAGED_SNAPSHOT "Warning: string table snapshot is damaged. An empty view is returned."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CSTRINGTABLE_ERRMSSG_NULL_STRINGTABLE "Error: string table is a null pointer."
+#define CSTRINGTABLE_ERRCODE_NULL_STRINGTABLE -1
+
+#define CSTRINGTABLE_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CSTRINGTABLE_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CSTRINGTABLE_ERRMSSG_INDEX_OUT_OF_BOUNDS "Error: index out of bounds."
+#define CSTRINGTABLE_ERRCODE_INDEX_OUT_OF_BOUNDS -3
+
+#endif // STRINGTABLE_H
@@ -0,0 +1,296 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h> // sysconf()
+
+#include "cthreadpool.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+typedef struct _threadpool_task {
+    void (*task)(void*);
+    void* argument;
+    struct _threadpool_task* next;
+} threadpool_task;
+
+struct _threadpool {
+    pthread_t* threads;
+    size_t workers;
+
+    pthread_mutex_t lock;
+    pthread_cond_t  task_available; // signalled when a task is queued or the pool shuts down
+    pthread_cond_t  idle;           // signalled when the last pending task finishes
+
+    threadpool_task* head;
+    threadpool_task* tail;
+    size_t pending;                 // queued and running tasks
+    bool shutdown;
+};
+
+// Bookkeeping of one 'threadpool_run()' call, shared by the runners it submits.
+typedef struct {
+    void (*task)(void*, size_t);
+    void* argument;
+    size_t count;
+    atomic_size_t next;
+
+    pthread_mutex_t lock;
+    pthread_cond_t  done;
+    size_t runners;
+} threadpool_group;
+
+static threadpool*     default_pool = NULL;
+static size_t          default_workers = 0;
+static pthread_once_t  default_once = PTHREAD_ONCE_INIT;
+static bool            default_started = false;    // set once the shared pool has read 'default_workers'
+static pthread_mutex_t default_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void threadpool_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CTHREADPOOL_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void threadpool_check_null(const threadpool* pool) {
+    if (!pool) threadpool_error_handling(CTHREADPOOL_ERRMSSG_NULL_THREADPOOL,
+                                         CTHREADPOOL_ERRCODE_NULL_THREADPOOL);
+}
+
+// General warning handling function.
+static void threadpool_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CTHREADPOOL_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ========= Worker thread ======== */
+/* ================================ */
+
+static void* threadpool_worker(void* argument) {
+    threadpool* pool = (threadpool*)argument;
+
+    while (true) {
+        pthread_mutex_lock(&pool->lock);
+
+        while (!pool->head && !pool->shutdown) pthread_cond_wait(&pool->task_available, &pool->lock);
+
+        if (!pool->head) {
+            // Shutting down and nothing left to do.
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+
+        threadpool_task* task = pool->head;
+        pool->head = task->next;
+        if (!pool->head) pool->tail = NULL;
+        pthread_mutex_unlock(&pool->lock);
+
+        task->task(task->argument);
+        free(task);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) pthread_cond_broadcast(&pool->idle);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of thread pool. If 'workers' is 0, one worker is started per online processor.
+threadpool* new_threadpool(const size_t workers) {
+    size_t count = workers;
+
+    if (count == 0) {
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        count = processors > 0 ? (size_t)processors : 1;
+    }
+
+    threadpool* pool = calloc(1, sizeof(threadpool));
+
+    if (!pool) threadpool_error_handling(CTHREADPOOL_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                         CTHREADPOOL_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    pool->threads = calloc(count, sizeof(pthread_t));
+
+    if (!pool->threads) {
+        free(pool);
+        threadpool_error_handling(CTHREADPOOL_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                  CTHREADPOOL_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->task_available, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+
+    for (size_t i = 0; i < count; i++) {
+        if (pthread_create(&pool->threads[i], NULL, threadpool_worker, pool) != 0) {
+            pool->workers = i;
+            delete_threadpool(pool);
+            threadpool_error_handling(CTHREADPOOL_ERRMSSG_THREAD_CREATION_FAILURE,
+                                      CTHREADPOOL_ERRCODE_THREAD_CREATION_FAILURE);
+        }
+    }
+
+    pool->workers = count;
+    return pool;
+}
+
+// Destructor of thread pool. Finishes the queued tasks, then joins the workers. Standardised template: void func_name(void* obj).
+void delete_threadpool(void* obj) {
+    if (obj) {
+        threadpool* pool = (threadpool*)obj;
+
+        pthread_mutex_lock(&pool->lock);
+        pool->shutdown = true;
+        pthread_cond_broadcast(&pool->task_available);
+        pthread_mutex_unlock(&pool->lock);
+
+        for (size_t i = 0; i < pool->workers; i++) pthread_join(pool->threads[i], NULL);
+
+        pthread_mutex_destroy(&pool->lock);
+        pthread_cond_destroy(&pool->task_available);
+        pthread_cond_destroy(&pool->idle);
+        free(pool->threads);
+        free(pool);
+        pool = NULL;
+        obj = pool;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of worker threads.
+size_t threadpool_get_workers(const threadpool* pool) {
+    threadpool_check_null(pool);
+    return pool->workers;
+}
+
+static void threadpool_delete_default(void) {
+    delete_threadpool(default_pool);
+    default_pool = NULL;
+}
+
+static void threadpool_create_default(void) {
+    pthread_mutex_lock(&default_lock);
+    default_started = true;
+    size_t workers = default_workers;
+    pthread_mutex_unlock(&default_lock);
+
+    default_pool = new_threadpool(workers);
+    atexit(threadpool_delete_default);
+}
+
+// Returns the shared pool used whenever a parallel algorithm receives NULL instead of a pool. Created on first use.
+threadpool* threadpool_get_default(void) {
+    pthread_once(&default_once, threadpool_create_default);
+    return default_pool;
+}
+
+// Sets the number of workers of the shared pool (0: one per online processor). Only effective before its first use.
+// Safe to call from any thread: the shared pool is created either with this number or before it, in which case a warning is issued.
+void threadpool_set_default_workers(const size_t workers) {
+    pthread_mutex_lock(&default_lock);
+    bool started = default_started;
+    if (!started) default_workers = workers;
+    pthread_mutex_unlock(&default_lock);
+
+    if (started) threadpool_warning_handling(CTHREADPOOL_WARNMSG_DEFAULT_STARTED);
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Queues 'task(argument)' to be run by one of the workers. Returns immediately.
+void threadpool_submit(threadpool* pool, void (*task)(void*), void* argument) {
+    threadpool_check_null(pool);
+
+    threadpool_task* node = malloc(sizeof(threadpool_task));
+
+    if (!node) threadpool_error_handling(CTHREADPOOL_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                         CTHREADPOOL_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    node->task = task;
+    node->argument = argument;
+    node->next = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+
+    if (pool->tail) pool->tail->next = node;
+    else pool->head = node;
+
+    pool->tail = node;
+    pool->pending++;
+    pthread_cond_signal(&pool->task_available);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// Blocks until every task submitted so far has finished.
+void threadpool_wait(threadpool* pool) {
+    threadpool_check_null(pool);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0) pthread_cond_wait(&pool->idle, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// One runner per worker: indices are handed out dynamically, so uneven tasks still balance.
+static void threadpool_group_runner(void* argument) {
+    threadpool_group* group = (threadpool_group*)argument;
+    size_t index;
+
+    while ((index = atomic_fetch_add(&group->next, 1)) < group->count) {
+        group->task(group->argument, index);
+    }
+
+    pthread_mutex_lock(&group->lock);
+    if (--group->runners == 0) pthread_cond_signal(&group->done);
+    pthread_mutex_unlock(&group->lock);
+}
+
+// Runs 'task(argument, index)' for every 'index' in [0, count) and blocks until all of them have finished.
+// Unlike 'threadpool_wait()', it only waits for its own tasks, so several threads can share the pool.
+void threadpool_run(threadpool* pool, void (*task)(void*, size_t), void* argument, const size_t count) {
+    threadpool_check_null(pool);
+    if (count == 0) return;
+
+    // A single index is not worth the round trip to a worker.
+    if (count == 1) {
+        task(argument, 0);
+        return;
+    }
+
+    threadpool_group group;
+    group.task = task;
+    group.argument = argument;
+    group.count = count;
+    atomic_init(&group.next, 0);
+    group.runners = count < pool->workers ? count : pool->workers;
+    pthread_mutex_init(&group.lock, NULL);
+    pthread_cond_init(&group.done, NULL);
+
+    size_t runners = group.runners;
+    for (size_t i = 0; i < runners; i++) threadpool_submit(pool, threadpool_group_runner, &group);
+
+    pthread_mutex_lock(&group.lock);
+    while (group.runners > 0) pthread_cond_wait(&group.done, &group.lock);
+    pthread_mutex_unlock(&group.lock);
+
+    pthread_mutex_destroy(&group.lock);
+    pthread_cond_destroy(&group.done);
+}
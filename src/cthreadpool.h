@@ -0,0 +1,83 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'threadpool' type is a fixed set of POSIX worker threads consuming a shared queue of tasks.
+Creating threads is expensive, so one pool is meant to be reused by many calls, e.g. by the parallel algorithms of 'array'.
+Tasks must not wait for other tasks of the same pool: with every worker waiting, nobody would be left to run them.
+*/
+
+// Type definition of 'threadpool' type.
+typedef struct _threadpool threadpool;
+
+// Alternative 'keyword' for type 'threadpool'.
+typedef threadpool ThreadPool;
+
+// Alternative 'keyword' for type 'threadpool'.
+typedef threadpool threadpool_t;
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of thread pool. If 'workers' is 0, one worker is started per online processor.
+threadpool* new_threadpool    (const size_t workers);
+
+// Destructor of thread pool. Finishes the queued tasks, then joins the workers. Standardised template: void func_name(void* obj).
+void        delete_threadpool (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of worker threads.
+size_t      threadpool_get_workers (const threadpool* pool);
+
+// Returns the shared pool used whenever a parallel algorithm receives NULL instead of a pool. Created on first use.
+threadpool* threadpool_get_default (void);
+
+// Sets the number of workers of the shared pool (0: one per online processor). Only effective before its first use.
+// Safe to call from any thread: the shared pool is created either with this number or before it, in which case a warning is issued.
+void        threadpool_set_default_workers (const size_t workers);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Queues 'task(argument)' to be run by one of the workers. Returns immediately.
+void threadpool_submit (threadpool* pool, void (*task)(void*), void* argument);
+
+// Blocks until every task submitted so far has finished.
+void threadpool_wait   (threadpool* pool);
+
+// Runs 'task(argument, index)' for every 'index' in [0, count) and blocks until all of them have finished.
+// Unlike 'threadpool_wait()', it only waits for its own tasks, so several threads can share the pool.
+void threadpool_run    (threadpool* pool, void (*task)(void*, size_t), void* argument, const size_t count);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CTHREADPOOL_WARNMSG_DEFAULT_STARTED "Warning: the default thread pool is already running. No changes have been made."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CTHREADPOOL_ERRMSSG_NULL_THREADPOOL "Error: thread pool is a null pointer."
+#define CTHREADPOOL_ERRCODE_NULL_THREADPOOL -1
+
+#define CTHREADPOOL_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CTHREADPOOL_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CTHREADPOOL_ERRMSSG_THREAD_CREATION_FAILURE "Error: worker thread could not be created."
+#define CTHREADPOOL_ERRCODE_THREAD_CREATION_FAILURE -3
+
+#endif // THREADPOOL_H
@@ -0,0 +1,463 @@
+#ifndef TYPED_H
+#define TYPED_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+Type-specialised containers generated by macros. Unlike 'array' and 'vector', they know their element type at compile time:
+there are no 'void*' elements and no callbacks, every function is 'static inline' and every comparison is inlined,
+so loops over numeric elements compile to tight (and vectorisable) code.
+
+    DATASTRUCTS_DEFINE_ARRAY(int, int_array)      ->  int_array*  new_int_array(capacity), int_array_sort(arr), ...
+    DATASTRUCTS_DEFINE_VECTOR(double, dbl_vector) ->  dbl_vector* new_dbl_vector(capacity), dbl_vector_push_back(vec, x), ...
+
+The '_WITH' variants take the name of a function or function-like macro 'less(a, b)' that orders two elements (passed by value),
+for element types that cannot be compared with '<':
+
+    #define point_less(a, b) ((a).x < (b).x)
+    DATASTRUCTS_DEFINE_VECTOR_WITH(point, point_vector, point_less)
+
+Elements are copied by assignment; a container owning resources through its elements has to release them itself.
+Typed arrays have no empty slots: all of their 'capacity' elements exist and start zeroed.
+*/
+
+// Default ordering of the generated containers.
+#define DATASTRUCTS_DEFAULT_LESS(a, b) ((a) < (b))
+
+// Below this many elements the generated sorting functions fall back to insertion sort.
+#define CTYPED_INSERTION_SORT_THRESHOLD 16
+
+// Marks the rarely taken slow paths, so that the compiler keeps them out of the loops calling the fast paths.
+// They are 'static' but not 'inline', hence 'unused' for the containers that never call them.
+#if defined(__GNUC__) || defined(__clang__)
+    #define CTYPED_COLD __attribute__((noinline, cold, unused))
+#else
+    #define CTYPED_COLD
+#endif
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CTYPED_ERRMSSG_NULL_CONTAINER "Error: container is a null pointer."
+#define CTYPED_ERRCODE_NULL_CONTAINER -1
+
+#define CTYPED_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CTYPED_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CTYPED_ERRMSSG_INDEX_OUT_OF_BOUNDS "Error: index out of bounds."
+#define CTYPED_ERRCODE_INDEX_OUT_OF_BOUNDS -3
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function shared by every generated container.
+static inline void typed_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CTYPED_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static inline void* typed_allocate(const size_t count, const size_t element_size) {
+    if (element_size != 0 && count > SIZE_MAX / element_size) {
+        typed_error_handling(CTYPED_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                             CTYPED_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    void* data = calloc(count > 0 ? count : 1, element_size);
+
+    if (!data) typed_error_handling(CTYPED_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                    CTYPED_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    return data;
+}
+
+static inline void* typed_reallocate(void* data, const size_t count, const size_t element_size) {
+    if (element_size != 0 && count > SIZE_MAX / element_size) {
+        typed_error_handling(CTYPED_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                             CTYPED_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    void* reallocated = realloc(data, (count > 0 ? count : 1) * element_size);
+
+    if (!reallocated) typed_error_handling(CTYPED_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                           CTYPED_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    return reallocated;
+}
+
+/* ======================================= */
+/* ====== Algorithms on plain arrays ===== */
+/* ======================================= */
+
+// Emits 'name_sort_range()', 'name_lower_bound_range()' and 'name_upper_bound_range()' operating on 'type*' ranges.
+// They are shared by the array and the vector generators.
+#define DATASTRUCTS_DEFINE_ALGORITHMS(type, name, less)                                                   \
+static inline void name##_insertion_sort_range(type* data, const size_t count) {                          \
+    for (size_t i = 1; i < count; i++) {                                                                  \
+        type value = data[i];                                                                             \
+        size_t j = i;                                                                                     \
+        while (j > 0 && less(value, data[j - 1])) {                                                       \
+            data[j] = data[j - 1];                                                                        \
+            j--;                                                                                          \
+        }                                                                                                 \
+        data[j] = value;                                                                                  \
+    }                                                                                                     \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_heap_sort_range(type* data, const size_t count) {                               \
+    for (size_t start = count / 2; start-- > 0; ) {                                                       \
+        for (size_t root = start; 2 * root + 1 < count; ) {                                               \
+            size_t child = 2 * root + 1;                                                                  \
+            if (child + 1 < count && less(data[child], data[child + 1])) child++;                         \
+            if (!less(data[root], data[child])) break;                                                    \
+            type swap = data[root]; data[root] = data[child]; data[child] = swap;                         \
+            root = child;                                                                                 \
+        }                                                                                                 \
+    }                                                                                                     \
+    for (size_t end = count; end-- > 1; ) {                                                               \
+        type swap = data[0]; data[0] = data[end]; data[end] = swap;                                       \
+        for (size_t root = 0; 2 * root + 1 < end; ) {                                                     \
+            size_t child = 2 * root + 1;                                                                  \
+            if (child + 1 < end && less(data[child], data[child + 1])) child++;                           \
+            if (!less(data[root], data[child])) break;                                                    \
+            swap = data[root]; data[root] = data[child]; data[child] = swap;                              \
+            root = child;                                                                                 \
+        }                                                                                                 \
+    }                                                                                                     \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_introsort_range(type* data, size_t count, size_t depth) {                       \
+    while (count > CTYPED_INSERTION_SORT_THRESHOLD) {                                                     \
+        if (depth-- == 0) {                                                                               \
+            name##_heap_sort_range(data, count);                                                          \
+            return;                                                                                       \
+        }                                                                                                 \
+        size_t middle = count / 2;                                                                        \
+        type swap;                                                                                        \
+        if (less(data[middle], data[0])) { swap = data[middle]; data[middle] = data[0]; data[0] = swap; } \
+        if (less(data[count - 1], data[middle])) {                                                        \
+            swap = data[count - 1]; data[count - 1] = data[middle]; data[middle] = swap;                  \
+            if (less(data[middle], data[0])) { swap = data[middle]; data[middle] = data[0]; data[0] = swap; } \
+        }                                                                                                 \
+        swap = data[0]; data[0] = data[middle]; data[middle] = swap;                                      \
+        type pivot = data[0];                                                                             \
+        size_t i = 0, j = count;                                                                          \
+        while (true) {                                                                                    \
+            do { i++; } while (i < count && less(data[i], pivot));                                        \
+            do { j--; } while (less(pivot, data[j]));                                                     \
+            if (i >= j) break;                                                                            \
+            swap = data[i]; data[i] = data[j]; data[j] = swap;                                            \
+        }                                                                                                 \
+        data[0] = data[j];                                                                                \
+        data[j] = pivot;                                                                                  \
+        if (j < count - j - 1) {                                                                          \
+            name##_introsort_range(data, j, depth);                                                       \
+            data  += j + 1;                                                                               \
+            count -= j + 1;                                                                               \
+        } else {                                                                                          \
+            name##_introsort_range(data + j + 1, count - j - 1, depth);                                   \
+            count = j;                                                                                    \
+        }                                                                                                 \
+    }                                                                                                     \
+    name##_insertion_sort_range(data, count);                                                             \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_sort_range(type* data, const size_t count) {                                    \
+    size_t depth = 0;                                                                                     \
+    for (size_t n = count; n > 1; n >>= 1) depth += 2;                                                    \
+    name##_introsort_range(data, count, depth);                                                           \
+}                                                                                                         \
+                                                                                                          \
+static inline size_t name##_lower_bound_range(const type* data, size_t count, const type key) {           \
+    const type* base = data;                                                                              \
+    while (count > 1) {                                                                                   \
+        size_t half = count / 2;                                                                          \
+        base = less(base[half - 1], key) ? base + half : base;                                            \
+        count -= half;                                                                                    \
+    }                                                                                                     \
+    return (size_t)(base - data) + (count == 1 && less(*base, key));                                      \
+}                                                                                                         \
+                                                                                                          \
+static inline size_t name##_upper_bound_range(const type* data, size_t count, const type key) {           \
+    const type* base = data;                                                                              \
+    while (count > 1) {                                                                                   \
+        size_t half = count / 2;                                                                          \
+        base = !less(key, base[half - 1]) ? base + half : base;                                           \
+        count -= half;                                                                                    \
+    }                                                                                                     \
+    return (size_t)(base - data) + (count == 1 && !less(key, *base));                                     \
+}
+
+/* ======================================= */
+/* ============ Typed arrays ============= */
+/* ======================================= */
+
+#define DATASTRUCTS_DEFINE_ARRAY(type, name) DATASTRUCTS_DEFINE_ARRAY_WITH(type, name, DATASTRUCTS_DEFAULT_LESS)
+
+#define DATASTRUCTS_DEFINE_ARRAY_WITH(type, name, less)                                                   \
+typedef struct {                                                                                          \
+    type*  data;                                                                                          \
+    size_t capacity;                                                                                      \
+} name;                                                                                                   \
+                                                                                                          \
+DATASTRUCTS_DEFINE_ALGORITHMS(type, name, less)                                                           \
+                                                                                                          \
+/* Constructor: 'capacity' zeroed elements in one allocation. */                                          \
+static inline name* new_##name(const size_t capacity) {                                                   \
+    name* arr = typed_allocate(1, sizeof(name));                                                          \
+    arr->data = typed_allocate(capacity, sizeof(type));                                                   \
+    arr->capacity = capacity;                                                                             \
+    return arr;                                                                                           \
+}                                                                                                         \
+                                                                                                          \
+/* Destructor. Standardised template: void func_name(void* obj). */                                       \
+static inline void delete_##name(void* obj) {                                                             \
+    if (obj) {                                                                                            \
+        free(((name*)obj)->data);                                                                         \
+        free(obj);                                                                                        \
+    }                                                                                                     \
+}                                                                                                         \
+                                                                                                          \
+static inline size_t name##_get_capacity(const name* arr) {                                               \
+    if (!arr) typed_error_handling(CTYPED_ERRMSSG_NULL_CONTAINER, CTYPED_ERRCODE_NULL_CONTAINER);         \
+    return arr->capacity;                                                                                 \
+}                                                                                                         \
+                                                                                                          \
+/* Raw storage for loops that do their own bounds checking. */                                            \
+static inline type* name##_get_data(const name* arr) {                                                    \
+    if (!arr) typed_error_handling(CTYPED_ERRMSSG_NULL_CONTAINER, CTYPED_ERRCODE_NULL_CONTAINER);         \
+    return arr->data;                                                                                     \
+}                                                                                                         \
+                                                                                                          \
+static inline type name##_get_item_at(const name* arr, const size_t index) {                              \
+    if (index >= arr->capacity) typed_error_handling(CTYPED_ERRMSSG_INDEX_OUT_OF_BOUNDS,                  \
+                                                     CTYPED_ERRCODE_INDEX_OUT_OF_BOUNDS);                 \
+    return arr->data[index];                                                                              \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_set_item_at(name* arr, const size_t index, const type value) {                  \
+    if (index >= arr->capacity) typed_error_handling(CTYPED_ERRMSSG_INDEX_OUT_OF_BOUNDS,                  \
+                                                     CTYPED_ERRCODE_INDEX_OUT_OF_BOUNDS);                 \
+    arr->data[index] = value;                                                                             \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_fill(name* arr, const type value) {                                             \
+    for (size_t i = 0; i < arr->capacity; i++) arr->data[i] = value;                                      \
+}                                                                                                         \
+                                                                                                          \
+static inline name* name##_copy(const name* arr) {                                                        \
+    name* copy = new_##name(arr->capacity);                                                               \
+    if (arr->capacity > 0) memcpy(copy->data, arr->data, arr->capacity * sizeof(type));                   \
+    return copy;                                                                                          \
+}                                                                                                         \
+                                                                                                          \
+/* Equal if neither element orders before the other, position by position. */                             \
+static inline bool name##_areequal(const name* arr1, const name* arr2) {                                  \
+    if (arr1->capacity != arr2->capacity) return false;                                                   \
+    for (size_t i = 0; i < arr1->capacity; i++) {                                                         \
+        if (less(arr1->data[i], arr2->data[i]) || less(arr2->data[i], arr1->data[i])) return false;       \
+    }                                                                                                     \
+    return true;                                                                                          \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_sort(name* arr) {                                                               \
+    name##_sort_range(arr->data, arr->capacity);                                                          \
+}                                                                                                         \
+                                                                                                          \
+/* Index of the first element not ordered before 'key' in a sorted array. */                              \
+static inline size_t name##_lower_bound(const name* arr, const type key) {                                \
+    return name##_lower_bound_range(arr->data, arr->capacity, key);                                       \
+}                                                                                                         \
+                                                                                                          \
+/* Index of the first element ordered after 'key' in a sorted array. */                                   \
+static inline size_t name##_upper_bound(const name* arr, const type key) {                                \
+    return name##_upper_bound_range(arr->data, arr->capacity, key);                                       \
+}                                                                                                         \
+                                                                                                          \
+/* Pointer to an element equivalent to 'key' in a sorted array or NULL if there is none. */               \
+static inline type* name##_binary_search(const name* arr, const type key) {                               \
+    size_t index = name##_lower_bound(arr, key);                                                          \
+    return index < arr->capacity && !less(key, arr->data[index]) ? arr->data + index : NULL;              \
+}
+
+/* ======================================= */
+/* ============ Typed vectors ============ */
+/* ======================================= */
+
+#define DATASTRUCTS_DEFINE_VECTOR(type, name) DATASTRUCTS_DEFINE_VECTOR_WITH(type, name, DATASTRUCTS_DEFAULT_LESS)
+
+#define DATASTRUCTS_DEFINE_VECTOR_WITH(type, name, less)                                                  \
+typedef struct {                                                                                          \
+    type*  data;                                                                                          \
+    size_t size;                                                                                          \
+    size_t capacity;                                                                                      \
+} name;                                                                                                   \
+                                                                                                          \
+DATASTRUCTS_DEFINE_ALGORITHMS(type, name, less)                                                           \
+                                                                                                          \
+/* Constructor: room for 'capacity' elements, none of them stored yet. */                                 \
+static inline name* new_##name(const size_t capacity) {                                                   \
+    name* vec = typed_allocate(1, sizeof(name));                                                          \
+    vec->data = capacity > 0 ? typed_allocate(capacity, sizeof(type)) : NULL;                             \
+    vec->capacity = capacity;                                                                             \
+    return vec;                                                                                           \
+}                                                                                                         \
+                                                                                                          \
+/* Destructor. Standardised template: void func_name(void* obj). */                                       \
+static inline void delete_##name(void* obj) {                                                             \
+    if (obj) {                                                                                            \
+        free(((name*)obj)->data);                                                                         \
+        free(obj);                                                                                        \
+    }                                                                                                     \
+}                                                                                                         \
+                                                                                                          \
+static inline size_t name##_get_size(const name* vec) {                                                   \
+    if (!vec) typed_error_handling(CTYPED_ERRMSSG_NULL_CONTAINER, CTYPED_ERRCODE_NULL_CONTAINER);         \
+    return vec->size;                                                                                     \
+}                                                                                                         \
+                                                                                                          \
+static inline size_t name##_get_capacity(const name* vec) {                                               \
+    if (!vec) typed_error_handling(CTYPED_ERRMSSG_NULL_CONTAINER, CTYPED_ERRCODE_NULL_CONTAINER);         \
+    return vec->capacity;                                                                                 \
+}                                                                                                         \
+                                                                                                          \
+/* Raw storage for loops that do their own bounds checking. */                                            \
+static inline type* name##_get_data(const name* vec) {                                                    \
+    if (!vec) typed_error_handling(CTYPED_ERRMSSG_NULL_CONTAINER, CTYPED_ERRCODE_NULL_CONTAINER);         \
+    return vec->data;                                                                                     \
+}                                                                                                         \
+                                                                                                          \
+static inline bool name##_isempty(const name* vec) {                                                      \
+    return vec->size == 0;                                                                                \
+}                                                                                                         \
+                                                                                                          \
+static inline type name##_get_item_at(const name* vec, const size_t index) {                              \
+    if (index >= vec->size) typed_error_handling(CTYPED_ERRMSSG_INDEX_OUT_OF_BOUNDS,                      \
+                                                 CTYPED_ERRCODE_INDEX_OUT_OF_BOUNDS);                     \
+    return vec->data[index];                                                                              \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_set_item_at(name* vec, const size_t index, const type value) {                  \
+    if (index >= vec->size) typed_error_handling(CTYPED_ERRMSSG_INDEX_OUT_OF_BOUNDS,                      \
+                                                 CTYPED_ERRCODE_INDEX_OUT_OF_BOUNDS);                     \
+    vec->data[index] = value;                                                                             \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_reserve(name* vec, const size_t capacity) {                                     \
+    if (capacity <= vec->capacity) return;                                                                \
+    vec->data = typed_reallocate(vec->data, capacity, sizeof(type));                                      \
+    vec->capacity = capacity;                                                                             \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_shrink_to_fit(name* vec) {                                                      \
+    if (vec->size == vec->capacity) return;                                                               \
+    if (vec->size == 0) {                                                                                 \
+        free(vec->data);                                                                                  \
+        vec->data = NULL;                                                                                 \
+    } else {                                                                                              \
+        vec->data = typed_reallocate(vec->data, vec->size, sizeof(type));                                 \
+    }                                                                                                     \
+    vec->capacity = vec->size;                                                                            \
+}                                                                                                         \
+                                                                                                          \
+/* Slow path of the insertions, kept out of line of the hot loop. */                                      \
+static CTYPED_COLD void name##_grow(name* vec, const size_t additional) {                                 \
+    if (additional > SIZE_MAX - vec->size) {                                                              \
+        typed_error_handling(CTYPED_ERRMSSG_MEMORY_ALLOCATION_FAILURE,                                    \
+                             CTYPED_ERRCODE_MEMORY_ALLOCATION_FAILURE);                                   \
+    }                                                                                                     \
+    size_t capacity = vec->capacity < 4 ? 4 : vec->capacity * 2;                                          \
+    if (capacity < vec->size + additional) capacity = vec->size + additional;                             \
+    name##_reserve(vec, capacity);                                                                        \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_push_back(name* vec, const type value) {                                        \
+    if (vec->size == vec->capacity) name##_grow(vec, 1);                                                  \
+    vec->data[vec->size++] = value;                                                                       \
+}                                                                                                         \
+                                                                                                          \
+/* Appends a zeroed element and returns it, so that it can be constructed in place. */                    \
+static inline type* name##_emplace_back(name* vec) {                                                      \
+    if (vec->size == vec->capacity) name##_grow(vec, 1);                                                  \
+    type* slot = vec->data + vec->size++;                                                                 \
+    memset(slot, 0, sizeof(type));                                                                        \
+    return slot;                                                                                          \
+}                                                                                                         \
+                                                                                                          \
+/* Removes the last element and returns it. The vector must not be empty. */                              \
+static inline type name##_pop_back(name* vec) {                                                           \
+    if (vec->size == 0) typed_error_handling(CTYPED_ERRMSSG_INDEX_OUT_OF_BOUNDS,                          \
+                                             CTYPED_ERRCODE_INDEX_OUT_OF_BOUNDS);                         \
+    return vec->data[--vec->size];                                                                        \
+}                                                                                                         \
+                                                                                                          \
+/* 'values' may point into the vector itself, and is found again after the reallocation. */               \
+static inline void name##_append_range(name* vec, const type* values, const size_t count) {               \
+    if (count > vec->capacity - vec->size) {                                                              \
+        bool inside = vec->size && values >= vec->data && values < vec->data + vec->size;                 \
+        size_t offset = inside ? (size_t)(values - vec->data) : 0;                                        \
+        name##_grow(vec, count);                                                                          \
+        if (inside) values = vec->data + offset;                                                          \
+    }                                                                                                     \
+    if (count > 0) memcpy(vec->data + vec->size, values, count * sizeof(type));                           \
+    vec->size += count;                                                                                   \
+}                                                                                                         \
+                                                                                                          \
+/* Removes the element at 'index' in O(1) by moving the last element into its place, and returns it. */   \
+static inline type name##_swap_remove(name* vec, const size_t index) {                                    \
+    if (index >= vec->size) typed_error_handling(CTYPED_ERRMSSG_INDEX_OUT_OF_BOUNDS,                      \
+                                                 CTYPED_ERRCODE_INDEX_OUT_OF_BOUNDS);                     \
+    type removed = vec->data[index];                                                                      \
+    vec->data[index] = vec->data[--vec->size];                                                            \
+    return removed;                                                                                       \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_mut_clean(name* vec) {                                                          \
+    vec->size = 0;                                                                                        \
+}                                                                                                         \
+                                                                                                          \
+static inline name* name##_copy(const name* vec) {                                                        \
+    name* copy = new_##name(vec->size);                                                                   \
+    name##_append_range(copy, vec->data, vec->size);                                                      \
+    return copy;                                                                                          \
+}                                                                                                         \
+                                                                                                          \
+static inline bool name##_areequal(const name* vec1, const name* vec2) {                                  \
+    if (vec1->size != vec2->size) return false;                                                           \
+    for (size_t i = 0; i < vec1->size; i++) {                                                             \
+        if (less(vec1->data[i], vec2->data[i]) || less(vec2->data[i], vec1->data[i])) return false;       \
+    }                                                                                                     \
+    return true;                                                                                          \
+}                                                                                                         \
+                                                                                                          \
+static inline void name##_sort(name* vec) {                                                               \
+    name##_sort_range(vec->data, vec->size);                                                              \
+}                                                                                                         \
+                                                                                                          \
+static inline size_t name##_lower_bound(const name* vec, const type key) {                                \
+    return name##_lower_bound_range(vec->data, vec->size, key);                                           \
+}                                                                                                         \
+                                                                                                          \
+static inline size_t name##_upper_bound(const name* vec, const type key) {                                \
+    return name##_upper_bound_range(vec->data, vec->size, key);                                           \
+}                                                                                                         \
+                                                                                                          \
+static inline type* name##_binary_search(const name* vec, const type key) {                               \
+    size_t index = name##_lower_bound(vec, key);                                                          \
+    return index < vec->size && !less(key, vec->data[index]) ? vec->data + index : NULL;                  \
+}
+
+#endif // TYPED_H
@@ -0,0 +1,436 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cvector.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+struct _vector {
+    unsigned char* data;
+
+    size_t capacity;
+    size_t size;
+    size_t element_size;
+    double growth_factor;
+    void (*destructor)(void*);
+    bool (*equality)(const void*, const void*);
+    void (*copy)(void*, const void*);
+};
+
+// Capacity of the first allocation of a vector created with capacity 0.
+#define CVECTOR_MINIMUM_CAPACITY 4
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void vector_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CVECTOR_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void vector_check_null(const vector* vec) {
+    if (!vec) vector_error_handling(CVECTOR_ERRMSSG_NULL_VECTOR,
+                                    CVECTOR_ERRCODE_NULL_VECTOR);
+}
+
+static void vector_check_index(const vector* vec, const size_t index) {
+    if (vec->size <= index) {
+        delete_vector((vector*)vec);
+        vector_error_handling(CVECTOR_ERRMSSG_INDEX_OUT_OF_BOUNDS,
+                              CVECTOR_ERRCODE_INDEX_OUT_OF_BOUNDS);
+    }
+}
+
+// General warning handling function.
+static void vector_warning_handling(const char* warn_msg) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CVECTOR_NO_WARNINGS))
+        fprintf(stderr, "%s\n", warn_msg);
+    #endif
+}
+
+/* ================================ */
+/* ======= Storage management ===== */
+/* ================================ */
+
+// Returns the address of the slot at 'index'.
+static inline unsigned char* vector_slot(const vector* vec, const size_t index) {
+    return vec->data + index * vec->element_size;
+}
+
+// Reallocates the storage to exactly 'capacity' elements.
+static void vector_reallocate(vector* vec, const size_t capacity) {
+    if (capacity > SIZE_MAX / vec->element_size) {
+        vector_error_handling(CVECTOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                              CVECTOR_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    if (capacity == 0) {
+        free(vec->data);
+        vec->data = NULL;
+        vec->capacity = 0;
+        return;
+    }
+
+    unsigned char* data = realloc(vec->data, capacity * vec->element_size);
+
+    if (!data) vector_error_handling(CVECTOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                     CVECTOR_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    vec->data = data;
+    vec->capacity = capacity;
+}
+
+// Makes room for 'additional' more elements, growing the capacity geometrically.
+static void vector_grow(vector* vec, const size_t additional) {
+    if (additional > SIZE_MAX - vec->size) {
+        vector_error_handling(CVECTOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                              CVECTOR_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    size_t required = vec->size + additional;
+    if (required <= vec->capacity) return;
+
+    double grown = (double)vec->capacity * vec->growth_factor;
+    size_t capacity = grown >= (double)SIZE_MAX ? SIZE_MAX : (size_t)grown;
+
+    if (capacity <= vec->capacity) capacity = vec->capacity + 1;
+    if (capacity < CVECTOR_MINIMUM_CAPACITY) capacity = CVECTOR_MINIMUM_CAPACITY;
+    if (capacity < required) capacity = required;
+
+    vector_reallocate(vec, capacity);
+}
+
+// Returns the offset of 'obj' in the storage, or SIZE_MAX if it does not point to an element of the vector.
+// Elements passed by address may live in the vector itself, and must be found again after a reallocation.
+static size_t vector_offset_of(const vector* vec, const void* obj) {
+    const unsigned char* address = obj;
+    bool inside = vec->size && address >= vec->data && address < vector_slot(vec, vec->size);
+    return inside ? (size_t)(address - vec->data) : SIZE_MAX;
+}
+
+// Calls the destructor on the slot, if there is one.
+static inline void vector_destroy_slot(const vector* vec, const size_t index) {
+    if (vec->destructor) vec->destructor(vector_slot(vec, index));
+}
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of vector. 'capacity' is the number of elements to allocate in advance and can be 0.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+vector* new_vector(const size_t capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*)) {
+    if (element_size == 0) {
+        vector_warning_handling(CVECTOR_WARNMSG_EMPTY_ELEMENT_SIZE);
+        return NULL;
+    }
+
+    vector* vec = calloc(1, sizeof(vector));
+
+    if (!vec) vector_error_handling(CVECTOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                    CVECTOR_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    vec->element_size = element_size;
+    vec->growth_factor = CVECTOR_DEFAULT_GROWTH_FACTOR;
+    vec->destructor = destructor;
+    vec->equality = equality;
+    vec->copy = copy;
+
+    if (capacity > 0) vector_reallocate(vec, capacity);
+
+    return vec;
+}
+
+// Destructor of vector. Standardised template: void func_name(void* obj).
+void delete_vector(void* obj) {
+    if (obj) {
+        vector* vec = (vector*)obj;
+
+        if (vec->destructor) {
+            for (size_t i = 0; i < vec->size; i++) vec->destructor(vector_slot(vec, i));
+        }
+
+        free(vec->data);
+        free(vec);
+        vec = NULL;
+        obj = vec;
+    }
+}
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of elements that fit in the current storage.
+size_t vector_get_capacity(const vector* vec) {
+    vector_check_null(vec);
+    return vec->capacity;
+}
+
+// Getter of the number of stored elements.
+size_t vector_get_size(const vector* vec) {
+    vector_check_null(vec);
+    return vec->size;
+}
+
+// Getter of the size of one element in bytes.
+size_t vector_get_element_size(const vector* vec) {
+    vector_check_null(vec);
+    return vec->element_size;
+}
+
+// Getter of the factor by which the capacity is multiplied when the vector runs out of space.
+double vector_get_growth_factor(const vector* vec) {
+    vector_check_null(vec);
+    return vec->growth_factor;
+}
+
+// Returns a pointer to the element at the specified index.
+void* vector_get_item_at(const vector* vec, const size_t index) {
+    vector_check_null(vec);
+    vector_check_index(vec, index);
+    return vector_slot(vec, index);
+}
+
+// Returns a pointer to the first element of the contiguous storage. NULL if nothing has been allocated yet.
+void* vector_get_data(const vector* vec) {
+    vector_check_null(vec);
+    return vec->data;
+}
+
+// Returns a pointer to the last element or NULL if the vector is empty.
+void* vector_get_back(const vector* vec) {
+    vector_check_null(vec);
+    return vec->size > 0 ? vector_slot(vec, vec->size - 1) : NULL;
+}
+
+// Sets the growth factor. It has to be greater than 1.
+void vector_set_growth_factor(vector* vec, const double growth_factor) {
+    vector_check_null(vec);
+
+    if (!(growth_factor > 1.0)) {
+        vector_warning_handling(CVECTOR_WARNMSG_INVALID_GROWTH);
+        return;
+    }
+
+    vec->growth_factor = growth_factor;
+}
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the vector is empty.
+bool vector_isempty(const vector* vec) {
+    vector_check_null(vec);
+    return vec->size == 0;
+}
+
+// Checks whether the contents of the two vectors are identical. The order of elements matters.
+bool vector_areequal(const vector* vec1, const vector* vec2) {
+    vector_check_null(vec1);
+    vector_check_null(vec2);
+
+    if (vec1->element_size != vec2->element_size ||
+        vec1->destructor != vec2->destructor ||
+        vec1->equality != vec2->equality ||
+        vec1->size != vec2->size) return false;
+
+    if (vec1->size == 0) return true;
+
+    if (!vec1->equality) return memcmp(vec1->data, vec2->data, vec1->size * vec1->element_size) == 0;
+
+    for (size_t i = 0; i < vec1->size; i++) {
+        if (!vec1->equality(vector_slot(vec1, i), vector_slot(vec2, i))) return false;
+    }
+
+    return true;
+}
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' to the end of the vector (bitwise, the vector takes ownership).
+void vector_push_back(vector* vec, const void* obj) {
+    vector_check_null(vec);
+
+    if (vec->size == vec->capacity) {
+        size_t offset = vector_offset_of(vec, obj);
+        vector_grow(vec, 1);
+        if (offset != SIZE_MAX) obj = vec->data + offset;
+    }
+
+    memcpy(vector_slot(vec, vec->size), obj, vec->element_size);
+    vec->size++;
+}
+
+// Appends a zeroed slot to the end of the vector and returns it, so that the element can be constructed in place.
+void* vector_emplace_back(vector* vec) {
+    vector_check_null(vec);
+    if (vec->size == vec->capacity) vector_grow(vec, 1);
+
+    unsigned char* slot = vector_slot(vec, vec->size);
+    memset(slot, 0, vec->element_size);
+    vec->size++;
+
+    return slot;
+}
+
+// Moves the last element into 'destination' and removes it. Returns 'destination' or NULL if the vector was empty.
+// If 'destination' is NULL, the element is deleted instead.
+void* vector_pop_back(vector* vec, void* destination) {
+    vector_check_null(vec);
+    if (vec->size == 0) return NULL;
+
+    if (destination) memcpy(destination, vector_slot(vec, vec->size - 1), vec->element_size);
+    else vector_destroy_slot(vec, vec->size - 1);
+    vec->size--;
+
+    return destination;
+}
+
+// Moves 'count' contiguous elements starting at 'elements' to the end of the vector with at most one reallocation.
+void vector_append_range(vector* vec, const void* elements, const size_t count) {
+    vector_check_null(vec);
+    if (count == 0) return;
+
+    size_t offset = vector_offset_of(vec, elements);
+    vector_grow(vec, count);
+    if (offset != SIZE_MAX) elements = vec->data + offset;
+
+    memcpy(vector_slot(vec, vec->size), elements, count * vec->element_size);
+    vec->size += count;
+}
+
+// Moves the element pointed to by 'obj' to 'index', shifting the following elements one slot to the right.
+void vector_insert_item_to(vector* vec, const size_t index, const void* obj) {
+    vector_check_null(vec);
+
+    // Inserting right after the last element is allowed.
+    if (index != vec->size) vector_check_index(vec, index);
+
+    size_t offset = vector_offset_of(vec, obj);
+    if (vec->size == vec->capacity) vector_grow(vec, 1);
+
+    // An element at or after 'index' moves one slot to the right with the others.
+    if (offset != SIZE_MAX) obj = vec->data + offset + (offset >= index * vec->element_size ? vec->element_size : 0);
+
+    memmove(vector_slot(vec, index + 1), vector_slot(vec, index), (vec->size - index) * vec->element_size);
+    memcpy(vector_slot(vec, index), obj, vec->element_size);
+    vec->size++;
+}
+
+// Moves the element at 'index' into 'destination' and closes the gap, keeping the order of the elements.
+// If 'destination' is NULL, the element is deleted instead.
+void vector_remove_item_at(vector* vec, const size_t index, void* destination) {
+    vector_check_null(vec);
+    vector_check_index(vec, index);
+
+    if (destination) memcpy(destination, vector_slot(vec, index), vec->element_size);
+    else vector_destroy_slot(vec, index);
+
+    memmove(vector_slot(vec, index), vector_slot(vec, index + 1), (vec->size - index - 1) * vec->element_size);
+    vec->size--;
+}
+
+// Moves the element at 'index' into 'destination' and fills the gap with the last element in O(1). The order is not kept.
+// If 'destination' is NULL, the element is deleted instead.
+void vector_swap_remove(vector* vec, const size_t index, void* destination) {
+    vector_check_null(vec);
+    vector_check_index(vec, index);
+
+    if (destination) memcpy(destination, vector_slot(vec, index), vec->element_size);
+    else vector_destroy_slot(vec, index);
+
+    vec->size--;
+    if (index != vec->size) memcpy(vector_slot(vec, index), vector_slot(vec, vec->size), vec->element_size);
+}
+
+// Creates a copy of the object at the specified 'index' in 'destination'. Returns 'destination'.
+void* vector_copy_item_from(const vector* vec, const size_t index, void* destination) {
+    vector_check_null(vec);
+    vector_check_index(vec, index);
+
+    if (vec->copy) vec->copy(destination, vector_slot(vec, index));
+    else memcpy(destination, vector_slot(vec, index), vec->element_size);
+
+    return destination;
+}
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Makes sure that at least 'capacity' elements fit without reallocation.
+void vector_reserve(vector* vec, const size_t capacity) {
+    vector_check_null(vec);
+    if (capacity > vec->capacity) vector_reallocate(vec, capacity);
+}
+
+// Releases the unused part of the storage.
+void vector_shrink_to_fit(vector* vec) {
+    vector_check_null(vec);
+    if (vec->size < vec->capacity) vector_reallocate(vec, vec->size);
+}
+
+/* ====================================================== */
+/* =========== Immutative vector manipulations ========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'vec'.
+vector* vector_copy(const vector* vec) {
+    vector_check_null(vec);
+
+    vector* copy = new_vector(vec->size, vec->element_size, vec->destructor, vec->equality, vec->copy);
+    copy->growth_factor = vec->growth_factor;
+
+    if (vec->copy) {
+        for (size_t i = 0; i < vec->size; i++) vec->copy(vector_slot(copy, i), vector_slot(vec, i));
+    } else if (vec->size > 0) {
+        memcpy(copy->data, vec->data, vec->size * vec->element_size);
+    }
+
+    copy->size = vec->size;
+    return copy;
+}
+
+/* ====================================================== */
+/* ============ Mutative vector manipulations =========== */
+/* ====================================================== */
+
+// Erases all the elements of the vector, resulting in an empty one. The capacity is kept.
+void vector_mut_clean(vector* vec) {
+    vector_check_null(vec);
+
+    if (vec->destructor) {
+        for (size_t i = 0; i < vec->size; i++) vec->destructor(vector_slot(vec, i));
+    }
+
+    vec->size = 0;
+}
+
+// Swaps the contents of two vectors in O(1).
+void vector_mut_swap(vector* vec1, vector* vec2) {
+    vector_check_null(vec1);
+    vector_check_null(vec2);
+
+    if (vec1->element_size != vec2->element_size || vec1->destructor != vec2->destructor ||
+        vec1->equality != vec2->equality || vec1->copy != vec2->copy) {
+        vector_warning_handling(CVECTOR_WARNMSG_SWAP_INCOMPATIBLE);
+        return;
+    }
+
+    vector buffer = *vec1;
+    *vec1 = *vec2;
+    *vec2 = buffer;
+}
@@ -0,0 +1,163 @@
+#ifndef VECTOR_H
+#define VECTOR_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'vector' type is a resizeable 'array': the elements are stored by value in one contiguous block, which grows as needed.
+Therefore, it has the following characteristics:
+    - resizeable, appending to the end takes amortised O(1) time
+    - no empty slots: the elements always occupy the indices [0, size)
+    - stores elements of one type, which are ensured by the element size and the destructor, equality and copy functions
+Similar in nature to std::vector in C++.
+
+The callback functions follow the conventions of 'array': they receive pointers to the element slots.
+Growing the storage may move the elements, so pointers into the vector are only valid until the next insertion.
+*/
+
+// Type definition of 'vector' type.
+typedef struct _vector vector;
+
+// Alternative 'keyword' for type 'vector'.
+typedef vector Vector;
+
+// Alternative 'keyword' for type 'vector'.
+typedef vector vector_t;
+
+// Growth factor used by new vectors.
+#define CVECTOR_DEFAULT_GROWTH_FACTOR 2.0
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of vector. 'capacity' is the number of elements to allocate in advance and can be 0.
+// 'destructor', 'equality' and 'copy' can be NULL for trivially copyable elements.
+vector* new_vector    (const size_t capacity, const size_t element_size, void (*destructor)(void*), bool (*equality)(const void*, const void*), void (*copy)(void*, const void*));
+
+// Destructor of vector. Standardised template: void func_name(void* obj).
+void    delete_vector (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the number of elements that fit in the current storage.
+size_t vector_get_capacity      (const vector* vec);
+
+// Getter of the number of stored elements.
+size_t vector_get_size          (const vector* vec);
+
+// Getter of the size of one element in bytes.
+size_t vector_get_element_size  (const vector* vec);
+
+// Getter of the factor by which the capacity is multiplied when the vector runs out of space.
+double vector_get_growth_factor (const vector* vec);
+
+// Returns a pointer to the element at the specified index.
+void*  vector_get_item_at       (const vector* vec, const size_t index);
+
+// Returns a pointer to the first element of the contiguous storage. NULL if nothing has been allocated yet.
+void*  vector_get_data          (const vector* vec);
+
+// Returns a pointer to the last element or NULL if the vector is empty.
+void*  vector_get_back          (const vector* vec);
+
+// Sets the growth factor. It has to be greater than 1.
+void   vector_set_growth_factor (vector* vec, const double growth_factor);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the vector is empty.
+bool vector_isempty  (const vector* vec);
+
+// Checks whether the contents of the two vectors are identical. The order of elements matters.
+bool vector_areequal (const vector* vec1, const vector* vec2);
+
+/* ======================================= */
+/* =========== General methods =========== */
+/* ======================================= */
+
+// Moves the element pointed to by 'obj' to the end of the vector (bitwise, the vector takes ownership).
+void  vector_push_back      (vector* vec, const void* obj);
+
+// Appends a zeroed slot to the end of the vector and returns it, so that the element can be constructed in place.
+void* vector_emplace_back   (vector* vec);
+
+// Moves the last element into 'destination' and removes it. Returns 'destination' or NULL if the vector was empty.
+// If 'destination' is NULL, the element is deleted instead.
+void* vector_pop_back       (vector* vec, void* destination);
+
+// Moves 'count' contiguous elements starting at 'elements' to the end of the vector with at most one reallocation.
+void  vector_append_range   (vector* vec, const void* elements, const size_t count);
+
+// Moves the element pointed to by 'obj' to 'index', shifting the following elements one slot to the right.
+void  vector_insert_item_to (vector* vec, const size_t index, const void* obj);
+
+// Moves the element at 'index' into 'destination' and closes the gap, keeping the order of the elements.
+// If 'destination' is NULL, the element is deleted instead.
+void  vector_remove_item_at (vector* vec, const size_t index, void* destination);
+
+// Moves the element at 'index' into 'destination' and fills the gap with the last element in O(1). The order is not kept.
+// If 'destination' is NULL, the element is deleted instead.
+void  vector_swap_remove    (vector* vec, const size_t index, void* destination);
+
+// Creates a copy of the object at the specified 'index' in 'destination'. Returns 'destination'.
+void* vector_copy_item_from (const vector* vec, const size_t index, void* destination);
+
+/* ======================================= */
+/* ========== Capacity management ======== */
+/* ======================================= */
+
+// Makes sure that at least 'capacity' elements fit without reallocation.
+void vector_reserve       (vector* vec, const size_t capacity);
+
+// Releases the unused part of the storage.
+void vector_shrink_to_fit (vector* vec);
+
+/* ====================================================== */
+/* =========== Immutative vector manipulations ========== */
+/* ====================================================== */
+
+// Copies the entire contents of 'vec'.
+vector* vector_copy (const vector* vec);
+
+/* ====================================================== */
+/* ============ Mutative vector manipulations =========== */
+/* ====================================================== */
+
+// Erases all the elements of the vector, resulting in an empty one. The capacity is kept.
+void vector_mut_clean (vector* vec);
+
+// Swaps the contents of two vectors in O(1).
+void vector_mut_swap  (vector* vec1, vector* vec2);
+
+/* ====================================== */
+/* ========== Warning messages ========== */
+/* ====================================== */
+
+#define CVECTOR_WARNMSG_EMPTY_ELEMENT_SIZE   "Warning: element size cannot be 0."
+#define CVECTOR_WARNMSG_INVALID_GROWTH       "Warning: growth factor has to be greater than 1. No changes have been made."
+#define CVECTOR_WARNMSG_SWAP_INCOMPATIBLE    "Warning: vectors of different element size or callbacks cannot be swapped. No changes have been made."
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CVECTOR_ERRMSSG_NULL_VECTOR "Error: vector is a null pointer."
+#define CVECTOR_ERRCODE_NULL_VECTOR -1
+
+#define CVECTOR_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CVECTOR_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#define CVECTOR_ERRMSSG_INDEX_OUT_OF_BOUNDS "Error: index out of bounds."
+#define CVECTOR_ERRCODE_INDEX_OUT_OF_BOUNDS -3
+
+#endif // VECTOR_H
@@ -0,0 +1,468 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "cwildcard.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+typedef enum {
+    WILDCARD_ATOM_BYTE,     // one given character
+    WILDCARD_ATOM_ANY,      // '?'
+    WILDCARD_ATOM_CLASS     // '[...]'
+} wildcard_atom_kind;
+
+typedef struct {
+    unsigned char kind;
+    uint32_t set;       // index of the set of characters of a class
+} wildcard_atom;
+
+// Part of the pattern between two stars, as a range of atoms.
+typedef struct {
+    size_t first;
+    size_t length;
+    bool literal;       // only 'WILDCARD_ATOM_BYTE' atoms, i.e. the characters can be compared with 'memcmp()'
+} wildcard_segment;
+
+typedef bool (*wildcard_matcher)(const wildcard* wc, const unsigned char* data, const size_t length);
+
+struct _wildcard {
+    char* pattern;
+    size_t pattern_length;
+    wildcard_kind kind;
+    wildcard_matcher matcher;
+    wildcard_atom* atoms;
+    unsigned char* bytes;           // the character of every atom, so that the literal segments are contiguous
+    size_t* borders;                // for every atom of a literal segment, the longest proper border of the segment up to it
+    size_t atom_count;
+    uint8_t (*sets)[32];            // bitsets of 256 characters
+    size_t set_count;
+    wildcard_segment* segments;
+    size_t segment_count;
+    bool has_star;
+    bool leading_star;
+    bool trailing_star;
+};
+
+/* ================================ */
+/* === Error handling functions === */
+/* ================================ */
+
+// General error handling function.
+static void wildcard_error_handling(const char* error_msg, const int error_code) {
+    #if !(defined(DATASTRUCTS_NO_WARNINGS) || defined(DATASTRUCTS_CWILDCARD_NO_WARNINGS))
+        fprintf(stderr, "Error: %d\n%s\n", error_code, error_msg);
+    #endif
+
+    exit(error_code);
+}
+
+static void wildcard_check_null(const wildcard* wc) {
+    if (!wc) wildcard_error_handling(CWILDCARD_ERRMSSG_NULL_WILDCARD,
+                                     CWILDCARD_ERRCODE_NULL_WILDCARD);
+}
+
+/* ================================ */
+/* =========== Matching =========== */
+/* ================================ */
+
+static inline bool wildcard_equal(const unsigned char* a, const unsigned char* b, const size_t length) {
+    return !length || memcmp(a, b, length) == 0;
+}
+
+// Returns the first occurrence of the literal segment in 'haystack', or NULL. Knuth-Morris-Pratt: after a mismatch, the search
+// resumes from the longest border of the part matched so far instead of the next position, so that no character is read twice.
+// 'memchr()' skips to the candidates whenever nothing is matched.
+static const unsigned char* wildcard_find_literal(const wildcard* wc, const wildcard_segment* segment,
+                                                  const unsigned char* haystack, const size_t haystack_length) {
+    const unsigned char* needle = wc->bytes + segment->first;
+    const size_t* borders = wc->borders + segment->first;
+    const size_t needle_length = segment->length;
+    size_t matched = 0;
+
+    for (size_t i = 0; i < haystack_length; i++) {
+        if (matched == 0) {
+            if (haystack_length - i < needle_length) return NULL;
+            const unsigned char* next = memchr(haystack + i, needle[0], haystack_length - i - needle_length + 1);
+            if (!next) return NULL;
+            i = (size_t)(next - haystack);
+        }
+
+        while (matched > 0 && haystack[i] != needle[matched]) matched = borders[matched - 1];
+        if (haystack[i] == needle[matched]) matched++;
+        if (matched == needle_length) return haystack + i + 1 - needle_length;
+    }
+    return NULL;
+}
+
+static inline bool wildcard_atom_match(const wildcard* wc, const size_t atom, const unsigned char character) {
+    switch (wc->atoms[atom].kind) {
+        case WILDCARD_ATOM_BYTE: return wc->bytes[atom] == character;
+        case WILDCARD_ATOM_ANY:  return true;
+        default:             return (wc->sets[wc->atoms[atom].set][character >> 3] >> (character & 7)) & 1;
+    }
+}
+
+// Checks whether the segment matches the characters at 'data', which has at least the length of the segment.
+static bool wildcard_segment_match_at(const wildcard* wc, const wildcard_segment* segment, const unsigned char* data) {
+    if (segment->literal) return wildcard_equal(data, wc->bytes + segment->first, segment->length);
+    for (size_t i = 0; i < segment->length; i++) {
+        if (!wildcard_atom_match(wc, segment->first + i, data[i])) return false;
+    }
+    return true;
+}
+
+// Returns the position of the leftmost match of the segment in 'data[from, limit)', or SIZE_MAX.
+static size_t wildcard_segment_find(const wildcard* wc, const wildcard_segment* segment, const unsigned char* data, const size_t from, const size_t limit) {
+    if (limit - from < segment->length) return SIZE_MAX;
+
+    if (segment->literal) {
+        const unsigned char* found = wildcard_find_literal(wc, segment, data + from, limit - from);
+        return found ? (size_t)(found - data) : SIZE_MAX;
+    }
+
+    size_t last = limit - segment->length;
+    bool first_is_byte = wc->atoms[segment->first].kind == WILDCARD_ATOM_BYTE;
+    for (size_t position = from; position <= last; position++) {
+        // Skip to the candidates starting with the first character of the segment.
+        if (first_is_byte) {
+            const unsigned char* next = memchr(data + position, wc->bytes[segment->first], last - position + 1);
+            if (!next) return SIZE_MAX;
+            position = (size_t)(next - data);
+        }
+        if (wildcard_segment_match_at(wc, segment, data + position)) return position;
+    }
+    return SIZE_MAX;
+}
+
+static bool wildcard_match_literal(const wildcard* wc, const unsigned char* data, const size_t length) {
+    return length == wc->atom_count && wildcard_equal(data, wc->bytes, length);
+}
+
+static bool wildcard_match_prefix(const wildcard* wc, const unsigned char* data, const size_t length) {
+    return length >= wc->atom_count && wildcard_equal(data, wc->bytes, wc->atom_count);
+}
+
+static bool wildcard_match_suffix(const wildcard* wc, const unsigned char* data, const size_t length) {
+    return length >= wc->atom_count && wildcard_equal(data + (length - wc->atom_count), wc->bytes, wc->atom_count);
+}
+
+static bool wildcard_match_infix(const wildcard* wc, const unsigned char* data, const size_t length) {
+    return wildcard_find_literal(wc, &wc->segments[0], data, length) != NULL;
+}
+
+static bool wildcard_match_any(const wildcard* wc, const unsigned char* data, const size_t length) {
+    (void)wc; (void)data; (void)length;
+    return true;
+}
+
+// The segments are separated by stars. Searching each one from the left, right after the previous one, leaves the most room
+// for the segments after it, so that a match is found if and only if one exists, without backtracking.
+static bool wildcard_match_general(const wildcard* wc, const unsigned char* data, const size_t length) {
+    if (length < wc->atom_count) return false;
+    if (!wc->has_star) return length == wc->atom_count && (!wc->segment_count || wildcard_segment_match_at(wc, &wc->segments[0], data));
+
+    size_t from = 0, limit = length;
+    size_t first = 0, last = wc->segment_count;
+
+    // With a star in the pattern, an anchored first and an anchored last segment are two different segments,
+    // and they cannot overlap since the string is at least as long as all segments together.
+    if (!wc->leading_star) {
+        if (!wildcard_segment_match_at(wc, &wc->segments[0], data)) return false;
+        from = wc->segments[0].length;
+        first++;
+    }
+    if (!wc->trailing_star) {
+        const wildcard_segment* segment = &wc->segments[--last];
+        limit -= segment->length;
+        if (!wildcard_segment_match_at(wc, segment, data + limit)) return false;
+    }
+
+    for (size_t i = first; i < last; i++) {
+        size_t position = wildcard_segment_find(wc, &wc->segments[i], data, from, limit);
+        if (position == SIZE_MAX) return false;
+        from = position + wc->segments[i].length;
+    }
+    return true;
+}
+
+/* ================================ */
+/* ========== Compilation ========= */
+/* ================================ */
+
+static void wildcard_set_add(uint8_t set[32], const unsigned char character) {
+    set[character >> 3] |= (uint8_t)(1u << (character & 7));
+}
+
+// Parses the class starting at the '[' at 'pattern[start]' into 'set'. Returns the index after its ']', or 0 if it is not closed.
+static size_t wildcard_parse_class(const char* pattern, const size_t length, const size_t start, uint8_t set[32]) {
+    size_t i = start + 1;
+    bool negate = i < length && (pattern[i] == '!' || pattern[i] == '^');
+    if (negate) i++;
+
+    memset(set, 0, 32);
+    for (bool first = true; i < length; first = false) {
+        unsigned char low = (unsigned char)pattern[i];
+        if (low == ']' && !first) break;
+        if (low == '\\' && i + 1 < length) low = (unsigned char)pattern[++i];
+        i++;
+
+        // A range, unless the '-' is the last character of the class.
+        if (i + 1 < length && pattern[i] == '-' && pattern[i + 1] != ']') {
+            unsigned char high = (unsigned char)pattern[i + 1];
+            i += 2;
+            if (high == '\\' && i < length) high = (unsigned char)pattern[i++];
+            for (unsigned c = low; c <= high; c++) wildcard_set_add(set, (unsigned char)c);
+        } else wildcard_set_add(set, low);
+    }
+    if (i >= length) return 0;
+
+    if (negate) for (size_t j = 0; j < 32; j++) set[j] = (uint8_t)~set[j];
+    return i + 1;
+}
+
+static void wildcard_add_atom(wildcard* wc, const wildcard_atom_kind kind, const unsigned char byte, const uint32_t set) {
+    wc->atoms[wc->atom_count].kind = (unsigned char)kind;
+    wc->atoms[wc->atom_count].set = set;
+    wc->bytes[wc->atom_count++] = byte;
+    wc->trailing_star = false;
+}
+
+static void wildcard_end_segment(wildcard* wc, const size_t first) {
+    if (wc->atom_count == first) return;
+
+    wildcard_segment* segment = &wc->segments[wc->segment_count++];
+    segment->first = first;
+    segment->length = wc->atom_count - first;
+    segment->literal = true;
+    for (size_t i = first; i < wc->atom_count; i++) {
+        if (wc->atoms[i].kind != WILDCARD_ATOM_BYTE) segment->literal = false;
+    }
+    if (!segment->literal) return;
+
+    const unsigned char* bytes = wc->bytes + first;
+    size_t* borders = wc->borders + first;
+    borders[0] = 0;
+    for (size_t i = 1, border = 0; i < segment->length; i++) {
+        while (border > 0 && bytes[i] != bytes[border]) border = borders[border - 1];
+        if (bytes[i] == bytes[border]) border++;
+        borders[i] = border;
+    }
+}
+
+static void wildcard_compile(wildcard* wc) {
+    const char* pattern = wc->pattern;
+    const size_t length = wc->pattern_length;
+    size_t segment_first = 0;
+
+    for (size_t i = 0; i < length;) {
+        unsigned char c = (unsigned char)pattern[i];
+        if (c == '*') {
+            if (wc->atom_count == 0) wc->leading_star = true;
+            wildcard_end_segment(wc, segment_first);
+            segment_first = wc->atom_count;
+            wc->has_star = wc->trailing_star = true;
+            i++;
+        } else if (c == '?') {
+            wildcard_add_atom(wc, WILDCARD_ATOM_ANY, 0, 0);
+            i++;
+        } else if (c == '\\' && i + 1 < length) {
+            wildcard_add_atom(wc, WILDCARD_ATOM_BYTE, (unsigned char)pattern[i + 1], 0);
+            i += 2;
+        } else if (c == '[') {
+            uint8_t* set = wc->sets[wc->set_count];
+            size_t next = wildcard_parse_class(pattern, length, i, set);
+            if (!next) {
+                wildcard_add_atom(wc, WILDCARD_ATOM_BYTE, c, 0);
+                i++;
+                continue;
+            }
+            i = next;
+
+            // Classes of one character, e.g. '[*]', or of every character, are simpler atoms.
+            size_t members = 0;
+            unsigned char member = 0;
+            for (unsigned k = 0; k < 256; k++) {
+                if ((set[k >> 3] >> (k & 7)) & 1) { members++; member = (unsigned char)k; }
+            }
+            if (members == 1) wildcard_add_atom(wc, WILDCARD_ATOM_BYTE, member, 0);
+            else if (members == 256) wildcard_add_atom(wc, WILDCARD_ATOM_ANY, 0, 0);
+            else wildcard_add_atom(wc, WILDCARD_ATOM_CLASS, 0, (uint32_t)wc->set_count++);
+        } else {
+            wildcard_add_atom(wc, WILDCARD_ATOM_BYTE, c, 0);
+            i++;
+        }
+    }
+    wildcard_end_segment(wc, segment_first);
+
+    bool literal = true;
+    for (size_t i = 0; i < wc->segment_count; i++) literal = literal && wc->segments[i].literal;
+
+    wc->kind = WILDCARD_GENERAL;
+    if (literal && !wc->has_star) wc->kind = WILDCARD_LITERAL;
+    else if (literal && wc->segment_count == 0) wc->kind = WILDCARD_ANY;
+    else if (literal && wc->segment_count == 1) {
+        if (!wc->leading_star) wc->kind = WILDCARD_PREFIX;
+        else wc->kind = wc->trailing_star ? WILDCARD_INFIX : WILDCARD_SUFFIX;
+    }
+
+    switch (wc->kind) {
+        case WILDCARD_LITERAL: wc->matcher = wildcard_match_literal; break;
+        case WILDCARD_PREFIX:  wc->matcher = wildcard_match_prefix; break;
+        case WILDCARD_SUFFIX:  wc->matcher = wildcard_match_suffix; break;
+        case WILDCARD_INFIX:   wc->matcher = wildcard_match_infix; break;
+        case WILDCARD_ANY:     wc->matcher = wildcard_match_any; break;
+        default:                wc->matcher = wildcard_match_general; break;
+    }
+}
+
+/* ================================ */
+/* ===== Constructor, destructor == */
+/* ================================ */
+
+// Constructor of wildcard compiling 'pattern'. A NULL pattern is compiled as the empty one, which only matches empty strings.
+wildcard* new_wildcard(const char* pattern) {
+    return new_wildcard_view(string_view_from_data(pattern ? pattern : "", pattern ? strlen(pattern) : 0));
+}
+
+// Constructor of wildcard compiling the characters of the view.
+wildcard* new_wildcard_view(const string_view pattern) {
+    wildcard* wc = calloc(1, sizeof(wildcard));
+    if (!wc) wildcard_error_handling(CWILDCARD_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                     CWILDCARD_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+
+    // Every character adds at most one atom and ends at most one segment, and a class takes at least 3 characters.
+    size_t length = pattern.length;
+    wc->pattern = malloc(length + 1);
+    wc->atoms = malloc((length + 1) * sizeof(wildcard_atom));
+    wc->bytes = malloc(length + 1);
+    wc->borders = malloc((length + 1) * sizeof(size_t));
+    wc->sets = malloc((length / 3 + 1) * sizeof(*wc->sets));
+    wc->segments = malloc((length + 1) * sizeof(wildcard_segment));
+    if (!wc->pattern || !wc->atoms || !wc->bytes || !wc->borders || !wc->sets || !wc->segments) {
+        delete_wildcard(wc);
+        wildcard_error_handling(CWILDCARD_ERRMSSG_MEMORY_ALLOCATION_FAILURE,
+                                CWILDCARD_ERRCODE_MEMORY_ALLOCATION_FAILURE);
+    }
+
+    if (length) memcpy(wc->pattern, pattern.data, length);
+    wc->pattern[length] = '\0';
+    wc->pattern_length = length;
+
+    wildcard_compile(wc);
+    return wc;
+}
+
+// Destructor of wildcard. Standardised template: void func_name(void* obj).
+void delete_wildcard(void* obj) {
+    wildcard* wc = (wildcard*)obj;
+    if (!wc) return;
+
+    free(wc->pattern);
+    free(wc->atoms);
+    free(wc->bytes);
+    free(wc->borders);
+    free(wc->sets);
+    free(wc->segments);
+    free(wc);
+    wc = NULL;
+    obj = wc;
+}
+
+/* ================================ */
+/* ============ Getters =========== */
+/* ================================ */
+
+// Getter of the pattern the wildcard was compiled from.
+string_view wildcard_get_pattern(const wildcard* wc) {
+    wildcard_check_null(wc);
+    return string_view_from_data(wc->pattern, wc->pattern_length);
+}
+
+// Getter of the shape of the pattern.
+wildcard_kind wildcard_get_kind(const wildcard* wc) {
+    wildcard_check_null(wc);
+    return wc->kind;
+}
+
+// Getter of the minimum length of a matching string, i.e. the number of characters, '?' and '[...]' in the pattern.
+size_t wildcard_get_min_length(const wildcard* wc) {
+    wildcard_check_null(wc);
+    return wc->atom_count;
+}
+
+/* ================================ */
+/* ========= Query methods ======== */
+/* ================================ */
+
+// Checks whether the whole string matches the pattern. A NULL string never matches.
+bool wildcard_match(const wildcard* wc, const string* str) {
+    wildcard_check_null(wc);
+    if (!str) return false;
+    return wc->matcher(wc, (const unsigned char*)string_get_data(str), string_get_length(str));
+}
+
+// Checks whether the whole view matches the pattern.
+bool wildcard_match_view(const wildcard* wc, const string_view view) {
+    wildcard_check_null(wc);
+    return wc->matcher(wc, (const unsigned char*)view.data, view.length);
+}
+
+/* ================================ */
+/* ========= Batch methods ======== */
+/* ================================ */
+
+// Stores in 'results' (may be NULL) whether each string matches. Returns the number of matching strings.
+size_t wildcard_match_many(const wildcard* wc, string* const* strings, const size_t count, bool* results) {
+    wildcard_check_null(wc);
+
+    wildcard_matcher matcher = wc->matcher;
+    size_t matches = 0;
+    for (size_t i = 0; i < count; i++) {
+        bool match = strings[i] && matcher(wc, (const unsigned char*)string_get_data(strings[i]), string_get_length(strings[i]));
+        if (results) results[i] = match;
+        matches += match;
+    }
+    return matches;
+}
+
+// Same as 'wildcard_match_many()' for views.
+size_t wildcard_match_many_views(const wildcard* wc, const string_view* views, const size_t count, bool* results) {
+    wildcard_check_null(wc);
+
+    wildcard_matcher matcher = wc->matcher;
+    size_t matches = 0;
+    for (size_t i = 0; i < count; i++) {
+        bool match = matcher(wc, (const unsigned char*)views[i].data, views[i].length);
+        if (results) results[i] = match;
+        matches += match;
+    }
+    return matches;
+}
+
+// Stores in 'indices' the indices of the matching strings, in increasing order. Returns their number.
+size_t wildcard_filter(const wildcard* wc, string* const* strings, const size_t count, size_t* indices) {
+    wildcard_check_null(wc);
+
+    wildcard_matcher matcher = wc->matcher;
+    size_t matches = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (strings[i] && matcher(wc, (const unsigned char*)string_get_data(strings[i]), string_get_length(strings[i]))) indices[matches++] = i;
+    }
+    return matches;
+}
+
+// Same as 'wildcard_filter()' for views.
+size_t wildcard_filter_views(const wildcard* wc, const string_view* views, const size_t count, size_t* indices) {
+    wildcard_check_null(wc);
+
+    wildcard_matcher matcher = wc->matcher;
+    size_t matches = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (matcher(wc, (const unsigned char*)views[i].data, views[i].length)) indices[matches++] = i;
+    }
+    return matches;
+}
@@ -0,0 +1,114 @@
+#ifndef WILDCARD_H
+#define WILDCARD_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cstring.h"
+
+/* ======================================= */
+/* ============= Definitions ============= */
+/* ======================================= */
+
+/*
+The 'wildcard' type is a glob pattern compiled once and then matched against any number of strings.
+Therefore, it has the following characteristics:
+    - '*' matches any sequence of characters, including an empty one and '/'; '?' matches exactly one character
+    - '[abc]' matches one of the listed characters, '[a-z]' one character of a range, '[!a-z]' or '[^a-z]' one character outside of them;
+      a ']' right after the opening bracket (or the negation) is listed like any other character
+    - '\' makes the next character literal, e.g. '\*'; a '[' without a closing ']' is literal as well, so every pattern is valid
+    - characters are compared as bytes, without case folding
+    - compiling splits the pattern at its stars and picks a matcher for its shape: whole literal, literal prefix ('abc*'),
+      literal suffix ('*abc'), literal infix ('*abc*'), anything ('*'), or the general matcher
+    - the general matcher anchors the first and last parts of the pattern at both ends of the string and searches the parts
+      in between from left to right, which never backtracks more than one part; literal parts are found with Knuth-Morris-Pratt
+      in linear time, while parts with '?' or '[...]' are tried at every position, in time proportional to the part times the string
+Similar in nature to 'fnmatch()' without flags, and to the compiled globs of 'ripgrep'.
+It is not named 'glob' so that it can be used next to the POSIX <glob.h>, which declares 'glob()', 'glob_t' and 'GLOB_*'.
+*/
+
+// Type definition of 'wildcard' type.
+typedef struct _wildcard wildcard;
+
+// Alternative 'keyword' for type 'wildcard'.
+typedef wildcard Wildcard;
+
+// Alternative 'keyword' for type 'wildcard'.
+typedef wildcard wildcard_t;
+
+// Shape of a compiled pattern, i.e. which matcher is used.
+typedef enum {
+    WILDCARD_LITERAL,   // no wildcards: the string has to be equal to the pattern
+    WILDCARD_PREFIX,    // 'abc*'
+    WILDCARD_SUFFIX,    // '*abc'
+    WILDCARD_INFIX,     // '*abc*'
+    WILDCARD_ANY,       // '*': every string matches
+    WILDCARD_GENERAL    // any other pattern
+} wildcard_kind;
+
+/* ========================================= */
+/* ======== Constructor, destructor ======== */
+/* ========================================= */
+
+// Constructor of wildcard compiling 'pattern'. A NULL pattern is compiled as the empty one, which only matches empty strings.
+wildcard* new_wildcard      (const char* pattern);
+
+// Constructor of wildcard compiling the characters of the view.
+wildcard* new_wildcard_view (const string_view pattern);
+
+// Destructor of wildcard. Standardised template: void func_name(void* obj).
+void      delete_wildcard   (void* obj);
+
+/* ======================================= */
+/* =============== Getters =============== */
+/* ======================================= */
+
+// Getter of the pattern the wildcard was compiled from.
+string_view   wildcard_get_pattern    (const wildcard* wc);
+
+// Getter of the shape of the pattern.
+wildcard_kind wildcard_get_kind       (const wildcard* wc);
+
+// Getter of the minimum length of a matching string, i.e. the number of characters, '?' and '[...]' in the pattern.
+size_t        wildcard_get_min_length (const wildcard* wc);
+
+/* ======================================= */
+/* ============ Query methods ============ */
+/* ======================================= */
+
+// Checks whether the whole string matches the pattern. A NULL string never matches.
+bool wildcard_match      (const wildcard* wc, const string* str);
+
+// Checks whether the whole view matches the pattern.
+bool wildcard_match_view (const wildcard* wc, const string_view view);
+
+/* ======================================= */
+/* ============ Batch methods ============ */
+/* ======================================= */
+
+// The functions below match the pattern against 'count' strings at once, calling the matcher picked at compilation directly.
+// NULL entries, e.g. the empty slots of an 'array', never match.
+
+// Stores in 'results' (may be NULL) whether each string matches. Returns the number of matching strings.
+size_t wildcard_match_many       (const wildcard* wc, string* const* strings, const size_t count, bool* results);
+
+// Same as 'wildcard_match_many()' for views.
+size_t wildcard_match_many_views (const wildcard* wc, const string_view* views, const size_t count, bool* results);
+
+// Stores in 'indices' the indices of the matching strings, in increasing order. Returns their number.
+size_t wildcard_filter           (const wildcard* wc, string* const* strings, const size_t count, size_t* indices);
+
+// Same as 'wildcard_filter()' for views.
+size_t wildcard_filter_views     (const wildcard* wc, const string_view* views, const size_t count, size_t* indices);
+
+/* ====================================== */
+/* === Error messages and error codes === */
+/* ====================================== */
+
+#define CWILDCARD_ERRMSSG_NULL_WILDCARD "Error: wildcard is a null pointer."
+#define CWILDCARD_ERRCODE_NULL_WILDCARD -1
+
+#define CWILDCARD_ERRMSSG_MEMORY_ALLOCATION_FAILURE "Error: memory allocation failed."
+#define CWILDCARD_ERRCODE_MEMORY_ALLOCATION_FAILURE -2
+
+#endif // WILDCARD_H
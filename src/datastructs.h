@@ -2,6 +2,31 @@
 #define DATASTRUCTS_H
 
 #include "cstring.h"
+#include "carray.h"
+#include "cthreadpool.h"
+#include "cvector.h"
+#include "ctyped.h"
+#include "chashmap.h"
+#include "cconcurrentmap.h"
+#include "clist.h"
+#include "cstack.h"
+#include "cqueue.h"
+#include "cdeque.h"
+#include "cspscqueue.h"
+#include "cmpmcqueue.h"
+#include "cbtree.h"
+#include "cmatrix.h"
+#include "cpriorityqueue.h"
+#include "cbitset.h"
+#include "cbloomfilter.h"
+#include "cradixtree.h"
+#include "cslaballocator.h"
+#include "cstringtable.h"
+#include "cstringcolumn.h"
+#include "cstringsort.h"
+#include "cwildcard.h"
+#include "ccsvreader.h"
+#include "ceditdistance.h"
 
 // include all function declarations through 'extern' keyword
 
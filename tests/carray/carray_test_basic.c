@@ -1,5 +1,108 @@
+#include <stdio.h>
 #include "../../src/carray.h"
+#include "../../src/cstring.h"
+
+void print_array_data(const array* arr);
+void print_array_equality(const array* arr1, const array* arr2);
+void test_array_primitives(void);
+void test_array_strings(void);
+
+// Slot callbacks for arrays of 'string*'.
+void delete_string_slot(void* slot);
+bool string_slot_areequal(const void* slot1, const void* slot2);
+void copy_string_slot(void* destination, const void* source);
 
 int main(void) {
+    puts("===== CARRAY data type unit tests - Basic functionalities =====");
+    test_array_primitives();
+    test_array_strings();
     return 0;
-}
\ No newline at end of file
+}
+
+void print_array_data(const array* arr) {
+    printf("capacity: %lu - size: %lu - element size: %lu - ",
+           array_get_capacity(arr), array_get_size(arr), array_get_element_size(arr));
+    array_isempty(arr) ? printf("empty - ") : printf("not empty - ");
+    array_isfull(arr)  ? printf("full\n")   : printf("not full\n");
+}
+
+void print_array_equality(const array* arr1, const array* arr2) {
+    array_areequal(arr1, arr2) ? printf("arrays are equal\n") : printf("arrays are NOT equal\n");
+}
+
+void test_array_primitives(void) {
+    printf("\n===== Test: inline storage of primitives =====\n");
+    array* arr = new_array(8, sizeof(int), NULL, NULL, NULL);
+    print_array_data(arr);
+
+    for (int i = 0; i < 8; i++) {
+        int value = i * i;
+        array_insert_item_to(arr, (size_t)i, &value);
+    }
+
+    print_array_data(arr);
+
+    // Slots are contiguous: walking the raw storage yields the same values as the getter.
+    int* data = array_get_data(arr);
+    for (size_t i = 0; i < array_get_capacity(arr); i++) {
+        printf("%d (%d) ", CAST(int, array_get_item_at(arr, i)), data[i]);
+    }
+    printf("\n");
+
+    int removed = 0;
+    array_remove_item_at(arr, 3, &removed);
+    printf("removed: %d - slot 3 is ", removed);
+    array_get_item_at(arr, 3) ? printf("occupied\n") : printf("empty\n");
+    array_delete_item_at(arr, 4);
+    print_array_data(arr);
+
+    array* other = new_array(8, sizeof(int), NULL, NULL, NULL);
+    print_array_equality(arr, other);
+    array_mut_swap(arr, other);
+    print_array_data(arr);
+    print_array_data(other);
+    array_mut_clean(other);
+    print_array_equality(arr, other);
+
+    delete_array(other);
+    delete_array(arr);
+}
+
+void test_array_strings(void) {
+    printf("\n===== Test: arrays of 'string*' =====\n");
+    array* arr = new_array(3, sizeof(string*), delete_string_slot, string_slot_areequal, copy_string_slot);
+
+    const char* words[] = { "one", "two", "three" };
+    for (size_t i = 0; i < 3; i++) {
+        string* str = new_string(words[i]);
+        array_insert_item_to(arr, i, &str);
+    }
+
+    string* replacement = new_string("TWO");
+    array_insert_item_to(arr, 1, &replacement);
+
+    for (size_t i = 0; i < array_get_capacity(arr); i++) {
+        printf("\"%s\" ", string_get_data(CAST(string*, array_get_item_at(arr, i))));
+    }
+    printf("\n");
+
+    string* copy = NULL;
+    array_copy_item_from(arr, 0, &copy);
+    printf("copy of slot 0: \"%s\"\n", string_get_data(copy));
+    delete_string(copy);
+
+    print_array_data(arr);
+    delete_array(arr);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
+
+bool string_slot_areequal(const void* slot1, const void* slot2) {
+    return string_areequal(*(string* const*)slot1, *(string* const*)slot2);
+}
+
+void copy_string_slot(void* destination, const void* source) {
+    *(string**)destination = string_copy(*(string* const*)source);
+}
@@ -0,0 +1,61 @@
+#include <stdio.h>
+#include "../../src/carray.h"
+
+void print_array_contents(const array* arr);
+void print_array_copy(const array* arr);
+void print_array_subarray(array* arr, size_t start, size_t end);
+
+int main(void) {
+    puts("===== CARRAY data type unit tests - Immutative functions =====");
+
+    array* arr = new_array(10, sizeof(long), NULL, NULL, NULL);
+
+    for (long i = 0; i < 10; i++) {
+        long value = 100 + i;
+        if (i != 6) array_insert_item_to(arr, (size_t)i, &value);
+    }
+
+    print_array_copy(arr);
+    print_array_subarray(arr, 2, 7);
+    print_array_subarray(arr, 9, 9);
+
+    delete_array(arr);
+    return 0;
+}
+
+void print_array_contents(const array* arr) {
+    printf("[ ");
+    for (size_t i = 0; i < array_get_capacity(arr); i++) {
+        void* item = array_get_item_at(arr, i);
+        item ? printf("%ld ", CAST(long, item)) : printf("_ ");
+    }
+    printf("] (%lu/%lu)%s\n", array_get_size(arr), array_get_capacity(arr), array_isview(arr) ? " view" : "");
+}
+
+void print_array_copy(const array* arr) {
+    printf("\n===== Test: copying =====\n");
+    array* copy = array_copy(arr);
+    print_array_contents(arr);
+    print_array_contents(copy);
+    array_areequal(arr, copy) ? printf("copy is equal to the original\n") : printf("copy is NOT equal to the original\n");
+    delete_array(copy);
+}
+
+void print_array_subarray(array* arr, size_t start, size_t end) {
+    printf("\n===== Test: subarray views (%lu, %lu) =====\n", start, end);
+    array* view = array_subarray(arr, start, end);
+    print_array_contents(view);
+
+    // Writing through the view is visible in the original array.
+    long value = -1;
+    array_insert_item_to(view, 0, &value);
+    print_array_contents(view);
+    print_array_contents(arr);
+
+    array* copy = array_copy(view);
+    print_array_contents(copy);
+    array_areequal(view, copy) ? printf("copy is equal to the view\n") : printf("copy is NOT equal to the view\n");
+
+    delete_array(copy);
+    delete_array(view);
+}
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include "../../src/carray.h"
+#include "../../src/cstring.h"
+
+void print_int_array(const array* arr);
+void test_array_fill(void);
+void test_array_copy_range(void);
+void test_array_fill_strings(void);
+
+void delete_string_slot(void* slot);
+bool string_slot_areequal(const void* slot1, const void* slot2);
+void copy_string_slot(void* destination, const void* source);
+
+int main(void) {
+    puts("===== CARRAY data type unit tests - Mutative functions =====");
+    test_array_fill();
+    test_array_copy_range();
+    test_array_fill_strings();
+    return 0;
+}
+
+void print_int_array(const array* arr) {
+    printf("[ ");
+    for (size_t i = 0; i < array_get_capacity(arr); i++) {
+        void* item = array_get_item_at(arr, i);
+        item ? printf("%d ", CAST(int, item)) : printf("_ ");
+    }
+    printf("] (%lu/%lu)\n", array_get_size(arr), array_get_capacity(arr));
+}
+
+void test_array_fill(void) {
+    printf("\n===== Test: filling =====\n");
+    array* arr = new_array(13, sizeof(int), NULL, NULL, NULL);
+    int value = 7;
+    array_fill(arr, &value);
+    print_int_array(arr);
+
+    array* view = array_subarray(arr, 3, 5);
+    value = 0;
+    array_fill(view, &value);
+    print_int_array(arr);
+
+    delete_array(view);
+    delete_array(arr);
+}
+
+void test_array_copy_range(void) {
+    printf("\n===== Test: copying ranges =====\n");
+    array* arr = new_array(10, sizeof(int), NULL, NULL, NULL);
+
+    for (int i = 0; i < 5; i++) array_insert_item_to(arr, (size_t)i, &i);
+    print_int_array(arr);
+
+    // Overlapping copy within the same array.
+    array_copy_range(arr, 3, arr, 0, 5);
+    print_int_array(arr);
+
+    array* other = new_array(4, sizeof(int), NULL, NULL, NULL);
+    array_copy_range(other, 1, arr, 5, 3);
+    print_int_array(other);
+
+    delete_array(other);
+    delete_array(arr);
+}
+
+void test_array_fill_strings(void) {
+    printf("\n===== Test: filling and copying arrays of 'string*' =====\n");
+    array* arr = new_array(4, sizeof(string*), delete_string_slot, string_slot_areequal, copy_string_slot);
+    string* str = new_string("filler");
+    array_fill(arr, &str);
+    delete_string(str);
+
+    array* copy = array_copy(arr);
+    array_areequal(arr, copy) ? printf("copy is equal to the original\n") : printf("copy is NOT equal to the original\n");
+
+    for (size_t i = 0; i < array_get_capacity(copy); i++) {
+        printf("\"%s\" ", string_get_data(CAST(string*, array_get_item_at(copy, i))));
+    }
+    printf("\n");
+
+    delete_array(copy);
+    delete_array(arr);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
+
+bool string_slot_areequal(const void* slot1, const void* slot2) {
+    return string_areequal(*(string* const*)slot1, *(string* const*)slot2);
+}
+
+void copy_string_slot(void* destination, const void* source) {
+    *(string**)destination = string_copy(*(string* const*)source);
+}
@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../src/carray.h"
+
+#define ELEMENT_COUNT 1000003
+
+int  compare_int(const void* a, const void* b);
+void double_element(void* element, void* context);
+void int_to_long(void* destination, const void* source, void* context);
+void sum_long(void* accumulator, const void* element, void* context);
+void combine_long(void* result, const void* partial, void* context);
+void test_array_parallel(threadpool* pool);
+
+int main(void) {
+    puts("===== CARRAY data type unit tests - Parallel algorithms =====");
+    threadpool* pool = new_threadpool(4);
+    test_array_parallel(pool);
+    test_array_parallel(NULL);
+    delete_threadpool(pool);
+    return 0;
+}
+
+int compare_int(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+void double_element(void* element, void* context) {
+    (void)context;
+    *(int*)element *= 2;
+}
+
+void int_to_long(void* destination, const void* source, void* context) {
+    (void)context;
+    *(long*)destination = *(const int*)source;
+}
+
+void sum_long(void* accumulator, const void* element, void* context) {
+    (void)context;
+    *(long*)accumulator += *(const long*)element;
+}
+
+void combine_long(void* result, const void* partial, void* context) {
+    (void)context;
+    *(long*)result += *(const long*)partial;
+}
+
+void test_array_parallel(threadpool* pool) {
+    printf("\n===== Test: parallel algorithms (%s pool) =====\n", pool ? "own" : "default");
+    array* arr = new_array(ELEMENT_COUNT, sizeof(int), NULL, NULL, NULL);
+    long expected = 0;
+
+    srand(7);
+    for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+        int value = rand() % 100000;
+        if (i % 10 == 9) continue;
+        array_insert_item_to(arr, i, &value);
+        expected += 2 * value;
+    }
+
+    array_parallel_for_each(arr, double_element, NULL, pool);
+
+    array* longs = new_array(ELEMENT_COUNT, sizeof(long), NULL, NULL, NULL);
+    array_parallel_map(arr, longs, int_to_long, NULL, pool);
+    printf("mapped %lu of %lu elements\n", array_get_size(longs), array_get_size(arr));
+
+    long sum = 0;
+    array_parallel_reduce(longs, &sum, sizeof(sum), sum_long, combine_long, NULL, pool);
+    printf("sum is %s\n", sum == expected ? "correct" : "INCORRECT");
+
+    array* copy = array_copy(arr);
+    array_parallel_sort(arr, compare_int, pool);
+    array_sort_typed(copy, ARRAY_KEY_INT32);
+    printf("parallel sort %s the radix sort\n", array_areequal(arr, copy) ? "matches" : "DIFFERS from");
+
+    delete_array(copy);
+    delete_array(longs);
+    delete_array(arr);
+}
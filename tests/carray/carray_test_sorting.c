@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "../../src/carray.h"
+#include "../../src/cstring.h"
+
+int  compare_int(const void* a, const void* b);
+int  compare_string_slot(const void* a, const void* b);
+void delete_string_slot(void* slot);
+bool check_sorted_int(const array* arr);
+void test_array_sort(size_t count);
+void test_array_sort_typed(void);
+void test_array_sort_strings(void);
+
+int main(void) {
+    puts("===== CARRAY data type unit tests - Sorting and searching =====");
+    test_array_sort(10);
+    test_array_sort(100000);
+    test_array_sort_typed();
+    test_array_sort_strings();
+    return 0;
+}
+
+int compare_int(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+int compare_string_slot(const void* a, const void* b) {
+    return string_compare(*(string* const*)a, *(string* const*)b);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
+
+bool check_sorted_int(const array* arr) {
+    for (size_t i = 1; i < array_get_size(arr); i++) {
+        if (CAST(int, array_get_item_at(arr, i - 1)) > CAST(int, array_get_item_at(arr, i))) return false;
+    }
+
+    return true;
+}
+
+void test_array_sort(size_t count) {
+    printf("\n===== Test: array_sort(), array_sort_stable() (%lu elements) =====\n", count);
+    array* arr1 = new_array(count, sizeof(int), NULL, NULL, NULL);
+
+    srand(42);
+    for (size_t i = 0; i < count; i++) {
+        int value = rand() % 1000;
+        if (i % 7 != 3) array_insert_item_to(arr1, i, &value);
+    }
+
+    array* arr2 = array_copy(arr1);
+    array* arr3 = array_copy(arr1);
+
+    array_sort(arr1, compare_int);
+    array_sort_stable(arr2, compare_int);
+    array_sort_typed(arr3, ARRAY_KEY_INT32);
+
+    printf("introsort: %s\n",   check_sorted_int(arr1) ? "sorted" : "NOT sorted");
+    printf("merge sort: %s\n",  check_sorted_int(arr2) ? "sorted" : "NOT sorted");
+    printf("radix sort: %s\n",  check_sorted_int(arr3) ? "sorted" : "NOT sorted");
+    printf("results are %s\n", array_areequal(arr1, arr2) && array_areequal(arr2, arr3) ? "equal" : "NOT equal");
+
+    int key = 500;
+    size_t lower = array_lower_bound(arr1, &key, compare_int);
+    size_t upper = array_upper_bound(arr1, &key, compare_int);
+    printf("lower bound of %d: %s\n", key, lower == array_lower_bound_typed(arr1, &key, ARRAY_KEY_INT32) ? "typed matches" : "typed DIFFERS");
+    printf("occurrences of %d: %lu\n", key, upper - lower);
+
+    delete_array(arr1);
+    delete_array(arr2);
+    delete_array(arr3);
+}
+
+void test_array_sort_typed(void) {
+    printf("\n===== Test: array_sort_typed() with negative and real numbers =====\n");
+    double values[] = { 3.5, -1.25, 0.0, -100.0, 42.0, -0.5, 7.75 };
+    array* arr = new_array(7, sizeof(double), NULL, NULL, NULL);
+
+    for (size_t i = 0; i < 7; i++) array_insert_item_to(arr, i, &values[i]);
+    array_sort_typed(arr, ARRAY_KEY_DOUBLE);
+
+    for (size_t i = 0; i < 7; i++) printf("%g ", CAST(double, array_get_item_at(arr, i)));
+    printf("\n");
+
+    double key = 7.75;
+    printf("%g is %s\n", key, array_binary_search_typed(arr, &key, ARRAY_KEY_DOUBLE) ? "found" : "NOT found");
+    key = 8.0;
+    printf("%g is %s\n", key, array_binary_search_typed(arr, &key, ARRAY_KEY_DOUBLE) ? "found" : "NOT found");
+
+    delete_array(arr);
+}
+
+void test_array_sort_strings(void) {
+    printf("\n===== Test: sorting and searching arrays of 'string*' =====\n");
+    const char* words[] = { "pear", "apple", "fig", "banana", "cherry" };
+    array* arr = new_array(6, sizeof(string*), delete_string_slot, NULL, NULL);
+
+    for (size_t i = 0; i < 5; i++) {
+        string* str = new_string(words[i]);
+        array_insert_item_to(arr, i + 1, &str);
+    }
+
+    array_sort(arr, compare_string_slot);
+
+    for (size_t i = 0; i < array_get_size(arr); i++) {
+        printf("\"%s\" ", string_get_data(CAST(string*, array_get_item_at(arr, i))));
+    }
+    printf("\n");
+
+    string* key = new_string("fig");
+    void* found = array_binary_search(arr, &key, compare_string_slot);
+    printf("\"%s\" is %s\n", string_get_data(key), found ? "found" : "NOT found");
+    delete_string(key);
+
+    delete_array(arr);
+}
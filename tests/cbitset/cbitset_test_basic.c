@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../src/cbitset.h"
+
+void print_bitset_data(const bitset* bs);
+void test_bitset_basics(void);
+void test_bitset_logic(void);
+void test_bitset_rank_select(void);
+
+int main(void) {
+    puts("===== CBITSET data type unit tests - Basic functionalities =====");
+    test_bitset_basics();
+    test_bitset_logic();
+    test_bitset_rank_select();
+    return 0;
+}
+
+void print_bitset_data(const bitset* bs) {
+    printf("size: %lu - words: %lu - set bits: %lu - ", bitset_get_size(bs), bitset_get_word_count(bs), bitset_count(bs));
+    bitset_isempty(bs) ? printf("empty\n") : printf("not empty\n");
+}
+
+static void print_set_bits(const bitset* bs) {
+    for (size_t i = bitset_find_next_set(bs, 0); i < bitset_get_size(bs); i = bitset_find_next_set(bs, i + 1)) printf("%lu ", i);
+    printf("\n");
+}
+
+void test_bitset_basics(void) {
+    printf("\n===== Test: single bits, ranges and searching =====\n");
+    bitset* bs = new_bitset(200);
+    print_bitset_data(bs);
+
+    bitset_set(bs, 3, true);
+    bitset_set(bs, 64, true);
+    bitset_flip(bs, 199);
+    bitset_flip(bs, 65);
+    bitset_flip(bs, 65);
+    print_set_bits(bs);
+    printf("bit 64: %d - bit 65: %d\n", bitset_get(bs, 64), bitset_get(bs, 65));
+
+    bitset_set_range(bs, 60, 131, true);
+    print_bitset_data(bs);
+    bitset_set_range(bs, 62, 128, false);
+    print_set_bits(bs);
+    printf("first clear bit from 60: %lu - from 199: %lu\n", bitset_find_next_clear(bs, 60), bitset_find_next_clear(bs, 199));
+
+    bitset_resize(bs, 100);
+    print_set_bits(bs);
+    bitset_resize(bs, 300);
+    print_bitset_data(bs);
+
+    bitset* copy = bitset_copy(bs);
+    printf("copy is equal: %s\n", bitset_areequal(copy, bs) ? "yes" : "no");
+    bitset_mut_clean(bs);
+    print_bitset_data(bs);
+
+    delete_bitset(copy);
+    delete_bitset(bs);
+}
+
+void test_bitset_logic(void) {
+    printf("\n===== Test: word-parallel logical operations =====\n");
+    enum { SIZE = 1000 };
+    bitset* a = new_bitset(SIZE);
+    bitset* b = new_bitset(SIZE);
+    bitset* c = new_bitset(SIZE);
+
+    for (size_t i = 0; i < SIZE; i += 2) bitset_set(a, i, true);
+    for (size_t i = 0; i < SIZE; i += 3) bitset_set(b, i, true);
+
+    bitset_and(c, a, b);
+    printf("a & b: %lu bits (multiples of 6: %d)\n", bitset_count(c), (SIZE + 5) / 6);
+    bitset_or(c, a, b);
+    printf("a | b: %lu bits\n", bitset_count(c));
+    bitset_xor(c, a, b);
+    printf("a ^ b: %lu bits\n", bitset_count(c));
+    bitset_andnot(c, a, b);
+    printf("a & ~b: %lu bits\n", bitset_count(c));
+
+    // The complement keeps the bits past the size clear.
+    bitset_not(c, c);
+    bitset_not(c, c);
+    bitset_andnot(c, c, a);
+    printf("~~(a & ~b) & ~a is empty: %s\n", bitset_isempty(c) ? "yes" : "no");
+    bitset_not(c, c);
+    printf("complement of the empty set: %lu bits\n", bitset_count(c));
+
+    bitset* other = new_bitset(SIZE + 1);
+    bitset_and(other, a, b);
+
+    delete_bitset(other);
+    delete_bitset(c);
+    delete_bitset(b);
+    delete_bitset(a);
+}
+
+void test_bitset_rank_select(void) {
+    printf("\n===== Test: rank and select, with and without the index =====\n");
+    enum { SIZE = 100000 };
+    bitset* bs = new_bitset(SIZE);
+    srand(41);
+
+    // Dense and sparse stretches, so that whole blocks and superblocks are empty or full.
+    for (size_t i = 0; i < SIZE; i++) {
+        bool dense = (i / 5000) % 3 == 0;
+        if ((dense && rand() % 4 != 0) || (!dense && (i / 5000) % 3 == 1 && rand() % 200 == 0)) bitset_set(bs, i, true);
+    }
+
+    size_t* ranks = malloc((SIZE + 1) * sizeof(size_t));
+    ranks[0] = 0;
+    for (size_t i = 0; i < SIZE; i++) ranks[i + 1] = ranks[i] + bitset_get(bs, i);
+
+    for (int pass = 0; pass < 2; pass++) {
+        bool rank_ok = true, select_ok = true;
+
+        for (size_t i = 0; i <= SIZE; i += (pass ? 1 : 97)) rank_ok = rank_ok && bitset_rank(bs, i) == ranks[i];
+        for (size_t i = 0; i < SIZE; i += (pass ? 1 : 97)) {
+            if (bitset_get(bs, i)) select_ok = select_ok && bitset_select(bs, ranks[i]) == i;
+        }
+        select_ok = select_ok && bitset_select(bs, ranks[SIZE]) == SIZE;
+
+        printf("%s index: rank %s - select %s\n", bitset_has_index(bs) ? "with" : "without",
+               rank_ok ? "ok" : "wrong", select_ok ? "ok" : "wrong");
+        bitset_build_index(bs);
+    }
+
+    printf("count from index: %s\n", bitset_count(bs) == ranks[SIZE] ? "ok" : "wrong");
+    bitset_set(bs, 0, true);
+    printf("index dropped by a modification: %s\n", bitset_has_index(bs) ? "no" : "yes");
+
+    free(ranks);
+    delete_bitset(bs);
+}
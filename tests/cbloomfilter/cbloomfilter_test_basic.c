@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../src/cbloomfilter.h"
+#include "../../src/cstring.h"
+
+void print_bloomfilter_data(const bloomfilter* bf);
+void test_bloomfilter_rates(void);
+void test_bloomfilter_batch(void);
+void test_bloomfilter_merge_serialize(void);
+
+int main(void) {
+    puts("===== CBLOOMFILTER data type unit tests - Basic functionalities =====");
+    test_bloomfilter_rates();
+    test_bloomfilter_batch();
+    test_bloomfilter_merge_serialize();
+    return 0;
+}
+
+void print_bloomfilter_data(const bloomfilter* bf) {
+    printf("blocks: %lu - probes: %lu - items: %lu\n", bloomfilter_get_block_count(bf),
+           bloomfilter_get_probe_count(bf), bloomfilter_get_item_count(bf));
+}
+
+static string* make_key(const char* prefix, const int number) {
+    return string_format("%s-%d", prefix, number);
+}
+
+void test_bloomfilter_rates(void) {
+    printf("\n===== Test: false-positive rate against the target =====\n");
+    const double targets[] = { 0.1, 0.01, 0.001 };
+    enum { KEYS = 50000, PROBES = 200000 };
+
+    for (size_t t = 0; t < 3; t++) {
+        bloomfilter* bf = new_bloomfilter(KEYS, targets[t]);
+
+        for (int i = 0; i < KEYS; i++) {
+            string* key = make_key("member", i);
+            bloomfilter_add(bf, key);
+            delete_string(key);
+        }
+
+        bool no_false_negatives = true;
+        for (int i = 0; i < KEYS; i++) {
+            string* key = make_key("member", i);
+            no_false_negatives = no_false_negatives && bloomfilter_maycontain(bf, key);
+            delete_string(key);
+        }
+
+        size_t false_positives = 0;
+        for (int i = 0; i < PROBES; i++) {
+            string* key = make_key("stranger", i);
+            false_positives += bloomfilter_maycontain(bf, key);
+            delete_string(key);
+        }
+
+        double rate = (double)false_positives / PROBES;
+        printf("target %.3f: no false negatives: %s - measured rate within target: %s\n", targets[t],
+               no_false_negatives ? "yes" : "no", rate <= targets[t] ? "yes" : "no");
+        delete_bloomfilter(bf);
+    }
+
+    printf("invalid rate: %s\n", new_bloomfilter(10, 1.0) ? "accepted" : "refused");
+}
+
+void test_bloomfilter_batch(void) {
+    printf("\n===== Test: batch queries =====\n");
+    bloomfilter* bf = new_bloomfilter(1000, 0.01);
+
+    enum { COUNT = 1000 };
+    string* keys[COUNT];
+    for (int i = 0; i < COUNT; i++) {
+        keys[i] = make_key(i % 2 ? "odd" : "even", i);
+        if (i % 2 == 0) bloomfilter_add_view(bf, string_get_view(keys[i]));
+    }
+
+    bool results[COUNT];
+    bloomfilter_maycontain_n(bf, keys, COUNT, results);
+
+    bool matches = true;
+    for (int i = 0; i < COUNT; i++) matches = matches && results[i] == bloomfilter_maycontain(bf, keys[i]);
+    printf("batch answers match single queries: %s - even keys found: %s\n", matches ? "yes" : "no", results[0] && results[998] ? "yes" : "no");
+    printf("view and hash queries agree: %s\n",
+           bloomfilter_maycontain_view(bf, string_view_from("even-4")) == bloomfilter_maycontain_hash(bf, string_hash_data("even-4", 6)) ? "yes" : "no");
+
+    for (int i = 0; i < COUNT; i++) delete_string(keys[i]);
+    delete_bloomfilter(bf);
+}
+
+void test_bloomfilter_merge_serialize(void) {
+    printf("\n===== Test: merging and serialisation =====\n");
+    bloomfilter* left = new_bloomfilter(500, 0.01);
+    bloomfilter* right = new_bloomfilter(500, 0.01);
+
+    for (int i = 0; i < 500; i++) {
+        string* key = make_key(i < 250 ? "left" : "right", i);
+        bloomfilter_add(i < 250 ? left : right, key);
+        delete_string(key);
+    }
+
+    bloomfilter_merge(left, right);
+    print_bloomfilter_data(left);
+
+    bool all = true;
+    for (int i = 0; i < 500; i++) {
+        string* key = make_key(i < 250 ? "left" : "right", i);
+        all = all && bloomfilter_maycontain(left, key);
+        delete_string(key);
+    }
+    printf("merged filter holds both halves: %s\n", all ? "yes" : "no");
+
+    size_t size = bloomfilter_get_serialized_size(left);
+    unsigned char* buffer = malloc(size);
+    printf("short buffer: %lu bytes written\n", bloomfilter_serialize(left, buffer, size - 1));
+    printf("serialised %s\n", bloomfilter_serialize(left, buffer, size) == size ? "completely" : "partially");
+
+    bloomfilter* restored = new_bloomfilter_from_bytes(buffer, size);
+    print_bloomfilter_data(restored);
+
+    bool same = true;
+    for (int i = 0; i < 2000; i++) {
+        string* key = make_key("any", i);
+        same = same && bloomfilter_maycontain(left, key) == bloomfilter_maycontain(restored, key);
+        delete_string(key);
+    }
+    printf("restored filter answers the same: %s\n", same ? "yes" : "no");
+
+    buffer[0] = 'X';
+    printf("corrupted buffer: %s\n", new_bloomfilter_from_bytes(buffer, size) ? "accepted" : "refused");
+
+    bloomfilter* other = new_bloomfilter(50000, 0.01);
+    bloomfilter_merge(left, other);
+    bloomfilter_mut_clean(left);
+    print_bloomfilter_data(left);
+
+    free(buffer);
+    delete_bloomfilter(other);
+    delete_bloomfilter(restored);
+    delete_bloomfilter(right);
+    delete_bloomfilter(left);
+}
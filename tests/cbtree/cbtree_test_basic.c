@@ -0,0 +1,283 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../src/cbtree.h"
+#include "../../src/cstring.h"
+
+void print_btree_data(const btree* tree);
+void test_btree_primitives(void);
+void test_btree_ranges(void);
+void test_btree_bulk_load(void);
+void test_btree_strings(void);
+void test_btree_deep_removal(void);
+
+// Slot callbacks for keys of 'int' and 'string*'.
+int compare_int_slot(const void* slot1, const void* slot2);
+int compare_string_slot(const void* slot1, const void* slot2);
+void delete_string_slot(void* slot);
+
+int main(void) {
+    puts("===== CBTREE data type unit tests - Basic functionalities =====");
+    test_btree_primitives();
+    test_btree_ranges();
+    test_btree_bulk_load();
+    test_btree_strings();
+    test_btree_deep_removal();
+    return 0;
+}
+
+void print_btree_data(const btree* tree) {
+    printf("size: %lu - height: %lu - ", btree_get_size(tree), btree_get_height(tree));
+    btree_isempty(tree) ? printf("empty\n") : printf("not empty\n");
+}
+
+// Checks that an in-order walk visits exactly the keys marked in 'present', in ascending order.
+static bool btree_matches(const btree* tree, const bool* present, const int universe) {
+    btree_iterator it = btree_begin(tree);
+    const void* key = NULL;
+    void* value = NULL;
+
+    for (int i = 0; i < universe; i++) {
+        if (!present[i]) continue;
+        if (!btree_next(&it, &key, &value)) return false;
+        if (*(const int*)key != i || *(long*)value != 10L * i) return false;
+    }
+
+    return !btree_next(&it, NULL, NULL);
+}
+
+void test_btree_primitives(void) {
+    printf("\n===== Test: random insertions and removals against a reference =====\n");
+    btree* tree = new_btree(sizeof(int), sizeof(long), compare_int_slot, NULL, NULL);
+    printf("keys per node: %lu\n", btree_get_node_order(tree));
+    print_btree_data(tree);
+
+    enum { UNIVERSE = 5000 };
+    bool present[UNIVERSE] = { false };
+    size_t expected = 0;
+    srand(38);
+
+    for (int round = 0; round < 40000; round++) {
+        int key = rand() % UNIVERSE;
+        long value = 10L * key;
+
+        if (rand() % 3 != 0) {
+            btree_insert(tree, &key, &value);
+            expected += !present[key];
+            present[key] = true;
+        }
+        else {
+            long removed = 0;
+            bool found = btree_remove(tree, &key, NULL, &removed);
+            if (found != present[key] || (found && removed != value)) printf("removal mismatch at key %d\n", key);
+            expected -= present[key];
+            present[key] = false;
+        }
+    }
+
+    bool lookups = true;
+    for (int key = 0; key < UNIVERSE; key++) {
+        long* value = btree_find(tree, &key);
+        if (present[key] != (value != NULL) || (value && *value != 10L * key)) lookups = false;
+    }
+
+    printf("size matches: %s - lookups match: %s - walk matches: %s\n",
+           btree_get_size(tree) == expected ? "yes" : "no", lookups ? "yes" : "no",
+           btree_matches(tree, present, UNIVERSE) ? "yes" : "no");
+    printf("height is logarithmic: %s\n", btree_get_height(tree) <= 3 ? "yes" : "no");
+
+    // Replacing a value keeps the size.
+    int key = 7;
+    long value = 700;
+    btree_insert(tree, &key, &value);
+    btree_insert(tree, &key, &value);
+    printf("replaced value: %ld\n", *(long*)btree_find(tree, &key));
+
+    // Emptying the tree through removals shrinks it down to nothing.
+    for (key = 0; key < UNIVERSE; key++) btree_remove(tree, &key, NULL, NULL);
+    print_btree_data(tree);
+
+    delete_btree(tree);
+}
+
+void test_btree_ranges(void) {
+    printf("\n===== Test: range iteration over linked leaves =====\n");
+    btree* tree = new_btree(sizeof(int), sizeof(long), compare_int_slot, NULL, NULL);
+
+    for (int i = 0; i < 1000; i += 2) {
+        long value = 10L * i;
+        btree_insert(tree, &i, &value);
+    }
+
+    // All keys in [101, 121).
+    int low = 101, high = 121;
+    btree_iterator it = btree_lower_bound(tree, &low);
+    const void* key = NULL;
+    while (btree_next(&it, &key, NULL) && *(const int*)key < high) printf("%d ", *(const int*)key);
+    printf("\n");
+
+    // All keys in (120, 130].
+    low = 120, high = 130;
+    it = btree_upper_bound(tree, &low);
+    while (btree_next(&it, &key, NULL) && *(const int*)key <= high) printf("%d ", *(const int*)key);
+    printf("\n");
+
+    low = 998;
+    it = btree_upper_bound(tree, &low);
+    printf("past the last key: %s\n", btree_next(&it, NULL, NULL) ? "not empty" : "empty");
+
+    delete_btree(tree);
+}
+
+void test_btree_bulk_load(void) {
+    printf("\n===== Test: bulk loading from sorted input =====\n");
+    btree* tree = new_btree(sizeof(int), sizeof(long), compare_int_slot, NULL, NULL);
+
+    enum { COUNT = 20000 };
+    int* keys = malloc(COUNT * sizeof(int));
+    long* values = malloc(COUNT * sizeof(long));
+    bool* present = calloc(3 * COUNT, sizeof(bool));
+    for (int i = 0; i < COUNT; i++) {
+        keys[i] = 3 * i;
+        values[i] = 30L * i;
+        present[3 * i] = true;
+    }
+
+    keys[1] = keys[0];
+    printf("unsorted input loaded: %s\n", btree_bulk_load(tree, keys, values, COUNT) ? "yes" : "no");
+    keys[1] = 3;
+
+    printf("sorted input loaded: %s\n", btree_bulk_load(tree, keys, values, COUNT) ? "yes" : "no");
+    print_btree_data(tree);
+    printf("walk matches: %s\n", btree_matches(tree, present, 3 * COUNT) ? "yes" : "no");
+
+    // The packed tree stays valid under further updates.
+    for (int i = 0; i < 3 * COUNT; i += 2) {
+        long value = 10L * i;
+        if (present[i]) btree_remove(tree, &i, NULL, NULL);
+        else btree_insert(tree, &i, &value);
+        present[i] = !present[i];
+    }
+    printf("walk matches after updates: %s\n", btree_matches(tree, present, 3 * COUNT) ? "yes" : "no");
+
+    free(present);
+    free(values);
+    free(keys);
+    delete_btree(tree);
+}
+
+void test_btree_strings(void) {
+    printf("\n===== Test: keys of 'string*' =====\n");
+    btree* tree = new_btree(sizeof(string*), sizeof(int), compare_string_slot, delete_string_slot, NULL);
+
+    const char* words[] = { "pear", "apple", "fig", "banana", "cherry", "apple", "kiwi", "date", "grape" };
+    for (int i = 0; i < 9; i++) {
+        string* word = new_string(words[i]);
+        btree_insert(tree, &word, &i);
+    }
+
+    string* probe = new_string("cherry");
+    string* removed = NULL;
+    btree_remove(tree, &probe, &removed, NULL);
+    printf("removed: \"%s\"\n", string_get_data(removed));
+    delete_string(removed);
+    delete_string(probe);
+
+    btree_iterator it = btree_begin(tree);
+    const void* key = NULL;
+    void* value = NULL;
+    while (btree_next(&it, &key, &value)) printf("%s:%d ", string_get_data(*(string* const*)key), *(int*)value);
+    printf("\n");
+    print_btree_data(tree);
+
+    // Separators are copies of leaf keys: removing many keys must never leave one pointing to a deleted string.
+    for (int i = 0; i < 2000; i++) {
+        string* number = string_format("%d", (i * 7919) % 2000);
+        btree_insert(tree, &number, &i);
+    }
+    print_btree_data(tree);
+
+    for (int i = 0; i < 2000; i++) {
+        probe = string_format("%d", (i * 104729) % 2000);
+        btree_remove(tree, &probe, NULL, NULL);
+        delete_string(probe);
+    }
+    print_btree_data(tree);
+
+    delete_btree(tree);
+}
+
+// Keys of 64 bytes holding a 'string*', so that nodes hold 4 keys and the tree gets deep with few elements.
+typedef struct {
+    string* str;
+    char padding[56];
+} wide_key;
+
+static int compare_wide_key(const void* slot1, const void* slot2) {
+    return string_compare(((const wide_key*)slot1)->str, ((const wide_key*)slot2)->str);
+}
+
+static void delete_wide_key(void* slot) {
+    delete_string(((wide_key*)slot)->str);
+}
+
+void test_btree_deep_removal(void) {
+    printf("\n===== Test: removals from a deep tree of 'string*' keys =====\n");
+    btree* tree = new_btree(sizeof(wide_key), sizeof(int), compare_wide_key, delete_wide_key, NULL);
+    enum { UNIVERSE = 3000 };
+    bool present[UNIVERSE] = { false };
+    size_t max_height = 0;
+    srand(41);
+
+    // Borrowing and merging copy separators down the tree: none of them may refer to a removed, deleted string.
+    for (int i = 0; i < 200000; i++) {
+        int number = rand() % UNIVERSE;
+        wide_key key = { .str = string_format("%d", number) };
+        if (rand() % 2) {
+            btree_insert(tree, &key, &number);
+            present[number] = true;
+        }
+        else {
+            btree_remove(tree, &key, NULL, NULL);
+            delete_string(key.str);
+            present[number] = false;
+        }
+        if (btree_get_height(tree) > max_height) max_height = btree_get_height(tree);
+    }
+
+    size_t errors = 0, count = 0;
+    for (int i = 0; i < UNIVERSE; i++) {
+        wide_key key = { .str = string_format("%d", i) };
+        int* value = btree_find(tree, &key);
+        if (present[i] != (value != NULL) || (value && *value != i)) errors++;
+        count += present[i];
+        delete_string(key.str);
+    }
+    printf("order: %lu - height reached: %lu - size matches: %s - lookup errors: %lu\n", btree_get_node_order(tree), max_height,
+           btree_get_size(tree) == count ? "yes" : "no", errors);
+    delete_btree(tree);
+
+    // A set: values of 0 bytes, passed as NULL.
+    btree* set = new_btree(sizeof(int), 0, compare_int_slot, NULL, NULL);
+    for (int i = 0; i < 100; i++) {
+        int key = i % 50;
+        btree_insert(set, &key, NULL);
+    }
+    int key = 7;
+    printf("set size: %lu - ", btree_get_size(set));
+    printf("removed 7: %s - ", btree_remove(set, &key, NULL, NULL) ? "yes" : "no");
+    printf("contains 7: %s\n", btree_contains(set, &key) ? "yes" : "no");
+    delete_btree(set);
+}
+
+int compare_int_slot(const void* slot1, const void* slot2) {
+    int a = *(const int*)slot1, b = *(const int*)slot2;
+    return (a > b) - (a < b);
+}
+
+int compare_string_slot(const void* slot1, const void* slot2) {
+    return string_compare(*(string* const*)slot1, *(string* const*)slot2);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
@@ -0,0 +1,163 @@
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "../../src/cconcurrentmap.h"
+#include "../../src/cstring.h"
+
+#define KEYS    2000
+#define READERS 4
+#define WRITERS 2
+
+typedef struct {
+    string_view key;
+    size_t* errors;
+} visit_check;
+
+typedef struct {
+    concurrentmap* map;
+    atomic_bool* stop;
+    size_t id;
+    size_t errors;
+    size_t hits;
+} worker;
+
+void print_concurrentmap_data(const concurrentmap* map);
+void test_concurrentmap_single_thread(void);
+void test_concurrentmap_readers_and_writers(void);
+void* reader_thread(void* argument);
+void* writer_thread(void* argument);
+void check_string_value(const void* value, void* context);
+
+void delete_string_slot(void* slot);
+
+int main(void) {
+    puts("===== CCONCURRENTMAP data type unit tests - Basic functionalities =====");
+    test_concurrentmap_single_thread();
+    test_concurrentmap_readers_and_writers();
+    return 0;
+}
+
+void print_concurrentmap_data(const concurrentmap* map) {
+    printf("size: %lu - shards: %lu - ", concurrentmap_get_size(map), concurrentmap_get_shards(map));
+    concurrentmap_isempty(map) ? printf("empty\n") : printf("not empty\n");
+}
+
+void test_concurrentmap_single_thread(void) {
+    printf("\n===== Test: insert(), update(), erase() =====\n");
+    concurrentmap* map = new_concurrentmap(sizeof(int), NULL, 4);
+    print_concurrentmap_data(map);
+
+    char buffer[32];
+    for (int i = 0; i < 1000; i++) {
+        snprintf(buffer, sizeof(buffer), "key-%d", i);
+        concurrentmap_insert(map, string_view_from(buffer), &i);
+    }
+    print_concurrentmap_data(map);
+
+    int value = -1;
+    printf("insert of an existing key: %s\n", concurrentmap_insert(map, string_view_from("key-7"), &value) ? "inserted" : "rejected");
+    printf("update of a missing key: %s\n", concurrentmap_update(map, string_view_from("key-1000"), &value) ? "updated" : "rejected");
+    concurrentmap_update(map, string_view_from("key-7"), &value);
+    concurrentmap_find(map, string_view_from("key-7"), &value);
+    printf("key-7 -> %d\n", value);
+
+    size_t mismatches = 0;
+    for (int i = 0; i < 1000; i += 2) {
+        snprintf(buffer, sizeof(buffer), "key-%d", i);
+        if (!concurrentmap_erase(map, string_view_from(buffer))) mismatches++;
+    }
+    for (int i = 0; i < 1000; i++) {
+        snprintf(buffer, sizeof(buffer), "key-%d", i);
+        if (concurrentmap_contains(map, string_view_from(buffer)) != (i % 2 == 1)) mismatches++;
+    }
+    printf("mismatches: %lu\n", mismatches);
+    print_concurrentmap_data(map);
+
+    delete_concurrentmap(map);
+}
+
+void test_concurrentmap_readers_and_writers(void) {
+    printf("\n===== Test: lock-free readers alongside writers =====\n");
+    concurrentmap* map = new_concurrentmap(sizeof(string*), delete_string_slot, 0);
+    atomic_bool stop;
+    atomic_init(&stop, false);
+
+    // Every value spells its own key, so a reader can tell a torn or misplaced value apart.
+    char buffer[32];
+    for (size_t i = 0; i < KEYS; i++) {
+        snprintf(buffer, sizeof(buffer), "key-%lu", i);
+        string* value = new_string(buffer);
+        concurrentmap_insert(map, string_view_from(buffer), &value);
+    }
+
+    pthread_t threads[READERS + WRITERS];
+    worker workers[READERS + WRITERS];
+
+    for (size_t i = 0; i < READERS + WRITERS; i++) {
+        workers[i] = (worker){ map, &stop, i, 0, 0 };
+        pthread_create(&threads[i], NULL, i < READERS ? reader_thread : writer_thread, &workers[i]);
+    }
+
+    for (size_t i = READERS; i < READERS + WRITERS; i++) pthread_join(threads[i], NULL);
+    atomic_store(&stop, true);
+    for (size_t i = 0; i < READERS; i++) pthread_join(threads[i], NULL);
+
+    size_t errors = 0, hits = 0;
+    for (size_t i = 0; i < READERS + WRITERS; i++) {
+        errors += workers[i].errors;
+        hits += workers[i].hits;
+    }
+    printf("reader errors: %lu - readers found keys: %s\n", errors, hits > 0 ? "yes" : "no");
+
+    concurrentmap_synchronize(map);
+    print_concurrentmap_data(map);
+    delete_concurrentmap(map);
+}
+
+void* reader_thread(void* argument) {
+    worker* self = (worker*)argument;
+    char buffer[32];
+
+    for (size_t round = 0; !atomic_load(self->stop) || round < 2; round++) {
+        for (size_t i = 0; i < KEYS; i++) {
+            snprintf(buffer, sizeof(buffer), "key-%lu", i);
+            visit_check check = { string_view_from(buffer), &self->errors };
+            if (concurrentmap_visit(self->map, check.key, check_string_value, &check)) self->hits++;
+        }
+    }
+
+    return NULL;
+}
+
+// Writers own the keys congruent to their index: they keep erasing, re-inserting and updating them.
+void* writer_thread(void* argument) {
+    worker* self = (worker*)argument;
+    char buffer[32];
+
+    for (size_t round = 0; round < 20; round++) {
+        for (size_t i = self->id - READERS; i < KEYS; i += WRITERS) {
+            snprintf(buffer, sizeof(buffer), "key-%lu", i);
+            string_view key = string_view_from(buffer);
+
+            if (round % 2 == 0) {
+                if (!concurrentmap_erase(self->map, key)) self->errors++;
+            } else {
+                string* value = new_string(buffer);
+                if (!concurrentmap_insert(self->map, key, &value)) self->errors++;
+                value = new_string(buffer);
+                if (!concurrentmap_update(self->map, key, &value)) self->errors++;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+void check_string_value(const void* value, void* context) {
+    visit_check* check = (visit_check*)context;
+    if (!string_view_areequal(string_get_view(*(string* const*)value), check->key)) (*check->errors)++;
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
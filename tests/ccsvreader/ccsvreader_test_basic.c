@@ -0,0 +1,164 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../src/ccsvreader.h"
+#include "../../src/cstring.h"
+
+void print_csvreader_rows(csvreader* reader);
+void test_csvreader_bytes(void);
+void test_csvreader_tsv(void);
+void test_csvreader_sources(void);
+
+int main(void) {
+    puts("===== CCSVREADER data type unit tests - Basic functionalities =====");
+    test_csvreader_bytes();
+    test_csvreader_tsv();
+    test_csvreader_sources();
+    return 0;
+}
+
+// Reads every remaining row, printing the fields between brackets.
+void print_csvreader_rows(csvreader* reader) {
+    while (csvreader_next_row(reader)) {
+        printf("row %lu (%lu):", csvreader_get_row_number(reader), csvreader_get_field_count(reader));
+        for (size_t i = 0; i < csvreader_get_field_count(reader); i++) {
+            string_view field = csvreader_get_field(reader, i);
+            printf(" [");
+            for (size_t j = 0; j < field.length; j++) field.data[j] == '\n' ? printf("\\n") : putchar(field.data[j]);
+            printf("]");
+        }
+        printf("\n");
+    }
+}
+
+void test_csvreader_bytes(void) {
+    printf("\n===== Test: new_csvreader_from_bytes(), next_row(), get_field() =====\n");
+    const char text[] = "id,name,comment\r\n"
+                        "1,\"Smith, John\",\"said \"\"hi\"\"\"\r\n"
+                        "2,\"multi\nline\",\n"
+                        "\n"
+                        "3,,\"\"\n"
+                        "4,\"lenient\"x,\"unclosed";
+    csvreader* reader = new_csvreader_from_bytes(text, sizeof(text) - 1, ',');
+    print_csvreader_rows(reader);
+    printf("after the end: %s\n", csvreader_next_row(reader) ? "row" : "none");
+    delete_csvreader(reader);
+
+    // Quoted delimiters and newlines across the 64-character blocks, and a row longer than a block.
+    char wide[400] = "";
+    for (int i = 0; i < 8; i++) strcat(wide, "\"a,b\nc\",");
+    strcat(wide, "last\nnext");
+    reader = new_csvreader_from_bytes(wide, strlen(wide), ',');
+    csvreader_next_row(reader);
+    string* field = csvreader_get_string(reader, 7);
+    printf("fields: %lu - eighth is \"a,b\\nc\": %s - ", csvreader_get_field_count(reader), strcmp(string_get_data(field), "a,b\nc") ? "no" : "yes");
+    delete_string(field);
+    print_csvreader_rows(reader);
+    delete_csvreader(reader);
+
+    reader = new_csvreader_from_bytes(NULL, 0, ',');
+    printf("empty input: %s\n", csvreader_next_row(reader) ? "row" : "none");
+    delete_csvreader(reader);
+}
+
+void test_csvreader_tsv(void) {
+    printf("\n===== Test: TSV, set_quote() =====\n");
+    const char text[] = "a\t\"b\tc\"\n\"quoted\"\tplain\n";
+
+    csvreader* reader = new_csvreader_from_bytes(text, sizeof(text) - 1, '\t');
+    print_csvreader_rows(reader);
+    delete_csvreader(reader);
+
+    reader = new_csvreader_from_bytes(text, sizeof(text) - 1, '\t');
+    csvreader_set_quote(reader, '\0');
+    print_csvreader_rows(reader);
+    delete_csvreader(reader);
+}
+
+// Appends a random field to 'text', quoting it when needed or at random, and stores its expected value.
+static void generate_field(char* text, size_t* length, char* expected, size_t* expected_length, const int size) {
+    static const char alphabet[] = "abcdef,\"\n ";
+    bool special = false;
+    for (int i = 0; i < size; i++) {
+        expected[i] = alphabet[rand() % (rand() % 4 ? 6 : 10)];
+        if (strchr(",\"\n", expected[i])) special = true;
+    }
+    *expected_length = (size_t)size;
+
+    bool quoted = special || rand() % 8 == 0;
+    if (quoted) text[(*length)++] = '"';
+    for (int i = 0; i < size; i++) {
+        if (expected[i] == '"') text[(*length)++] = '"';
+        text[(*length)++] = expected[i];
+    }
+    if (quoted) text[(*length)++] = '"';
+}
+
+// Reads all rows and compares them with the fields written by 'generate_field()'.
+static size_t count_mismatches(csvreader* reader, char** fields, const size_t* lengths, const int* field_counts, const int rows) {
+    size_t mismatches = 0, field = 0;
+    int row = 0;
+    for (; csvreader_next_row(reader); row++) {
+        if (row >= rows || (int)csvreader_get_field_count(reader) != field_counts[row]) return mismatches + 1;
+        for (int i = 0; i < field_counts[row]; i++, field++) {
+            if (!string_view_areequal(csvreader_get_field(reader, (size_t)i), string_view_from_data(fields[field], lengths[field]))) mismatches++;
+        }
+    }
+    return mismatches + (size_t)(rows - row);
+}
+
+void test_csvreader_sources(void) {
+    printf("\n===== Test: new_csvreader_from_stream(), new_csvreader_from_file() =====\n");
+    const char* path = "ccsvreader_test_input.csv";
+    enum { ROWS = 4000 };
+    srand(9);
+
+    // Random rows of several chunks, with one field longer than a chunk.
+    size_t capacity = 4 * CCSVREADER_CHUNK_SIZE + (size_t)ROWS * 8 * 70;
+    char* text = malloc(capacity);
+    char** fields = malloc(ROWS * 8 * sizeof(char*));
+    size_t* lengths = malloc(ROWS * 8 * sizeof(size_t));
+    int* field_counts = malloc(ROWS * sizeof(int));
+    size_t length = 0, field = 0;
+
+    for (int row = 0; row < ROWS; row++) {
+        field_counts[row] = 1 + rand() % 8;
+        for (int i = 0; i < field_counts[row]; i++, field++) {
+            int size = row == ROWS / 2 && i == 0 ? (int)CCSVREADER_CHUNK_SIZE + 100 : rand() % 30;
+            fields[field] = malloc((size_t)size + 1);
+            if (i) text[length++] = ',';
+            generate_field(text, &length, fields[field], &lengths[field], size);
+        }
+        if (rand() % 2) text[length++] = '\r';
+        text[length++] = '\n';
+    }
+
+    FILE* file = fopen(path, "wb");
+    fwrite(text, 1, length, file);
+    fclose(file);
+
+    csvreader* reader = new_csvreader_from_bytes(text, length, ',');
+    printf("bytes: %lu mismatches\n", count_mismatches(reader, fields, lengths, field_counts, ROWS));
+    delete_csvreader(reader);
+
+    file = fopen(path, "rb");
+    reader = new_csvreader_from_stream(file, ',');
+    printf("stream: %lu mismatches\n", count_mismatches(reader, fields, lengths, field_counts, ROWS));
+    delete_csvreader(reader);
+    fclose(file);
+
+    reader = new_csvreader_from_file(path, ',');
+    size_t mismatches = count_mismatches(reader, fields, lengths, field_counts, ROWS);
+    printf("mapped file: %lu mismatches - rows: %lu\n", mismatches, csvreader_get_row_number(reader));
+    delete_csvreader(reader);
+    remove(path);
+
+    reader = new_csvreader_from_file("ccsvreader_missing.csv", ',');
+    printf("missing file: %s\n", reader ? "opened" : "NULL");
+
+    for (size_t i = 0; i < field; i++) free(fields[i]);
+    free(field_counts);
+    free(lengths);
+    free(fields);
+    free(text);
+}
@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../src/cdeque.h"
+#include "../../src/cstring.h"
+
+void print_deque_data(const deque* deq);
+void print_int_deque(const deque* deq);
+void test_deque_both_ends(void);
+void test_deque_against_reference(void);
+void test_deque_batches(void);
+void test_deque_strings(void);
+
+void delete_string_slot(void* slot);
+bool string_slot_areequal(const void* slot1, const void* slot2);
+void copy_string_slot(void* destination, const void* source);
+
+int main(void) {
+    puts("===== CDEQUE data type unit tests - Basic functionalities =====");
+    test_deque_both_ends();
+    test_deque_against_reference();
+    test_deque_batches();
+    test_deque_strings();
+    return 0;
+}
+
+void print_deque_data(const deque* deq) {
+    printf("size: %lu - capacity: %lu - ", deque_get_size(deq), deque_get_capacity(deq));
+    deque_isempty(deq) ? printf("empty\n") : printf("not empty\n");
+}
+
+void print_int_deque(const deque* deq) {
+    printf("[ ");
+    for (size_t i = 0; i < deque_get_size(deq); i++) printf("%d ", *(int*)deque_get_item_at(deq, i));
+    printf("]\n");
+}
+
+void test_deque_both_ends(void) {
+    printf("\n===== Test: push and pop at both ends =====\n");
+    deque* deq = new_deque(4, sizeof(int), NULL, NULL, NULL);
+    print_deque_data(deq);
+
+    for (int i = 0; i < 5; i++) deque_push_back(deq, &i);
+    for (int i = -1; i > -5; i--) deque_push_front(deq, &i);
+    *(int*)deque_emplace_front(deq) += 100;
+    print_int_deque(deq);
+    print_deque_data(deq);
+
+    int front, back;
+    deque_pop_front(deq, &front);
+    deque_pop_back(deq, &back);
+    printf("popped front: %d - popped back: %d - front: %d - back: %d\n",
+           front, back, *(int*)deque_get_front(deq), *(int*)deque_get_back(deq));
+
+    delete_deque(deq);
+}
+
+void test_deque_against_reference(void) {
+    printf("\n===== Test: random operations against a plain array =====\n");
+    deque* deq = new_deque(0, sizeof(int), NULL, NULL, NULL);
+    int reference[8192];
+    size_t first = 4096, last = 4096; // reference elements occupy [first, last)
+    size_t mismatches = 0;
+
+    srand(7);
+    for (int step = 0; step < 20000; step++) {
+        int operation = rand() % 4;
+        int value;
+
+        if (operation == 0 && first > 0) {
+            reference[--first] = step;
+            deque_push_front(deq, &step);
+        } else if (operation == 1 && last < 8192) {
+            reference[last++] = step;
+            deque_push_back(deq, &step);
+        } else if (operation == 2 && first < last) {
+            deque_pop_front(deq, &value);
+            if (value != reference[first++]) mismatches++;
+        } else if (operation == 3 && first < last) {
+            deque_pop_back(deq, &value);
+            if (value != reference[--last]) mismatches++;
+        }
+    }
+
+    for (size_t i = first; i < last; i++) {
+        if (*(int*)deque_get_item_at(deq, i - first) != reference[i]) mismatches++;
+    }
+    printf("size matches: %s - mismatches: %lu\n", last - first == deque_get_size(deq) ? "yes" : "no", mismatches);
+
+    delete_deque(deq);
+}
+
+void test_deque_batches(void) {
+    printf("\n===== Test: batch operations at both ends =====\n");
+    deque* deq = new_deque(8, sizeof(int), NULL, NULL, NULL);
+
+    int front[] = { 1, 2, 3 };
+    int back[] = { 7, 8, 9, 10, 11 };
+    int middle[] = { 4, 5, 6 };
+    deque_push_back_n(deq, middle, 3);
+    deque_push_front_n(deq, front, 3);
+    deque_push_back_n(deq, back, 5);
+    print_int_deque(deq);
+    print_deque_data(deq);
+
+    int output[4];
+    size_t count = deque_pop_back_n(deq, output, 4);
+    printf("popped %lu from the back: %d %d %d %d\n", count, output[0], output[1], output[2], output[3]);
+    count = deque_pop_front_n(deq, output, 2);
+    printf("popped %lu from the front: %d %d\n", count, output[0], output[1]);
+    print_int_deque(deq);
+
+    deque* copy = deque_copy(deq);
+    deque_areequal(deq, copy) ? printf("copy is equal\n") : printf("copy is NOT equal\n");
+
+    deque_mut_clean(deq);
+    print_deque_data(deq);
+
+    // Elements of the deque itself, through a full and wrapped ring that has to be reallocated.
+    deque_shrink_to_fit(deq);
+    for (int i = 0; i < 4; i++) deque_push_back(deq, &i);
+    deque_pop_front_n(deq, NULL, 2);
+    for (int i = 4; i < 6; i++) deque_push_back(deq, &i);
+    deque_push_back(deq, deque_get_front(deq));
+    deque_shrink_to_fit(deq);
+    deque_push_front(deq, deque_get_item_at(deq, 2));
+    deque_pop_front_n(deq, NULL, 3);
+    deque_shrink_to_fit(deq);
+    deque_push_front(deq, deque_get_back(deq));
+    deque_push_back(deq, deque_get_front(deq));
+    deque_shrink_to_fit(deq);
+    deque_push_back_n(deq, deque_get_item_at(deq, 1), 3);
+    deque_shrink_to_fit(deq);
+    deque_push_front_n(deq, deque_get_item_at(deq, 4), 4);
+    printf("own elements added: ");
+    print_int_deque(deq);
+
+    delete_deque(copy);
+    delete_deque(deq);
+}
+
+void test_deque_strings(void) {
+    printf("\n===== Test: deques of 'string*' =====\n");
+    deque* deq = new_deque(2, sizeof(string*), delete_string_slot, string_slot_areequal, copy_string_slot);
+
+    const char* words[] = { "north", "east", "south", "west" };
+    for (size_t i = 0; i < 4; i++) {
+        string* str = new_string(words[i]);
+        i % 2 == 0 ? deque_push_back(deq, &str) : deque_push_front(deq, &str);
+    }
+
+    for (size_t i = 0; i < deque_get_size(deq); i++) printf("\"%s\" ", string_get_data(*(string**)deque_get_item_at(deq, i)));
+    printf("\n");
+
+    deque_pop_back(deq, NULL);
+    deque_pop_front_n(deq, NULL, 1);
+    print_deque_data(deq);
+
+    delete_deque(deq);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
+
+bool string_slot_areequal(const void* slot1, const void* slot2) {
+    return string_areequal(*(string* const*)slot1, *(string* const*)slot2);
+}
+
+void copy_string_slot(void* destination, const void* source) {
+    *(string**)destination = string_copy(*(string* const*)source);
+}
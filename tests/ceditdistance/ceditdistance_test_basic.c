@@ -0,0 +1,141 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../src/ceditdistance.h"
+#include "../../src/cstring.h"
+
+void test_editdistance_examples(void);
+void test_editdistance_random(void);
+void test_editdistance_bounded(void);
+void test_editdistance_search(void);
+
+size_t reference_distance(const char* a, const size_t m, const char* b, const size_t n, const int damerau);
+void random_text(char* buffer, const size_t length, const int alphabet);
+
+int main(void) {
+    puts("===== CEDITDISTANCE unit tests - Basic functionalities =====");
+    test_editdistance_examples();
+    test_editdistance_random();
+    test_editdistance_bounded();
+    test_editdistance_search();
+    return 0;
+}
+
+// Dynamic programming over the whole matrix, with transpositions of the optimal string alignment if 'damerau'.
+size_t reference_distance(const char* a, const size_t m, const char* b, const size_t n, const int damerau) {
+    size_t* d = malloc((m + 1) * (n + 1) * sizeof(size_t));
+    #define D(i, j) d[(i) * (n + 1) + (j)]
+    for (size_t i = 0; i <= m; i++) D(i, 0) = i;
+    for (size_t j = 0; j <= n; j++) D(0, j) = j;
+    for (size_t i = 1; i <= m; i++) {
+        for (size_t j = 1; j <= n; j++) {
+            size_t best = D(i - 1, j - 1) + (a[i - 1] != b[j - 1]);
+            if (D(i - 1, j) + 1 < best) best = D(i - 1, j) + 1;
+            if (D(i, j - 1) + 1 < best) best = D(i, j - 1) + 1;
+            if (damerau && i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1] && D(i - 2, j - 2) + 1 < best) best = D(i - 2, j - 2) + 1;
+            D(i, j) = best;
+        }
+    }
+    size_t distance = D(m, n);
+    #undef D
+    free(d);
+    return distance;
+}
+
+void random_text(char* buffer, const size_t length, const int alphabet) {
+    for (size_t i = 0; i < length; i++) buffer[i] = (char)('a' + rand() % alphabet);
+    buffer[length] = '\0';
+}
+
+void test_editdistance_examples(void) {
+    printf("\n===== Test: levenshtein(), damerau() =====\n");
+    const char* pairs[][2] = { { "kitten", "sitting" }, { "ca", "abc" }, { "abcd", "acbd" }, { "", "abc" }, { "same", "same" }, { "flaw", "lawn" } };
+    for (size_t i = 0; i < sizeof(pairs) / sizeof(*pairs); i++) {
+        string* a = new_string(pairs[i][0]);
+        string* b = new_string(pairs[i][1]);
+        printf("\"%s\" - \"%s\": levenshtein %lu, damerau %lu\n", pairs[i][0], pairs[i][1], editdistance_levenshtein(a, b), editdistance_damerau(a, b));
+        delete_string(a);
+        delete_string(b);
+    }
+
+    // Views may contain '\0' characters.
+    printf("with '\\0': %lu\n", editdistance_levenshtein_view(string_view_from_data("a\0b", 3), string_view_from_data("a\0\0b", 4)));
+}
+
+// Random strings of up to 300 characters, i.e. up to 5 words, against the reference.
+void test_editdistance_random(void) {
+    printf("\n===== Test: against dynamic programming =====\n");
+    char a[320], b[320];
+    size_t errors = 0, damerau_errors = 0;
+    srand(17);
+
+    for (int i = 0; i < 3000; i++) {
+        size_t m = (size_t)(i % 3 ? rand() % 70 : rand() % 300), n = (size_t)(i % 3 ? rand() % 70 : rand() % 300);
+        int alphabet = 2 + rand() % 4;
+        random_text(a, m, alphabet);
+
+        // Mostly edits of the first string, so that the distances are small and transpositions happen.
+        if (i % 2) {
+            n = m;
+            memcpy(b, a, m + 1);
+            for (int e = rand() % 6; e > 0 && n > 1; e--) {
+                size_t at = (size_t)rand() % (n - 1);
+                char swap = b[at]; b[at] = b[at + 1]; b[at + 1] = swap;
+                if (rand() % 3 == 0) b[rand() % n] = 'z';
+            }
+        } else random_text(b, n, alphabet);
+
+        string_view va = string_view_from_data(a, m), vb = string_view_from_data(b, n);
+        if (editdistance_levenshtein_view(va, vb) != reference_distance(a, m, b, n, 0)) errors++;
+        if (editdistance_damerau_view(va, vb) != reference_distance(a, m, b, n, 1)) damerau_errors++;
+    }
+    printf("levenshtein errors: %lu - damerau errors: %lu\n", errors, damerau_errors);
+}
+
+void test_editdistance_bounded(void) {
+    printf("\n===== Test: levenshtein_bounded(), damerau_bounded() =====\n");
+    string* a = new_string("international");
+    string* b = new_string("interpolation");
+    printf("distance: %lu - bounded by 10: %lu - by 4: %lu - by 0: %lu\n", editdistance_levenshtein(a, b),
+           editdistance_levenshtein_bounded(a, b, 10), editdistance_levenshtein_bounded(a, b, 4), editdistance_levenshtein_bounded(a, b, 0));
+    delete_string(a);
+    delete_string(b);
+
+    char x[200], y[200];
+    size_t errors = 0;
+    srand(23);
+    for (int i = 0; i < 3000; i++) {
+        size_t m = (size_t)rand() % 150, n = (size_t)rand() % 150, bound = (size_t)rand() % 40;
+        random_text(x, m, 3);
+        random_text(y, n, 3);
+        string_view vx = string_view_from_data(x, m), vy = string_view_from_data(y, n);
+        size_t exact = reference_distance(x, m, y, n, 0), exact_damerau = reference_distance(x, m, y, n, 1);
+        if (editdistance_levenshtein_bounded_view(vx, vy, bound) != (exact <= bound ? exact : bound + 1)) errors++;
+        if (editdistance_damerau_bounded_view(vx, vy, bound) != (exact_damerau <= bound ? exact_damerau : bound + 1)) errors++;
+    }
+    printf("random bounded errors: %lu\n", errors);
+}
+
+void test_editdistance_search(void) {
+    printf("\n===== Test: search(), search_damerau() =====\n");
+    const char* names[] = { "Jonathan Smith", "Jonathon Smith", "John Smith", NULL, "Jon Smyth", "Joanna Smith", "Jonathan Smiht", "Nathan Smith" };
+    string* strings[8];
+    for (int i = 0; i < 8; i++) strings[i] = names[i] ? new_string(names[i]) : NULL;
+    string* query = new_string("Jonathan Smith");
+
+    editdistance_match matches[4];
+    size_t found = editdistance_search(query, strings, 8, 4, matches, 4);
+    printf("levenshtein:");
+    for (size_t i = 0; i < found; i++) printf(" %s (%lu)", names[matches[i].index], matches[i].distance);
+    printf("\n");
+
+    found = editdistance_search_damerau(query, strings, 8, 4, matches, 3);
+    printf("damerau, 3 best:");
+    for (size_t i = 0; i < found; i++) printf(" %s (%lu)", names[matches[i].index], matches[i].distance);
+    printf("\n");
+
+    printf("within 0: %lu - limit 0: %lu\n", editdistance_search(query, strings + 1, 7, 0, matches, 4), editdistance_search(query, strings, 8, 4, matches, 0));
+
+    delete_string(query);
+    for (int i = 0; i < 8; i++) delete_string(strings[i]);
+}
@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include "../../src/chashmap.h"
+#include "../../src/cstring.h"
+
+void print_hashmap_data(const hashmap* map);
+void test_hashmap_insert_find(void);
+void test_hashmap_growth_and_removal(void);
+void test_hashmap_views(void);
+void test_hashmap_owned_values(void);
+
+void delete_string_slot(void* slot);
+
+int main(void) {
+    puts("===== CHASHMAP data type unit tests - Basic functionalities =====");
+    test_hashmap_insert_find();
+    test_hashmap_growth_and_removal();
+    test_hashmap_views();
+    test_hashmap_owned_values();
+    return 0;
+}
+
+void print_hashmap_data(const hashmap* map) {
+    printf("size: %lu - capacity: %lu - ", hashmap_get_size(map), hashmap_get_capacity(map));
+    hashmap_isempty(map) ? printf("empty\n") : printf("not empty\n");
+}
+
+void test_hashmap_insert_find(void) {
+    printf("\n===== Test: insert(), find(), overwrite =====\n");
+    hashmap* map = new_hashmap(sizeof(int), NULL);
+    print_hashmap_data(map);
+
+    const char* words[] = { "alpha", "beta", "gamma", "delta", "epsilon" };
+    for (int i = 0; i < 5; i++) {
+        string* key = new_string(words[i]);
+        hashmap_insert(map, key, &i);
+        delete_string(key);
+    }
+    print_hashmap_data(map);
+
+    string* key = new_string("gamma");
+    printf("gamma -> %d\n", *(int*)hashmap_find(map, key));
+
+    int replacement = 42;
+    hashmap_insert(map, key, &replacement);
+    printf("gamma -> %d after overwrite - size: %lu\n", *(int*)hashmap_find(map, key), hashmap_get_size(map));
+
+    string* suffix = new_string("!");
+    string_mut_concatenate(key, suffix);
+    delete_string(suffix);
+    hashmap_contains(map, key) ? printf("\"%s\" found\n", string_get_data(key)) : printf("\"%s\" not found\n", string_get_data(key));
+    delete_string(key);
+
+    delete_hashmap(map);
+}
+
+void test_hashmap_growth_and_removal(void) {
+    printf("\n===== Test: growth, remove(), reserve(), rehash() =====\n");
+    hashmap* map = new_hashmap(sizeof(size_t), NULL);
+    hashmap_reserve(map, 100);
+    size_t reserved = hashmap_get_capacity(map);
+
+    char buffer[32];
+    for (size_t i = 0; i < 100; i++) {
+        snprintf(buffer, sizeof(buffer), "key-%lu", i);
+        hashmap_insert_view(map, string_view_from(buffer), &i);
+    }
+    printf("capacity unchanged after reserve: %s\n", reserved == hashmap_get_capacity(map) ? "yes" : "no");
+
+    for (size_t i = 100; i < 10000; i++) {
+        snprintf(buffer, sizeof(buffer), "key-%lu", i);
+        hashmap_insert_view(map, string_view_from(buffer), &i);
+    }
+    print_hashmap_data(map);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < 10000; i++) {
+        snprintf(buffer, sizeof(buffer), "key-%lu", i);
+        size_t* value = hashmap_find_view(map, string_view_from(buffer));
+        if (!value || *value != i) mismatches++;
+    }
+    printf("mismatches: %lu\n", mismatches);
+
+    // Remove every even key, then re-insert and remove them again to churn through deleted slots.
+    for (int round = 0; round < 3; round++) {
+        for (size_t i = 0; i < 10000; i += 2) {
+            snprintf(buffer, sizeof(buffer), "key-%lu", i);
+            size_t removed = 0;
+            if (!hashmap_remove_view(map, string_view_from(buffer), &removed) || removed != i) mismatches++;
+        }
+        if (round < 2) {
+            for (size_t i = 0; i < 10000; i += 2) {
+                snprintf(buffer, sizeof(buffer), "key-%lu", i);
+                hashmap_insert_view(map, string_view_from(buffer), &i);
+            }
+        }
+    }
+    print_hashmap_data(map);
+
+    for (size_t i = 0; i < 10000; i++) {
+        snprintf(buffer, sizeof(buffer), "key-%lu", i);
+        if (hashmap_contains_view(map, string_view_from(buffer)) != (i % 2 == 1)) mismatches++;
+    }
+    printf("mismatches after removals: %lu\n", mismatches);
+
+    hashmap_rehash(map);
+    print_hashmap_data(map);
+
+    size_t position = 0, count = 0, sum = 0;
+    const string* key;
+    void* value;
+    while (hashmap_iterate(map, &position, &key, &value)) {
+        count++;
+        sum += *(size_t*)value;
+    }
+    printf("iterated: %lu - sum of values: %lu\n", count, sum);
+
+    hashmap_mut_clean(map);
+    print_hashmap_data(map);
+    delete_hashmap(map);
+}
+
+void test_hashmap_views(void) {
+    printf("\n===== Test: emplace(), views into larger buffers =====\n");
+    hashmap* map = new_hashmap(sizeof(int), NULL);
+
+    // Word count over a sentence without allocating temporary strings for the lookups.
+    const char* text = "the quick brown fox jumps over the lazy dog the end";
+    const char* start = text;
+    for (const char* c = text; ; c++) {
+        if (*c == ' ' || *c == '\0') {
+            (*(int*)hashmap_emplace(map, string_view_from_data(start, (size_t)(c - start))))++;
+            if (*c == '\0') break;
+            start = c + 1;
+        }
+    }
+
+    print_hashmap_data(map);
+    printf("the: %d - fox: %d - cat: %s\n",
+           *(int*)hashmap_find_view(map, string_view_from("the")),
+           *(int*)hashmap_find_view(map, string_view_from("fox")),
+           hashmap_find_view(map, string_view_from("cat")) ? "found" : "not found");
+
+    delete_hashmap(map);
+}
+
+void test_hashmap_owned_values(void) {
+    printf("\n===== Test: values owning resources =====\n");
+    hashmap* map = new_hashmap(sizeof(string*), delete_string_slot);
+
+    string* key = new_string("greeting");
+    string* value = new_string("hello");
+    hashmap_insert(map, key, &value);
+
+    value = new_string("bonjour");
+    hashmap_insert(map, key, &value);
+    printf("greeting -> \"%s\"\n", string_get_data(*(string**)hashmap_find(map, key)));
+
+    string* removed = NULL;
+    hashmap_remove(map, key, &removed);
+    printf("removed \"%s\" - ", string_get_data(removed));
+    print_hashmap_data(map);
+    delete_string(removed);
+
+    value = new_string("hi");
+    hashmap_insert(map, key, &value);
+    delete_string(key);
+
+    delete_hashmap(map);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
@@ -0,0 +1,204 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../src/clist.h"
+#include "../../src/cstring.h"
+
+void print_list_data(const list* lst);
+void print_int_list(const list* lst);
+void test_list_ends(void);
+void test_list_against_reference(void);
+void test_list_bulk_and_splice(void);
+void test_list_strings(void);
+void add_to_sum(void* element, void* context);
+
+void delete_string_slot(void* slot);
+bool string_slot_areequal(const void* slot1, const void* slot2);
+void copy_string_slot(void* destination, const void* source);
+
+int main(void) {
+    puts("===== CLIST data type unit tests - Basic functionalities =====");
+    test_list_ends();
+    test_list_against_reference();
+    test_list_bulk_and_splice();
+    test_list_strings();
+    return 0;
+}
+
+void print_list_data(const list* lst) {
+    printf("size: %lu - node capacity: %lu - pooled nodes: %lu - ",
+           list_get_size(lst), list_get_node_capacity(lst), list_get_pooled_nodes(lst));
+    list_isempty(lst) ? printf("empty\n") : printf("not empty\n");
+}
+
+void print_int_list(const list* lst) {
+    printf("[ ");
+    list_iterator it = list_begin(lst);
+    for (int* element; (element = list_next(&it)); ) printf("%d ", *element);
+    printf("]\n");
+}
+
+void add_to_sum(void* element, void* context) {
+    *(long*)context += *(int*)element;
+}
+
+void test_list_ends(void) {
+    printf("\n===== Test: push and pop at both ends, node pool =====\n");
+    list* lst = new_list(4, sizeof(int), NULL, NULL, NULL);
+    print_list_data(lst);
+
+    for (int i = 0; i < 6; i++) list_push_back(lst, &i);
+    for (int i = -1; i > -6; i--) list_push_front(lst, &i);
+    print_int_list(lst);
+    printf("front: %d - back: %d - item 7: %d\n",
+           *(int*)list_get_front(lst), *(int*)list_get_back(lst), *(int*)list_get_item_at(lst, 7));
+
+    int popped;
+    list_pop_front(lst, &popped);
+    printf("popped front: %d - ", popped);
+    list_pop_back(lst, &popped);
+    printf("popped back: %d\n", popped);
+
+    list_mut_clean(lst);
+    print_list_data(lst);
+
+    // The nodes of the cleaned list are reused, nothing new is allocated until the pool runs dry.
+    for (int i = 0; i < 8; i++) list_push_back(lst, &i);
+    print_list_data(lst);
+
+    list_reserve(lst, 20);
+    print_list_data(lst);
+    list_release_pool(lst);
+    print_list_data(lst);
+
+    delete_list(lst);
+}
+
+void test_list_against_reference(void) {
+    printf("\n===== Test: random insertions and removals against a plain array =====\n");
+    list* lst = new_list(8, sizeof(int), NULL, NULL, NULL);
+    int reference[4096];
+    size_t size = 0;
+    size_t mismatches = 0;
+
+    srand(42);
+    for (int step = 0; step < 20000; step++) {
+        bool insert = size == 0 || (size < 4096 && rand() % 3 != 0);
+        size_t index = (size_t)rand() % (size + (insert ? 1 : 0));
+
+        if (insert) {
+            for (size_t i = size; i > index; i--) reference[i] = reference[i - 1];
+            reference[index] = step;
+            size++;
+            list_insert_item_to(lst, index, &step);
+        } else {
+            int removed;
+            list_remove_item_at(lst, index, &removed);
+            if (removed != reference[index]) mismatches++;
+            for (size_t i = index; i + 1 < size; i++) reference[i] = reference[i + 1];
+            size--;
+        }
+    }
+
+    list_iterator it = list_begin(lst);
+    for (size_t i = 0; i < size; i++) {
+        int* element = list_next(&it);
+        if (!element || *element != reference[i]) mismatches++;
+    }
+    if (list_next(&it)) mismatches++;
+
+    printf("size matches: %s - mismatches: %lu\n", size == list_get_size(lst) ? "yes" : "no", mismatches);
+    delete_list(lst);
+}
+
+void test_list_bulk_and_splice(void) {
+    printf("\n===== Test: insert_range(), splice(), copy(), for_each() =====\n");
+    list* lst = new_list(4, sizeof(int), NULL, NULL, NULL);
+    int values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    list_insert_range(lst, 0, values, 10);
+    int middle[] = { 100, 101, 102, 103, 104 };
+    list_insert_range(lst, 3, middle, 5);
+    print_int_list(lst);
+
+    list* other = new_list(4, sizeof(int), NULL, NULL, NULL);
+    int spliced[] = { -1, -2, -3 };
+    list_insert_range(other, 0, spliced, 3);
+
+    list_splice(lst, 6, other);
+    print_int_list(lst);
+    print_list_data(other);
+
+    list_insert_range(other, 0, spliced, 3);
+    list_splice(lst, 0, other);
+    list_insert_range(other, 0, spliced, 3);
+    list_splice(lst, list_get_size(lst), other);
+    print_int_list(lst);
+
+    list* copy = list_copy(lst);
+    list_areequal(lst, copy) ? printf("copy is equal\n") : printf("copy is NOT equal\n");
+
+    long sum = 0;
+    list_for_each(copy, add_to_sum, &sum);
+    printf("sum: %ld\n", sum);
+
+    list* incompatible = new_list(8, sizeof(int), NULL, NULL, NULL);
+    list_splice(lst, 0, incompatible);
+
+    // Splicing single elements splits a node every time; the halves are merged back instead of piling up underfull nodes.
+    list* many = new_list(4, sizeof(int), NULL, NULL, NULL);
+    list_insert_range(many, 0, values, 10);
+    for (int i = 0; i < 100; i++) {
+        list_push_back(other, &i);
+        list_splice(many, 1 + (size_t)(i * 7) % list_get_size(many), other);
+    }
+    sum = 0;
+    list_for_each(many, add_to_sum, &sum);
+    printf("after 100 single splices: sum: %ld - ", sum);
+    print_list_data(many);
+    delete_list(many);
+
+    delete_list(incompatible);
+    delete_list(copy);
+    delete_list(other);
+    delete_list(lst);
+}
+
+void test_list_strings(void) {
+    printf("\n===== Test: lists of 'string*' =====\n");
+    list* lst = new_list(0, sizeof(string*), delete_string_slot, string_slot_areequal, copy_string_slot);
+
+    const char* words[] = { "lorem", "ipsum", "dolor", "sit", "amet" };
+    for (size_t i = 0; i < 5; i++) {
+        string* str = new_string(words[i]);
+        list_push_back(lst, &str);
+    }
+
+    list_remove_item_at(lst, 1, NULL);
+
+    string* copy = NULL;
+    list_copy_item_from(lst, 2, &copy);
+    printf("copy of item 2: \"%s\"\n", string_get_data(copy));
+    delete_string(copy);
+
+    list* duplicate = list_copy(lst);
+    list_areequal(lst, duplicate) ? printf("lists are equal\n") : printf("lists are NOT equal\n");
+
+    list_iterator it = list_begin(duplicate);
+    for (string** element; (element = list_next(&it)); ) printf("\"%s\" ", string_get_data(*element));
+    printf("\n");
+
+    print_list_data(lst);
+    delete_list(duplicate);
+    delete_list(lst);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
+
+bool string_slot_areequal(const void* slot1, const void* slot2) {
+    return string_areequal(*(string* const*)slot1, *(string* const*)slot2);
+}
+
+void copy_string_slot(void* destination, const void* source) {
+    *(string**)destination = string_copy(*(string* const*)source);
+}
@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "../../src/cmatrix.h"
+
+void print_matrix_data(const matrix* mat);
+void test_matrix_basics(void);
+void test_matrix_elementwise(void);
+void test_matrix_multiply(void);
+void test_matrix_transpose(void);
+
+int main(void) {
+    puts("===== CMATRIX data type unit tests - Basic functionalities =====");
+    test_matrix_basics();
+    test_matrix_elementwise();
+    test_matrix_multiply();
+    test_matrix_transpose();
+    return 0;
+}
+
+void print_matrix_data(const matrix* mat) {
+    printf("depth: %lu - rows: %lu - columns: %lu - size: %lu\n", matrix_get_depth(mat),
+           matrix_get_rows(mat), matrix_get_columns(mat), matrix_get_size(mat));
+}
+
+// Fills the matrix with small integers, which keeps every sum exact.
+static void fill_pattern(matrix* mat, const unsigned seed) {
+    double* data = matrix_get_data(mat);
+    for (size_t i = 0; i < matrix_get_size(mat); i++) data[i] = (double)((i * 7 + seed * 13) % 11) - 5.0;
+}
+
+static double square(double value, void* context) {
+    (void)context;
+    return value * value;
+}
+
+void test_matrix_basics(void) {
+    printf("\n===== Test: shape, storage and element access =====\n");
+    matrix* mat = new_matrix(3, 5);
+    print_matrix_data(mat);
+    printf("storage is 64-byte aligned: %s\n", (uintptr_t)matrix_get_data(mat) % CMATRIX_ALIGNMENT == 0 ? "yes" : "no");
+
+    matrix_set_item_at(mat, 2, 4, 1.5);
+    printf("element (2, 4): %.1f - row-major index 14: %.1f\n", matrix_get_item_at(mat, 2, 4), matrix_get_data(mat)[14]);
+
+    matrix* cube = new_matrix_3d(2, 3, 4);
+    print_matrix_data(cube);
+    matrix_set_item_at_3d(cube, 1, 2, 3, -2.0);
+    printf("element (1, 2, 3): %.1f - last index: %.1f\n", matrix_get_item_at_3d(cube, 1, 2, 3), matrix_get_data(cube)[23]);
+
+    matrix_set_tile_size(mat, 20);
+    printf("tile size: %lu\n", matrix_get_tile_size(mat));
+
+    matrix* copy = matrix_copy(cube);
+    printf("copy is equal: %s\n", matrix_areequal(copy, cube) ? "yes" : "no");
+
+    delete_matrix(copy);
+    delete_matrix(cube);
+    delete_matrix(mat);
+}
+
+void test_matrix_elementwise(void) {
+    printf("\n===== Test: elementwise operations and reductions =====\n");
+    matrix* a = new_matrix(7, 9);
+    matrix* b = new_matrix(7, 9);
+    matrix* c = new_matrix(7, 9);
+    fill_pattern(a, 1);
+    fill_pattern(b, 2);
+
+    matrix_add(c, a, b);
+    matrix_subtract(c, c, b);
+    printf("(a + b) - b == a: %s\n", matrix_areequal(c, a) ? "yes" : "no");
+
+    matrix_hadamard(c, a, a);
+    matrix* squares = new_matrix(7, 9);
+    matrix_apply(squares, a, square, NULL);
+    printf("a * a == square(a): %s\n", matrix_areequal(c, squares) ? "yes" : "no");
+    printf("sum(a * a) == dot(a, a): %s\n", matrix_sum(c) == matrix_dot(a, a) ? "yes" : "no");
+
+    matrix_scale(c, a, -2.0);
+    double sum = 0.0, min = matrix_get_data(a)[0], max = min;
+    for (size_t i = 0; i < matrix_get_size(a); i++) {
+        double value = matrix_get_data(a)[i];
+        sum += value;
+        if (value < min) min = value;
+        if (value > max) max = value;
+    }
+    printf("sum: %s - min: %s - max: %s - scaled sum: %s\n", matrix_sum(a) == sum ? "ok" : "wrong",
+           matrix_min(a) == min ? "ok" : "wrong", matrix_max(a) == max ? "ok" : "wrong",
+           matrix_sum(c) == -2.0 * sum ? "ok" : "wrong");
+
+    matrix_fill(c, 0.5);
+    printf("filled sum: %.1f\n", matrix_sum(c));
+
+    matrix* wrong = new_matrix(9, 7);
+    matrix_add(wrong, a, b);
+    printf("mismatched destination untouched: %s\n", matrix_sum(wrong) == 0.0 ? "yes" : "no");
+
+    delete_matrix(wrong);
+    delete_matrix(squares);
+    delete_matrix(c);
+    delete_matrix(b);
+    delete_matrix(a);
+}
+
+// Textbook triple loop, the reference for the blocked kernels.
+static bool multiply_matches(const matrix* product, const matrix* a, const matrix* b) {
+    size_t n = matrix_get_rows(a), k = matrix_get_columns(a), m = matrix_get_columns(b);
+
+    for (size_t layer = 0; layer < matrix_get_depth(a); layer++) {
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < m; j++) {
+                double sum = 0.0;
+                for (size_t p = 0; p < k; p++) sum += matrix_get_item_at_3d(a, layer, i, p) * matrix_get_item_at_3d(b, layer, p, j);
+                if (sum != matrix_get_item_at_3d(product, layer, i, j)) return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void test_matrix_multiply(void) {
+    printf("\n===== Test: blocked and parallel multiplication =====\n");
+    const size_t shapes[][3] = { { 1, 1, 1 }, { 5, 3, 7 }, { 33, 70, 19 }, { 64, 64, 64 }, { 100, 37, 131 } };
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        size_t n = shapes[s][0], k = shapes[s][1], m = shapes[s][2];
+        matrix* a = new_matrix(n, k);
+        matrix* b = new_matrix(k, m);
+        matrix* c = new_matrix(n, m);
+        fill_pattern(a, 3);
+        fill_pattern(b, 4);
+
+        matrix_multiply(c, a, b);
+        bool serial = multiply_matches(c, a, b);
+
+        matrix_set_tile_size(c, 16);
+        matrix_fill(c, 1.0);
+        matrix_multiply(c, a, b);
+        bool small_tiles = multiply_matches(c, a, b);
+
+        matrix_fill(c, 1.0);
+        matrix_parallel_multiply(c, a, b, NULL);
+        bool parallel = multiply_matches(c, a, b);
+
+        printf("%lux%lu times %lux%lu: serial %s - small tiles %s - parallel %s\n", n, k, k, m,
+               serial ? "ok" : "wrong", small_tiles ? "ok" : "wrong", parallel ? "ok" : "wrong");
+
+        delete_matrix(c);
+        delete_matrix(b);
+        delete_matrix(a);
+    }
+
+    // Every layer of a 3D matrix is multiplied independently.
+    matrix* a = new_matrix_3d(3, 10, 6);
+    matrix* b = new_matrix_3d(3, 6, 9);
+    matrix* c = new_matrix_3d(3, 10, 9);
+    fill_pattern(a, 5);
+    fill_pattern(b, 6);
+    matrix_set_tile_size(c, 8);
+    matrix_parallel_multiply(c, a, b, NULL);
+    printf("layered product: %s\n", multiply_matches(c, a, b) ? "ok" : "wrong");
+
+    matrix_multiply(a, a, b);
+    matrix_multiply(c, b, a);
+
+    delete_matrix(c);
+    delete_matrix(b);
+    delete_matrix(a);
+}
+
+void test_matrix_transpose(void) {
+    printf("\n===== Test: cache-oblivious transposition =====\n");
+    matrix* a = new_matrix_3d(2, 45, 77);
+    matrix* t = new_matrix_3d(2, 77, 45);
+    matrix* back = new_matrix_3d(2, 45, 77);
+    fill_pattern(a, 7);
+
+    matrix_transpose(t, a);
+    bool transposed = true;
+    for (size_t layer = 0; layer < 2; layer++) {
+        for (size_t i = 0; i < 45; i++) {
+            for (size_t j = 0; j < 77; j++) {
+                if (matrix_get_item_at_3d(a, layer, i, j) != matrix_get_item_at_3d(t, layer, j, i)) transposed = false;
+            }
+        }
+    }
+
+    matrix_transpose(back, t);
+    printf("transposed: %s - transposed twice is the original: %s\n", transposed ? "yes" : "no", matrix_areequal(back, a) ? "yes" : "no");
+
+    delete_matrix(back);
+    delete_matrix(t);
+    delete_matrix(a);
+}
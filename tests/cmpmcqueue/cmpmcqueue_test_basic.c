@@ -0,0 +1,159 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include "../../src/cmpmcqueue.h"
+#include "../../src/cstring.h"
+
+#define PRODUCERS 3
+#define CONSUMERS 3
+#define RECORDS_PER_PRODUCER 5000
+
+typedef struct {
+    mpmcqueue* que;
+    size_t id;
+    atomic_size_t* consumed;
+    size_t received;
+    size_t checksum;
+    size_t errors;
+} worker;
+
+void print_mpmcqueue_data(const mpmcqueue* que);
+void test_mpmcqueue_single_thread(void);
+void test_mpmcqueue_many_threads(void);
+void* producer_thread(void* argument);
+void* consumer_thread(void* argument);
+
+void delete_string_slot(void* slot);
+
+int main(void) {
+    puts("===== CMPMCQUEUE data type unit tests - Basic functionalities =====");
+    test_mpmcqueue_single_thread();
+    test_mpmcqueue_many_threads();
+    return 0;
+}
+
+void print_mpmcqueue_data(const mpmcqueue* que) {
+    printf("size: %lu - capacity: %lu - ", mpmcqueue_get_size(que), mpmcqueue_get_capacity(que));
+    mpmcqueue_isempty(que) ? printf("empty\n") : printf("not empty\n");
+}
+
+void test_mpmcqueue_single_thread(void) {
+    printf("\n===== Test: try_push(), try_pop(), batches =====\n");
+    mpmcqueue* que = new_mpmcqueue(5, sizeof(int), NULL);
+    print_mpmcqueue_data(que);
+
+    int values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    printf("pushed: %lu\n", mpmcqueue_push_n(que, values, 10));
+    printf("push into full queue: %s\n", mpmcqueue_try_push(que, &values[0]) ? "succeeded" : "failed");
+
+    int output[10];
+    size_t popped = mpmcqueue_pop_n(que, output, 5);
+    printf("popped %lu: ", popped);
+    for (size_t i = 0; i < popped; i++) printf("%d ", output[i]);
+    printf("\n");
+
+    mpmcqueue_try_push(que, &values[9]);
+    mpmcqueue_push_n(que, values, 4);
+    popped = mpmcqueue_pop_n(que, output, 10);
+    printf("popped %lu: ", popped);
+    for (size_t i = 0; i < popped; i++) printf("%d ", output[i]);
+    printf("\n");
+
+    int value;
+    printf("pop from empty queue: %s\n", mpmcqueue_try_pop(que, &value) ? "succeeded" : "failed");
+    print_mpmcqueue_data(que);
+    delete_mpmcqueue(que);
+}
+
+void test_mpmcqueue_many_threads(void) {
+    printf("\n===== Test: several producers and consumers passing 'string*' records =====\n");
+    mpmcqueue* que = new_mpmcqueue(128, sizeof(string*), delete_string_slot);
+    atomic_size_t consumed;
+    atomic_init(&consumed, 0);
+
+    pthread_t threads[PRODUCERS + CONSUMERS];
+    worker workers[PRODUCERS + CONSUMERS];
+
+    for (size_t i = 0; i < PRODUCERS + CONSUMERS; i++) {
+        workers[i] = (worker){ que, i, &consumed, 0, 0, 0 };
+        pthread_create(&threads[i], NULL, i < PRODUCERS ? producer_thread : consumer_thread, &workers[i]);
+    }
+    for (size_t i = 0; i < PRODUCERS + CONSUMERS; i++) pthread_join(threads[i], NULL);
+
+    // Every record is the decimal representation of a unique number: the checksum tells whether each arrived exactly once.
+    size_t received = 0, checksum = 0, errors = 0;
+    for (size_t i = PRODUCERS; i < PRODUCERS + CONSUMERS; i++) {
+        received += workers[i].received;
+        checksum += workers[i].checksum;
+        errors += workers[i].errors;
+    }
+
+    size_t total = PRODUCERS * RECORDS_PER_PRODUCER;
+    printf("received: %lu - checksum matches: %s - per-producer order violations: %lu\n",
+           received, checksum == total * (total - 1) / 2 ? "yes" : "no", errors);
+    print_mpmcqueue_data(que);
+    delete_mpmcqueue(que);
+}
+
+void* producer_thread(void* argument) {
+    worker* self = (worker*)argument;
+    char buffer[32];
+
+    for (size_t i = 0; i < RECORDS_PER_PRODUCER; ) {
+        string* batch[4];
+        size_t count = i % 3 == 0 ? 1 : 4;
+        if (count > RECORDS_PER_PRODUCER - i) count = RECORDS_PER_PRODUCER - i;
+
+        for (size_t j = 0; j < count; j++) {
+            snprintf(buffer, sizeof(buffer), "%lu", self->id * RECORDS_PER_PRODUCER + i + j);
+            batch[j] = new_string(buffer);
+        }
+
+        for (size_t pushed = 0; pushed < count; ) {
+            pushed += mpmcqueue_push_n(self->que, batch + pushed, count - pushed);
+            if (pushed < count) sched_yield();
+        }
+        i += count;
+    }
+
+    return NULL;
+}
+
+void* consumer_thread(void* argument) {
+    worker* self = (worker*)argument;
+    size_t total = PRODUCERS * RECORDS_PER_PRODUCER;
+    size_t last_seen[PRODUCERS];
+    for (size_t i = 0; i < PRODUCERS; i++) last_seen[i] = SIZE_MAX;
+
+    while (atomic_load(self->consumed) < total) {
+        string* batch[8];
+        size_t count = mpmcqueue_pop_n(self->que, batch, self->id % 2 == 0 ? 1 : 8);
+        if (count == 0) {
+            sched_yield();
+            continue;
+        }
+
+        atomic_fetch_add(self->consumed, count);
+        for (size_t i = 0; i < count; i++) {
+            size_t number = (size_t)strtoull(string_get_data(batch[i]), NULL, 10);
+            size_t producer = number / RECORDS_PER_PRODUCER;
+
+            // One consumer sees the records of one producer in increasing order.
+            if (last_seen[producer] != SIZE_MAX && last_seen[producer] >= number) self->errors++;
+            last_seen[producer] = number;
+
+            self->checksum += number;
+            self->received++;
+            delete_string(batch[i]);
+        }
+    }
+
+    return NULL;
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
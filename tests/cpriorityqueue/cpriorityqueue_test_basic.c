@@ -0,0 +1,219 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../src/cpriorityqueue.h"
+#include "../../src/cstring.h"
+
+void print_priorityqueue_data(const priorityqueue* pq);
+void test_priorityqueue_ordering(void);
+void test_priorityqueue_handles(void);
+void test_priorityqueue_dijkstra(void);
+void test_priorityqueue_strings(void);
+
+// Slot callbacks for elements of 'int', 'string*' and Dijkstra entries.
+int compare_int_slot(const void* slot1, const void* slot2);
+int compare_string_slot(const void* slot1, const void* slot2);
+void delete_string_slot(void* slot);
+
+int main(void) {
+    puts("===== CPRIORITYQUEUE data type unit tests - Basic functionalities =====");
+    test_priorityqueue_ordering();
+    test_priorityqueue_handles();
+    test_priorityqueue_dijkstra();
+    test_priorityqueue_strings();
+    return 0;
+}
+
+void print_priorityqueue_data(const priorityqueue* pq) {
+    printf("size: %lu - capacity: %lu - arity: %lu - ", priorityqueue_get_size(pq),
+           priorityqueue_get_capacity(pq), priorityqueue_get_arity(pq));
+    priorityqueue_isempty(pq) ? printf("empty\n") : printf("not empty\n");
+}
+
+// Pops every element, checking that they come out in non-decreasing order. Returns how many there were.
+static size_t drain_sorted(priorityqueue* pq, bool* sorted) {
+    size_t count = 0;
+    int previous = 0, value = 0;
+    *sorted = true;
+
+    while (priorityqueue_pop(pq, &value)) {
+        if (count++ > 0 && value < previous) *sorted = false;
+        previous = value;
+    }
+
+    return count;
+}
+
+void test_priorityqueue_ordering(void) {
+    printf("\n===== Test: ordering for several arities =====\n");
+    const size_t arities[] = { 2, 0, 8 };
+    srand(40);
+
+    for (size_t a = 0; a < 3; a++) {
+        priorityqueue* pq = new_priorityqueue(0, sizeof(int), arities[a], compare_int_slot, NULL, false);
+
+        for (int i = 0; i < 1000; i++) {
+            int value = rand() % 500;
+            priorityqueue_push(pq, &value);
+            if (i % 3 == 0) priorityqueue_pop(pq, NULL);
+        }
+        print_priorityqueue_data(pq);
+
+        int batch[3000];
+        for (int i = 0; i < 3000; i++) batch[i] = rand() % 10000 - 5000;
+        priorityqueue_push_n(pq, batch, 3000, NULL);
+        printf("top after batch: %d\n", *(int*)priorityqueue_get_top(pq));
+
+        bool sorted = false;
+        size_t count = drain_sorted(pq, &sorted);
+        printf("popped %lu elements in order: %s\n", count, sorted ? "yes" : "no");
+
+        delete_priorityqueue(pq);
+    }
+}
+
+void test_priorityqueue_handles(void) {
+    printf("\n===== Test: decrease-key and removal through handles =====\n");
+    priorityqueue* pq = new_priorityqueue(4, sizeof(int), 0, compare_int_slot, NULL, true);
+
+    priorityqueue_handle handles[200];
+    int values[200];
+    for (int i = 0; i < 200; i++) values[i] = 1000 + (i * 37) % 200;
+    priorityqueue_push_n(pq, values, 100, handles);
+    for (int i = 100; i < 200; i++) handles[i] = priorityqueue_push(pq, &values[i]);
+    print_priorityqueue_data(pq);
+
+    bool found = true;
+    for (int i = 0; i < 200; i++) {
+        if (*(int*)priorityqueue_get_item(pq, handles[i]) != values[i]) found = false;
+    }
+    printf("every handle finds its element: %s\n", found ? "yes" : "no");
+
+    int key = 5;
+    priorityqueue_decrease_key(pq, handles[150], &key);
+    printf("top after decrease-key: %d\n", *(int*)priorityqueue_get_top(pq));
+
+    key = 5000;
+    priorityqueue_update(pq, handles[150], &key);
+    int removed = 0;
+    priorityqueue_remove(pq, handles[7], &removed);
+    printf("removed: %d - handle still valid: %s\n", removed, priorityqueue_contains(pq, handles[7]) ? "yes" : "no");
+    printf("removing again: %s\n", priorityqueue_remove(pq, handles[7], NULL) ? "done" : "refused");
+
+    // The handle of the removed element is recycled for the next push.
+    key = 0;
+    printf("recycled handle: %s\n", priorityqueue_push(pq, &key) == handles[7] ? "yes" : "no");
+
+    bool sorted = false;
+    int top = 0;
+    priorityqueue_pop(pq, &top);
+    size_t count = drain_sorted(pq, &sorted);
+    printf("first: %d - then %lu elements in order: %s\n", top, count, sorted ? "yes" : "no");
+
+    priorityqueue* plain = new_priorityqueue(0, sizeof(int), 0, compare_int_slot, NULL, false);
+    printf("handle without tracking: %s\n", priorityqueue_push(plain, &key) == CPRIORITYQUEUE_NO_HANDLE ? "none" : "some");
+    priorityqueue_remove(plain, 0, NULL);
+
+    delete_priorityqueue(plain);
+    delete_priorityqueue(pq);
+}
+
+// Tentative distance of a vertex, ordered by distance.
+typedef struct {
+    long distance;
+    int vertex;
+} dijkstra_entry;
+
+static int compare_entry_slot(const void* slot1, const void* slot2) {
+    long a = ((const dijkstra_entry*)slot1)->distance, b = ((const dijkstra_entry*)slot2)->distance;
+    return (a > b) - (a < b);
+}
+
+void test_priorityqueue_dijkstra(void) {
+    printf("\n===== Test: Dijkstra's algorithm with decrease-key =====\n");
+    enum { VERTICES = 300 };
+    static long weights[VERTICES][VERTICES];
+    for (int i = 0; i < VERTICES; i++) {
+        for (int j = 0; j < VERTICES; j++) weights[i][j] = rand() % 8 == 0 ? 1 + rand() % 100 : -1;
+    }
+
+    // Reference: the quadratic textbook version.
+    long reference[VERTICES];
+    bool done[VERTICES] = { false };
+    for (int i = 0; i < VERTICES; i++) reference[i] = -1;
+    reference[0] = 0;
+    for (int round = 0; round < VERTICES; round++) {
+        int best = -1;
+        for (int i = 0; i < VERTICES; i++) {
+            if (!done[i] && reference[i] >= 0 && (best < 0 || reference[i] < reference[best])) best = i;
+        }
+        if (best < 0) break;
+        done[best] = true;
+        for (int j = 0; j < VERTICES; j++) {
+            long candidate = reference[best] + weights[best][j];
+            if (weights[best][j] >= 0 && (reference[j] < 0 || candidate < reference[j])) reference[j] = candidate;
+        }
+    }
+
+    priorityqueue* pq = new_priorityqueue(0, sizeof(dijkstra_entry), 0, compare_entry_slot, NULL, true);
+    priorityqueue_handle handles[VERTICES];
+    long distances[VERTICES];
+    for (int i = 0; i < VERTICES; i++) {
+        distances[i] = -1;
+        handles[i] = CPRIORITYQUEUE_NO_HANDLE;
+    }
+
+    dijkstra_entry entry = { 0, 0 };
+    distances[0] = 0;
+    handles[0] = priorityqueue_push(pq, &entry);
+
+    while (priorityqueue_pop(pq, &entry)) {
+        handles[entry.vertex] = CPRIORITYQUEUE_NO_HANDLE;
+        for (int j = 0; j < VERTICES; j++) {
+            if (weights[entry.vertex][j] < 0) continue;
+            dijkstra_entry relaxed = { entry.distance + weights[entry.vertex][j], j };
+            if (distances[j] >= 0 && relaxed.distance >= distances[j]) continue;
+
+            if (handles[j] != CPRIORITYQUEUE_NO_HANDLE) priorityqueue_decrease_key(pq, handles[j], &relaxed);
+            else handles[j] = priorityqueue_push(pq, &relaxed);
+            distances[j] = relaxed.distance;
+        }
+    }
+
+    bool matches = true;
+    for (int i = 0; i < VERTICES; i++) matches = matches && distances[i] == reference[i];
+    printf("distances match the reference: %s\n", matches ? "yes" : "no");
+
+    delete_priorityqueue(pq);
+}
+
+void test_priorityqueue_strings(void) {
+    printf("\n===== Test: elements of 'string*' =====\n");
+    priorityqueue* pq = new_priorityqueue(0, sizeof(string*), 3, compare_string_slot, delete_string_slot, false);
+
+    const char* words[] = { "pear", "apple", "fig", "banana", "cherry", "kiwi", "date" };
+    for (size_t i = 0; i < 7; i++) {
+        string* word = new_string(words[i]);
+        priorityqueue_push(pq, &word);
+    }
+
+    string* first = NULL;
+    priorityqueue_pop(pq, &first);
+    printf("first: \"%s\" - next: \"%s\"\n", string_get_data(first), string_get_data(*(string**)priorityqueue_get_top(pq)));
+    delete_string(first);
+    print_priorityqueue_data(pq);
+
+    delete_priorityqueue(pq);
+}
+
+int compare_int_slot(const void* slot1, const void* slot2) {
+    int a = *(const int*)slot1, b = *(const int*)slot2;
+    return (a > b) - (a < b);
+}
+
+int compare_string_slot(const void* slot1, const void* slot2) {
+    return string_compare(*(string* const*)slot1, *(string* const*)slot2);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
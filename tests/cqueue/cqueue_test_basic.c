@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include "../../src/cqueue.h"
+#include "../../src/cstring.h"
+
+void print_queue_data(const queue* que);
+void print_int_queue(const queue* que);
+void test_queue_wrap_around(void);
+void test_queue_batches(void);
+void test_queue_strings(void);
+
+void delete_string_slot(void* slot);
+bool string_slot_areequal(const void* slot1, const void* slot2);
+void copy_string_slot(void* destination, const void* source);
+
+int main(void) {
+    puts("===== CQUEUE data type unit tests - Basic functionalities =====");
+    test_queue_wrap_around();
+    test_queue_batches();
+    test_queue_strings();
+    return 0;
+}
+
+void print_queue_data(const queue* que) {
+    printf("size: %lu - capacity: %lu - ", queue_get_size(que), queue_get_capacity(que));
+    queue_isempty(que) ? printf("empty\n") : printf("not empty\n");
+}
+
+void print_int_queue(const queue* que) {
+    printf("[ ");
+    for (size_t i = 0; i < queue_get_size(que); i++) printf("%d ", *(int*)queue_get_item_at(que, i));
+    printf("]\n");
+}
+
+void test_queue_wrap_around(void) {
+    printf("\n===== Test: enqueue(), dequeue(), growth of a wrapped buffer =====\n");
+    queue* que = new_queue(5, sizeof(int), NULL, NULL, NULL);
+    print_queue_data(que);
+
+    for (int i = 0; i < 6; i++) queue_enqueue(que, &i);
+    int value;
+    for (int i = 0; i < 4; i++) queue_dequeue(que, &value);
+
+    // The contents wrap around the end of the buffer now; growing unwraps them.
+    for (int i = 6; i < 12; i++) queue_enqueue(que, &i);
+    print_int_queue(que);
+    for (int i = 12; i < 20; i++) queue_enqueue(que, &i);
+    print_int_queue(que);
+    print_queue_data(que);
+    printf("front: %d - back: %d\n", *(int*)queue_get_front(que), *(int*)queue_get_back(que));
+
+    size_t mismatches = 0;
+    for (int expected = 4; queue_dequeue(que, &value); expected++) {
+        if (value != expected) mismatches++;
+    }
+    printf("mismatches: %lu\n", mismatches);
+    print_queue_data(que);
+
+    queue_shrink_to_fit(que);
+    print_queue_data(que);
+
+    // The front element enqueued again, through a full buffer that has to be reallocated.
+    for (int i = 0; i < 4; i++) queue_enqueue(que, &i);
+    queue_shrink_to_fit(que);
+    queue_enqueue(que, queue_get_front(que));
+    print_int_queue(que);
+    delete_queue(que);
+}
+
+void test_queue_batches(void) {
+    printf("\n===== Test: enqueue_n(), dequeue_n(), copy() =====\n");
+    queue* que = new_queue(0, sizeof(int), NULL, NULL, NULL);
+
+    int values[100];
+    int output[100];
+    int produced = 0, consumed = 0;
+    size_t mismatches = 0;
+
+    // Batches of varying size keep the head moving around the ring; the elements are numbered consecutively.
+    for (int round = 1; round < 60; round++) {
+        size_t count = (size_t)(round % 17) + 3;
+        for (size_t i = 0; i < count; i++) values[i] = produced++;
+        queue_enqueue_n(que, values, count);
+
+        count = queue_dequeue_n(que, output, (size_t)(round % 13) + 1);
+        for (size_t i = 0; i < count; i++) {
+            if (output[i] != consumed++) mismatches++;
+        }
+    }
+
+    while (queue_dequeue(que, output)) {
+        if (output[0] != consumed++) mismatches++;
+    }
+    printf("consumed all: %s - ", consumed == produced ? "yes" : "no");
+    printf("mismatches: %lu\n", mismatches);
+
+    for (int i = 0; i < 10; i++) values[i] = i;
+    queue_enqueue_n(que, values, 10);
+    queue* copy = queue_copy(que);
+    queue_areequal(que, copy) ? printf("copy is equal\n") : printf("copy is NOT equal\n");
+    print_int_queue(copy);
+
+    queue_reserve(que, 1000);
+    print_queue_data(que);
+    queue_areequal(que, copy) ? printf("still equal after reserve\n") : printf("NOT equal after reserve\n");
+
+    delete_queue(copy);
+    delete_queue(que);
+}
+
+void test_queue_strings(void) {
+    printf("\n===== Test: queues of 'string*' =====\n");
+    queue* que = new_queue(2, sizeof(string*), delete_string_slot, string_slot_areequal, copy_string_slot);
+
+    const char* words[] = { "first", "second", "third", "fourth", "fifth" };
+    for (size_t i = 0; i < 5; i++) {
+        string* str = new_string(words[i]);
+        queue_enqueue(que, &str);
+    }
+
+    string* front = NULL;
+    queue_dequeue(que, &front);
+    printf("dequeued: \"%s\" - new front: \"%s\"\n", string_get_data(front), string_get_data(*(string**)queue_get_front(que)));
+    delete_string(front);
+
+    queue* copy = queue_copy(que);
+    queue_areequal(que, copy) ? printf("copy is equal\n") : printf("copy is NOT equal\n");
+
+    queue_dequeue_n(que, NULL, 2);
+    print_queue_data(que);
+
+    delete_queue(copy);
+    delete_queue(que);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
+
+bool string_slot_areequal(const void* slot1, const void* slot2) {
+    return string_areequal(*(string* const*)slot1, *(string* const*)slot2);
+}
+
+void copy_string_slot(void* destination, const void* source) {
+    *(string**)destination = string_copy(*(string* const*)source);
+}
@@ -0,0 +1,289 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../src/cradixtree.h"
+#include "../../src/cstring.h"
+
+void print_radixtree_data(const radixtree* tree);
+void test_radixtree_insert_find(void);
+void test_radixtree_node_growth(void);
+void test_radixtree_prefix_queries(void);
+void test_radixtree_against_reference(void);
+void test_radixtree_owned_values(void);
+
+bool print_key(const string_view key, void* value, void* context);
+bool collect_key(const string_view key, void* value, void* context);
+void delete_string_slot(void* slot);
+
+int main(void) {
+    puts("===== CRADIXTREE data type unit tests - Basic functionalities =====");
+    test_radixtree_insert_find();
+    test_radixtree_node_growth();
+    test_radixtree_prefix_queries();
+    test_radixtree_against_reference();
+    test_radixtree_owned_values();
+    return 0;
+}
+
+void print_radixtree_data(const radixtree* tree) {
+    printf("size: %lu - ", radixtree_get_size(tree));
+    radixtree_isempty(tree) ? printf("empty\n") : printf("not empty\n");
+}
+
+void test_radixtree_insert_find(void) {
+    printf("\n===== Test: insert(), find(), remove() =====\n");
+    radixtree* tree = new_radixtree(sizeof(int), NULL);
+    print_radixtree_data(tree);
+
+    const char* words[] = { "romane", "romanus", "romulus", "rubens", "ruber", "rubicon", "rubicundus", "rom", "" };
+    for (int i = 0; i < 9; i++) radixtree_insert_view(tree, string_view_from(words[i]), &i);
+    print_radixtree_data(tree);
+
+    for (int i = 0; i < 9; i++) {
+        int* value = radixtree_find_view(tree, string_view_from(words[i]));
+        printf("\"%s\" -> %d\n", words[i], value ? *value : -1);
+    }
+
+    string* key = new_string("ruber");
+    int replacement = 42;
+    radixtree_insert(tree, key, &replacement);
+    printf("ruber -> %d after overwrite - size: %lu\n", *(int*)radixtree_find(tree, key), radixtree_get_size(tree));
+
+    int removed = 0;
+    radixtree_remove(tree, key, &removed);
+    printf("removed ruber (%d) - contains: %s\n", removed, radixtree_contains(tree, key) ? "yes" : "no");
+    delete_string(key);
+
+    printf("contains \"ro\": %s - \"romanes\": %s - \"rube\": %s\n",
+           radixtree_contains_view(tree, string_view_from("ro")) ? "yes" : "no",
+           radixtree_contains_view(tree, string_view_from("romanes")) ? "yes" : "no",
+           radixtree_contains_view(tree, string_view_from("rube")) ? "yes" : "no");
+
+    radixtree_remove_view(tree, string_view_from("rom"), NULL);
+    radixtree_remove_view(tree, string_view_from(""), NULL);
+    printf("after removing \"rom\" and \"\": romulus -> %d - ", *(int*)radixtree_find_view(tree, string_view_from("romulus")));
+    print_radixtree_data(tree);
+
+    radixtree_mut_clean(tree);
+    print_radixtree_data(tree);
+    delete_radixtree(tree);
+}
+
+void test_radixtree_node_growth(void) {
+    printf("\n===== Test: nodes of 4, 16, 48 and 256 children =====\n");
+    radixtree* tree = new_radixtree(sizeof(size_t), NULL);
+
+    // Every two-byte key below "k": the node after "k" goes through every layout and back.
+    char buffer[3] = { 'k', 0, 0 };
+    for (size_t byte = 0; byte < 256; byte++) {
+        buffer[1] = (char)byte;
+        radixtree_insert_view(tree, string_view_from_data(buffer, 2), &byte);
+    }
+    print_radixtree_data(tree);
+
+    size_t errors = 0;
+    for (size_t byte = 0; byte < 256; byte++) {
+        buffer[1] = (char)byte;
+        size_t* value = radixtree_find_view(tree, string_view_from_data(buffer, 2));
+        if (!value || *value != byte) errors++;
+    }
+    printf("lookups: %lu errors\n", errors);
+
+    for (size_t byte = 0; byte < 256; byte += 2) {
+        buffer[1] = (char)byte;
+        radixtree_remove_view(tree, string_view_from_data(buffer, 2), NULL);
+    }
+    for (size_t byte = 0; byte < 256; byte++) {
+        buffer[1] = (char)byte;
+        if (radixtree_contains_view(tree, string_view_from_data(buffer, 2)) != (byte % 2 == 1)) errors++;
+    }
+    printf("after removing the even bytes: %lu errors - ", errors);
+    print_radixtree_data(tree);
+
+    for (size_t byte = 1; byte < 255; byte += 2) {
+        buffer[1] = (char)byte;
+        radixtree_remove_view(tree, string_view_from_data(buffer, 2), NULL);
+    }
+    buffer[1] = (char)255;
+    printf("last key left -> %lu - ", *(size_t*)radixtree_find_view(tree, string_view_from_data(buffer, 2)));
+    print_radixtree_data(tree);
+
+    delete_radixtree(tree);
+}
+
+bool print_key(const string_view key, void* value, void* context) {
+    (void)context;
+    printf("  \"%.*s\" -> %d\n", (int)key.length, key.data, *(int*)value);
+    return true;
+}
+
+void test_radixtree_prefix_queries(void) {
+    printf("\n===== Test: longest_prefix(), visit_prefixes(), visit_range() =====\n");
+    radixtree* tree = new_radixtree(sizeof(int), NULL);
+
+    const char* routes[] = { "/", "/api", "/api/v1", "/api/v1/users", "/api/v2", "/static", "/apiary" };
+    for (int i = 0; i < 7; i++) radixtree_insert_view(tree, string_view_from(routes[i]), &i);
+
+    const char* requests[] = { "/api/v1/users/17", "/api/v3", "/apia", "/index.html", "api" };
+    for (int i = 0; i < 5; i++) {
+        size_t length = 0;
+        int* value = radixtree_longest_prefix(tree, string_view_from(requests[i]), &length);
+        if (value) printf("%s -> \"%.*s\" (%d)\n", requests[i], (int)length, requests[i], *value);
+        else printf("%s -> no route\n", requests[i]);
+    }
+
+    printf("prefixes of /api/v1/users/17:\n");
+    radixtree_visit_prefixes(tree, string_view_from("/api/v1/users/17"), print_key, NULL);
+
+    printf("keys starting with /api:\n");
+    radixtree_visit_range(tree, string_view_from("/api"), print_key, NULL);
+
+    printf("keys starting with /s:\n");
+    radixtree_visit_range(tree, string_view_from("/s"), print_key, NULL);
+
+    printf("keys starting with /x:\n");
+    radixtree_visit_range(tree, string_view_from("/x"), print_key, NULL);
+
+    delete_radixtree(tree);
+}
+
+typedef struct {
+    char** keys;
+    size_t count;
+} key_list;
+
+bool collect_key(const string_view key, void* value, void* context) {
+    (void)value;
+    key_list* list = context;
+    list->keys[list->count] = malloc(key.length + 1);
+    memcpy(list->keys[list->count], key.data, key.length);
+    list->keys[list->count++][key.length] = '\0';
+    return true;
+}
+
+static int compare_cstrings(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+void test_radixtree_against_reference(void) {
+    printf("\n===== Test: random insertions and removals against a reference =====\n");
+    #define REFERENCE_KEYS 3000
+    radixtree* tree = new_radixtree(sizeof(int), NULL);
+    char* keys[REFERENCE_KEYS];
+    int values[REFERENCE_KEYS];
+    bool present[REFERENCE_KEYS] = { false };
+    size_t present_count = 0, errors = 0;
+
+    // Short keys over a small alphabet, so that many of them are prefixes of one another.
+    srand(7);
+    for (int i = 0; i < REFERENCE_KEYS; i++) {
+        size_t length = (size_t)(rand() % 9);
+        keys[i] = malloc(length + 1);
+        for (size_t j = 0; j < length; j++) keys[i][j] = "abcd"[rand() % 4];
+        keys[i][length] = '\0';
+    }
+
+    for (int round = 0; round < 20000; round++) {
+        int i = rand() % REFERENCE_KEYS;
+        string_view key = string_view_from(keys[i]);
+
+        if (rand() % 3) {
+            // Duplicated strings share the state of their first index.
+            int first = i;
+            for (int j = 0; j < i; j++) if (!strcmp(keys[j], keys[i])) { first = j; break; }
+            if (!present[first]) { present[first] = true; present_count++; }
+            values[first] = round;
+            radixtree_insert_view(tree, key, &round);
+        }
+        else {
+            int first = i;
+            for (int j = 0; j < i; j++) if (!strcmp(keys[j], keys[i])) { first = j; break; }
+            if (radixtree_remove_view(tree, key, NULL) != present[first]) errors++;
+            if (present[first]) { present[first] = false; present_count--; }
+        }
+    }
+
+    for (int i = 0; i < REFERENCE_KEYS; i++) {
+        int first = i;
+        for (int j = 0; j < i; j++) if (!strcmp(keys[j], keys[i])) { first = j; break; }
+        int* value = radixtree_find_view(tree, string_view_from(keys[i]));
+        if ((value != NULL) != present[first] || (value && *value != values[first])) errors++;
+    }
+    printf("lookups: %lu errors - size matches: %s\n", errors, radixtree_get_size(tree) == present_count ? "yes" : "no");
+
+    // Longest prefix against a linear scan.
+    size_t lpm_errors = 0;
+    for (int i = 0; i < REFERENCE_KEYS; i++) {
+        size_t expected = SIZE_MAX, length = SIZE_MAX;
+        for (int j = 0; j < REFERENCE_KEYS; j++) {
+            size_t candidate = strlen(keys[j]);
+            if (present[j] && !strncmp(keys[j], keys[i], candidate) && candidate <= strlen(keys[i]) &&
+                (expected == SIZE_MAX || candidate > expected)) expected = candidate;
+        }
+        void* value = radixtree_longest_prefix(tree, string_view_from(keys[i]), &length);
+        if (value ? length != expected : expected != SIZE_MAX) lpm_errors++;
+    }
+    printf("longest prefixes: %lu errors\n", lpm_errors);
+
+    // Range visits return exactly the present keys with the prefix, sorted.
+    char* visited[REFERENCE_KEYS];
+    char* expected[REFERENCE_KEYS];
+    const char* prefixes[] = { "", "a", "ab", "dcb", "abcdabcd", "abcdabcda" };
+    size_t range_errors = 0;
+    for (int p = 0; p < 6; p++) {
+        key_list list = { visited, 0 };
+        size_t expected_count = 0, prefix_length = strlen(prefixes[p]);
+        radixtree_visit_range(tree, string_view_from(prefixes[p]), collect_key, &list);
+
+        for (int j = 0; j < REFERENCE_KEYS; j++) {
+            if (present[j] && !strncmp(keys[j], prefixes[p], prefix_length)) expected[expected_count++] = keys[j];
+        }
+        qsort(expected, expected_count, sizeof(char*), compare_cstrings);
+
+        if (list.count != expected_count) range_errors++;
+        for (size_t j = 0; j < list.count; j++) {
+            if (j < expected_count && strcmp(visited[j], expected[j])) range_errors++;
+            free(visited[j]);
+        }
+    }
+    printf("range visits: %lu errors\n", range_errors);
+
+    // Removing everything leaves an empty tree.
+    for (int i = 0; i < REFERENCE_KEYS; i++) radixtree_remove_view(tree, string_view_from(keys[i]), NULL);
+    print_radixtree_data(tree);
+
+    for (int i = 0; i < REFERENCE_KEYS; i++) free(keys[i]);
+    delete_radixtree(tree);
+    #undef REFERENCE_KEYS
+}
+
+void test_radixtree_owned_values(void) {
+    printf("\n===== Test: values owning resources =====\n");
+    radixtree* tree = new_radixtree(sizeof(string*), delete_string_slot);
+
+    string* key = new_string("greeting");
+    string* value = new_string("hello");
+    radixtree_insert(tree, key, &value);
+
+    value = new_string("bonjour");
+    radixtree_insert(tree, key, &value);
+    printf("greeting -> \"%s\"\n", string_get_data(*(string**)radixtree_find(tree, key)));
+
+    string* removed = NULL;
+    radixtree_remove(tree, key, &removed);
+    printf("removed \"%s\" - ", string_get_data(removed));
+    print_radixtree_data(tree);
+    delete_string(removed);
+
+    value = new_string("hi");
+    radixtree_insert(tree, key, &value);
+    value = new_string("hey");
+    radixtree_insert_view(tree, string_view_from("greet"), &value);
+    delete_string(key);
+
+    delete_radixtree(tree);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
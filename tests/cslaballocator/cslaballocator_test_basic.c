@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include "../../src/cslaballocator.h"
+
+void print_slaballocator_stats(slaballocator* sa);
+void test_slaballocator_size_classes(void);
+void test_slaballocator_alloc_free(void);
+void test_slaballocator_list_nodes(void);
+void test_slaballocator_threads(void);
+
+void* thread_work(void* argument);
+
+int main(void) {
+    puts("===== CSLABALLOCATOR data type unit tests - Basic functionalities =====");
+    test_slaballocator_size_classes();
+    test_slaballocator_alloc_free();
+    test_slaballocator_list_nodes();
+    test_slaballocator_threads();
+    return 0;
+}
+
+void print_slaballocator_stats(slaballocator* sa) {
+    slaballocator_stats stats = slaballocator_get_stats(sa);
+    printf("slabs: %lu - reserved: %lu - in use: %lu blocks, %lu bytes - allocations: %lu\n",
+           stats.slab_count, stats.reserved_bytes, stats.objects_in_use, stats.bytes_in_use, stats.allocations);
+}
+
+void test_slaballocator_size_classes(void) {
+    printf("\n===== Test: get_class_size() =====\n");
+    const size_t sizes[] = { 0, 1, 16, 17, 100, 129, 200, 257, 500, 512, 513 };
+    for (int i = 0; i < 11; i++) printf("%lu -> %lu\n", sizes[i], slaballocator_get_class_size(sizes[i]));
+}
+
+void test_slaballocator_alloc_free(void) {
+    printf("\n===== Test: alloc(), calloc(), free(), mut_shrink() =====\n");
+    slaballocator* sa = new_slaballocator(SLABALLOCATOR_LOCAL);
+    print_slaballocator_stats(sa);
+
+    // Enough 24-byte blocks for several slabs; every block must be aligned, distinct and writable.
+    enum { BLOCKS = 1000 };
+    unsigned char* blocks[BLOCKS];
+    size_t misaligned = 0, overlaps = 0;
+    for (int i = 0; i < BLOCKS; i++) {
+        blocks[i] = slaballocator_alloc(sa, 24);
+        if ((uintptr_t)blocks[i] % _Alignof(max_align_t)) misaligned++;
+        memset(blocks[i], i & 0xFF, 24);
+    }
+    for (int i = 0; i < BLOCKS; i++) {
+        for (int j = 0; j < 24; j++) if (blocks[i][j] != (i & 0xFF)) { overlaps++; break; }
+    }
+    printf("misaligned: %lu - overwritten: %lu\n", misaligned, overlaps);
+    print_slaballocator_stats(sa);
+
+    slaballocator_stats stats = slaballocator_get_class_stats(sa, 1);
+    printf("class 1: %lu-byte blocks in %lu slabs, %lu in use\n", stats.object_size, stats.slab_count, stats.objects_in_use);
+
+    // Freed blocks are reused before new ones are carved.
+    for (int i = 0; i < BLOCKS; i += 2) slaballocator_free(sa, blocks[i]);
+    print_slaballocator_stats(sa);
+    for (int i = 0; i < BLOCKS; i += 2) blocks[i] = slaballocator_calloc(sa, 24);
+    size_t nonzero = 0;
+    for (int i = 0; i < BLOCKS; i += 2) {
+        for (int j = 0; j < 24; j++) if (blocks[i][j]) { nonzero++; break; }
+    }
+    printf("calloc: %lu non-zero blocks - ", nonzero);
+    print_slaballocator_stats(sa);
+
+    // Freeing everything keeps one empty slab per class, shrinking releases it.
+    for (int i = 0; i < BLOCKS; i++) slaballocator_free(sa, blocks[i]);
+    print_slaballocator_stats(sa);
+    slaballocator_mut_shrink(sa);
+    print_slaballocator_stats(sa);
+
+    printf("too large: %s\n", slaballocator_alloc(sa, CSLABALLOCATOR_MAX_SIZE + 1) ? "allocated" : "NULL");
+    slaballocator_free(sa, NULL);
+    delete_slaballocator(sa);
+}
+
+typedef struct node {
+    struct node* next;
+    int value;
+} node;
+
+void test_slaballocator_list_nodes(void) {
+    printf("\n===== Test: nodes of a list, freed at once by mut_clean() =====\n");
+    slaballocator* sa = new_slaballocator(SLABALLOCATOR_SHARED);
+
+    node* head = NULL;
+    for (int i = 0; i < 10000; i++) {
+        node* n = slaballocator_alloc(sa, sizeof(node));
+        n->value = i;
+        n->next = head;
+        head = n;
+    }
+
+    long long sum = 0;
+    for (node* n = head; n; n = n->next) sum += n->value;
+    printf("sum: %lld - ", sum);
+    print_slaballocator_stats(sa);
+
+    slaballocator_mut_clean(sa);
+    print_slaballocator_stats(sa);
+
+    node* reused = slaballocator_alloc(sa, sizeof(node));
+    reused->value = 1;
+    print_slaballocator_stats(sa);
+
+    delete_slaballocator(sa);
+}
+
+void* thread_work(void* argument) {
+    slaballocator* sa = argument;
+    void* blocks[256];
+    size_t errors = 0;
+
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < 256; i++) {
+            size_t size = 8 + (size_t)((i * 37 + round) % 300);
+            blocks[i] = slaballocator_alloc(sa, size);
+            memset(blocks[i], i, size);
+        }
+        for (int i = 0; i < 256; i++) {
+            if (((unsigned char*)blocks[i])[0] != (unsigned char)i) errors++;
+            slaballocator_free(sa, blocks[i]);
+        }
+    }
+
+    return (void*)errors;
+}
+
+void test_slaballocator_threads(void) {
+    printf("\n===== Test: thread caches =====\n");
+    slaballocator* sa = new_slaballocator(SLABALLOCATOR_THREAD_CACHE);
+
+    enum { THREADS = 4 };
+    pthread_t threads[THREADS];
+    for (int i = 0; i < THREADS; i++) pthread_create(&threads[i], NULL, thread_work, sa);
+
+    size_t errors = 0;
+    for (int i = 0; i < THREADS; i++) {
+        void* result;
+        pthread_join(threads[i], &result);
+        errors += (size_t)result;
+    }
+
+    // The caches of the exited threads have been given back.
+    slaballocator_stats stats = slaballocator_get_stats(sa);
+    printf("errors: %lu - in use after the threads exited: %lu\n", errors, stats.objects_in_use);
+
+    // Blocks cached by the calling thread pin their slabs until its cache is flushed, which shrinking does.
+    void* blocks[1000];
+    for (int i = 0; i < 1000; i++) blocks[i] = slaballocator_alloc(sa, 40);
+    for (int i = 0; i < 1000; i++) slaballocator_free(sa, blocks[i]);
+    stats = slaballocator_get_stats(sa);
+    printf("cached by this thread: %lu - ", stats.objects_in_use);
+    slaballocator_flush_cache(sa);
+    stats = slaballocator_get_stats(sa);
+    printf("after flush_cache(): %lu - ", stats.objects_in_use);
+    slaballocator_mut_shrink(sa);
+    print_slaballocator_stats(sa);
+
+    // Slabs whose memory was given back are reused.
+    for (int i = 0; i < 1000; i++) {
+        blocks[i] = slaballocator_alloc(sa, 40);
+        memset(blocks[i], 0xAB, 40);
+    }
+    for (int i = 0; i < 1000; i++) slaballocator_free(sa, blocks[i]);
+    slaballocator_flush_cache(sa);
+    print_slaballocator_stats(sa);
+    delete_slaballocator(sa);
+}
@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include "../../src/cspscqueue.h"
+#include "../../src/cstring.h"
+
+#define RECORDS 20000
+
+void print_spscqueue_data(const spscqueue* que);
+void test_spscqueue_single_thread(void);
+void test_spscqueue_two_threads(void);
+void* producer_thread(void* argument);
+
+void delete_string_slot(void* slot);
+
+int main(void) {
+    puts("===== CSPSCQUEUE data type unit tests - Basic functionalities =====");
+    test_spscqueue_single_thread();
+    test_spscqueue_two_threads();
+    return 0;
+}
+
+void print_spscqueue_data(const spscqueue* que) {
+    printf("size: %lu - capacity: %lu - ", spscqueue_get_size(que), spscqueue_get_capacity(que));
+    spscqueue_isempty(que) ? printf("empty\n") : printf("not empty\n");
+}
+
+void test_spscqueue_single_thread(void) {
+    printf("\n===== Test: try_push(), try_pop(), batches =====\n");
+    spscqueue* que = new_spscqueue(6, sizeof(int), NULL);
+    print_spscqueue_data(que);
+
+    int values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    printf("pushed: %lu\n", spscqueue_push_n(que, values, 10));
+    printf("push into full queue: %s\n", spscqueue_try_push(que, &values[0]) ? "succeeded" : "failed");
+    print_spscqueue_data(que);
+
+    int output[10];
+    size_t popped = spscqueue_pop_n(que, output, 3);
+    printf("popped %lu: %d %d %d\n", popped, output[0], output[1], output[2]);
+
+    // The next batch wraps around the end of the ring.
+    printf("pushed: %lu\n", spscqueue_push_n(que, values + 8, 2));
+    popped = spscqueue_pop_n(que, output, 10);
+    printf("popped %lu: ", popped);
+    for (size_t i = 0; i < popped; i++) printf("%d ", output[i]);
+    printf("\n");
+
+    int value;
+    printf("pop from empty queue: %s\n", spscqueue_try_pop(que, &value) ? "succeeded" : "failed");
+    delete_spscqueue(que);
+}
+
+void test_spscqueue_two_threads(void) {
+    printf("\n===== Test: handing 'string*' records over to another thread =====\n");
+    spscqueue* que = new_spscqueue(64, sizeof(string*), delete_string_slot);
+
+    pthread_t producer;
+    pthread_create(&producer, NULL, producer_thread, que);
+
+    size_t received = 0, mismatches = 0;
+    string* batch[16];
+    char expected[32];
+
+    while (received < RECORDS) {
+        size_t count = spscqueue_pop_n(que, batch, 16);
+        if (count == 0) sched_yield();
+
+        for (size_t i = 0; i < count; i++) {
+            snprintf(expected, sizeof(expected), "record-%lu", received++);
+            if (!string_view_areequal(string_get_view(batch[i]), string_view_from(expected))) mismatches++;
+            delete_string(batch[i]);
+        }
+    }
+
+    pthread_join(producer, NULL);
+    printf("received: %lu - mismatches: %lu\n", received, mismatches);
+    print_spscqueue_data(que);
+
+    // Without a destination, the popped records are deleted by the queue.
+    for (int i = 0; i < 5; i++) {
+        string* record = new_string("dropped");
+        spscqueue_try_push(que, &record);
+    }
+    bool dropped = spscqueue_try_pop(que, NULL);
+    printf("dropped: %s + %lu - ", dropped ? "one" : "none", spscqueue_pop_n(que, NULL, 10));
+    print_spscqueue_data(que);
+    delete_spscqueue(que);
+}
+
+// Alternates single pushes and batches, so that both paths race with the consumer.
+void* producer_thread(void* argument) {
+    spscqueue* que = (spscqueue*)argument;
+    char buffer[32];
+    size_t sent = 0;
+
+    while (sent < RECORDS) {
+        if (sent % 2 == 0) {
+            snprintf(buffer, sizeof(buffer), "record-%lu", sent);
+            string* record = new_string(buffer);
+            while (!spscqueue_try_push(que, &record)) sched_yield();
+            sent++;
+            continue;
+        }
+
+        string* batch[8];
+        size_t count = RECORDS - sent < 8 ? RECORDS - sent : 8;
+        for (size_t i = 0; i < count; i++) {
+            snprintf(buffer, sizeof(buffer), "record-%lu", sent + i);
+            batch[i] = new_string(buffer);
+        }
+
+        for (size_t pushed = 0; pushed < count; ) {
+            pushed += spscqueue_push_n(que, batch + pushed, count - pushed);
+            if (pushed < count) sched_yield();
+        }
+        sent += count;
+    }
+
+    return NULL;
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
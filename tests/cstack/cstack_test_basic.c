@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include "../../src/cstack.h"
+#include "../../src/cstring.h"
+
+void print_stack_data(const stack* stk);
+void test_stack_push_pop(void);
+void test_stack_batches(void);
+void test_stack_boundary(void);
+void test_stack_strings(void);
+
+void delete_string_slot(void* slot);
+bool string_slot_areequal(const void* slot1, const void* slot2);
+void copy_string_slot(void* destination, const void* source);
+
+int main(void) {
+    puts("===== CSTACK data type unit tests - Basic functionalities =====");
+    test_stack_push_pop();
+    test_stack_batches();
+    test_stack_boundary();
+    test_stack_strings();
+    return 0;
+}
+
+void print_stack_data(const stack* stk) {
+    printf("size: %lu - capacity: %lu - ", stack_get_size(stk), stack_get_capacity(stk));
+    stack_isempty(stk) ? printf("empty\n") : printf("not empty\n");
+}
+
+void test_stack_push_pop(void) {
+    printf("\n===== Test: push(), pop(), stable pointers =====\n");
+    stack* stk = new_stack(4, sizeof(int), NULL, NULL, NULL);
+    print_stack_data(stk);
+
+    int zero = 0;
+    stack_push(stk, &zero);
+    int* first = stack_get_top(stk);
+
+    for (int i = 1; i < 100; i++) stack_push(stk, &i);
+    print_stack_data(stk);
+    printf("top: %d\n", *(int*)stack_get_top(stk));
+
+    size_t mismatches = 0;
+    for (int i = 99; i > 0; i--) {
+        int value;
+        if (!stack_pop(stk, &value) || value != i) mismatches++;
+    }
+
+    // Growing never moved the first element.
+    printf("first element kept its address: %s\n", stack_get_top(stk) == first ? "yes" : "no");
+    stack_pop(stk, NULL);
+
+    printf("mismatches: %lu - pop on empty stack: %s\n", mismatches, stack_pop(stk, NULL) ? "popped" : "NULL");
+    print_stack_data(stk);
+
+    delete_stack(stk);
+}
+
+void test_stack_batches(void) {
+    printf("\n===== Test: push_n(), pop_n(), copy() =====\n");
+    stack* stk = new_stack(0, sizeof(int), NULL, NULL, NULL);
+
+    int values[1000];
+    for (int i = 0; i < 1000; i++) values[i] = i;
+    stack_push_n(stk, values, 1000);
+    print_stack_data(stk);
+
+    stack* copy = stack_copy(stk);
+    stack_areequal(stk, copy) ? printf("copy is equal\n") : printf("copy is NOT equal\n");
+
+    int popped[300];
+    size_t count = stack_pop_n(stk, popped, 300);
+    printf("popped %lu: first %d - last %d - new top: %d\n", count, popped[0], popped[299], *(int*)stack_get_top(stk));
+
+    stack_areequal(stk, copy) ? printf("stacks are equal\n") : printf("stacks are NOT equal\n");
+    stack_push_n(stk, popped, 300);
+    stack_areequal(stk, copy) ? printf("stacks are equal again\n") : printf("stacks are NOT equal\n");
+
+    count = stack_pop_n(stk, NULL, 5000);
+    printf("popped %lu - ", count);
+    print_stack_data(stk);
+
+    stack_shrink_to_fit(stk);
+    print_stack_data(stk);
+
+    delete_stack(copy);
+    delete_stack(stk);
+}
+
+void test_stack_boundary(void) {
+    printf("\n===== Test: alternating at a segment boundary, spare segment =====\n");
+    stack* stk = new_stack(4, sizeof(int), NULL, NULL, NULL);
+
+    int values[] = { 1, 2, 3, 4 };
+    stack_push_n(stk, values, 4);
+
+    // Pushing and popping across the boundary reuses the same two segments.
+    for (int i = 0; i < 1000; i++) {
+        stack_push(stk, &i);
+        stack_push(stk, &i);
+        stack_pop(stk, NULL);
+        stack_pop(stk, NULL);
+        stack_pop(stk, NULL);
+        stack_push(stk, &i);
+    }
+    print_stack_data(stk);
+    printf("keep spare: %s\n", stack_get_keep_spare(stk) ? "yes" : "no");
+
+    stack_set_keep_spare(stk, false);
+    for (int i = 0; i < 100; i++) {
+        stack_push(stk, &i);
+        stack_pop(stk, NULL);
+    }
+    print_stack_data(stk);
+
+    delete_stack(stk);
+}
+
+void test_stack_strings(void) {
+    printf("\n===== Test: stacks of 'string*' =====\n");
+    stack* stk = new_stack(2, sizeof(string*), delete_string_slot, string_slot_areequal, copy_string_slot);
+
+    const char* words[] = { "first", "second", "third", "fourth", "fifth" };
+    for (size_t i = 0; i < 5; i++) {
+        string* str = new_string(words[i]);
+        stack_push(stk, &str);
+    }
+
+    stack* copy = stack_copy(stk);
+    stack_areequal(stk, copy) ? printf("copy is equal\n") : printf("copy is NOT equal\n");
+
+    string* top = NULL;
+    stack_pop(stk, &top);
+    printf("popped: \"%s\" - new top: \"%s\"\n", string_get_data(top), string_get_data(*(string**)stack_get_top(stk)));
+    delete_string(top);
+
+    stack_pop_n(stk, NULL, 2);
+    print_stack_data(stk);
+
+    stack_mut_swap(stk, copy);
+    print_stack_data(stk);
+
+    delete_stack(copy);
+    delete_stack(stk);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
+
+bool string_slot_areequal(const void* slot1, const void* slot2) {
+    return string_areequal(*(string* const*)slot1, *(string* const*)slot2);
+}
+
+void copy_string_slot(void* destination, const void* source) {
+    *(string**)destination = string_copy(*(string* const*)source);
+}
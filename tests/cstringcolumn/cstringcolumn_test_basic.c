@@ -0,0 +1,164 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../src/cstringcolumn.h"
+#include "../../src/cstring.h"
+
+void print_stringcolumn_data(const stringcolumn* col);
+void test_stringcolumn_append(void);
+void test_stringcolumn_split(void);
+void test_stringcolumn_sort_rebuild(void);
+void test_stringcolumn_memory(void);
+
+int main(void) {
+    puts("===== CSTRINGCOLUMN data type unit tests - Basic functionalities =====");
+    test_stringcolumn_append();
+    test_stringcolumn_split();
+    test_stringcolumn_sort_rebuild();
+    test_stringcolumn_memory();
+    return 0;
+}
+
+void print_stringcolumn_data(const stringcolumn* col) {
+    printf("size: %lu - bytes: %lu -", stringcolumn_get_size(col), stringcolumn_get_byte_size(col));
+    for (size_t i = 0; i < stringcolumn_get_size(col); i++) {
+        string_view view = stringcolumn_get_view(col, i);
+        printf(" \"%.*s\"", (int)view.length, view.data);
+    }
+    printf("\n");
+}
+
+void test_stringcolumn_append(void) {
+    printf("\n===== Test: append(), append_view(), copy(), areequal() =====\n");
+    stringcolumn* col = new_stringcolumn(0, 0);
+    print_stringcolumn_data(col);
+
+    string* str = new_string("first");
+    stringcolumn_append(col, str);
+    delete_string(str);
+    stringcolumn_append_view(col, string_view_from(""));
+    stringcolumn_append_view(col, string_view_from("third one"));
+
+    // Appending a part of the column itself, while it has to grow. Appending invalidates the views, so it is fetched every time.
+    for (int i = 0; i < 20; i++) stringcolumn_append_view(col, string_view_from_data(stringcolumn_get_view(col, 2).data, 5));
+    stringcolumn_append_view(col, stringcolumn_get_view(col, 0));
+    print_stringcolumn_data(col);
+
+    stringcolumn* copy = stringcolumn_copy(col);
+    printf("copy equal: %s - ", stringcolumn_areequal(col, copy) ? "yes" : "no");
+    stringcolumn_append_view(copy, string_view_from("x"));
+    printf("after appending to the copy: %s\n", stringcolumn_areequal(col, copy) ? "yes" : "no");
+
+    string* last = stringcolumn_get_string(copy, stringcolumn_get_size(copy) - 1);
+    printf("last of the copy: \"%s\" - offset width: %lu\n", string_get_data(last), stringcolumn_get_offset_width(copy));
+    delete_string(last);
+
+    stringcolumn_mut_clean(col);
+    print_stringcolumn_data(col);
+    printf("empty: %s\n", stringcolumn_isempty(col) ? "yes" : "no");
+
+    delete_stringcolumn(copy);
+    delete_stringcolumn(col);
+}
+
+void test_stringcolumn_split(void) {
+    printf("\n===== Test: append_split() =====\n");
+    stringcolumn* col = new_stringcolumn(4, 16);
+
+    printf("appended: %lu\n", stringcolumn_append_split(col, string_view_from("red,green,,blue,"), ",", false));
+    print_stringcolumn_data(col);
+
+    stringcolumn_mut_clean(col);
+    printf("appended: %lu\n", stringcolumn_append_split(col, string_view_from("red,green,,blue,"), ",", true));
+    print_stringcolumn_data(col);
+
+    stringcolumn_mut_clean(col);
+    printf("appended: %lu\n", stringcolumn_append_split(col, string_view_from("the quick\tbrown\n fox\n"), " \t\n", false));
+    print_stringcolumn_data(col);
+
+    printf("appended: %lu\n", stringcolumn_append_split(col, string_view_from(""), ",", false));
+    printf("appended: %lu\n", stringcolumn_append_split(col, string_view_from("no delimiters"), NULL, false));
+
+    // Splitting a string of the column itself.
+    stringcolumn_mut_clean(col);
+    stringcolumn_append_view(col, string_view_from("a b c d e f g h i j k l m n o p"));
+    printf("appended: %lu\n", stringcolumn_append_split(col, stringcolumn_get_view(col, 0), " ", false));
+    print_stringcolumn_data(col);
+
+    delete_stringcolumn(col);
+}
+
+static int compare_views(const void* a, const void* b) {
+    return string_view_compare(*(const string_view*)a, *(const string_view*)b);
+}
+
+void test_stringcolumn_sort_rebuild(void) {
+    printf("\n===== Test: sort_permutation(), mut_rebuild(), mut_sort() =====\n");
+    stringcolumn* col = new_stringcolumn(0, 0);
+    stringcolumn_append_split(col, string_view_from("pear apple fig applesauce apple banana appl cherry"), " ", false);
+
+    size_t permutation[8];
+    stringcolumn_sort_permutation(col, permutation);
+    printf("permutation:");
+    for (int i = 0; i < 8; i++) printf(" %lu", permutation[i]);
+    printf("\n");
+
+    // Keep every other string of the sorted order, the first one twice.
+    size_t selection[5] = { permutation[0], permutation[0], permutation[2], permutation[4], permutation[6] };
+    stringcolumn_mut_rebuild(col, selection, 5);
+    print_stringcolumn_data(col);
+
+    // A larger column against qsort on views, with shared 8-byte prefixes.
+    stringcolumn_mut_clean(col);
+    srand(3);
+    for (int i = 0; i < 5000; i++) {
+        char buffer[24];
+        int length = snprintf(buffer, sizeof(buffer), "%s%d", rand() % 2 ? "prefix__" : "prefix_", rand() % 1000);
+        stringcolumn_append_view(col, string_view_from_data(buffer, (size_t)length));
+    }
+
+    string_view* expected = malloc(5000 * sizeof(string_view));
+    string** copies = malloc(5000 * sizeof(string*));
+    for (size_t i = 0; i < 5000; i++) {
+        copies[i] = stringcolumn_get_string(col, i);
+        expected[i] = string_get_view(copies[i]);
+    }
+    qsort(expected, 5000, sizeof(string_view), compare_views);
+
+    stringcolumn_mut_sort(col);
+    size_t errors = 0;
+    for (size_t i = 0; i < 5000; i++) {
+        if (!string_view_areequal(stringcolumn_get_view(col, i), expected[i])) errors++;
+    }
+    printf("sorted 5000 strings: %lu errors\n", errors);
+
+    for (size_t i = 0; i < 5000; i++) delete_string(copies[i]);
+    free(copies);
+    free(expected);
+    delete_stringcolumn(col);
+}
+
+void test_stringcolumn_memory(void) {
+    printf("\n===== Test: memory usage =====\n");
+    stringcolumn* col = new_stringcolumn(0, 0);
+
+    for (int i = 0; i < 100000; i++) {
+        char buffer[16];
+        int length = snprintf(buffer, sizeof(buffer), "row%d", i);
+        stringcolumn_append_view(col, string_view_from_data(buffer, (size_t)length));
+    }
+
+    size_t before = stringcolumn_get_memory_usage(col);
+    size_t* identity = malloc(100000 * sizeof(size_t));
+    for (size_t i = 0; i < 100000; i++) identity[i] = i;
+    stringcolumn_mut_rebuild(col, identity, 100000);
+    free(identity);
+
+    size_t after = stringcolumn_get_memory_usage(col);
+    printf("bytes: %lu - offsets: %lu bytes each - shrunk by the rebuild: %s - per string: %.1f bytes\n",
+           stringcolumn_get_byte_size(col), stringcolumn_get_offset_width(col), after < before ? "yes" : "no", after / 100000.0);
+
+    string_view view = stringcolumn_get_view(col, 99999);
+    printf("last: \"%.*s\"\n", (int)view.length, view.data);
+    delete_stringcolumn(col);
+}
@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../src/cstringsort.h"
+#include "../../src/cstring.h"
+#include "../../src/cthreadpool.h"
+
+void test_stringsort_strings(void);
+void test_stringsort_views(void);
+void test_stringsort_parallel(void);
+void test_stringsort_shared_prefix(void);
+
+int compare_string_slot(const void* a, const void* b);
+string* random_string(void);
+
+int main(void) {
+    puts("===== CSTRINGSORT unit tests - Basic functionalities =====");
+    test_stringsort_strings();
+    test_stringsort_views();
+    test_stringsort_parallel();
+    test_stringsort_shared_prefix();
+    return 0;
+}
+
+int compare_string_slot(const void* a, const void* b) {
+    return string_compare(*(string* const*)a, *(string* const*)b);
+}
+
+// Words over a small alphabet with frequent long common prefixes and duplicates.
+string* random_string(void) {
+    static const char* prefixes[] = { "", "http://www.", "http://www.example.com/", "aaaaaaaaaaaaaaaaaaaa" };
+    char buffer[64];
+    int length = snprintf(buffer, sizeof(buffer), "%s", prefixes[rand() % 4]);
+    int extra = rand() % 12;
+    for (int i = 0; i < extra; i++) buffer[length++] = "abc"[rand() % 3];
+    buffer[length] = '\0';
+    return new_string(buffer);
+}
+
+void test_stringsort_strings(void) {
+    printf("\n===== Test: stringsort_strings() =====\n");
+    string* words[9] = { new_string("pear"), new_string("apple"), NULL, new_string("applesauce"), new_string(""),
+                         new_string("apple"), new_string("app"), NULL, new_string("banana") };
+
+    stringsort_strings(words, 9);
+    for (int i = 0; i < 9; i++) printf("%s\"%s\"", i ? " " : "", words[i] ? string_get_data(words[i]) : "NULL");
+    printf("\n");
+    for (int i = 0; i < 9; i++) delete_string(words[i]);
+
+    // Against qsort with 'string_compare()'.
+    srand(11);
+    enum { COUNT = 20000 };
+    string** strings = malloc(COUNT * sizeof(string*));
+    string** expected = malloc(COUNT * sizeof(string*));
+    for (int i = 0; i < COUNT; i++) strings[i] = expected[i] = random_string();
+
+    qsort(expected, COUNT, sizeof(string*), compare_string_slot);
+    stringsort_strings(strings, COUNT);
+
+    size_t errors = 0;
+    for (int i = 0; i < COUNT; i++) if (string_compare(strings[i], expected[i]) != 0) errors++;
+    printf("%d random strings: %lu errors\n", COUNT, errors);
+
+    for (int i = 0; i < COUNT; i++) delete_string(strings[i]);
+    free(expected);
+    free(strings);
+}
+
+void test_stringsort_views(void) {
+    printf("\n===== Test: stringsort_views() =====\n");
+
+    // Views may contain '\0' characters, and differ only after the first 8 characters.
+    const char text[] = "abcdefgh\0abcdefgh\0\0abcdefghXabcdefghabcdefgh\0x";
+    string_view views[7] = {
+        string_view_from_data(text, 9),         // "abcdefgh\0"
+        string_view_from_data(text, 8),         // "abcdefgh"
+        string_view_from_data(text + 9, 10),    // "abcdefgh\0\0"
+        string_view_from_data(text + 19, 9),    // "abcdefghX"
+        string_view_from_data(text + 28, 16),   // "abcdefghabcdefgh"
+        string_view_from_data(text + 44, 2),    // "\0x"
+        string_view_from_data(text, 0)          // ""
+    };
+
+    stringsort_views(views, 7);
+    for (int i = 0; i < 7; i++) {
+        printf("%s\"", i ? " " : "");
+        for (size_t j = 0; j < views[i].length; j++) views[i].data[j] ? putchar(views[i].data[j]) : printf("\\0");
+        printf("\"");
+    }
+    printf("\n");
+
+    size_t errors = 0;
+    for (int i = 1; i < 7; i++) if (string_view_compare(views[i - 1], views[i]) > 0) errors++;
+    printf("out of order: %lu\n", errors);
+}
+
+void test_stringsort_parallel(void) {
+    printf("\n===== Test: stringsort_parallel_strings(), stringsort_parallel_views() =====\n");
+    // The views are sorted on the default pool, the strings on a pool of 4 workers.
+    threadpool* pool = new_threadpool(4);
+
+    srand(5);
+    enum { COUNT = 200000 };
+    string** strings = malloc(COUNT * sizeof(string*));
+    string** expected = malloc(COUNT * sizeof(string*));
+    string_view* views = malloc(COUNT * sizeof(string_view));
+    for (int i = 0; i < COUNT; i++) {
+        strings[i] = expected[i] = i % 1000 == 0 ? NULL : random_string();
+        if (strings[i]) views[i] = string_get_view(strings[i]);
+        else views[i] = string_view_from("");
+    }
+
+    stringsort_parallel_views(views, COUNT, NULL);
+    stringsort_parallel_strings(strings, COUNT, pool);
+
+    // qsort cannot compare NULL strings: sort the non-NULL ones.
+    size_t filled = 0;
+    for (int i = 0; i < COUNT; i++) if (expected[i]) expected[filled++] = expected[i];
+    qsort(expected, filled, sizeof(string*), compare_string_slot);
+
+    size_t errors = 0, nulls = 0;
+    for (size_t i = 0; i < COUNT; i++) {
+        if (i < filled && (!strings[i] || string_compare(strings[i], expected[i]) != 0)) errors++;
+        if (!strings[i]) nulls++;
+    }
+    printf("strings: %lu errors - NULL entries at the end: %lu\n", errors, nulls);
+
+    errors = 0;
+    for (size_t i = 1; i < COUNT; i++) if (string_view_compare(views[i - 1], views[i]) > 0) errors++;
+    printf("views: %lu out of order\n", errors);
+
+    for (size_t i = 0; i < filled; i++) delete_string(strings[i]);
+    free(views);
+    free(expected);
+    free(strings);
+    delete_threadpool(pool);
+}
+
+void test_stringsort_shared_prefix(void) {
+    printf("\n===== Test: strings sharing a long prefix, sorted and reversed input =====\n");
+    threadpool* pool = new_threadpool(4);
+
+    // Half of the strings share a prefix longer than a key: the parallel ranges are still split on their depth-0 keys.
+    srand(11);
+    enum { COUNT = 60000 };
+    char (*buffers)[40] = malloc(COUNT * sizeof(*buffers));
+    string_view* views = malloc(COUNT * sizeof(string_view));
+    for (int i = 0; i < COUNT; i++) {
+        int length = snprintf(buffers[i], sizeof(buffers[i]), "%s%08x%04x", i % 2 ? "shared/prefix/" : "", rand(), rand() & 0xffff);
+        views[i] = string_view_from_data(buffers[i], (size_t)length);
+    }
+
+    stringsort_parallel_views(views, COUNT, pool);
+    size_t errors = 0;
+    for (size_t i = 1; i < COUNT; i++) if (string_view_compare(views[i - 1], views[i]) > 0) errors++;
+    printf("parallel: %lu out of order\n", errors);
+
+    // Already sorted, reversed, then every other pair swapped: orders that unbalance a plain quicksort.
+    for (size_t i = 0; i < COUNT / 2; i++) {
+        string_view swap = views[i];
+        views[i] = views[COUNT - 1 - i];
+        views[COUNT - 1 - i] = swap;
+    }
+    stringsort_views(views, COUNT);
+    errors = 0;
+    for (size_t i = 1; i < COUNT; i++) if (string_view_compare(views[i - 1], views[i]) > 0) errors++;
+    printf("reversed: %lu out of order\n", errors);
+
+    for (size_t i = 0; i + 1 < COUNT; i += 4) {
+        string_view swap = views[i];
+        views[i] = views[i + 1];
+        views[i + 1] = swap;
+    }
+    stringsort_views(views, COUNT);
+    errors = 0;
+    for (size_t i = 1; i < COUNT; i++) if (string_view_compare(views[i - 1], views[i]) > 0) errors++;
+    printf("swapped pairs: %lu out of order\n", errors);
+
+    free(views);
+    free(buffers);
+    delete_threadpool(pool);
+}
@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../src/cstringtable.h"
+#include "../../src/cstring.h"
+
+void print_stringtable_data(const stringtable* st);
+void test_stringtable_bytes(void);
+void test_stringtable_file(void);
+void test_stringtable_invalid(void);
+
+int main(void) {
+    puts("===== CSTRINGTABLE data type unit tests - Basic functionalities =====");
+    test_stringtable_bytes();
+    test_stringtable_file();
+    test_stringtable_invalid();
+    return 0;
+}
+
+void print_stringtable_data(const stringtable* st) {
+    printf("size: %lu -", stringtable_get_size(st));
+    for (size_t i = 0; i < stringtable_get_size(st); i++) {
+        string_view view = stringtable_get_view(st, i);
+        printf(" \"%.*s\"", (int)view.length, view.data);
+    }
+    printf("\n");
+}
+
+void test_stringtable_bytes(void) {
+    printf("\n===== Test: serialize(), new_stringtable_from_bytes() =====\n");
+    string* strings[5] = { new_string("alpha"), new_string(""), NULL, new_string("gamma ray"), new_string("delta") };
+
+    size_t size = stringtable_get_serialized_size(strings, 5);
+    unsigned char* buffer = malloc(size);
+    printf("serialized size: %lu - too small buffer: %lu bytes written\n", size, stringtable_serialize(strings, 5, buffer, size - 1));
+    printf("written: %lu bytes\n", stringtable_serialize(strings, 5, buffer, size));
+
+    stringtable* st = new_stringtable_from_bytes(buffer, size);
+    print_stringtable_data(st);
+    printf("verified: %s\n", stringtable_verify(st) ? "yes" : "no");
+
+    // The views point into the buffer and are terminated.
+    string_view view = stringtable_get_view(st, 3);
+    printf("view inside the buffer: %s - C string: \"%s\"\n",
+           (const unsigned char*)view.data > buffer && (const unsigned char*)view.data < buffer + size ? "yes" : "no", view.data);
+
+    string* copy = stringtable_get_string(st, 4);
+    printf("copy: \"%s\" - equal to the original: %s\n", string_get_data(copy), string_areequal(copy, strings[4]) ? "yes" : "no");
+    delete_string(copy);
+
+    delete_stringtable(st);
+    free(buffer);
+    for (int i = 0; i < 5; i++) delete_string(strings[i]);
+}
+
+void test_stringtable_file(void) {
+    printf("\n===== Test: save(), new_stringtable_from_file() =====\n");
+    const char* path = "cstringtable_test_snapshot.bin";
+
+    // Enough strings for several chunks of offsets.
+    enum { COUNT = 3000 };
+    string** strings = malloc(COUNT * sizeof(string*));
+    for (int i = 0; i < COUNT; i++) strings[i] = string_format("entry %d", i * 7);
+
+    printf("saved: %s\n", stringtable_save(path, strings, COUNT) ? "yes" : "no");
+
+    stringtable* st = new_stringtable_from_file(path);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < stringtable_get_size(st); i++) {
+        if (!string_view_areequal(stringtable_get_view(st, i), string_get_view(strings[i]))) mismatches++;
+    }
+    printf("size: %lu - mismatches: %lu - verified: %s\n", stringtable_get_size(st), mismatches, stringtable_verify(st) ? "yes" : "no");
+
+    // The file matches the in-memory serialisation byte for byte.
+    size_t size = stringtable_get_serialized_size(strings, COUNT);
+    unsigned char* buffer = malloc(size);
+    stringtable_serialize(strings, COUNT, buffer, size);
+
+    FILE* file = fopen(path, "rb");
+    unsigned char* contents = malloc(size + 1);
+    size_t read = fread(contents, 1, size + 1, file);
+    fclose(file);
+    printf("file size: %lu - identical to serialize(): %s\n", read, read == size && !memcmp(buffer, contents, size) ? "yes" : "no");
+
+    // Saving over the mapped file replaces it without touching the table still reading the previous one.
+    printf("saved again: %s - ", stringtable_save(path, strings, 10) ? "yes" : "no");
+    stringtable* replaced = new_stringtable_from_file(path);
+    printf("new size: %lu - ", stringtable_get_size(replaced));
+    printf("old size: %lu - old last string: %s\n", stringtable_get_size(st), stringtable_get_view(st, COUNT - 1).data);
+    file = fopen("cstringtable_test_snapshot.bin.tmp", "rb");
+    printf("temporary file left: %s\n", file ? "yes" : "no");
+    if (file) fclose(file);
+    delete_stringtable(replaced);
+
+    free(contents);
+    free(buffer);
+    delete_stringtable(st);
+    remove(path);
+    for (int i = 0; i < COUNT; i++) delete_string(strings[i]);
+    free(strings);
+}
+
+void test_stringtable_invalid(void) {
+    printf("\n===== Test: invalid and damaged snapshots =====\n");
+    string* strings[3] = { new_string("one"), new_string("two"), new_string("three") };
+    size_t size = stringtable_get_serialized_size(strings, 3);
+    unsigned char* buffer = malloc(size);
+    stringtable_serialize(strings, 3, buffer, size);
+
+    printf("truncated header: %s\n", new_stringtable_from_bytes(buffer, 40) ? "opened" : "rejected");
+    printf("truncated characters: %s\n", new_stringtable_from_bytes(buffer, size - 2) ? "opened" : "rejected");
+    printf("missing file: %s\n", new_stringtable_from_file("does/not/exist.bin") ? "opened" : "rejected");
+
+    buffer[4] = 2;
+    printf("future version: %s\n", new_stringtable_from_bytes(buffer, size) ? "opened" : "rejected");
+    buffer[4] = CSTRINGTABLE_FORMAT_VERSION;
+
+    // Corrupt the offset between "one" and "two": detected by verify(), and the getters stay inside the snapshot.
+    buffer[64 + 8] = 200;
+    stringtable* st = new_stringtable_from_bytes(buffer, size);
+    printf("damaged offset: verified: %s\n", stringtable_verify(st) ? "yes" : "no");
+    string_view view = stringtable_get_view(st, 0);
+    printf("damaged string length: %lu\n", view.length);
+    delete_stringtable(st);
+
+    free(buffer);
+    for (int i = 0; i < 3; i++) delete_string(strings[i]);
+}
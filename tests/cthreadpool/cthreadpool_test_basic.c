@@ -0,0 +1,50 @@
+#include <stdio.h>
+#include <stdatomic.h>
+#include "../../src/cthreadpool.h"
+
+void increment(void* argument);
+void square_at(void* argument, size_t index);
+void test_threadpool_submit(threadpool* pool);
+void test_threadpool_run(threadpool* pool);
+
+int main(void) {
+    puts("===== CTHREADPOOL data type unit tests - Basic functionalities =====");
+    threadpool* pool = new_threadpool(4);
+    printf("workers: %lu\n", threadpool_get_workers(pool));
+
+    test_threadpool_submit(pool);
+    test_threadpool_run(pool);
+    test_threadpool_run(threadpool_get_default());
+
+    delete_threadpool(pool);
+    return 0;
+}
+
+void increment(void* argument) {
+    atomic_fetch_add((atomic_int*)argument, 1);
+}
+
+void square_at(void* argument, size_t index) {
+    ((size_t*)argument)[index] = index * index;
+}
+
+void test_threadpool_submit(threadpool* pool) {
+    printf("\n===== Test: threadpool_submit(), threadpool_wait() =====\n");
+    atomic_int counter;
+    atomic_init(&counter, 0);
+
+    for (int i = 0; i < 1000; i++) threadpool_submit(pool, increment, &counter);
+    threadpool_wait(pool);
+
+    printf("counter: %d\n", atomic_load(&counter));
+}
+
+void test_threadpool_run(threadpool* pool) {
+    printf("\n===== Test: threadpool_run() (%lu workers) =====\n", threadpool_get_workers(pool));
+    size_t squares[100] = { 0 };
+    threadpool_run(pool, square_at, squares, 100);
+
+    size_t errors = 0;
+    for (size_t i = 0; i < 100; i++) errors += squares[i] != i * i;
+    printf("errors: %lu\n", errors);
+}
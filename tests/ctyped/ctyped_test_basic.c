@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include "../../src/ctyped.h"
+
+typedef struct {
+    int x;
+    int y;
+} point;
+
+#define point_less(a, b) ((a).x < (b).x || ((a).x == (b).x && (a).y < (b).y))
+
+DATASTRUCTS_DEFINE_ARRAY(int, int_array)
+DATASTRUCTS_DEFINE_VECTOR(double, double_vector)
+DATASTRUCTS_DEFINE_VECTOR_WITH(point, point_vector, point_less)
+
+void test_typed_array(void);
+void test_typed_vector(void);
+void test_typed_vector_with(void);
+
+int main(void) {
+    puts("===== CTYPED macro-generated containers unit tests - Basic functionalities =====");
+    test_typed_array();
+    test_typed_vector();
+    test_typed_vector_with();
+    return 0;
+}
+
+void test_typed_array(void) {
+    printf("\n===== Test: DATASTRUCTS_DEFINE_ARRAY(int, int_array) =====\n");
+    int_array* arr = new_int_array(1000);
+
+    srand(3);
+    for (size_t i = 0; i < int_array_get_capacity(arr); i++) int_array_set_item_at(arr, i, rand() % 500);
+
+    int_array* copy = int_array_copy(arr);
+    int_array_sort(arr);
+
+    bool sorted = true;
+    for (size_t i = 1; i < int_array_get_capacity(arr); i++) sorted &= int_array_get_item_at(arr, i - 1) <= int_array_get_item_at(arr, i);
+    printf("sorted: %s\n", sorted ? "yes" : "no");
+    int_array_sort(copy);
+    printf("sorted copy is %s\n", int_array_areequal(arr, copy) ? "equal" : "NOT equal");
+
+    size_t lower = int_array_lower_bound(arr, 250), upper = int_array_upper_bound(arr, 250);
+    printf("250 occurs %lu times, binary search %s it\n", upper - lower, int_array_binary_search(arr, 250) ? "finds" : "does NOT find");
+    printf("-1 is %s\n", int_array_binary_search(arr, -1) ? "found" : "NOT found");
+
+    int_array_fill(copy, 9);
+    printf("after fill: %d %d\n", int_array_get_item_at(copy, 0), int_array_get_item_at(copy, 999));
+
+    delete_int_array(copy);
+    delete_int_array(arr);
+}
+
+void test_typed_vector(void) {
+    printf("\n===== Test: DATASTRUCTS_DEFINE_VECTOR(double, double_vector) =====\n");
+    double_vector* vec = new_double_vector(0);
+
+    for (int i = 10; i > 0; i--) double_vector_push_back(vec, i * 0.5);
+    double range[] = { 0.25, 7.5 };
+    double_vector_append_range(vec, range, 2);
+    *double_vector_emplace_back(vec) += 1.0;
+
+    printf("size: %lu - capacity: %lu\n", double_vector_get_size(vec), double_vector_get_capacity(vec));
+
+    double_vector_sort(vec);
+    for (size_t i = 0; i < double_vector_get_size(vec); i++) printf("%g ", double_vector_get_item_at(vec, i));
+    printf("\n");
+
+    double popped = double_vector_pop_back(vec);
+    double removed = double_vector_swap_remove(vec, 0);
+    printf("popped %g, swap-removed %g\n", popped, removed);
+    double_vector_shrink_to_fit(vec);
+    printf("size: %lu - capacity: %lu\n", double_vector_get_size(vec), double_vector_get_capacity(vec));
+
+    // Elements of the vector itself, through full storage that has to be reallocated.
+    double_vector_append_range(vec, double_vector_get_data(vec) + 1, double_vector_get_size(vec) - 1);
+    for (size_t i = 0; i < double_vector_get_size(vec); i++) printf("%g ", double_vector_get_item_at(vec, i));
+    printf("\n");
+
+    delete_double_vector(vec);
+}
+
+void test_typed_vector_with(void) {
+    printf("\n===== Test: DATASTRUCTS_DEFINE_VECTOR_WITH(point, point_vector, point_less) =====\n");
+    point_vector* vec = new_point_vector(4);
+    point points[] = { { 3, 1 }, { 1, 2 }, { 3, 0 }, { 2, 5 }, { 1, 1 } };
+    point_vector_append_range(vec, points, 5);
+    point_vector_sort(vec);
+
+    for (size_t i = 0; i < point_vector_get_size(vec); i++) {
+        point p = point_vector_get_item_at(vec, i);
+        printf("(%d, %d) ", p.x, p.y);
+    }
+    printf("\n");
+
+    point key = { 2, 5 };
+    printf("(2, 5) is %s\n", point_vector_binary_search(vec, key) ? "found" : "NOT found");
+
+    delete_point_vector(vec);
+}
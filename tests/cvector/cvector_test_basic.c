@@ -0,0 +1,157 @@
+#include <stdio.h>
+#include "../../src/cvector.h"
+#include "../../src/cstring.h"
+
+typedef struct {
+    int id;
+    double weight;
+} record;
+
+void print_vector_data(const vector* vec);
+void print_int_vector(const vector* vec);
+void test_vector_growth(void);
+void test_vector_removal(void);
+void test_vector_emplace(void);
+void test_vector_strings(void);
+
+void delete_string_slot(void* slot);
+bool string_slot_areequal(const void* slot1, const void* slot2);
+void copy_string_slot(void* destination, const void* source);
+
+int main(void) {
+    puts("===== CVECTOR data type unit tests - Basic functionalities =====");
+    test_vector_growth();
+    test_vector_removal();
+    test_vector_emplace();
+    test_vector_strings();
+    return 0;
+}
+
+void print_vector_data(const vector* vec) {
+    printf("size: %lu - capacity: %lu - growth factor: %.2f - ",
+           vector_get_size(vec), vector_get_capacity(vec), vector_get_growth_factor(vec));
+    vector_isempty(vec) ? printf("empty\n") : printf("not empty\n");
+}
+
+void print_int_vector(const vector* vec) {
+    printf("[ ");
+    for (size_t i = 0; i < vector_get_size(vec); i++) printf("%d ", *(int*)vector_get_item_at(vec, i));
+    printf("]\n");
+}
+
+void test_vector_growth(void) {
+    printf("\n===== Test: push_back(), reserve(), shrink_to_fit() =====\n");
+    vector* vec = new_vector(0, sizeof(int), NULL, NULL, NULL);
+    print_vector_data(vec);
+
+    for (int i = 0; i < 10; i++) vector_push_back(vec, &i);
+    print_vector_data(vec);
+
+    vector_set_growth_factor(vec, 1.5);
+    int range[] = { 10, 11, 12, 13, 14, 15, 16 };
+    vector_append_range(vec, range, 7);
+    print_vector_data(vec);
+    print_int_vector(vec);
+
+    vector_reserve(vec, 100);
+    print_vector_data(vec);
+    vector_shrink_to_fit(vec);
+    print_vector_data(vec);
+
+    vector* copy = vector_copy(vec);
+    vector_areequal(vec, copy) ? printf("copy is equal to the original\n") : printf("copy is NOT equal to the original\n");
+
+    delete_vector(copy);
+    delete_vector(vec);
+}
+
+void test_vector_removal(void) {
+    printf("\n===== Test: insertion and removal =====\n");
+    vector* vec = new_vector(8, sizeof(int), NULL, NULL, NULL);
+    for (int i = 0; i < 8; i++) vector_push_back(vec, &i);
+
+    int value = 100;
+    vector_insert_item_to(vec, 3, &value);
+    print_int_vector(vec);
+
+    vector_remove_item_at(vec, 0, &value);
+    printf("removed %d: ", value);
+    print_int_vector(vec);
+
+    vector_swap_remove(vec, 1, &value);
+    printf("swap-removed %d: ", value);
+    print_int_vector(vec);
+
+    vector_pop_back(vec, &value);
+    printf("popped %d: ", value);
+    print_int_vector(vec);
+
+    // Elements of the vector itself, through full storage that has to be reallocated.
+    vector_shrink_to_fit(vec);
+    vector_push_back(vec, vector_get_item_at(vec, 0));
+    vector_shrink_to_fit(vec);
+    vector_insert_item_to(vec, 1, vector_get_item_at(vec, 4));
+    vector_shrink_to_fit(vec);
+    vector_append_range(vec, vector_get_item_at(vec, 0), 3);
+    printf("own elements added: ");
+    print_int_vector(vec);
+
+    vector_mut_clean(vec);
+    print_vector_data(vec);
+    delete_vector(vec);
+}
+
+void test_vector_emplace(void) {
+    printf("\n===== Test: emplace_back() =====\n");
+    vector* vec = new_vector(0, sizeof(record), NULL, NULL, NULL);
+
+    for (int i = 0; i < 5; i++) {
+        record* slot = vector_emplace_back(vec);
+        slot->id = i;
+        slot->weight = i * 0.5;
+    }
+
+    for (size_t i = 0; i < vector_get_size(vec); i++) {
+        record* item = vector_get_item_at(vec, i);
+        printf("(%d, %.1f) ", item->id, item->weight);
+    }
+    printf("\n");
+
+    delete_vector(vec);
+}
+
+void test_vector_strings(void) {
+    printf("\n===== Test: vectors of 'string*' =====\n");
+    vector* vec = new_vector(0, sizeof(string*), delete_string_slot, string_slot_areequal, copy_string_slot);
+    const char* words[] = { "alpha", "beta", "gamma", "delta" };
+
+    for (size_t i = 0; i < 4; i++) {
+        string* str = new_string(words[i]);
+        vector_push_back(vec, &str);
+    }
+
+    vector_swap_remove(vec, 0, NULL);
+    vector_pop_back(vec, NULL);
+    vector* copy = vector_copy(vec);
+
+    for (size_t i = 0; i < vector_get_size(copy); i++) {
+        printf("\"%s\" ", string_get_data(*(string**)vector_get_item_at(copy, i)));
+    }
+    printf("\n");
+    vector_areequal(vec, copy) ? printf("copy is equal to the original\n") : printf("copy is NOT equal to the original\n");
+
+    delete_vector(copy);
+    delete_vector(vec);
+}
+
+void delete_string_slot(void* slot) {
+    delete_string(*(string**)slot);
+}
+
+bool string_slot_areequal(const void* slot1, const void* slot2) {
+    return string_areequal(*(string* const*)slot1, *(string* const*)slot2);
+}
+
+void copy_string_slot(void* destination, const void* source) {
+    *(string**)destination = string_copy(*(string* const*)source);
+}
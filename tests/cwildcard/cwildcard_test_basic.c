@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fnmatch.h>
+#include "../../src/cwildcard.h"
+#include "../../src/cstring.h"
+
+void print_wildcard_data(const wildcard* wc);
+void test_wildcard_match(void);
+void test_wildcard_syntax(void);
+void test_wildcard_batch(void);
+void test_wildcard_random(void);
+
+int main(void) {
+    puts("===== CWILDCARD data type unit tests - Basic functionalities =====");
+    test_wildcard_match();
+    test_wildcard_syntax();
+    test_wildcard_batch();
+    test_wildcard_random();
+    return 0;
+}
+
+void print_wildcard_data(const wildcard* wc) {
+    static const char* kinds[] = { "literal", "prefix", "suffix", "infix", "any", "general" };
+    string_view pattern = wildcard_get_pattern(wc);
+    printf("\"%.*s\": %s, min length %lu\n", (int)pattern.length, pattern.data, kinds[wildcard_get_kind(wc)], wildcard_get_min_length(wc));
+}
+
+void test_wildcard_match(void) {
+    printf("\n===== Test: new_wildcard(), get_kind(), match() =====\n");
+    const char* patterns[] = { "metrics.cpu", "metrics.*", "*.log", "*error*", "**", "", "src/*/test_?.c", "*a*b*a*", "[a-c]*[!0-9]" };
+    const char* texts[] = { "metrics.cpu", "metrics.", "server.log", "an error here", "", "src/lib/test_1.c", "src/test_1.c", "abba", "cat9", "cab" };
+
+    for (size_t p = 0; p < sizeof(patterns) / sizeof(*patterns); p++) {
+        wildcard* wc = new_wildcard(patterns[p]);
+        print_wildcard_data(wc);
+        printf("   matches:");
+        for (size_t t = 0; t < sizeof(texts) / sizeof(*texts); t++) {
+            string* str = new_string(texts[t]);
+            if (wildcard_match(wc, str)) printf(" \"%s\"", texts[t]);
+            delete_string(str);
+        }
+        printf("\n");
+        delete_wildcard(wc);
+    }
+}
+
+void test_wildcard_syntax(void) {
+    printf("\n===== Test: escapes, classes, NULL =====\n");
+    const char* cases[][2] = {
+        { "a\\*b", "a*b" }, { "a\\*b", "axb" }, { "[*]x", "*x" }, { "[]]", "]" }, { "[!]]", "a" }, { "[!]]", "]" },
+        { "[a-]", "-" }, { "x[", "x[" }, { "[ab", "[ab" }, { "[^a]", "b" }, { "[\\]]", "]" }, { "*\\", "dir\\" }
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(*cases); i++) {
+        wildcard* wc = new_wildcard(cases[i][0]);
+        printf("\"%s\" ~ \"%s\": %s\n", cases[i][0], cases[i][1], wildcard_match_view(wc, string_view_from(cases[i][1])) ? "yes" : "no");
+        delete_wildcard(wc);
+    }
+
+    // Views may contain '\0' characters.
+    wildcard* wc = new_wildcard_view(string_view_from_data("a\0*", 3));
+    printf("NUL in pattern: %s - ", wildcard_match_view(wc, string_view_from_data("a\0zz", 4)) ? "yes" : "no");
+    printf("NULL string: %s\n", wildcard_match(wc, NULL) ? "yes" : "no");
+    delete_wildcard(wc);
+
+    wc = new_wildcard(NULL);
+    print_wildcard_data(wc);
+    delete_wildcard(wc);
+}
+
+void test_wildcard_batch(void) {
+    printf("\n===== Test: match_many(), filter() =====\n");
+    const char* names[] = { "cpu.user", "cpu.system", "mem.free", "cpu", "disk.cpu.user" };
+    string* strings[6] = { NULL };
+    string_view views[5];
+    for (size_t i = 0; i < 5; i++) {
+        strings[i] = new_string(names[i]);
+        views[i] = string_get_view(strings[i]);
+    }
+
+    wildcard* wc = new_wildcard("cpu.*");
+    bool results[6];
+    size_t matches = wildcard_match_many(wc, strings, 6, results);
+    printf("matches: %lu -", matches);
+    for (size_t i = 0; i < 6; i++) printf(" %d", results[i]);
+    printf("\n");
+    delete_wildcard(wc);
+
+    wc = new_wildcard("*.?ser");
+    size_t indices[6];
+    matches = wildcard_filter_views(wc, views, 5, indices);
+    printf("filtered views:");
+    for (size_t i = 0; i < matches; i++) printf(" %s", names[indices[i]]);
+    printf(" - strings: %lu - counted: %lu\n", wildcard_filter(wc, strings, 6, indices), wildcard_match_many_views(wc, views, 5, NULL));
+    delete_wildcard(wc);
+
+    for (size_t i = 0; i < 5; i++) delete_string(strings[i]);
+}
+
+// Random patterns and strings over a small alphabet, against 'fnmatch()'.
+void test_wildcard_random(void) {
+    printf("\n===== Test: against fnmatch() =====\n");
+    static const char* tokens[] = { "a", "b", "/", "*", "?", "[ab]", "[!a]", "[a-b/]", "ab", "**" };
+    srand(7);
+
+    size_t checked = 0, errors = 0;
+    for (int p = 0; p < 2000; p++) {
+        char pattern[64] = "";
+        int token_count = rand() % 7;
+        for (int t = 0; t < token_count; t++) strcat(pattern, tokens[rand() % 10]);
+        wildcard* wc = new_wildcard(pattern);
+
+        for (int s = 0; s < 50; s++) {
+            char text[16];
+            int length = rand() % 10;
+            for (int i = 0; i < length; i++) text[i] = "ab/"[rand() % 3];
+            text[length] = '\0';
+
+            bool expected = fnmatch(pattern, text, 0) == 0;
+            if (wildcard_match_view(wc, string_view_from(text)) != expected) errors++;
+            checked++;
+        }
+        delete_wildcard(wc);
+    }
+    printf("checked: %lu - errors: %lu\n", checked, errors);
+}